@@ -0,0 +1,53 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file instanced_lit.vert
+/// Vertex shader for OsgInstanceBatch, places the unit shape with the per instance rigid transform and scale, the
+/// side attribute moves the two halves of a capsule apart. Lighting is per vertex with one light like
+/// basic_lit.vert, use with basic_lit.frag. The program needs to bind the attributes to the
+/// INSTANCE_*_VERTEX_ATTRIBUTE_ID locations.
+
+attribute float side;
+attribute vec4 instanceRow0;
+attribute vec4 instanceRow1;
+attribute vec4 instanceRow2;
+attribute vec4 instanceScale;
+
+varying vec4 color;
+
+void main(void)
+{
+	vec4 local = vec4(gl_Vertex.xyz * instanceScale.xyz + vec3(0.0, side * instanceScale.w, 0.0), 1.0);
+	vec4 world = vec4(dot(instanceRow0, local), dot(instanceRow1, local), dot(instanceRow2, local), 1.0);
+	vec3 localNormal = gl_Normal / instanceScale.xyz;
+	vec3 worldNormal = vec3(dot(instanceRow0.xyz, localNormal), dot(instanceRow1.xyz, localNormal),
+		dot(instanceRow2.xyz, localNormal));
+	gl_Position = gl_ModelViewProjectionMatrix * world;
+
+	vec4 eyePosition = gl_ModelViewMatrix * world;
+	vec3 lightDir = gl_LightSource[0].position.xyz - eyePosition.xyz * gl_LightSource[0].position.w;
+	float lightDistance = length(lightDir);
+	lightDir = normalize(lightDir);
+
+	vec3 normal = normalize(gl_NormalMatrix * worldNormal);
+
+	float attenuation = 1.0 / (gl_LightSource[0].constantAttenuation +
+		gl_LightSource[0].linearAttenuation * lightDistance +
+		gl_LightSource[0].quadraticAttenuation * lightDistance * lightDistance);
+
+	color.rgb = attenuation * max(dot(lightDir, normal), 0.0) * gl_Color.rgb * gl_LightSource[0].diffuse.rgb +
+		gl_LightSource[0].ambient.rgb;
+	color.a = gl_Color.a;
+}
@@ -0,0 +1,30 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file point_cloud.vert
+/// Vertex shader for point clouds with a size per point, pass through the color. The program needs to bind
+/// "pointSize" to POINT_SIZE_VERTEX_ATTRIBUTE_ID with Program::setAttributeLocation(), use with basic_unlit.frag
+
+attribute float pointSize;
+
+varying vec4 color;
+
+void main(void)
+{
+	gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+	gl_PointSize = pointSize;
+
+	color = gl_Color;
+}
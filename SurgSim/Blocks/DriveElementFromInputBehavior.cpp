@@ -34,7 +34,8 @@ SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Blocks::DriveElementFro
 
 DriveElementFromInputBehavior::DriveElementFromInputBehavior(const std::string& name) :
 	SurgSim::Framework::Behavior(name),
-	m_poseName("pose")
+	m_poseName("pose"),
+	m_poseIndex(-1)
 {
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(DriveElementFromInputBehavior, std::shared_ptr<SurgSim::Framework::Component>,
 									  Source, getSource, setSource);
@@ -44,6 +45,7 @@ DriveElementFromInputBehavior::DriveElementFromInputBehavior(const std::string&
 void DriveElementFromInputBehavior::setSource(std::shared_ptr<SurgSim::Framework::Component> source)
 {
 	m_source = checkAndConvert<SurgSim::Input::InputComponent>(source, "SurgSim::Input::InputComponent");
+	m_poseIndex = -1;
 }
 
 std::shared_ptr<SurgSim::Framework::Component> DriveElementFromInputBehavior::getSource()
@@ -54,6 +56,7 @@ std::shared_ptr<SurgSim::Framework::Component> DriveElementFromInputBehavior::ge
 void DriveElementFromInputBehavior::setPoseName(const std::string& poseName)
 {
 	m_poseName = poseName;
+	m_poseIndex = -1;
 }
 
 std::string DriveElementFromInputBehavior::getPoseName()
@@ -65,10 +68,11 @@ void DriveElementFromInputBehavior::update(double dt)
 {
 	SurgSim::DataStructures::DataGroup dataGroup;
 	m_source->getData(&dataGroup);
+	dataGroup.poses().cacheIndex(m_poseName, &m_poseIndex);
 	RigidTransform3d pose;
-	if (dataGroup.poses().get(m_poseName, &pose))
+	if (dataGroup.poses().get(m_poseIndex, &pose))
 	{
-		getPoseComponent()->setPose(m_source->getLocalPose() * pose);
+		m_pose.setValue(m_source->getLocalPose() * pose);
 	}
 }
 
@@ -93,6 +97,10 @@ bool DriveElementFromInputBehavior::doWakeUp()
 				getName() + "' must belong to a SceneElement with a PoseComponent.";
 		result = false;
 	}
+	else
+	{
+		m_pose = getPoseComponent()->getProperty<RigidTransform3d>("Pose");
+	}
 
 	return result;
 }
@@ -18,6 +18,7 @@
 
 #include "SurgSim/Framework/Behavior.h"
 #include "SurgSim/Framework/ObjectFactory.h"
+#include "SurgSim/Math/RigidTransform.h"
 
 namespace SurgSim
 {
@@ -76,6 +77,12 @@ class DriveElementFromInputBehavior : public SurgSim::Framework::Behavior
 	std::shared_ptr<SurgSim::Input::InputComponent> m_source;
 
 	std::string m_poseName;
+
+	/// The cached index of the pose in the input data, -1 if not cached yet
+	int m_poseIndex;
+
+	/// The pose property of the pose component, resolved when the behavior wakes up
+	SurgSim::Framework::Accessible::Property<SurgSim::Math::RigidTransform3d> m_pose;
 };
 
 
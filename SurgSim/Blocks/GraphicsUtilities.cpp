@@ -139,9 +139,8 @@ std::shared_ptr<Graphics::OsgMaterial> createNormalMappedMaterial(
 	SURGSIM_ASSERT(program != nullptr) << "Could not load program" << "Shaders/dns_mapping_material";
 
 	// Prepare vertex attributes
-	auto osgProgram = program->getOsgProgram();
-	osgProgram->addBindAttribLocation("tangent", Graphics::TANGENT_VERTEX_ATTRIBUTE_ID);
-	osgProgram->addBindAttribLocation("bitangent", Graphics::BITANGENT_VERTEX_ATTRIBUTE_ID);
+	program->setAttributeLocation("tangent", Graphics::TANGENT_VERTEX_ATTRIBUTE_ID);
+	program->setAttributeLocation("bitangent", Graphics::BITANGENT_VERTEX_ATTRIBUTE_ID);
 
 	material->setProgram(program);
 
@@ -0,0 +1,101 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Blocks/RecordPoseHistoryBehavior.h"
+
+#include "SurgSim/Framework/Clock.h"
+#include "SurgSim/Framework/FrameworkConvert.h"
+#include "SurgSim/Framework/Log.h"
+#include "SurgSim/Framework/Representation.h"
+
+using SurgSim::Framework::checkAndConvert;
+
+namespace SurgSim
+{
+namespace Blocks
+{
+
+SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Blocks::RecordPoseHistoryBehavior,
+				 RecordPoseHistoryBehavior);
+
+RecordPoseHistoryBehavior::RecordPoseHistoryBehavior(const std::string& name) :
+	Framework::Behavior(name),
+	m_history(std::make_shared<DataStructures::TimedHistory<Math::RigidTransform3d>>(32))
+{
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(RecordPoseHistoryBehavior, std::shared_ptr<Framework::Component>,
+									  Source, getSource, setSource);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(RecordPoseHistoryBehavior, size_t, Capacity, getCapacity, setCapacity);
+}
+
+void RecordPoseHistoryBehavior::setSource(const std::shared_ptr<Framework::Component>& source)
+{
+	SURGSIM_ASSERT(nullptr != source) << "'source' can not be nullptr.";
+	m_source = checkAndConvert<Framework::Representation>(source, "SurgSim::Framework::Representation");
+}
+
+std::shared_ptr<Framework::Representation> RecordPoseHistoryBehavior::getSource() const
+{
+	return m_source;
+}
+
+void RecordPoseHistoryBehavior::setCapacity(size_t capacity)
+{
+	m_history->setCapacity(capacity);
+}
+
+size_t RecordPoseHistoryBehavior::getCapacity() const
+{
+	return m_history->getCapacity();
+}
+
+std::shared_ptr<const DataStructures::TimedHistory<Math::RigidTransform3d>>
+RecordPoseHistoryBehavior::getHistory() const
+{
+	return m_history;
+}
+
+double RecordPoseHistoryBehavior::getTime()
+{
+	return boost::chrono::duration<double>(Framework::Clock::now().time_since_epoch()).count();
+}
+
+void RecordPoseHistoryBehavior::update(double dt)
+{
+	m_history->push(getTime(), m_source->getPose());
+}
+
+int RecordPoseHistoryBehavior::getTargetManagerType() const
+{
+	return Framework::MANAGER_TYPE_PHYSICS;
+}
+
+bool RecordPoseHistoryBehavior::doInitialize()
+{
+	return true;
+}
+
+bool RecordPoseHistoryBehavior::doWakeUp()
+{
+	if (m_source == nullptr)
+	{
+		SURGSIM_LOG_SEVERE(Framework::Logger::getDefaultLogger()) << getFullName() << " does not have a Source.";
+		return false;
+	}
+	m_history->push(getTime(), m_source->getPose());
+	return true;
+}
+
+};  // namespace Blocks
+};  // namespace SurgSim
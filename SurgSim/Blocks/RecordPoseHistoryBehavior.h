@@ -0,0 +1,91 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_BLOCKS_RECORDPOSEHISTORYBEHAVIOR_H
+#define SURGSIM_BLOCKS_RECORDPOSEHISTORYBEHAVIOR_H
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/DataStructures/TimedHistory.h"
+#include "SurgSim/Framework/Behavior.h"
+#include "SurgSim/Framework/ObjectFactory.h"
+#include "SurgSim/Math/RigidTransform.h"
+
+namespace SurgSim
+{
+
+namespace Framework
+{
+class Representation;
+}
+
+namespace Blocks
+{
+
+SURGSIM_STATIC_REGISTRATION(RecordPoseHistoryBehavior);
+
+/// Behavior that records the pose of a representation with a timestamp every time the physics thread updates, so
+/// that SamplePoseHistoryBehavior can interpolate it at the rate of the graphics thread.
+class RecordPoseHistoryBehavior : public Framework::Behavior
+{
+public:
+	/// Constructor
+	/// \param name Name of the behavior
+	explicit RecordPoseHistoryBehavior(const std::string& name);
+
+	SURGSIM_CLASSNAME(SurgSim::Blocks::RecordPoseHistoryBehavior);
+
+	/// Set the representation whose pose is recorded
+	/// \param source The representation
+	void setSource(const std::shared_ptr<Framework::Component>& source);
+
+	/// \return The representation whose pose is recorded
+	std::shared_ptr<Framework::Representation> getSource() const;
+
+	/// Set the number of poses that are kept, this clears the history. The history needs to cover the latency of
+	/// the SamplePoseHistoryBehavior, e.g. 50 poses for a latency of 50ms at 1kHz. Default is 32.
+	/// \param capacity The number of poses
+	void setCapacity(size_t capacity);
+
+	/// \return The number of poses that are kept
+	size_t getCapacity() const;
+
+	/// \return The recorded poses, timestamped with getTime()
+	std::shared_ptr<const DataStructures::TimedHistory<Math::RigidTransform3d>> getHistory() const;
+
+	/// \return The current time in seconds, this is the clock used for the timestamps of the history
+	static double getTime();
+
+	void update(double dt) override;
+
+	int getTargetManagerType() const override;
+
+private:
+	bool doInitialize() override;
+
+	bool doWakeUp() override;
+
+	/// The representation whose pose is recorded
+	std::shared_ptr<Framework::Representation> m_source;
+
+	/// The recorded poses
+	std::shared_ptr<DataStructures::TimedHistory<Math::RigidTransform3d>> m_history;
+};
+
+};  // namespace Blocks
+};  // namespace SurgSim
+
+#endif  // SURGSIM_BLOCKS_RECORDPOSEHISTORYBEHAVIOR_H
@@ -0,0 +1,125 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Blocks/SamplePoseHistoryBehavior.h"
+
+#include "SurgSim/Blocks/RecordPoseHistoryBehavior.h"
+#include "SurgSim/Framework/FrameworkConvert.h"
+#include "SurgSim/Framework/Log.h"
+#include "SurgSim/Framework/Representation.h"
+#include "SurgSim/Framework/SceneElement.h"
+
+using SurgSim::Framework::checkAndConvert;
+
+namespace SurgSim
+{
+namespace Blocks
+{
+
+SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Blocks::SamplePoseHistoryBehavior,
+				 SamplePoseHistoryBehavior);
+
+SamplePoseHistoryBehavior::SamplePoseHistoryBehavior(const std::string& name) :
+	Framework::Behavior(name),
+	m_latency(0.0),
+	m_maxExtrapolation(0.0)
+{
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SamplePoseHistoryBehavior, std::shared_ptr<Framework::Component>,
+									  Source, getSource, setSource);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SamplePoseHistoryBehavior, std::shared_ptr<Framework::Component>,
+									  Target, getTarget, setTarget);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SamplePoseHistoryBehavior, double, Latency, getLatency, setLatency);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SamplePoseHistoryBehavior, double, MaxExtrapolation,
+									  getMaxExtrapolation, setMaxExtrapolation);
+}
+
+void SamplePoseHistoryBehavior::setSource(const std::shared_ptr<Framework::Component>& source)
+{
+	SURGSIM_ASSERT(nullptr != source) << "'source' can not be nullptr.";
+	m_source = checkAndConvert<RecordPoseHistoryBehavior>(source, "SurgSim::Blocks::RecordPoseHistoryBehavior");
+}
+
+std::shared_ptr<RecordPoseHistoryBehavior> SamplePoseHistoryBehavior::getSource() const
+{
+	return m_source;
+}
+
+void SamplePoseHistoryBehavior::setTarget(const std::shared_ptr<Framework::Component>& target)
+{
+	SURGSIM_ASSERT(nullptr != target) << "'target' can not be nullptr.";
+	m_target = checkAndConvert<Framework::Representation>(target, "SurgSim::Framework::Representation");
+}
+
+std::shared_ptr<Framework::Representation> SamplePoseHistoryBehavior::getTarget() const
+{
+	return m_target;
+}
+
+void SamplePoseHistoryBehavior::setLatency(double latency)
+{
+	SURGSIM_ASSERT(latency >= 0.0) << "The latency can not be negative.";
+	m_latency = latency;
+}
+
+double SamplePoseHistoryBehavior::getLatency() const
+{
+	return m_latency;
+}
+
+void SamplePoseHistoryBehavior::setMaxExtrapolation(double time)
+{
+	SURGSIM_ASSERT(time >= 0.0) << "The extrapolation time can not be negative.";
+	m_maxExtrapolation = time;
+}
+
+double SamplePoseHistoryBehavior::getMaxExtrapolation() const
+{
+	return m_maxExtrapolation;
+}
+
+void SamplePoseHistoryBehavior::update(double dt)
+{
+	Math::RigidTransform3d pose;
+	if (m_source->getHistory()->sample(RecordPoseHistoryBehavior::getTime() - m_latency, &pose,
+									   m_maxExtrapolation))
+	{
+		auto element = m_target->getSceneElement();
+		m_target->setLocalPose((element != nullptr) ? element->getPose().inverse() * pose : pose);
+	}
+}
+
+int SamplePoseHistoryBehavior::getTargetManagerType() const
+{
+	return Framework::MANAGER_TYPE_GRAPHICS;
+}
+
+bool SamplePoseHistoryBehavior::doInitialize()
+{
+	return true;
+}
+
+bool SamplePoseHistoryBehavior::doWakeUp()
+{
+	if (m_source == nullptr || m_target == nullptr)
+	{
+		SURGSIM_LOG_SEVERE(Framework::Logger::getDefaultLogger()) << getFullName()
+				<< " needs a Source and a Target.";
+		return false;
+	}
+	return true;
+}
+
+};  // namespace Blocks
+};  // namespace SurgSim
@@ -0,0 +1,108 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_BLOCKS_SAMPLEPOSEHISTORYBEHAVIOR_H
+#define SURGSIM_BLOCKS_SAMPLEPOSEHISTORYBEHAVIOR_H
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/Framework/Behavior.h"
+#include "SurgSim/Framework/ObjectFactory.h"
+
+namespace SurgSim
+{
+
+namespace Framework
+{
+class Representation;
+}
+
+namespace Blocks
+{
+class RecordPoseHistoryBehavior;
+
+SURGSIM_STATIC_REGISTRATION(SamplePoseHistoryBehavior);
+
+/// Behavior that sets the pose of a representation, usually a graphics representation, from the poses recorded by
+/// a RecordPoseHistoryBehavior, sampled every time the graphics thread updates. The pose is sampled at the current
+/// time minus the latency: with a latency of about one period of the physics thread it is interpolated between
+/// two recorded poses, which removes the stutter of drawing the physics poses at a different rate, with a smaller
+/// latency it is extrapolated from the two newest poses.
+/// This allows content that is far away or moves slowly to be simulated at a lower rate than it is drawn.
+class SamplePoseHistoryBehavior : public Framework::Behavior
+{
+public:
+	/// Constructor
+	/// \param name Name of the behavior
+	explicit SamplePoseHistoryBehavior(const std::string& name);
+
+	SURGSIM_CLASSNAME(SurgSim::Blocks::SamplePoseHistoryBehavior);
+
+	/// Set the behavior recording the poses
+	/// \param source The RecordPoseHistoryBehavior
+	void setSource(const std::shared_ptr<Framework::Component>& source);
+
+	/// \return The behavior recording the poses
+	std::shared_ptr<RecordPoseHistoryBehavior> getSource() const;
+
+	/// Set the representation whose pose is set, the sampled pose is its pose in world coordinates
+	/// \param target The representation
+	void setTarget(const std::shared_ptr<Framework::Component>& target);
+
+	/// \return The representation whose pose is set
+	std::shared_ptr<Framework::Representation> getTarget() const;
+
+	/// Set how far in the past the poses are sampled, default is 0
+	/// \param latency The latency in seconds
+	void setLatency(double latency);
+
+	/// \return How far in the past the poses are sampled, in seconds
+	double getLatency() const;
+
+	/// Set how far past the newest recorded pose the poses may be extrapolated, default is 0, i.e. the newest pose
+	/// is used until the next one is recorded
+	/// \param time The time in seconds
+	void setMaxExtrapolation(double time);
+
+	/// \return How far past the newest recorded pose the poses may be extrapolated, in seconds
+	double getMaxExtrapolation() const;
+
+	void update(double dt) override;
+
+	int getTargetManagerType() const override;
+
+private:
+	bool doInitialize() override;
+
+	bool doWakeUp() override;
+
+	/// The behavior recording the poses
+	std::shared_ptr<RecordPoseHistoryBehavior> m_source;
+
+	/// The representation whose pose is set
+	std::shared_ptr<Framework::Representation> m_target;
+
+	/// How far in the past the poses are sampled
+	double m_latency;
+
+	/// How far past the newest pose the poses may be extrapolated
+	double m_maxExtrapolation;
+};
+
+};  // namespace Blocks
+};  // namespace SurgSim
+
+#endif  // SURGSIM_BLOCKS_SAMPLEPOSEHISTORYBEHAVIOR_H
@@ -39,12 +39,15 @@ SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Blocks::TransferPhysics
 				 TransferPhysicsToGraphicsMeshBehavior);
 
 TransferPhysicsToGraphicsMeshBehavior::TransferPhysicsToGraphicsMeshBehavior(const std::string& name) :
-	Framework::Behavior(name)
+	Framework::Behavior(name),
+	m_isDirectUpload(false)
 {
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(TransferPhysicsToGraphicsMeshBehavior,
 									  std::shared_ptr<Framework::Component>, Source, getSource, setSource);
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(TransferPhysicsToGraphicsMeshBehavior,
 									  std::shared_ptr<Framework::Component>, Target, getTarget, setTarget);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(TransferPhysicsToGraphicsMeshBehavior, bool, DirectUpload,
+									  isDirectUpload, setDirectUpload);
 
 	// Enable full serialization on the index map type, but need to deal with overloaded functions
 	{
@@ -120,6 +123,46 @@ void TransferPhysicsToGraphicsMeshBehavior::update(double dt)
 {
 	auto state = m_source->getFinalState();
 
+	if (m_isDirectUpload)
+	{
+		size_t numVertices = m_target->getMesh()->getNumVertices();
+		size_t numDofPerNode = (state->getNumNodes() == 0) ? 0 : state->getNumDof() / state->getNumNodes();
+		const Math::Vector& positions = state->getPositions();
+		float* buffer = m_target->getVertexPositionBuffer(numVertices);
+
+		if (m_indexMap.empty())
+		{
+			SURGSIM_ASSERT(state->getNumNodes() <= numVertices)
+					<< "The source " << m_source->getFullName() << " has more nodes than the target "
+					<< m_target->getFullName() << " has vertices.";
+			if (numDofPerNode == 3)
+			{
+				Eigen::Map<Eigen::VectorXf>(buffer, positions.size()) = positions.cast<float>();
+			}
+			else
+			{
+				for (size_t nodeId = 0; nodeId < state->getNumNodes(); ++nodeId)
+				{
+					Eigen::Map<Eigen::Vector3f>(buffer + 3 * nodeId) =
+						positions.segment<3>(numDofPerNode * nodeId).cast<float>();
+				}
+			}
+		}
+		else
+		{
+			for (const auto& mapping : m_indexMap)
+			{
+				SURGSIM_ASSERT(mapping.second < numVertices) << "The index map refers to vertex " << mapping.second
+						<< ", but the target " << m_target->getFullName() << " has " << numVertices << " vertices.";
+				Eigen::Map<Eigen::Vector3f>(buffer + 3 * mapping.second) =
+					positions.segment<3>(numDofPerNode * mapping.first).cast<float>();
+			}
+		}
+
+		m_target->publishVertexPositions();
+		return;
+	}
+
 	if (m_indexMap.empty())
 	{
 		auto mesh = m_target->getMesh();
@@ -208,6 +251,16 @@ const std::vector<std::pair<size_t, size_t>> TransferPhysicsToGraphicsMeshBehavi
 	return m_indexMap;
 }
 
+void TransferPhysicsToGraphicsMeshBehavior::setDirectUpload(bool val)
+{
+	m_isDirectUpload = val;
+}
+
+bool TransferPhysicsToGraphicsMeshBehavior::isDirectUpload() const
+{
+	return m_isDirectUpload;
+}
+
 std::vector<std::pair<size_t, size_t>> generateIndexMap(
 										const std::shared_ptr<DataStructures::TriangleMeshPlain>& source,
 										const std::shared_ptr<DataStructures::TriangleMeshPlain>& target)
@@ -219,8 +272,8 @@ std::vector<std::pair<size_t, size_t>> generateIndexMap(
 			<< "Can't build correspondence map, meshes are missing vertices";
 
 
-	// Caclulate AABB for Mesh
-	const auto& vertices = target->getVertices();
+	// Caclulate AABB for Mesh, through const access so that vertices shared with other meshes are not copied
+	const auto& vertices = static_cast<const DataStructures::TriangleMeshPlain&>(*target).getVertices();
 	Math::Aabbd bounds;
 
 	for (const auto& vertex : vertices)
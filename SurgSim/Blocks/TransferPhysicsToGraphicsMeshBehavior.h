@@ -48,6 +48,9 @@ SURGSIM_STATIC_REGISTRATION(TransferPhysicsToGraphicsMeshBehavior);
 /// index. If an index map is available, for each pair in the index map it will take the nodeId from the first
 /// member of the pair and copy it to the vertex with the id of the second member of the pair.
 /// The index map can be computed from meshes given to this behavior or precomputed via other means.
+/// With direct upload enabled the positions are converted to single precision and written straight into the vertex
+/// buffer of the target (see MeshRepresentation::getVertexPositionBuffer()), applying the index map on the way, which
+/// replaces the copies through the Mesh with one pass over the nodes.
 class TransferPhysicsToGraphicsMeshBehavior : public Framework::Behavior
 {
 public:
@@ -95,6 +98,14 @@ class TransferPhysicsToGraphicsMeshBehavior : public Framework::Behavior
 	/// \return the current mapping
 	const std::vector<std::pair<size_t, size_t>> getIndexMap() const;
 
+	/// Sets whether the positions are written directly into the vertex buffer of the target, instead of into its
+	/// Mesh. The Mesh of the target is then no longer updated after wake up. Default is false.
+	/// \param val Whether to use the direct upload path
+	void setDirectUpload(bool val);
+
+	/// \return true if the positions are written directly into the vertex buffer of the target
+	bool isDirectUpload() const;
+
 	void update(double dt) override;
 
 private:
@@ -114,6 +125,9 @@ class TransferPhysicsToGraphicsMeshBehavior : public Framework::Behavior
 
 	/// The mapping to be used if not empty.
 	std::vector<std::pair<size_t, size_t>> m_indexMap;
+
+	/// Whether the positions are written directly into the vertex buffer of the target
+	bool m_isDirectUpload;
 };
 
 /// Generate a mapping, for each point in source find the points target that coincide
@@ -0,0 +1,88 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "SurgSim/Blocks/RecordPoseHistoryBehavior.h"
+#include "SurgSim/Framework/BasicSceneElement.h"
+#include "SurgSim/Framework/Representation.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/Scene.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Quaterniond;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Math::makeRigidTransform;
+
+namespace SurgSim
+{
+namespace Blocks
+{
+
+TEST(RecordPoseHistoryBehaviorTests, Init)
+{
+	auto behavior = std::make_shared<RecordPoseHistoryBehavior>("behavior");
+	EXPECT_EQ(Framework::MANAGER_TYPE_PHYSICS, behavior->getTargetManagerType());
+	EXPECT_EQ(nullptr, behavior->getSource());
+	EXPECT_EQ(32u, behavior->getCapacity());
+	EXPECT_TRUE(behavior->getHistory()->isEmpty());
+
+	EXPECT_THROW(behavior->setSource(nullptr), Framework::AssertionFailure);
+	EXPECT_THROW(behavior->setSource(std::make_shared<RecordPoseHistoryBehavior>("other")),
+				 Framework::AssertionFailure);
+
+	auto representation = std::make_shared<Framework::Representation>("representation");
+	behavior->setSource(representation);
+	EXPECT_EQ(representation, behavior->getSource());
+
+	behavior->setCapacity(4);
+	EXPECT_EQ(4u, behavior->getCapacity());
+}
+
+TEST(RecordPoseHistoryBehaviorTests, Record)
+{
+	auto runtime = std::make_shared<Framework::Runtime>();
+	auto element = std::make_shared<Framework::BasicSceneElement>("element");
+	auto representation = std::make_shared<Framework::Representation>("representation");
+	auto behavior = std::make_shared<RecordPoseHistoryBehavior>("behavior");
+	behavior->setSource(representation);
+	element->addComponent(representation);
+	element->addComponent(behavior);
+	runtime->getScene()->addSceneElement(element);
+
+	RigidTransform3d elementPose = makeRigidTransform(Quaterniond::Identity(), Vector3d(1.0, 0.0, 0.0));
+	RigidTransform3d localPose = makeRigidTransform(Quaterniond::Identity(), Vector3d(0.0, 2.0, 0.0));
+	element->setPose(elementPose);
+	representation->setLocalPose(localPose);
+
+	double before = RecordPoseHistoryBehavior::getTime();
+	ASSERT_TRUE(behavior->wakeUp());
+	behavior->update(0.001);
+	double after = RecordPoseHistoryBehavior::getTime();
+
+	auto history = behavior->getHistory();
+	EXPECT_LE(1u, history->size());
+	double time;
+	RigidTransform3d pose;
+	ASSERT_TRUE(history->getNewest(&time, &pose));
+	EXPECT_LE(before, time);
+	EXPECT_GE(after, time);
+	EXPECT_TRUE(pose.isApprox(elementPose * localPose));
+}
+
+};  // namespace Blocks
+};  // namespace SurgSim
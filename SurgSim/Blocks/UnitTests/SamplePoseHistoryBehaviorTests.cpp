@@ -0,0 +1,109 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+
+#include "SurgSim/Blocks/RecordPoseHistoryBehavior.h"
+#include "SurgSim/Blocks/SamplePoseHistoryBehavior.h"
+#include "SurgSim/Framework/BasicSceneElement.h"
+#include "SurgSim/Framework/Representation.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/Scene.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Quaterniond;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Math::makeRigidTransform;
+
+namespace SurgSim
+{
+namespace Blocks
+{
+
+TEST(SamplePoseHistoryBehaviorTests, Init)
+{
+	auto behavior = std::make_shared<SamplePoseHistoryBehavior>("behavior");
+	EXPECT_EQ(Framework::MANAGER_TYPE_GRAPHICS, behavior->getTargetManagerType());
+	EXPECT_EQ(nullptr, behavior->getSource());
+	EXPECT_EQ(nullptr, behavior->getTarget());
+	EXPECT_DOUBLE_EQ(0.0, behavior->getLatency());
+	EXPECT_DOUBLE_EQ(0.0, behavior->getMaxExtrapolation());
+
+	auto representation = std::make_shared<Framework::Representation>("representation");
+	EXPECT_THROW(behavior->setSource(representation), Framework::AssertionFailure);
+	EXPECT_THROW(behavior->setTarget(nullptr), Framework::AssertionFailure);
+	EXPECT_THROW(behavior->setLatency(-1.0), Framework::AssertionFailure);
+	EXPECT_THROW(behavior->setMaxExtrapolation(-1.0), Framework::AssertionFailure);
+
+	auto recorder = std::make_shared<RecordPoseHistoryBehavior>("recorder");
+	behavior->setSource(recorder);
+	behavior->setTarget(representation);
+	behavior->setLatency(0.01);
+	behavior->setMaxExtrapolation(0.02);
+	EXPECT_EQ(recorder, behavior->getSource());
+	EXPECT_EQ(representation, behavior->getTarget());
+	EXPECT_DOUBLE_EQ(0.01, behavior->getLatency());
+	EXPECT_DOUBLE_EQ(0.02, behavior->getMaxExtrapolation());
+}
+
+TEST(SamplePoseHistoryBehaviorTests, Sample)
+{
+	auto runtime = std::make_shared<Framework::Runtime>();
+
+	auto sourceElement = std::make_shared<Framework::BasicSceneElement>("source");
+	auto source = std::make_shared<Framework::Representation>("representation");
+	auto recorder = std::make_shared<RecordPoseHistoryBehavior>("recorder");
+	recorder->setSource(source);
+	sourceElement->addComponent(source);
+	sourceElement->addComponent(recorder);
+	runtime->getScene()->addSceneElement(sourceElement);
+
+	auto targetElement = std::make_shared<Framework::BasicSceneElement>("target");
+	auto target = std::make_shared<Framework::Representation>("representation");
+	auto sampler = std::make_shared<SamplePoseHistoryBehavior>("sampler");
+	sampler->setSource(recorder);
+	sampler->setTarget(target);
+	targetElement->addComponent(target);
+	targetElement->addComponent(sampler);
+	runtime->getScene()->addSceneElement(targetElement);
+	RigidTransform3d targetElementPose = makeRigidTransform(Quaterniond::Identity(), Vector3d(0.0, 0.0, 5.0));
+	targetElement->setPose(targetElementPose);
+
+	RigidTransform3d first = makeRigidTransform(Quaterniond::Identity(), Vector3d(1.0, 0.0, 0.0));
+	RigidTransform3d second = makeRigidTransform(Quaterniond::Identity(), Vector3d(2.0, 0.0, 0.0));
+	sourceElement->setPose(first);
+	ASSERT_TRUE(recorder->wakeUp());
+	ASSERT_TRUE(sampler->wakeUp());
+	boost::this_thread::sleep(boost::posix_time::milliseconds(2));
+	sourceElement->setPose(second);
+	recorder->update(0.001);
+
+	// The target gets the world pose of the source, even though its scene element is somewhere else
+	sampler->update(0.016);
+	EXPECT_TRUE(target->getPose().isApprox(second));
+	EXPECT_TRUE(target->getLocalPose().isApprox(targetElementPose.inverse() * second));
+
+	// Far enough in the past, the oldest pose is used
+	sampler->setLatency(100.0);
+	sampler->update(0.016);
+	EXPECT_TRUE(target->getPose().isApprox(first));
+}
+
+};  // namespace Blocks
+};  // namespace SurgSim
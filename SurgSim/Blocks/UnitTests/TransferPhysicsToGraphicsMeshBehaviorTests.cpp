@@ -17,6 +17,8 @@
 /// Tests for the TransferPhysicsToGraphicsBehavior class.
 
 #include <gtest/gtest.h>
+#include <osg/Array>
+#include <osg/Geometry>
 
 #include "SurgSim/Blocks/TransferPhysicsToGraphicsMeshBehavior.h"
 #include "SurgSim/DataStructures/TriangleMesh.h"
@@ -128,6 +130,55 @@ TEST(TransferPhysicsToGraphicsMeshBehaviorTests, Update)
 	runtime->stop();
 }
 
+TEST(TransferPhysicsToGraphicsMeshBehaviorTests, DirectUpload)
+{
+	auto runtime = std::make_shared<Runtime>("config.txt");
+	auto behaviorManager = std::make_shared<BehaviorManager>();
+	runtime->addManager(behaviorManager);
+
+	auto scene = runtime->getScene();
+	auto sceneElement = std::make_shared<BasicSceneElement>("scene element");
+
+	auto physics = std::make_shared<Fem3DRepresentation>("Fem3D");
+	physics->loadFem("Geometry/wound_deformable.ply");
+
+	auto graphics = std::make_shared<OsgMeshRepresentation>("GraphicsMesh");
+	auto behavior = std::make_shared<TransferPhysicsToGraphicsMeshBehavior>("Behavior");
+	behavior->setSource(physics);
+	behavior->setTarget(graphics);
+	EXPECT_FALSE(behavior->isDirectUpload());
+	behavior->setDirectUpload(true);
+	EXPECT_TRUE(behavior->getValue<bool>("DirectUpload"));
+
+	sceneElement->addComponent(behavior);
+	sceneElement->addComponent(physics);
+	sceneElement->addComponent(graphics);
+	scene->addSceneElement(sceneElement);
+
+	EXPECT_NO_THROW(runtime->start());
+	boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+	runtime->stop();
+
+	auto finalState = physics->getFinalState();
+	auto target = graphics->getMesh();
+	size_t numNodes = finalState->getNumNodes();
+	ASSERT_EQ(numNodes, target->getNumVertices());
+
+	finalState->getPositions() *= 2.0;
+	behavior->update(1.0);
+	graphics->update(1.0);
+
+	// The positions went to the vertex array of the geometry, the mesh was not touched
+	auto vertices = static_cast<osg::Vec3Array*>(graphics->getOsgGeometry()->getVertexArray());
+	ASSERT_EQ(numNodes, vertices->size());
+	for (size_t nodeId = 0; nodeId < numNodes; ++nodeId)
+	{
+		Vector3d vertex((*vertices)[nodeId].x(), (*vertices)[nodeId].y(), (*vertices)[nodeId].z());
+		EXPECT_TRUE(finalState->getPosition(nodeId).isApprox(vertex, 1e-6));
+		EXPECT_TRUE(finalState->getPosition(nodeId).isApprox(2.0 * target->getVertex(nodeId).position));
+	}
+}
+
 TEST(TransferPhysicsToGraphicsMeshBehaviorTests, Serialization)
 {
 	std::string filename = std::string("Geometry/wound_deformable_with_texture.ply");
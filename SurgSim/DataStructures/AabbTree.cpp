@@ -18,6 +18,9 @@
 
 #include <memory>
 
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
+
 namespace SurgSim
 {
 namespace DataStructures
@@ -71,6 +74,26 @@ const SurgSim::Math::Aabbd& AabbTree::getAabb() const
 	return m_typedRoot->getAabb();
 }
 
+void AabbTree::write(Framework::BinaryWriter* writer) const
+{
+	writer->write(static_cast<uint64_t>(m_maxObjectsPerNode));
+	m_typedRoot->write(writer);
+}
+
+bool AabbTree::read(Framework::BinaryReader* reader, size_t objectCount)
+{
+	uint64_t maxObjectsPerNode = 0;
+	auto root = std::make_shared<AabbTreeNode>();
+	if (!reader->read(&maxObjectsPerNode) || !root->read(reader, objectCount))
+	{
+		return false;
+	}
+	m_maxObjectsPerNode = static_cast<size_t>(maxObjectsPerNode);
+	m_typedRoot = root;
+	setRoot(m_typedRoot);
+	return true;
+}
+
 std::list<AabbTree::TreeNodePairType> AabbTree::spatialJoin(const AabbTree& otherTree) const
 {
 	std::list<TreeNodePairType> result;
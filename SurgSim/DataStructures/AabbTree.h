@@ -24,6 +24,11 @@
 
 namespace SurgSim
 {
+namespace Framework
+{
+class BinaryReader;
+class BinaryWriter;
+}
 
 namespace DataStructures
 {
@@ -67,6 +72,16 @@ class AabbTree : public Tree
 	/// \return the AABB for the tree
 	const SurgSim::Math::Aabbd& getAabb() const;
 
+	/// Write the structure of the tree, so that it can be restored by read() without building it again.
+	/// \param writer The writer to write to.
+	void write(Framework::BinaryWriter* writer) const;
+
+	/// Restore the structure of a tree written by write(), replacing all the tree information.
+	/// \param reader The reader to read from.
+	/// \param objectCount The number of objects, the ids of all the items need to be smaller.
+	/// \return true if the tree was read, false if the data is invalid, the tree is then unchanged.
+	bool read(Framework::BinaryReader* reader, size_t objectCount);
+
 	/// Type indicating a relationship between two AabbTreeNodes
 	typedef std::pair<std::shared_ptr<AabbTreeNode>, std::shared_ptr<AabbTreeNode>> TreeNodePairType;
 
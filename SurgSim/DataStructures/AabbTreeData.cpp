@@ -93,6 +93,11 @@ size_t AabbTreeData::getSize() const
 	return m_data.size();
 }
 
+const std::list<AabbTreeData::Item>& AabbTreeData::getItems() const
+{
+	return m_data;
+}
+
 std::shared_ptr<AabbTreeData> AabbTreeData::takeLargerElements()
 {
 	std::shared_ptr<AabbTreeData> result(std::make_shared<AabbTreeData>());
@@ -67,6 +67,9 @@ class AabbTreeData : public TreeData
 	/// \return the number of items
 	size_t getSize() const;
 
+	/// \return the items with their AABBs and object ids
+	const std::list<Item>& getItems() const;
+
 	/// Split the current items into two geometric halves, keep the first half and return a pointer to the second half.
 	/// The split is done along the longest axis of the enclosing aabb, the center of this axis is the point where
 	/// the split occurs. This object will keep items that have a smaller coordinate than the center, the result will
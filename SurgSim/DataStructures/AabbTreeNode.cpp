@@ -16,7 +16,18 @@
 #include "SurgSim/DataStructures/AabbTreeNode.h"
 #include "SurgSim/DataStructures/AabbTreeData.h"
 
+#include <vector>
+
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Log.h"
+#include "SurgSim/Math/Vector.h"
+
+namespace
+{
+/// Deepest node accepted by AabbTreeNode::read(), protects against corrupted data
+const size_t MaxReadDepth = 256;
+}
 
 namespace SurgSim
 {
@@ -166,6 +177,100 @@ void AabbTreeNode::getIntersections(const SurgSim::Math::Aabbd& aabb, std::list<
 	data->getIntersections(aabb, result);
 }
 
+void AabbTreeNode::write(Framework::BinaryWriter* writer) const
+{
+	writer->write(static_cast<uint8_t>(getNumChildren()));
+	if (getNumChildren() == 0)
+	{
+		std::vector<uint64_t> ids;
+		std::vector<SurgSim::Math::Vector3d> bounds;
+		auto data = std::static_pointer_cast<AabbTreeData>(getData());
+		if (data != nullptr)
+		{
+			ids.reserve(data->getSize());
+			bounds.reserve(2 * data->getSize());
+			for (auto const& item : data->getItems())
+			{
+				ids.push_back(static_cast<uint64_t>(item.second));
+				bounds.push_back(item.first.min());
+				bounds.push_back(item.first.max());
+			}
+		}
+		writer->writeArray(ids);
+		writer->writeArray(bounds);
+	}
+	else
+	{
+		writer->write(SurgSim::Math::Vector3d(m_aabb.min()));
+		writer->write(SurgSim::Math::Vector3d(m_aabb.max()));
+		writer->write(static_cast<uint64_t>(m_axis));
+		for (size_t i = 0; i < getNumChildren(); ++i)
+		{
+			std::static_pointer_cast<AabbTreeNode>(getChild(i))->write(writer);
+		}
+	}
+}
+
+bool AabbTreeNode::read(Framework::BinaryReader* reader, size_t objectCount)
+{
+	SURGSIM_ASSERT(getNumChildren() == 0) << "Can't call read on a node that already has nodes";
+	SURGSIM_ASSERT(getData() == nullptr) << "Can't call read on a node that already has data.";
+	return read(reader, objectCount, 0);
+}
+
+bool AabbTreeNode::read(Framework::BinaryReader* reader, size_t objectCount, size_t depth)
+{
+	uint8_t numChildren = 0;
+	if (depth > MaxReadDepth || !reader->read(&numChildren))
+	{
+		return false;
+	}
+
+	if (numChildren == 0)
+	{
+		std::vector<uint64_t> ids;
+		std::vector<SurgSim::Math::Vector3d> bounds;
+		if (!reader->readArray(&ids) || !reader->readArray(&bounds) || bounds.size() != 2 * ids.size())
+		{
+			return false;
+		}
+		if (!ids.empty())
+		{
+			std::list<AabbTreeData::Item> items;
+			for (size_t i = 0; i < ids.size(); ++i)
+			{
+				if (ids[i] >= objectCount)
+				{
+					return false;
+				}
+				items.emplace_back(SurgSim::Math::Aabbd(bounds[2 * i], bounds[2 * i + 1]), static_cast<size_t>(ids[i]));
+			}
+			setData(std::make_shared<AabbTreeData>(std::move(items)));
+		}
+		return true;
+	}
+
+	SurgSim::Math::Vector3d min;
+	SurgSim::Math::Vector3d max;
+	uint64_t axis = 0;
+	if (numChildren != 2 || !reader->read(&min) || !reader->read(&max) || !reader->read(&axis) || axis > 2)
+	{
+		return false;
+	}
+	m_aabb = SurgSim::Math::Aabbd(min, max);
+	m_axis = static_cast<size_t>(axis);
+	for (uint8_t i = 0; i < numChildren; ++i)
+	{
+		auto child = std::make_shared<AabbTreeNode>();
+		addChild(child);
+		if (!child->read(reader, objectCount, depth + 1))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 }
 }
 
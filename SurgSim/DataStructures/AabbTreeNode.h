@@ -23,6 +23,12 @@
 
 namespace SurgSim
 {
+namespace Framework
+{
+class BinaryReader;
+class BinaryWriter;
+}
+
 namespace DataStructures
 {
 
@@ -83,11 +89,27 @@ class AabbTreeNode : public TreeNode
 	/// \param [out] result location to receive the results of the call.
 	void getIntersections(const SurgSim::Math::Aabbd& aabb, std::list<size_t>* result);
 
+	/// Write the structure of this node and its children, so that it can be restored without splitting again.
+	/// \param writer The writer to write to.
+	void write(Framework::BinaryWriter* writer) const;
+
+	/// Restore the structure written by write(), the node needs to be empty and not have any children.
+	/// \param reader The reader to read from.
+	/// \param objectCount The number of objects, the ids of all the items need to be smaller.
+	/// \return true if the structure was read, false if the data is invalid, the node is then in an unspecified state.
+	bool read(Framework::BinaryReader* reader, size_t objectCount);
+
 protected:
 
 	bool doAccept(TreeVisitor* visitor) override;
 
 private:
+	/// Restore the structure written by write()
+	/// \param reader The reader to read from.
+	/// \param objectCount The number of objects, the ids of all the items need to be smaller.
+	/// \param depth The depth of this node in the tree, reading fails if it gets too deep.
+	/// \return true if the structure was read.
+	bool read(Framework::BinaryReader* reader, size_t objectCount, size_t depth);
 
 	/// The internal bounding box for this node, it is used when the node does not have any data
 	SurgSim::Math::Aabbd m_aabb;
@@ -56,6 +56,20 @@ static const char* const TORQUE = "torque";
 static const char* const DAMPER_JACOBIAN = "damperJacobian";
 static const char* const SPRING_JACOBIAN = "springJacobian";
 
+/// One row per contact: the plane normal (3), the plane offset (1), the stiffness (1), and the contact point on the
+/// tool in the frame of the input pose (3).  \sa SurgSim::Devices::LocalContactModel
+static const char* const CONTACT_MODEL = "contactModel";
+
+/// The time a device produced the input (scalar, in s, see Framework::getMonotonicTime()), and its number in the
+/// sequence of inputs of the device (integer).
+static const char* const TIMESTAMP = "timestamp";
+static const char* const SEQUENCE_NUMBER = "sequenceNumber";
+/// The timestamp and sequence number of the input the output was computed from, and the time the output was handed
+/// over to the device.  \sa SurgSim::Input::LatencyStatistics
+static const char* const INPUT_TIMESTAMP = "inputTimestamp";
+static const char* const INPUT_SEQUENCE_NUMBER = "inputSequenceNumber";
+static const char* const OUTPUT_TIMESTAMP = "outputTimestamp";
+
 static const char* const IS_HOMED = "isHomed";
 static const char* const IS_ORIENTATION_HOMED = "isOrientationHomed";
 static const char* const IS_POSITION_HOMED = "isPositionHomed";
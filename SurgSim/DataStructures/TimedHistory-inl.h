@@ -0,0 +1,172 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DATASTRUCTURES_TIMEDHISTORY_INL_H
+#define SURGSIM_DATASTRUCTURES_TIMEDHISTORY_INL_H
+
+#include <algorithm>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+namespace SurgSim
+{
+namespace DataStructures
+{
+
+template <class T>
+TimedHistory<T>::TimedHistory(size_t capacity) :
+	m_begin(0),
+	m_size(0)
+{
+	SURGSIM_ASSERT(capacity > 0) << "A TimedHistory needs to keep at least one value.";
+	m_samples.resize(capacity);
+}
+
+template <class T>
+void TimedHistory<T>::setCapacity(size_t capacity)
+{
+	SURGSIM_ASSERT(capacity > 0) << "A TimedHistory needs to keep at least one value.";
+	UniqueLock lock(m_mutex);
+	m_samples.resize(capacity);
+	m_begin = 0;
+	m_size = 0;
+}
+
+template <class T>
+size_t TimedHistory<T>::getCapacity() const
+{
+	SharedLock lock(m_mutex);
+	return m_samples.size();
+}
+
+template <class T>
+void TimedHistory<T>::push(double time, const T& value)
+{
+	UniqueLock lock(m_mutex);
+	if (m_size > 0)
+	{
+		Sample& newest = m_samples[(m_begin + m_size - 1) % m_samples.size()];
+		SURGSIM_ASSERT(time >= newest.time) << "Values have to be pushed in increasing time, " << time
+											<< " is before the newest time " << newest.time << ".";
+		if (time == newest.time)
+		{
+			newest.value = value;
+			return;
+		}
+	}
+
+	Sample* sample;
+	if (m_size < m_samples.size())
+	{
+		sample = &m_samples[(m_begin + m_size) % m_samples.size()];
+		++m_size;
+	}
+	else
+	{
+		sample = &m_samples[m_begin];
+		m_begin = (m_begin + 1) % m_samples.size();
+	}
+	sample->time = time;
+	sample->value = value;
+}
+
+template <class T>
+bool TimedHistory<T>::sample(double time, T* value, double maxExtrapolation) const
+{
+	using SurgSim::Math::interpolate;
+
+	SharedLock lock(m_mutex);
+	if (m_size == 0)
+	{
+		return false;
+	}
+
+	const Sample& oldest = get(0);
+	const Sample& newest = get(m_size - 1);
+	if (m_size == 1 || time <= oldest.time)
+	{
+		*value = (m_size == 1) ? newest.value : oldest.value;
+	}
+	else if (time >= newest.time)
+	{
+		const Sample& previous = get(m_size - 2);
+		double extrapolatedTime = std::min(time, newest.time + std::max(maxExtrapolation, 0.0));
+		*value = interpolate(previous.value, newest.value,
+							 (extrapolatedTime - previous.time) / (newest.time - previous.time));
+	}
+	else
+	{
+		// Consumers sample close to the newest value, so the search starts from there
+		size_t next = m_size - 1;
+		while (get(next - 1).time > time)
+		{
+			--next;
+		}
+		const Sample& previous = get(next - 1);
+		const Sample& following = get(next);
+		*value = interpolate(previous.value, following.value,
+							 (time - previous.time) / (following.time - previous.time));
+	}
+	return true;
+}
+
+template <class T>
+bool TimedHistory<T>::getNewest(double* time, T* value) const
+{
+	SharedLock lock(m_mutex);
+	if (m_size == 0)
+	{
+		return false;
+	}
+	const Sample& newest = get(m_size - 1);
+	*time = newest.time;
+	*value = newest.value;
+	return true;
+}
+
+template <class T>
+size_t TimedHistory<T>::size() const
+{
+	SharedLock lock(m_mutex);
+	return m_size;
+}
+
+template <class T>
+bool TimedHistory<T>::isEmpty() const
+{
+	SharedLock lock(m_mutex);
+	return m_size == 0;
+}
+
+template <class T>
+void TimedHistory<T>::clear()
+{
+	UniqueLock lock(m_mutex);
+	m_begin = 0;
+	m_size = 0;
+}
+
+template <class T>
+const typename TimedHistory<T>::Sample& TimedHistory<T>::get(size_t index) const
+{
+	return m_samples[(m_begin + index) % m_samples.size()];
+}
+
+};  // namespace DataStructures
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DATASTRUCTURES_TIMEDHISTORY_INL_H
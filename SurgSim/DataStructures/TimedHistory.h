@@ -0,0 +1,116 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DATASTRUCTURES_TIMEDHISTORY_H
+#define SURGSIM_DATASTRUCTURES_TIMEDHISTORY_H
+
+#include <boost/thread.hpp>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+#include <vector>
+
+namespace SurgSim
+{
+namespace DataStructures
+{
+
+/// Fixed size history of timestamped values, written by one thread and sampled at arbitrary times by others.
+/// This decouples the rate at which a value is produced, e.g. a pose or the vertices computed by the physics thread,
+/// from the rate at which it is consumed, e.g. by the graphics thread. A consumer samples the history at its own
+/// time minus a latency; with a latency of about one producer period the sample falls between two values and is
+/// interpolated, with a smaller latency it lies after the newest value and is extrapolated from the two newest ones.
+/// Values are interpolated with SurgSim::Math::interpolate(), or an overload of interpolate(previous, next, t) found
+/// through argument dependent lookup, which is called with t outside of [0, 1] for extrapolation.
+/// Once the history is full, pushing a value replaces the oldest one in place, so values that own memory, e.g.
+/// dynamic vectors of positions, do not allocate once all the slots have been used.
+/// \tparam T Type of the values
+template <class T>
+class TimedHistory
+{
+public:
+	/// Constructor
+	/// \param capacity The number of values that are kept
+	explicit TimedHistory(size_t capacity = 16);
+
+	/// Change the number of values that are kept, this clears the history
+	/// \param capacity The number of values that are kept, at least 1
+	void setCapacity(size_t capacity);
+
+	/// \return The number of values that are kept
+	size_t getCapacity() const;
+
+	/// Add the newest value
+	/// \param time The time of the value, values have to be pushed in increasing time, a value with the same time
+	///        as the newest one replaces it
+	/// \param value The value
+	void push(double time, const T& value);
+
+	/// Sample the history, values before the oldest one are clamped to the oldest one, values after the newest one
+	/// are extrapolated up to maxExtrapolation after the newest time and clamped after that
+	/// \param time The time at which to sample the history
+	/// \param [out] value The interpolated value
+	/// \param maxExtrapolation How far past the newest value the history may be extrapolated, in seconds
+	/// \return false if the history is empty, value is not changed then
+	bool sample(double time, T* value, double maxExtrapolation = 0.0) const;
+
+	/// \param [out] time The time of the newest value
+	/// \param [out] value The newest value
+	/// \return false if the history is empty
+	bool getNewest(double* time, T* value) const;
+
+	/// \return The number of values in the history
+	size_t size() const;
+
+	/// \return true if no value has been pushed since the construction or the last clear()
+	bool isEmpty() const;
+
+	/// Remove all the values
+	void clear();
+
+private:
+	typedef boost::shared_lock<boost::shared_mutex> SharedLock;
+	typedef boost::unique_lock<boost::shared_mutex> UniqueLock;
+
+	/// A timestamped value
+	struct Sample
+	{
+		double time;
+		T value;
+		EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+	};
+
+	/// \param index The index of the value, 0 is the oldest one
+	/// \return The sample
+	const Sample& get(size_t index) const;
+
+	/// The samples, used as a ring buffer
+	std::vector<Sample, Eigen::aligned_allocator<Sample>> m_samples;
+
+	/// The index of the oldest sample
+	size_t m_begin;
+
+	/// The number of samples in use
+	size_t m_size;
+
+	/// The mutex between the writer and the readers
+	mutable boost::shared_mutex m_mutex;
+};
+
+};  // namespace DataStructures
+};  // namespace SurgSim
+
+#include "SurgSim/DataStructures/TimedHistory-inl.h"
+
+#endif  // SURGSIM_DATASTRUCTURES_TIMEDHISTORY_H
@@ -25,7 +25,10 @@ namespace DataStructures
 {
 
 template <class VertexData, class EdgeData, class TriangleData>
-TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleMesh()
+TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleMesh() :
+	m_edges(std::make_shared<std::vector<EdgeType>>()),
+	m_triangles(std::make_shared<std::vector<TriangleType>>()),
+	m_trianglesRevision(0)
 {
 }
 
@@ -34,9 +37,10 @@ TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleMesh(
 	const TriangleMesh<VertexData, EdgeData, TriangleData>& other) :
 	Vertices<VertexData>::Vertices(other),
 	SurgSim::Framework::Asset(),
-	m_edges(other.getEdges()),
-	m_triangles(other.getTriangles()),
-	m_freeTriangles(other.m_freeTriangles)
+	m_edges(std::make_shared<std::vector<EdgeType>>(other.getEdges())),
+	m_triangles(std::make_shared<std::vector<TriangleType>>(other.getTriangles())),
+	m_freeTriangles(other.m_freeTriangles),
+	m_trianglesRevision(0)
 {
 }
 
@@ -44,16 +48,19 @@ template <class VertexData, class EdgeData, class TriangleData>
 template <class V, class E, class T>
 TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleMesh(const TriangleMesh<V, E, T>& other) :
 	Vertices<VertexData>::Vertices(other),
-	SurgSim::Framework::Asset()
+	SurgSim::Framework::Asset(),
+	m_edges(std::make_shared<std::vector<EdgeType>>()),
+	m_triangles(std::make_shared<std::vector<TriangleType>>()),
+	m_trianglesRevision(0)
 {
-	m_edges.reserve(other.getEdges().size());
+	m_edges->reserve(other.getEdges().size());
 	for (auto& edge : other.getEdges())
 	{
 		addEdge(EdgeType(edge));
 	}
 
 	size_t index = 0;
-	m_triangles.reserve(other.getTriangles().size());
+	m_triangles->reserve(other.getTriangles().size());
 	for (auto& triangle : other.getTriangles())
 	{
 		addTriangle(TriangleType(triangle));
@@ -80,8 +87,9 @@ std::string TriangleMesh<VertexData, EdgeData, TriangleData>::getClassName() con
 template <class VertexData, class EdgeData, class TriangleData>
 size_t TriangleMesh<VertexData, EdgeData, TriangleData>::addEdge(const EdgeType& edge)
 {
-	m_edges.push_back(edge);
-	return m_edges.size() - 1;
+	auto& edges = getWritableEdges();
+	edges.push_back(edge);
+	return edges.size() - 1;
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
@@ -91,16 +99,17 @@ size_t TriangleMesh<VertexData, EdgeData, TriangleData>::addTriangle(const Trian
 
 	SURGSIM_ASSERT(triangle.isValid) << "Cannot insert invalid triangle into mesh.";
 
+	auto& triangles = getWritableTriangles();
 	if (m_freeTriangles.empty())
 	{
-		m_triangles.push_back(triangle);
-		result = m_triangles.size() - 1;
+		triangles.push_back(triangle);
+		result = triangles.size() - 1;
 	}
 	else
 	{
 		result = m_freeTriangles.back();
 		m_freeTriangles.pop_back();
-		m_triangles[result] = triangle;
+		triangles[result] = triangle;
 	}
 
 	return result;
@@ -109,55 +118,61 @@ size_t TriangleMesh<VertexData, EdgeData, TriangleData>::addTriangle(const Trian
 template <class VertexData, class EdgeData, class TriangleData>
 size_t TriangleMesh<VertexData, EdgeData, TriangleData>::getNumEdges() const
 {
-	return m_edges.size();
+	return m_edges->size();
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 size_t TriangleMesh<VertexData, EdgeData, TriangleData>::getNumTriangles() const
 {
-	return m_triangles.size() - m_freeTriangles.size();
+	return m_triangles->size() - m_freeTriangles.size();
+}
+
+template <class VertexData, class EdgeData, class TriangleData>
+size_t TriangleMesh<VertexData, EdgeData, TriangleData>::getTrianglesRevision() const
+{
+	return m_trianglesRevision;
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 const std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::EdgeType>&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getEdges() const
 {
-	return m_edges;
+	return *m_edges;
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::EdgeType>&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getEdges()
 {
-	return m_edges;
+	return getWritableEdges();
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 const std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleType>&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getTriangles() const
 {
-	return m_triangles;
+	return *m_triangles;
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleType>&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getTriangles()
 {
-	return m_triangles;
+	return getWritableTriangles();
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 const typename TriangleMesh<VertexData, EdgeData, TriangleData>::EdgeType&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getEdge(size_t id) const
 {
-	return m_edges[id];
+	return (*m_edges)[id];
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 typename TriangleMesh<VertexData, EdgeData, TriangleData>::EdgeType&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getEdge(size_t id)
 {
-	return m_edges[id];
+	return getWritableEdges()[id];
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
@@ -178,7 +193,7 @@ template <class VertexData, class EdgeData, class TriangleData>
 const typename TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleType&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getTriangle(size_t id) const
 {
-	auto const& triangle = m_triangles[id];
+	auto const& triangle = (*m_triangles)[id];
 	SURGSIM_ASSERT(triangle.isValid) << "Attempted to access invalid or deleted triangle.";
 	return triangle;
 }
@@ -187,7 +202,7 @@ template <class VertexData, class EdgeData, class TriangleData>
 typename TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleType&
 TriangleMesh<VertexData, EdgeData, TriangleData>::getTriangle(size_t id)
 {
-	auto& triangle = m_triangles[id];
+	auto& triangle = getWritableTriangles()[id];
 	SURGSIM_ASSERT(triangle.isValid) << "Attempted to access invalid or deleted triangle.";
 	return triangle;
 }
@@ -195,7 +210,7 @@ TriangleMesh<VertexData, EdgeData, TriangleData>::getTriangle(size_t id)
 template <class VertexData, class EdgeData, class TriangleData>
 void TriangleMesh<VertexData, EdgeData, TriangleData>::removeTriangle(size_t id)
 {
-	auto& triangle = m_triangles[id];
+	auto& triangle = getWritableTriangles()[id];
 	if (triangle.isValid)
 	{
 		triangle.isValid = false;
@@ -227,7 +242,7 @@ bool TriangleMesh<VertexData, EdgeData, TriangleData>::isValid() const
 	size_t numVertices = Vertices<VertexData>::getNumVertices();
 
 	// Test edges validity
-	for (typename std::vector<EdgeType>::const_iterator it = m_edges.begin(); it != m_edges.end(); ++it)
+	for (typename std::vector<EdgeType>::const_iterator it = m_edges->begin(); it != m_edges->end(); ++it)
 	{
 		for (int vertexId = 0; vertexId < 2; vertexId++)
 		{
@@ -239,7 +254,8 @@ bool TriangleMesh<VertexData, EdgeData, TriangleData>::isValid() const
 	}
 
 	// Test triangles validity
-	for (typename std::vector<TriangleType>::const_iterator it = m_triangles.begin(); it != m_triangles.end(); ++it)
+	for (typename std::vector<TriangleType>::const_iterator it = m_triangles->begin(); it != m_triangles->end();
+		 ++it)
 	{
 		for (int vertexId = 0; vertexId < 3; vertexId++)
 		{
@@ -257,13 +273,13 @@ bool TriangleMesh<VertexData, EdgeData, TriangleData>::isValid() const
 template <class VertexData, class EdgeData, class TriangleData>
 void TriangleMesh<VertexData, EdgeData, TriangleData>::doClearEdges()
 {
-	m_edges.clear();
+	getWritableEdges().clear();
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
 void TriangleMesh<VertexData, EdgeData, TriangleData>::doClearTriangles()
 {
-	m_triangles.clear();
+	getWritableTriangles().clear();
 	m_freeTriangles.clear();
 }
 
@@ -271,8 +287,8 @@ template <class VertexData, class EdgeData, class TriangleData>
 bool TriangleMesh<VertexData, EdgeData, TriangleData>::isEqual(const Vertices<VertexData>& mesh) const
 {
 	const TriangleMesh& triangleMesh = static_cast<const TriangleMesh&>(mesh);
-	return Vertices<VertexData>::isEqual(triangleMesh) && m_edges == triangleMesh.getEdges() &&
-		   m_triangles == triangleMesh.getTriangles();
+	return Vertices<VertexData>::isEqual(triangleMesh) && *m_edges == triangleMesh.getEdges() &&
+		   *m_triangles == triangleMesh.getTriangles();
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
@@ -298,6 +314,24 @@ bool TriangleMesh<VertexData, EdgeData, TriangleData>::doLoad(const std::string&
 	return true;
 }
 
+template <class VertexData, class EdgeData, class TriangleData>
+bool TriangleMesh<VertexData, EdgeData, TriangleData>::isCacheable() const
+{
+	return true;
+}
+
+template <class VertexData, class EdgeData, class TriangleData>
+bool TriangleMesh<VertexData, EdgeData, TriangleData>::doCopyData(const SurgSim::Framework::Asset& other)
+{
+	auto mesh = dynamic_cast<const TriangleMesh<VertexData, EdgeData, TriangleData>*>(&other);
+	if (mesh == nullptr)
+	{
+		return false;
+	}
+	shareData(*mesh);
+	return true;
+}
+
 template <class VertexData, class EdgeData, class TriangleData>
 void TriangleMesh<VertexData, EdgeData, TriangleData>::doClear()
 {
@@ -308,10 +342,11 @@ void TriangleMesh<VertexData, EdgeData, TriangleData>::doClear()
 
 template <class VertexData, class EdgeData, class TriangleData>
 TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleMesh(TriangleMesh&& other) :
-	Vertices<VertexData>::Vertices(std::move(other))
+	Vertices<VertexData>::Vertices(std::move(other)),
+	m_edges(std::make_shared<std::vector<EdgeType>>()),
+	m_triangles(std::make_shared<std::vector<TriangleType>>()),
+	m_trianglesRevision(0)
 {
-	doClearTriangles();
-	doClearEdges();
 	std::swap(m_triangles, other.m_triangles);
 	std::swap(m_edges, other.m_edges);
 	std::swap(m_freeTriangles, other.m_freeTriangles);
@@ -322,9 +357,30 @@ TriangleMesh<VertexData, EdgeData, TriangleData>& TriangleMesh<VertexData, EdgeD
 		TriangleMesh<VertexData, EdgeData, TriangleData>& other)
 {
 	Vertices<VertexData>::operator=(other);
-	m_triangles = other.m_triangles;
-	m_edges = other.m_edges;
+	if (m_triangles != other.m_triangles)
+	{
+		if (m_triangles.use_count() > 1)
+		{
+			m_triangles = std::make_shared<std::vector<TriangleType>>(*other.m_triangles);
+		}
+		else
+		{
+			*m_triangles = *other.m_triangles;
+		}
+	}
+	if (m_edges != other.m_edges)
+	{
+		if (m_edges.use_count() > 1)
+		{
+			m_edges = std::make_shared<std::vector<EdgeType>>(*other.m_edges);
+		}
+		else
+		{
+			*m_edges = *other.m_edges;
+		}
+	}
 	m_freeTriangles = other.m_freeTriangles;
+	++m_trianglesRevision;
 	return *this;
 }
 
@@ -333,16 +389,48 @@ TriangleMesh<VertexData, EdgeData, TriangleData>& TriangleMesh<VertexData, EdgeD
 (TriangleMesh<VertexData, EdgeData, TriangleData>&& other)
 {
 	Vertices<VertexData>::operator=(std::move(other));
-	doClearTriangles();
-	doClearEdges();
 	std::swap(m_triangles, other.m_triangles);
 	std::swap(m_edges, other.m_edges);
 	std::swap(m_freeTriangles, other.m_freeTriangles);
+	++m_trianglesRevision;
 	return *this;
 }
 
 template <class VertexData, class EdgeData, class TriangleData>
-void SurgSim::DataStructures::TriangleMesh<VertexData, EdgeData, TriangleData>::save(const std::string& fileName)
+void TriangleMesh<VertexData, EdgeData, TriangleData>::shareData(const TriangleMesh& other)
+{
+	Vertices<VertexData>::shareVertices(other);
+	m_edges = other.m_edges;
+	m_triangles = other.m_triangles;
+	m_freeTriangles = other.m_freeTriangles;
+	++m_trianglesRevision;
+}
+
+template <class VertexData, class EdgeData, class TriangleData>
+std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::EdgeType>&
+TriangleMesh<VertexData, EdgeData, TriangleData>::getWritableEdges()
+{
+	if (m_edges.use_count() > 1)
+	{
+		m_edges = std::make_shared<std::vector<EdgeType>>(*m_edges);
+	}
+	return *m_edges;
+}
+
+template <class VertexData, class EdgeData, class TriangleData>
+std::vector<typename TriangleMesh<VertexData, EdgeData, TriangleData>::TriangleType>&
+TriangleMesh<VertexData, EdgeData, TriangleData>::getWritableTriangles()
+{
+	if (m_triangles.use_count() > 1)
+	{
+		m_triangles = std::make_shared<std::vector<TriangleType>>(*m_triangles);
+	}
+	++m_trianglesRevision;
+	return *m_triangles;
+}
+
+template <class VertexData, class EdgeData, class TriangleData>
+void SurgSim::DataStructures::TriangleMesh<VertexData, EdgeData, TriangleData>::save(const std::string& fileName) const
 {
 	std::fstream out(fileName, std::ios::out);
 
@@ -53,6 +53,9 @@ namespace DataStructures
 /// A subclass that is designed for a specific use (such as collision detection) may also specify the VertexData,
 /// EdgeData, and TriangleData to what is required.
 ///
+/// Meshes created from the AssetCache share their vertices, edges and triangles with the cached mesh until they are
+/// modified, see shareData().
+///
 /// \tparam	VertexData	Type of extra data stored in each vertex
 /// \tparam	EdgeData	Type of extra data stored in each edge
 /// \tparam	TriangleData	Type of extra data stored in each triangle
@@ -132,6 +135,12 @@ class TriangleMesh : public Vertices<VertexData>, public SurgSim::Framework::Ass
 	/// \return the number of triangles in this mesh.
 	size_t getNumTriangles() const;
 
+	/// Get the revision of the triangles, for data derived from the triangles to detect that it is out of date.
+	/// \note The revision changes on every access that may modify the triangles, i.e. non const access, assignment
+	///       and sharing, even when the triangles stay the same.
+	/// \return the revision of the triangles of this mesh.
+	size_t getTrianglesRevision() const;
+
 	/// Retrieve all edges
 	/// \return a vector containing the position of each edge.
 	const std::vector<EdgeType>& getEdges() const;
@@ -201,7 +210,7 @@ class TriangleMesh : public Vertices<VertexData>, public SurgSim::Framework::Ass
 
 	/// Save the triangle mesh in the ply format
 	/// \param fileName the filename where to save
-	void save(const std::string& fileName);
+	void save(const std::string& fileName) const;
 
 protected:
 	/// Remove all edges from the mesh.
@@ -219,6 +228,15 @@ class TriangleMesh : public Vertices<VertexData>, public SurgSim::Framework::Ass
 
 	bool doLoad(const std::string& fileName) override;
 
+	bool isCacheable() const override;
+
+	bool doCopyData(const SurgSim::Framework::Asset& other) override;
+
+	/// Share the vertices, edges and triangles of another mesh instead of copying them, the storage is duplicated on
+	/// the first non-const access of either mesh, see Vertices::shareVertices() for references taken before.
+	/// \param other the mesh whose storage will be shared
+	void shareData(const TriangleMesh& other);
+
 	using Vertices<VertexData>::doClearVertices;
 
 	static std::string m_className;
@@ -228,15 +246,24 @@ class TriangleMesh : public Vertices<VertexData>, public SurgSim::Framework::Ass
 	/// Clear mesh to return to an empty state (no vertices, no edges, no triangles).
 	virtual void doClear();
 
-	/// Edges
-	std::vector<EdgeType> m_edges;
+	/// \return the edges for modification, duplicating them first if their storage is shared
+	std::vector<EdgeType>& getWritableEdges();
+
+	/// \return the triangles for modification, duplicating them first if their storage is shared
+	std::vector<TriangleType>& getWritableTriangles();
 
-	/// Triangles
-	std::vector<TriangleType> m_triangles;
+	/// Edges, possibly shared with other meshes, never nullptr
+	std::shared_ptr<std::vector<EdgeType>> m_edges;
+
+	/// Triangles, possibly shared with other meshes, never nullptr
+	std::shared_ptr<std::vector<TriangleType>> m_triangles;
 
 	/// List of indices of deleted triangles, to be reused when another triangle is added
 	std::vector<size_t> m_freeTriangles;
 
+	/// Revision of the triangles, changed whenever they may be modified
+	size_t m_trianglesRevision;
+
 public:
 	// Dependent name resolution for inherited functions and typenames from templates
 	using typename Vertices<VertexData>::VertexType;
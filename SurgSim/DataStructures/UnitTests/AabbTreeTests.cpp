@@ -21,6 +21,8 @@
 #include "SurgSim/DataStructures/AabbTreeIntersectionVisitor.h"
 #include "SurgSim/DataStructures/AabbTreeNode.h"
 #include "SurgSim/DataStructures/TriangleMesh.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Framework/Timer.h"
 #include "SurgSim/Math/Aabb.h"
@@ -103,6 +105,83 @@ TEST(AabbTreeTests, BatchBuildTest)
 	tree->set(std::move(items));
 }
 
+namespace
+{
+/// \return true if both nodes and all their children have the same data and bounding boxes
+bool isSameStructure(std::shared_ptr<TreeNode> lhs, std::shared_ptr<TreeNode> rhs)
+{
+	auto lhsNode = std::static_pointer_cast<AabbTreeNode>(lhs);
+	auto rhsNode = std::static_pointer_cast<AabbTreeNode>(rhs);
+	if (*lhsNode != *rhsNode || lhsNode->getNumChildren() != rhsNode->getNumChildren() ||
+		!lhsNode->getAabb().isApprox(rhsNode->getAabb()))
+	{
+		return false;
+	}
+	for (size_t i = 0; i < lhsNode->getNumChildren(); ++i)
+	{
+		if (!isSameStructure(lhsNode->getChild(i), rhsNode->getChild(i)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+}
+
+TEST(AabbTreeTests, WriteReadTest)
+{
+	auto runtime = std::make_shared<SurgSim::Framework::Runtime>("config.txt");
+	auto mesh = std::make_shared<TriangleMeshPlain>();
+	mesh->load("Geometry/arm_collision.ply");
+
+	std::list<AabbTreeData::Item> items;
+	for (size_t i = 0; i < mesh->getNumTriangles(); ++i)
+	{
+		auto positions = mesh->getTrianglePositions(i);
+		items.emplace_back(SurgSim::Math::makeAabb(positions[0], positions[1], positions[2]), i);
+	}
+	AabbTree tree(3);
+	tree.set(std::move(items));
+
+	Framework::BinaryWriter writer;
+	tree.write(&writer);
+	const auto& buffer = writer.getBuffer();
+
+	{
+		SCOPED_TRACE("The tree is restored with the same structure");
+		AabbTree restored;
+		Framework::BinaryReader reader(buffer.data(), buffer.size());
+		ASSERT_TRUE(restored.read(&reader, mesh->getNumTriangles()));
+		EXPECT_TRUE(reader.isAtEnd());
+		EXPECT_TRUE(isSameStructure(tree.getRoot(), restored.getRoot()));
+		EXPECT_EQ(tree.getMaxObjectsPerNode(), restored.getMaxObjectsPerNode());
+		EXPECT_TRUE(tree.getAabb().isApprox(restored.getAabb()));
+
+		Aabbd query(Vector3d(-0.1, -0.1, -0.1), Vector3d(0.1, 0.1, 0.1));
+		AabbTreeIntersectionVisitor expected(query);
+		AabbTreeIntersectionVisitor actual(query);
+		tree.getRoot()->accept(&expected);
+		restored.getRoot()->accept(&actual);
+		EXPECT_EQ(expected.getIntersections(), actual.getIntersections());
+	}
+
+	{
+		SCOPED_TRACE("Ids out of range are rejected and leave the tree unchanged");
+		AabbTree restored;
+		Framework::BinaryReader reader(buffer.data(), buffer.size());
+		EXPECT_FALSE(restored.read(&reader, mesh->getNumTriangles() - 1));
+		EXPECT_EQ(0u, restored.getRoot()->getNumChildren());
+		EXPECT_EQ(nullptr, restored.getRoot()->getData());
+	}
+
+	{
+		SCOPED_TRACE("Truncated data is rejected");
+		AabbTree restored;
+		Framework::BinaryReader reader(buffer.data(), buffer.size() / 2);
+		EXPECT_FALSE(restored.read(&reader, mesh->getNumTriangles()));
+	}
+}
+
 TEST(AabbTreeTests, EasyIntersectionTest)
 {
 	auto tree = std::make_shared<AabbTree>(3);
@@ -0,0 +1,157 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "SurgSim/DataStructures/TimedHistory.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Quaterniond;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector;
+using SurgSim::Math::Vector3d;
+using SurgSim::Math::makeRigidTransform;
+
+namespace SurgSim
+{
+namespace DataStructures
+{
+
+TEST(TimedHistoryTests, Init)
+{
+	EXPECT_NO_THROW(TimedHistory<Vector3d> history);
+	EXPECT_THROW(TimedHistory<Vector3d> history(0), Framework::AssertionFailure);
+
+	TimedHistory<Vector3d> history(4);
+	EXPECT_EQ(4u, history.getCapacity());
+	EXPECT_EQ(0u, history.size());
+	EXPECT_TRUE(history.isEmpty());
+
+	Vector3d value(1.0, 2.0, 3.0);
+	EXPECT_FALSE(history.sample(0.0, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(1.0, 2.0, 3.0)));
+}
+
+TEST(TimedHistoryTests, Push)
+{
+	TimedHistory<Vector3d> history(3);
+	history.push(1.0, Vector3d(1.0, 0.0, 0.0));
+	history.push(2.0, Vector3d(2.0, 0.0, 0.0));
+	EXPECT_EQ(2u, history.size());
+
+	// The same time replaces the newest value
+	history.push(2.0, Vector3d(3.0, 0.0, 0.0));
+	EXPECT_EQ(2u, history.size());
+	double time;
+	Vector3d value;
+	ASSERT_TRUE(history.getNewest(&time, &value));
+	EXPECT_DOUBLE_EQ(2.0, time);
+	EXPECT_TRUE(value.isApprox(Vector3d(3.0, 0.0, 0.0)));
+
+	EXPECT_THROW(history.push(1.5, Vector3d::Zero()), Framework::AssertionFailure);
+
+	// Once full, the oldest values are replaced
+	history.push(3.0, Vector3d(4.0, 0.0, 0.0));
+	history.push(4.0, Vector3d(5.0, 0.0, 0.0));
+	EXPECT_EQ(3u, history.size());
+	ASSERT_TRUE(history.sample(0.0, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(3.0, 0.0, 0.0)));
+	ASSERT_TRUE(history.getNewest(&time, &value));
+	EXPECT_DOUBLE_EQ(4.0, time);
+
+	history.clear();
+	EXPECT_TRUE(history.isEmpty());
+	EXPECT_FALSE(history.getNewest(&time, &value));
+
+	history.push(1.0, Vector3d(1.0, 0.0, 0.0));
+	history.setCapacity(8);
+	EXPECT_EQ(8u, history.getCapacity());
+	EXPECT_TRUE(history.isEmpty());
+}
+
+TEST(TimedHistoryTests, Sample)
+{
+	TimedHistory<Vector3d> history(4);
+	Vector3d value;
+
+	history.push(1.0, Vector3d(1.0, 0.0, 0.0));
+	ASSERT_TRUE(history.sample(5.0, &value, 1.0));
+	EXPECT_TRUE(value.isApprox(Vector3d(1.0, 0.0, 0.0)));
+
+	for (int i = 2; i <= 6; ++i)
+	{
+		history.push(static_cast<double>(i), Vector3d(static_cast<double>(i), 2.0 * i, 0.0));
+	}
+
+	// Clamped before the oldest value
+	ASSERT_TRUE(history.sample(0.0, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(3.0, 6.0, 0.0)));
+
+	// Interpolated in between
+	ASSERT_TRUE(history.sample(3.25, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(3.25, 6.5, 0.0)));
+	ASSERT_TRUE(history.sample(5.5, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(5.5, 11.0, 0.0)));
+	ASSERT_TRUE(history.sample(4.0, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(4.0, 8.0, 0.0)));
+
+	// Without extrapolation the newest value is used
+	ASSERT_TRUE(history.sample(7.0, &value));
+	EXPECT_TRUE(value.isApprox(Vector3d(6.0, 12.0, 0.0)));
+
+	// Extrapolated up to the given limit
+	ASSERT_TRUE(history.sample(6.25, &value, 0.5));
+	EXPECT_TRUE(value.isApprox(Vector3d(6.25, 12.5, 0.0)));
+	ASSERT_TRUE(history.sample(8.0, &value, 0.5));
+	EXPECT_TRUE(value.isApprox(Vector3d(6.5, 13.0, 0.0)));
+}
+
+TEST(TimedHistoryTests, SampleDynamicVector)
+{
+	TimedHistory<Vector> history;
+	Vector positions(6);
+	positions << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+	history.push(0.0, positions);
+	history.push(0.5, 2.0 * positions);
+
+	Vector value;
+	ASSERT_TRUE(history.sample(0.25, &value));
+	ASSERT_EQ(6, value.size());
+	EXPECT_TRUE(value.isApprox(1.5 * positions));
+}
+
+TEST(TimedHistoryTests, SamplePose)
+{
+	TimedHistory<RigidTransform3d> history;
+	RigidTransform3d start = makeRigidTransform(Quaterniond::Identity(), Vector3d(1.0, 2.0, 3.0));
+	RigidTransform3d end = makeRigidTransform(Quaterniond(Eigen::AngleAxisd(0.2, Vector3d::UnitZ())),
+											  Vector3d(3.0, 2.0, 1.0));
+	history.push(1.0, start);
+	history.push(2.0, end);
+
+	RigidTransform3d pose;
+	ASSERT_TRUE(history.sample(1.5, &pose));
+	EXPECT_TRUE(pose.isApprox(Math::interpolate(start, end, 0.5)));
+
+	ASSERT_TRUE(history.sample(2.5, &pose, 1.0));
+	EXPECT_TRUE(pose.translation().isApprox(Vector3d(4.0, 2.0, 0.0)));
+	EXPECT_NEAR(0.3, Eigen::AngleAxisd(pose.linear()).angle(), 1e-9);
+}
+
+};  // namespace DataStructures
+};  // namespace SurgSim
@@ -658,6 +658,63 @@ TEST_F(TriangleMeshTest, LoadTest)
 }
 
 
+namespace
+{
+/// Mesh exposing the sharing of the storage with another mesh
+class SharingMesh : public TriangleMeshPlain
+{
+public:
+	SharingMesh() {}
+	SharingMesh(const SharingMesh& other) : TriangleMeshPlain(other) {}
+	using TriangleMeshPlain::shareData;
+};
+}
+
+TEST_F(TriangleMeshTest, ShareDataTest)
+{
+	SharingMesh first;
+	for (size_t i = 0; i < testPositions.size(); ++i)
+	{
+		first.addVertex(TriangleMeshPlain::VertexType(testPositions[i]));
+	}
+	for (size_t i = 0; i < testTriangleVertices.size(); ++i)
+	{
+		first.addTriangle(TriangleMeshPlain::TriangleType(testTriangleVertices[i]));
+	}
+
+	SharingMesh second;
+	size_t revision = second.getTrianglesRevision();
+	second.shareData(first);
+	EXPECT_NE(revision, second.getTrianglesRevision());
+	const SharingMesh& constFirst = first;
+	const SharingMesh& constSecond = second;
+	EXPECT_EQ(&constFirst.getVertices(), &constSecond.getVertices());
+	EXPECT_EQ(&constFirst.getTriangles(), &constSecond.getTriangles());
+	EXPECT_TRUE(first == second);
+
+	// Modifying one mesh duplicates its data, the other mesh is unchanged
+	second.setVertexPosition(0, Vector3d(5.0, 5.0, 5.0));
+	EXPECT_NE(&constFirst.getVertices(), &constSecond.getVertices());
+	EXPECT_TRUE(Vector3d(5.0, 5.0, 5.0).isApprox(second.getVertexPosition(0)));
+	EXPECT_TRUE(testPositions[0].isApprox(first.getVertexPosition(0)));
+
+	// Reading the triangles keeps the revision, modifying them changes it
+	revision = second.getTrianglesRevision();
+	EXPECT_EQ(testTriangleVertices.size(), constSecond.getTriangles().size());
+	EXPECT_EQ(revision, second.getTrianglesRevision());
+	second.removeTriangle(0);
+	EXPECT_NE(revision, second.getTrianglesRevision());
+	EXPECT_NE(&constFirst.getTriangles(), &constSecond.getTriangles());
+	EXPECT_EQ(testTriangleVertices.size() - 1, second.getNumTriangles());
+	EXPECT_EQ(testTriangleVertices.size(), first.getNumTriangles());
+	EXPECT_TRUE(first.getTriangle(0).isValid);
+
+	// Copies never share their data
+	SharingMesh copy(first);
+	EXPECT_NE(&constFirst.getVertices(), &static_cast<const SharingMesh&>(copy).getVertices());
+	EXPECT_TRUE(copy == first);
+}
+
 TEST_F(TriangleMeshTest, GetTrianglePositions)
 {
 	MockTriangleMesh mesh;
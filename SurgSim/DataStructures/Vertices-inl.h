@@ -27,15 +27,54 @@ namespace DataStructures
 {
 
 template <class VertexData>
-Vertices<VertexData>::Vertices()
+Vertices<VertexData>::Vertices() :
+	m_vertices(std::make_shared<std::vector<VertexType>>())
 {
 }
 
+template <class VertexData>
+Vertices<VertexData>::Vertices(const Vertices& other) :
+	m_vertices(std::make_shared<std::vector<VertexType>>(*other.m_vertices))
+{
+}
+
+template <class VertexData>
+Vertices<VertexData>::Vertices(Vertices&& other) :
+	m_vertices(std::make_shared<std::vector<VertexType>>())
+{
+	std::swap(m_vertices, other.m_vertices);
+}
+
+template <class VertexData>
+Vertices<VertexData>& Vertices<VertexData>::operator=(const Vertices& other)
+{
+	if (m_vertices != other.m_vertices)
+	{
+		if (m_vertices.use_count() > 1)
+		{
+			m_vertices = std::make_shared<std::vector<VertexType>>(*other.m_vertices);
+		}
+		else
+		{
+			*m_vertices = *other.m_vertices;
+		}
+	}
+	return *this;
+}
+
+template <class VertexData>
+Vertices<VertexData>& Vertices<VertexData>::operator=(Vertices&& other)
+{
+	std::swap(m_vertices, other.m_vertices);
+	return *this;
+}
+
 template <class VertexData>
 template <class V>
-Vertices<VertexData>::Vertices(const Vertices<V>& other)
+Vertices<VertexData>::Vertices(const Vertices<V>& other) :
+	m_vertices(std::make_shared<std::vector<VertexType>>())
 {
-	m_vertices.reserve(other.getVertices().size());
+	m_vertices->reserve(other.getVertices().size());
 	for (auto& otherVertex : other.getVertices())
 	{
 		addVertex(VertexType(otherVertex));
@@ -47,19 +86,20 @@ template <class V>
 Vertices<VertexData>& Vertices<VertexData>::operator=(const Vertices<V>& other)
 {
 	auto& otherVertices = other.getVertices();
+	auto& vertices = getWritableVertices();
 
-	if (otherVertices.size() < m_vertices.size())
+	if (otherVertices.size() < vertices.size())
 	{
-		m_vertices.resize(otherVertices.size());
+		vertices.resize(otherVertices.size());
 	}
 	else
 	{
-		m_vertices.reserve(otherVertices.size());
+		vertices.reserve(otherVertices.size());
 	}
 
-	auto vertex = m_vertices.begin();
+	auto vertex = vertices.begin();
 	auto otherVertex = otherVertices.begin();
-	for (; vertex != m_vertices.end(); ++vertex, ++otherVertex)
+	for (; vertex != vertices.end(); ++vertex, ++otherVertex)
 	{
 		*vertex = *otherVertex;
 	}
@@ -91,60 +131,62 @@ bool Vertices<VertexData>::update()
 template <class VertexData>
 size_t Vertices<VertexData>::addVertex(const VertexType& vertex)
 {
-	m_vertices.push_back(vertex);
-	return m_vertices.size() - 1;
+	auto& vertices = getWritableVertices();
+	vertices.push_back(vertex);
+	return vertices.size() - 1;
 }
 
 template <class VertexData>
 size_t Vertices<VertexData>::getNumVertices() const
 {
-	return m_vertices.size();
+	return m_vertices->size();
 }
 
 template <class VertexData>
 const typename Vertices<VertexData>::VertexType& Vertices<VertexData>::getVertex(size_t id) const
 {
-	return m_vertices[id];
+	return (*m_vertices)[id];
 }
 
 template <class VertexData>
 typename Vertices<VertexData>::VertexType& Vertices<VertexData>::getVertex(size_t id)
 {
-	return m_vertices[id];
+	return getWritableVertices()[id];
 }
 
 template <class VertexData>
 const std::vector<typename Vertices<VertexData>::VertexType>& Vertices<VertexData>::getVertices() const
 {
-	return m_vertices;
+	return *m_vertices;
 }
 
 template <class VertexData>
 std::vector<typename Vertices<VertexData>::VertexType>& Vertices<VertexData>::getVertices()
 {
-	return m_vertices;
+	return getWritableVertices();
 }
 
 template <class VertexData>
 void Vertices<VertexData>::setVertexPosition(size_t id, const SurgSim::Math::Vector3d& position)
 {
-	m_vertices[id].position = position;
+	getWritableVertices()[id].position = position;
 }
 
 template <class VertexData>
 const SurgSim::Math::Vector3d& Vertices<VertexData>::getVertexPosition(size_t id) const
 {
-	return m_vertices[id].position;
+	return (*m_vertices)[id].position;
 }
 
 template <class VertexData>
 void Vertices<VertexData>::setVertexPositions(const std::vector<SurgSim::Math::Vector3d>& positions, bool doUpdate)
 {
-	SURGSIM_ASSERT(m_vertices.size() == positions.size()) << "Number of positions must match number of vertices.";
+	auto& vertices = getWritableVertices();
+	SURGSIM_ASSERT(vertices.size() == positions.size()) << "Number of positions must match number of vertices.";
 
-	for (size_t i = 0; i < m_vertices.size(); ++i)
+	for (size_t i = 0; i < vertices.size(); ++i)
 	{
-		m_vertices[i].position = positions[i];
+		vertices[i].position = positions[i];
 	}
 
 	if (doUpdate)
@@ -156,7 +198,7 @@ void Vertices<VertexData>::setVertexPositions(const std::vector<SurgSim::Math::V
 template <class VertexData>
 void Vertices<VertexData>::transform(const Math::RigidTransform3d& pose)
 {
-	for (auto& vertex : m_vertices)
+	for (auto& vertex : getWritableVertices())
 	{
 		vertex.position = pose * vertex.position;
 	}
@@ -177,13 +219,19 @@ bool Vertices<VertexData>::operator!=(const Vertices& mesh) const
 template <class VertexData>
 void Vertices<VertexData>::doClearVertices()
 {
-	m_vertices.clear();
+	getWritableVertices().clear();
 }
 
 template <class VertexData>
 bool Vertices<VertexData>::isEqual(const Vertices& mesh) const
 {
-	return m_vertices == mesh.m_vertices;
+	return m_vertices == mesh.m_vertices || *m_vertices == *mesh.m_vertices;
+}
+
+template <class VertexData>
+void Vertices<VertexData>::shareVertices(const Vertices& other)
+{
+	m_vertices = other.m_vertices;
 }
 
 template <class VertexData>
@@ -198,6 +246,16 @@ bool Vertices<VertexData>::doUpdate()
 	return true;
 }
 
+template <class VertexData>
+std::vector<typename Vertices<VertexData>::VertexType>& Vertices<VertexData>::getWritableVertices()
+{
+	if (m_vertices.use_count() > 1)
+	{
+		m_vertices = std::make_shared<std::vector<VertexType>>(*m_vertices);
+	}
+	return *m_vertices;
+}
+
 };
 };
 
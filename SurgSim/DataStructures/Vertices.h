@@ -16,6 +16,7 @@
 #ifndef SURGSIM_DATASTRUCTURES_VERTICES_H
 #define SURGSIM_DATASTRUCTURES_VERTICES_H
 
+#include <memory>
 #include <vector>
 
 #include "SurgSim/DataStructures/EmptyData.h"
@@ -44,6 +45,10 @@ namespace DataStructures
 /// of vertices and the data required. This method would use the addVertex() method to add the created vertices to the
 /// Mesh.
 ///
+/// Copies and assignments copy the vertices. Subclasses can instead share the vertices of another instance through
+/// shareVertices(), the storage is then duplicated by the first non-const access (copy-on-write), so that large
+/// immutable data (e.g. assets held by the AssetCache) is not duplicated for every user.
+///
 /// \tparam	VertexData	Type of extra data stored in each vertex (void for no data)
 /// \sa Vertex
 /// \sa MeshElement
@@ -57,6 +62,24 @@ class Vertices
 	/// Constructor
 	Vertices();
 
+	/// Copy constructor, the vertices are copied
+	/// \param other the Vertices to copy from
+	Vertices(const Vertices& other);
+
+	/// Move constructor
+	/// \param other the Vertices to move from
+	Vertices(Vertices&& other);
+
+	/// Copy assignment, the vertices are copied
+	/// \param other the Vertices to copy from
+	/// \return this object
+	Vertices& operator=(const Vertices& other);
+
+	/// Move assignment
+	/// \param other the Vertices to move from
+	/// \return this object
+	Vertices& operator=(Vertices&& other);
+
 	/// Copy constructor when the template data is a different type
 	/// In this case, no data will be copied
 	/// \tparam V type of data stored in the other Vertices
@@ -96,13 +119,15 @@ class Vertices
 	/// Returns the specified vertex.
 	const VertexType& getVertex(size_t id) const;
 
-	/// Returns the specified vertex (non const version).
+	/// Returns the specified vertex for modification (non const version).
+	/// \note Duplicates the vertices first if they are shared, see shareVertices(), use the const version to read them.
 	VertexType& getVertex(size_t id);
 
 	/// Returns a vector containing the position of each vertex.
 	const std::vector<VertexType>& getVertices() const;
 
-	/// Returns a vector containing the position of each vertex (non const version).
+	/// Returns a vector containing the position of each vertex for modification (non const version).
+	/// \note Duplicates the vertices first if they are shared, see shareVertices(), use the const version to read them.
 	std::vector<VertexType>& getVertices();
 
 	/// Sets the position of a vertex.
@@ -144,6 +169,13 @@ class Vertices
 	/// \param	mesh	Mesh must be of the same type as that which it is compared against
 	virtual bool isEqual(const Vertices& mesh) const;
 
+	/// Share the vertices of another instance instead of copying them, the storage is duplicated on the first
+	/// non-const access of either instance.
+	/// \note References to the vertices taken before that access keep referring to the old shared storage, i.e.
+	///       they do not see the modifications, the vertices need to be retrieved again after modifying them.
+	/// \param other the Vertices whose storage will be shared
+	void shareVertices(const Vertices& other);
+
 private:
 	/// Clear mesh to return to an empty state (no vertices).
 	virtual void doClear();
@@ -155,7 +187,11 @@ class Vertices
 	virtual bool doUpdate();
 
 	/// Vertices
-	std::vector<VertexType> m_vertices;
+	/// \return the vertices for modification, duplicating them first if their storage is shared
+	std::vector<VertexType>& getWritableVertices();
+
+	/// Vertices, possibly shared with other instances, never nullptr
+	std::shared_ptr<std::vector<VertexType>> m_vertices;
 };
 
 typedef Vertices<EmptyData> VerticesPlain;
@@ -16,6 +16,8 @@
 #include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
 
 #include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/DataStructures/DataGroupCopier.h"
 
 using SurgSim::DataStructures::DataGroup;
 
@@ -49,12 +51,56 @@ bool DeviceFilter::isInitialized() const
 
 void DeviceFilter::initializeInput(const std::string& device, const DataGroup& inputData)
 {
-	filterInput(device, inputData, &getInputData());
+	if (m_filterChain.empty())
+	{
+		initializeInputFilter(device, inputData, &getInputData());
+	}
+	else
+	{
+		// Each filter sets up its part of the layout, from the initial data filtered by the previous ones
+		std::vector<DataGroup> stages(m_filterChain.size() - 1);
+		const DataGroup* stageInput = &inputData;
+		for (size_t i = 0; i < stages.size(); ++i)
+		{
+			m_filterChain[i]->initializeInputFilter(device, *stageInput, &stages[i]);
+			stageInput = &stages[i];
+		}
+		initializeInputFilter(device, *stageInput, &getInputData());
+
+		Layout layout;
+		updateLayout(inputData, &layout);
+		if (updateLayout(getInputData(), &layout))
+		{
+			m_chainCopier = std::make_shared<DataStructures::DataGroupCopier>(inputData, &getInputData());
+		}
+		else
+		{
+			m_chainCopier.reset();
+		}
+	}
 }
 
 void DeviceFilter::handleInput(const std::string& device, const DataGroup& inputData)
 {
-	filterInput(device, inputData, &getInputData());
+	if (m_filterChain.empty())
+	{
+		filterInput(device, inputData, &getInputData());
+	}
+	else
+	{
+		if (m_chainCopier == nullptr)
+		{
+			getInputData() = inputData;
+		}
+		else
+		{
+			m_chainCopier->copy(inputData, &getInputData());
+		}
+		for (auto filter : m_filterChain)
+		{
+			filter->filterInputInPlace(device, &getInputData());
+		}
+	}
 	pushInput();
 }
 
@@ -63,19 +109,105 @@ bool DeviceFilter::requestOutput(const std::string& device, DataGroup* outputDat
 	bool state = pullOutput();
 	if (state)
 	{
-		filterOutput(device, getOutputData(), outputData);
+		if (m_filterChain.empty())
+		{
+			filterOutput(device, getOutputData(), outputData);
+		}
+		else
+		{
+			*outputData = getOutputData();
+			for (auto filter = m_filterChain.rbegin(); filter != m_filterChain.rend(); ++filter)
+			{
+				(*filter)->filterOutputInPlace(device, outputData);
+			}
+		}
 	}
 	return state;
 }
 
+void DeviceFilter::setFilterChain(const std::vector<DeviceFilter*>& filters)
+{
+	SURGSIM_ASSERT(filters.empty() || filters.back() == this) <<
+		"The last filter in the chain of " << getName() << " has to be the filter itself.";
+	m_filterChain = filters;
+	m_chainCopier.reset();
+}
+
+void DeviceFilter::initializeInputFilter(const std::string& device, const DataGroup& inputData, DataGroup* result)
+{
+	filterInput(device, inputData, result);
+}
+
+void DeviceFilter::filterInputInPlace(const std::string& device, DataGroup* data)
+{
+}
+
+void DeviceFilter::filterOutputInPlace(const std::string& device, DataGroup* data)
+{
+}
+
 void DeviceFilter::filterInput(const std::string& device, const DataGroup& dataToFilter, DataGroup* result)
 {
-	*result = dataToFilter;
+	copyInput(dataToFilter, result);
+	filterInputInPlace(device, result);
 }
 
 void DeviceFilter::filterOutput(const std::string& device, const DataGroup& dataToFilter, DataGroup* result)
 {
 	*result = dataToFilter;
+	filterOutputInPlace(device, result);
+}
+
+void DeviceFilter::copyAddingVectors(const DataGroup& inputData, const std::vector<std::string>& names,
+	DataGroup* result)
+{
+	if (result->isEmpty())
+	{
+		m_inputCopier.reset();
+		bool isMissing = false;
+		for (const auto& name : names)
+		{
+			isMissing = isMissing || !inputData.vectors().hasEntry(name);
+		}
+		if (isMissing)
+		{
+			DataStructures::DataGroupBuilder builder;
+			builder.addEntriesFrom(inputData);
+			for (const auto& name : names)
+			{
+				builder.addVector(name);
+			}
+			*result = builder.createData();
+			m_inputCopier = std::make_shared<DataStructures::DataGroupCopier>(inputData, result);
+		}
+	}
+	copyInput(inputData, result);
+}
+
+void DeviceFilter::copyInput(const DataGroup& inputData, DataGroup* result)
+{
+	if (m_inputCopier == nullptr)
+	{
+		*result = inputData;
+	}
+	else
+	{
+		m_inputCopier->copy(inputData, result);
+	}
+}
+
+bool DeviceFilter::updateLayout(const DataGroup& data, Layout* layout)
+{
+	const Layout dataLayout = {{data.poses().getDirectory(), data.vectors().getDirectory(),
+		data.matrices().getDirectory(), data.scalars().getDirectory(), data.integers().getDirectory(),
+		data.booleans().getDirectory(), data.strings().getDirectory(), data.images().getDirectory(),
+		data.customData().getDirectory()}};
+	bool changed = (dataLayout != *layout);
+	if (changed)
+	{
+		*layout = dataLayout;
+	}
+	return changed;
 }
 
 };  // namespace Devices
@@ -16,7 +16,10 @@
 #ifndef SURGSIM_DEVICES_DEVICEFILTERS_DEVICEFILTER_H
 #define SURGSIM_DEVICES_DEVICEFILTERS_DEVICEFILTER_H
 
+#include <array>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "SurgSim/Input/CommonDevice.h"
 #include "SurgSim/Input/InputConsumerInterface.h"
@@ -27,6 +30,8 @@ namespace SurgSim
 namespace DataStructures
 {
 class DataGroup;
+class DataGroupCopier;
+class IndexDirectory;
 }
 
 namespace Devices
@@ -34,6 +39,8 @@ namespace Devices
 
 /// A device filter can be connected between a device and the InputConsumerInterface (e.g., InputComponent) and/or
 /// the OutputProducerInterface (e.g., OutputComponent), and can alter the data being passed from/to the device.
+/// Filters do their work in filterInputInPlace() and filterOutputInPlace(), so that several filters can be run one
+/// after the other on the same data, see setFilterChain().
 class DeviceFilter :
 	public Input::CommonDevice, public Input::InputConsumerInterface, public Input::OutputProducerInterface
 {
@@ -54,8 +61,64 @@ class DeviceFilter :
 
 	bool requestOutput(const std::string& device, DataStructures::DataGroup* outputData) override;
 
+	/// Run a sequence of filters as a single one.  This filter then takes the input directly from the device, copies
+	/// it once into its input data and runs filterInputInPlace() of all the filters in order, and it runs
+	/// filterOutputInPlace() of all the filters in reverse order directly on the output data of the device.  Thus
+	/// the filters do not copy the data from one to the next, and the cost of each filter is only the cost of the
+	/// entries it changes.
+	/// \param filters The filters, in the order of the input, the last one has to be this filter.  The filters are
+	///		not owned, they have to outlive the chain.  An empty vector goes back to filtering with this filter only.
+	/// \exception Asserts if the last filter is not this filter.
+	/// \note Has to be set before this filter is added as an input consumer to the device.
+	void setFilterChain(const std::vector<DeviceFilter*>& filters);
+
+	/// Set up the filtering of the input data, called once when the device adds this filter as an input consumer.
+	/// The default implementation calls filterInput().
+	/// \param device The name of the device pushing the input data.
+	/// \param inputData The initial input data.
+	/// \param [in,out] result An empty DataGroup, or one that is assignable from inputData.  Will contain the
+	///		filtered initial data, its layout is the layout of the data passed to filterInputInPlace().  Filters that
+	///		add entries to the input data add them here.
+	virtual void initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+		DataStructures::DataGroup* result);
+
+	/// Filter the input data in place.  The default implementation does nothing.
+	/// \param device The name of the device pushing the input data.
+	/// \param [in,out] data The data that will be filtered.
+	virtual void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data);
+
+	/// Filter the output data in place.  The default implementation does nothing.
+	/// \param device The name of the device pulling the output data.
+	/// \param [in,out] data The data that will be filtered.
+	virtual void filterOutputInPlace(const std::string& device, DataStructures::DataGroup* data);
+
 protected:
-	/// Filter the input data.
+	/// The layout of a DataGroup, i.e., the IndexDirectory of each of its NamedData.
+	typedef std::array<std::shared_ptr<const DataStructures::IndexDirectory>, 9> Layout;
+
+	/// Check whether indices cached for a layout can be used with some data.
+	/// \param data The data.
+	/// \param [in,out] layout The layout the indices were cached for.  Set to the layout of data if they differ.
+	/// \return true if the layouts differ, and the indices need to be cached again.
+	static bool updateLayout(const DataStructures::DataGroup& data, Layout* layout);
+
+	/// Copy the input data, adding the vector entries it does not have yet, for filters that write entries the
+	/// device may not provide (e.g., the velocities).  When result is empty the layout of the result is built, and
+	/// a copier is kept if entries had to be added, later calls and filterInput() then copy through that copier.
+	/// \param inputData The input data.
+	/// \param names The names of the vector entries the result needs.
+	/// \param [in,out] result An empty DataGroup, or one set up by a previous call.  Will contain the input data and
+	///		the added entries.
+	void copyAddingVectors(const DataStructures::DataGroup& inputData, const std::vector<std::string>& names,
+		DataStructures::DataGroup* result);
+
+	/// Copy the input data into a result set up by copyAddingVectors(), or assign it if no entries were added.
+	/// \param inputData The input data.
+	/// \param [in,out] result Will contain the input data.
+	void copyInput(const DataStructures::DataGroup& inputData, DataStructures::DataGroup* result);
+
+	/// Filter the input data.  The default implementation copies the data with copyInput(), then calls
+	/// filterInputInPlace().
 	/// \param device The name of the device pushing the input data.
 	/// \param dataToFilter The data that will be filtered.
 	/// \param [in,out] result A pointer to a DataGroup object that must be assignable to by the dataToFilter object.
@@ -63,7 +126,7 @@ class DeviceFilter :
 	virtual void filterInput(const std::string& device, const DataStructures::DataGroup& dataToFilter,
 		DataStructures::DataGroup* result);
 
-	/// Filter the output data.
+	/// Filter the output data.  The default implementation copies the data, then calls filterOutputInPlace().
 	/// \param device The name of the device pulling the output data.
 	/// \param dataToFilter The data that will be filtered.
 	/// \param [in,out] result A pointer to a DataGroup object that must be assignable to by the dataToFilter object.
@@ -77,6 +140,15 @@ class DeviceFilter :
 private:
 	/// true if initialized and not finalized.
 	bool m_initialized;
+
+	/// The filters run by this filter, empty if it only runs itself.
+	std::vector<DeviceFilter*> m_filterChain;
+
+	/// Copies the device input into the input data of the chain, if the filters changed the layout.
+	std::shared_ptr<DataStructures::DataGroupCopier> m_chainCopier;
+
+	/// Copies the input data into the layout built by copyAddingVectors(), if entries were added.
+	std::shared_ptr<DataStructures::DataGroupCopier> m_inputCopier;
 };
 
 };  // namespace Devices
@@ -64,16 +64,23 @@ bool FilteredDevice::initialize()
 		result = false;
 	}
 
-	if (result)
+	if (result && (m_devices.size() > 1))
 	{
-		for (size_t i = 0; i < m_devices.size() - 1; ++i)
+		// The filters are run in one chain by the last filter, which is connected directly to the raw/base device.
+		std::vector<DeviceFilter*> filters;
+		for (size_t i = 1; i < m_devices.size(); ++i)
 		{
-			auto deviceFilter = std::dynamic_pointer_cast<DeviceFilter>(m_devices[i + 1]);
+			auto deviceFilter = std::dynamic_pointer_cast<DeviceFilter>(m_devices[i]);
 			SURGSIM_ASSERT(deviceFilter != nullptr) << "Expected a device filter.";
-			result = result && m_devices[i]->addInputConsumer(deviceFilter) &&
-				m_devices[i]->setOutputProducer(deviceFilter);
+			filters.push_back(deviceFilter.get());
 		}
+		auto lastFilter = std::static_pointer_cast<DeviceFilter>(m_devices.back());
+		lastFilter->setFilterChain(filters);
+		result = m_devices[0]->addInputConsumer(lastFilter) && m_devices[0]->setOutputProducer(lastFilter);
+	}
 
+	if (result)
+	{
 		for (auto& device : m_devices)
 		{
 			if (!device->isInitialized())
@@ -109,12 +116,13 @@ bool FilteredDevice::finalize()
 
 void FilteredDevice::doFinalize()
 {
-	for (size_t i = 0; i < m_devices.size() - 1; ++i)
+	if (m_devices.size() > 1)
 	{
-		auto deviceFilter = std::dynamic_pointer_cast<DeviceFilter>(m_devices[i + 1]);
-		SURGSIM_ASSERT(deviceFilter != nullptr) << "Expected a device filter.";
-		m_devices[i]->removeInputConsumer(deviceFilter);
-		m_devices[i]->removeOutputProducer(deviceFilter);
+		auto lastFilter = std::dynamic_pointer_cast<DeviceFilter>(m_devices.back());
+		SURGSIM_ASSERT(lastFilter != nullptr) << "Expected a device filter.";
+		m_devices[0]->removeInputConsumer(lastFilter);
+		m_devices[0]->removeOutputProducer(lastFilter);
+		lastFilter->setFilterChain(std::vector<DeviceFilter*>());
 	}
 }
 
@@ -36,6 +36,9 @@ namespace Devices
 class DeviceFilter;
 
 /// A DeviceInterface connected in series with one or more DeviceFilters.  Useful for serialization.
+/// On initialization the filters are set up as a single chain, run by the last filter, so that the data is not copied
+/// from one filter to the next.
+/// \sa DeviceFilter::setFilterChain
 class FilteredDevice : public Input::DeviceInterface
 {
 public:
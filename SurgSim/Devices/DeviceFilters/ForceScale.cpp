@@ -32,46 +32,54 @@ SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::ForceScale,
 ForceScale::ForceScale(const std::string& name) :
 	DeviceFilter(name),
 	m_forceScale(1.0),
-	m_torqueScale(1.0)
+	m_torqueScale(1.0),
+	m_forceIndex(-1),
+	m_torqueIndex(-1),
+	m_springJacobianIndex(-1),
+	m_damperJacobianIndex(-1)
 {
 }
 
-void ForceScale::filterOutput(const std::string& device, const DataGroup& dataToFilter, DataGroup* result)
+void ForceScale::filterOutputInPlace(const std::string& device, DataGroup* data)
 {
 	boost::lock_guard<boost::mutex> lock(m_mutex);
 
-	*result = dataToFilter;
+	if (updateLayout(*data, &m_outputLayout))
+	{
+		m_forceIndex = data->vectors().getIndex(DataStructures::Names::FORCE);
+		m_torqueIndex = data->vectors().getIndex(DataStructures::Names::TORQUE);
+		m_springJacobianIndex = data->matrices().getIndex(DataStructures::Names::SPRING_JACOBIAN);
+		m_damperJacobianIndex = data->matrices().getIndex(DataStructures::Names::DAMPER_JACOBIAN);
+	}
 
 	Vector3d force;
-	if (dataToFilter.vectors().get(DataStructures::Names::FORCE, &force))
+	if (data->vectors().get(m_forceIndex, &force))
 	{
 		force *= m_forceScale;
-		result->vectors().set(DataStructures::Names::FORCE, force);
+		data->vectors().set(m_forceIndex, force);
 	}
 
 	Vector3d torque;
-	if (dataToFilter.vectors().get(DataStructures::Names::TORQUE, &torque))
+	if (data->vectors().get(m_torqueIndex, &torque))
 	{
 		torque *= m_torqueScale;
-		result->vectors().set(DataStructures::Names::TORQUE, torque);
+		data->vectors().set(m_torqueIndex, torque);
 	}
 
 	// Scale the spring's contribution to the force and torque. First three rows calculate force, last three for torque.
-	DataGroup::DynamicMatrixType springJacobian;
-	if (dataToFilter.matrices().get(DataStructures::Names::SPRING_JACOBIAN, &springJacobian))
+	if (data->matrices().get(m_springJacobianIndex, &m_jacobian))
 	{
-		springJacobian.block<3,6>(0, 0) *= m_forceScale;
-		springJacobian.block<3,6>(3, 0) *= m_torqueScale;
-		result->matrices().set(DataStructures::Names::SPRING_JACOBIAN, springJacobian);
+		m_jacobian.block<3,6>(0, 0) *= m_forceScale;
+		m_jacobian.block<3,6>(3, 0) *= m_torqueScale;
+		data->matrices().set(m_springJacobianIndex, m_jacobian);
 	}
 
 	// Scale the damper's contribution to the force and torque. First three rows calculate force, last three for torque.
-	DataGroup::DynamicMatrixType damperJacobian;
-	if (dataToFilter.matrices().get(DataStructures::Names::DAMPER_JACOBIAN, &damperJacobian))
+	if (data->matrices().get(m_damperJacobianIndex, &m_jacobian))
 	{
-		damperJacobian.block<3,6>(0, 0) *= m_forceScale;
-		damperJacobian.block<3,6>(3, 0) *= m_torqueScale;
-		result->matrices().set(DataStructures::Names::DAMPER_JACOBIAN, damperJacobian);
+		m_jacobian.block<3,6>(0, 0) *= m_forceScale;
+		m_jacobian.block<3,6>(3, 0) *= m_torqueScale;
+		data->matrices().set(m_damperJacobianIndex, m_jacobian);
 	}
 }
 
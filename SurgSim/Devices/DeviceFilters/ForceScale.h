@@ -19,6 +19,7 @@
 #include <boost/thread/mutex.hpp>
 #include <string>
 
+#include "SurgSim/DataStructures/DataGroup.h"
 #include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
 
 namespace SurgSim
@@ -50,10 +51,9 @@ class ForceScale : public DeviceFilter
 	/// \param torqueScale The scalar scaling factor.
 	void setTorqueScale(double torqueScale);
 
-private:
-	void filterOutput(const std::string& device, const DataStructures::DataGroup& dataToFilter,
-		DataStructures::DataGroup* result) override;
+	void filterOutputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
 
+private:
 	/// The mutex that protects the scaling factors.
 	boost::mutex m_mutex;
 
@@ -62,6 +62,20 @@ class ForceScale : public DeviceFilter
 
 	/// The scaling factor applied to each direction of the torque.
 	double m_torqueScale;
+
+	/// The layout of the output data the indices are cached for.
+	Layout m_outputLayout;
+
+	///@{
+	/// Cached indices of the output data.
+	int m_forceIndex;
+	int m_torqueIndex;
+	int m_springJacobianIndex;
+	int m_damperJacobianIndex;
+	///@}
+
+	/// The Jacobian being scaled, kept so its storage is reused.
+	DataStructures::DataGroup::DynamicMatrixType m_jacobian;
 };
 
 };  // namespace Devices
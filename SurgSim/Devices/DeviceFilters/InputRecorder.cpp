@@ -0,0 +1,180 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/DeviceFilters/InputRecorder.h"
+
+#include "SurgSim/Framework/Log.h"
+
+using SurgSim::DataStructures::DataGroup;
+
+namespace
+{
+/// The maximum number of records waiting to be written, about a second of input at 1 kHz
+const size_t QUEUE_CAPACITY = 1024;
+
+/// Time the writer thread sleeps when there is nothing to write
+const boost::posix_time::milliseconds IDLE_PERIOD(1);
+}
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::InputRecorder, InputRecorder);
+
+InputRecorder::InputRecorder(const std::string& name) :
+	DeviceFilter(name),
+	m_records(QUEUE_CAPACITY),
+	m_freeRecords(QUEUE_CAPACITY),
+	m_isRecording(false),
+	m_isRunning(false),
+	m_droppedCount(0),
+	m_hasStarted(false)
+{
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(InputRecorder, std::string, FileName, getFileName, setFileName);
+}
+
+InputRecorder::~InputRecorder()
+{
+	stop();
+}
+
+void InputRecorder::setFileName(const std::string& fileName)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The file of " << getName() << " cannot be set once it is initialized.";
+	m_fileName = fileName;
+}
+
+const std::string& InputRecorder::getFileName() const
+{
+	return m_fileName;
+}
+
+bool InputRecorder::initialize()
+{
+	if (!m_log.open(m_fileName))
+	{
+		SURGSIM_LOG_SEVERE(Framework::Logger::getLogger("Devices/Filters/InputRecorder")) << getName() <<
+			" could not open the file '" << m_fileName << "' to record the input.";
+		return false;
+	}
+	m_hasStarted = false;
+	m_droppedCount = 0;
+	if (m_initialInput != nullptr)
+	{
+		// The writer thread is not running yet, the initial input can be written directly
+		m_start = boost::chrono::steady_clock::now();
+		m_hasStarted = true;
+		m_log.write(0.0, *m_initialInput);
+		m_initialInput.reset();
+	}
+	m_isRunning = true;
+	m_thread = boost::thread(&InputRecorder::run, this);
+	m_isRecording = true;
+	return DeviceFilter::initialize();
+}
+
+bool InputRecorder::finalize()
+{
+	stop();
+	return DeviceFilter::finalize();
+}
+
+size_t InputRecorder::getDroppedCount() const
+{
+	return m_droppedCount;
+}
+
+void InputRecorder::initializeInputFilter(const std::string& device, const DataGroup& inputData, DataGroup* result)
+{
+	DeviceFilter::initializeInputFilter(device, inputData, result);
+	if (!m_isRecording)
+	{
+		m_initialInput.reset(new DataGroup(*result));
+	}
+}
+
+void InputRecorder::filterInputInPlace(const std::string& device, DataGroup* data)
+{
+	if (!m_isRecording)
+	{
+		return;
+	}
+
+	const auto now = boost::chrono::steady_clock::now();
+	if (!m_hasStarted)
+	{
+		m_start = now;
+		m_hasStarted = true;
+	}
+
+	// Reuse the memory of a written record, if there is one
+	m_freeRecords.tryPop(&m_record);
+	m_log.encode(boost::chrono::duration<double>(now - m_start).count(), *data, &m_record);
+	if (!m_records.tryPush(std::move(m_record)))
+	{
+		// The dropped record may have held the layout, the next one needs to hold it again
+		m_log.resetLayout();
+		++m_droppedCount;
+	}
+}
+
+void InputRecorder::run()
+{
+	std::vector<char> record;
+	size_t reportedDrops = 0;
+	while (true)
+	{
+		if (m_records.tryPop(&record))
+		{
+			m_log.writeRecord(record);
+			m_freeRecords.tryPush(std::move(record));
+		}
+		else
+		{
+			// Report drops once the queue was drained, there is space again at this point
+			size_t drops = m_droppedCount;
+			if (drops != reportedDrops)
+			{
+				SURGSIM_LOG_WARNING(Framework::Logger::getLogger("Devices/Filters/InputRecorder")) << getName() <<
+					" dropped " << drops - reportedDrops << " samples, the writer could not keep up.";
+				reportedDrops = drops;
+			}
+			else if (!m_isRunning)
+			{
+				break;
+			}
+			else
+			{
+				boost::this_thread::sleep(IDLE_PERIOD);
+			}
+		}
+	}
+}
+
+void InputRecorder::stop()
+{
+	m_isRecording = false;
+	if (m_thread.joinable())
+	{
+		m_isRunning = false;
+		m_thread.join();
+	}
+	m_log.close();
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
@@ -0,0 +1,129 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_DEVICEFILTERS_INPUTRECORDER_H
+#define SURGSIM_DEVICES_DEVICEFILTERS_INPUTRECORDER_H
+
+#include <atomic>
+#include <boost/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
+#include "SurgSim/Framework/LockFreeQueue.h"
+#include "SurgSim/Input/InputLog.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_STATIC_REGISTRATION(InputRecorder);
+
+/// A device filter that records the input of a device into a binary log, with the time each sample arrived, so that
+/// the session can be played back later by a ReplayDevice without the hardware.  The input passes through unchanged,
+/// and the output is not touched.  The initial input of the device is recorded at time 0, it is kept until the filter
+/// is initialized when it arrives before, as it does inside a FilteredDevice.
+/// The samples are encoded on the device thread and handed to a writer thread through a lock free queue, so that
+/// recording does not add disk I/O to the device thread.  When the queue is full the sample is dropped and counted,
+/// the log stays readable.
+/// \sa SurgSim::Input::InputLogWriter, SurgSim::Devices::ReplayDevice
+class InputRecorder : public DeviceFilter
+{
+public:
+	/// Constructor.
+	/// \param name	Name of this device filter.
+	explicit InputRecorder(const std::string& name);
+
+	/// Destructor, writes out the samples that are still queued.
+	~InputRecorder();
+
+	SURGSIM_CLASSNAME(SurgSim::Devices::InputRecorder);
+
+	/// Set the file the input is recorded to.
+	/// \param fileName The name of the file, an existing file is replaced.
+	/// \exception Asserts if the filter is already initialized.
+	void setFileName(const std::string& fileName);
+
+	/// \return The name of the file the input is recorded to.
+	const std::string& getFileName() const;
+
+	/// Opens the file, records the initial input if it arrived before, and starts the writer thread.
+	/// \return false if the file could not be opened.
+	bool initialize() override;
+
+	/// \return The number of samples that were not recorded because the writer thread fell behind.
+	size_t getDroppedCount() const;
+
+	/// Records the initial input, or keeps it until the filter is initialized.
+	void initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+		DataStructures::DataGroup* result) override;
+
+	/// Records the input.
+	void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
+
+protected:
+	bool finalize() override;
+
+private:
+	/// Loop of the writer thread.
+	void run();
+
+	/// Stop the writer thread once it wrote out the queued samples, and close the file.
+	void stop();
+
+	/// The name of the file.
+	std::string m_fileName;
+
+	/// The log, the records are encoded on the device thread and written on the writer thread.
+	Input::InputLogWriter m_log;
+
+	/// The records waiting to be written.
+	Framework::LockFreeQueue<std::vector<char>> m_records;
+
+	/// The records that have been written, handed back to the device thread to reuse their memory.
+	Framework::LockFreeQueue<std::vector<char>> m_freeRecords;
+
+	/// The initial input that arrived before the filter was initialized, recorded by initialize().
+	std::unique_ptr<DataStructures::DataGroup> m_initialInput;
+
+	/// The record being encoded on the device thread.
+	std::vector<char> m_record;
+
+	/// Whether the samples are recorded.
+	std::atomic<bool> m_isRecording;
+
+	/// Whether the writer thread keeps waiting for records.
+	std::atomic<bool> m_isRunning;
+
+	/// The number of samples that were dropped.
+	std::atomic<size_t> m_droppedCount;
+
+	/// The writer thread.
+	boost::thread m_thread;
+
+	/// Whether a sample has been recorded yet.
+	bool m_hasStarted;
+
+	/// The time of the first sample.
+	boost::chrono::steady_clock::time_point m_start;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_DEVICEFILTERS_INPUTRECORDER_H
@@ -0,0 +1,123 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/DeviceFilters/LocalContactModel.h"
+
+#include <algorithm>
+#include <boost/thread/locks.hpp>
+
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::LocalContactModel, LocalContactModel);
+
+LocalContactModel::LocalContactModel(const std::string& name) :
+	DeviceFilter(name),
+	m_pose(RigidTransform3d::Identity()),
+	m_hasPose(false),
+	m_poseIndex(-1),
+	m_contactModelIndex(-1),
+	m_inputPoseIndex(-1),
+	m_forceIndex(-1),
+	m_torqueIndex(-1)
+{
+}
+
+void LocalContactModel::filterInputInPlace(const std::string& device, DataGroup* data)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+
+	if (updateLayout(*data, &m_inputLayout))
+	{
+		m_poseIndex = data->poses().getIndex(DataStructures::Names::POSE);
+	}
+
+	if (data->poses().get(m_poseIndex, &m_pose))
+	{
+		m_hasPose = true;
+	}
+}
+
+void LocalContactModel::filterOutputInPlace(const std::string& device, DataGroup* data)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+
+	if (updateLayout(*data, &m_outputLayout))
+	{
+		m_contactModelIndex = data->matrices().getIndex(DataStructures::Names::CONTACT_MODEL);
+		m_inputPoseIndex = data->poses().getIndex(DataStructures::Names::INPUT_POSE);
+		m_forceIndex = data->vectors().getIndex(DataStructures::Names::FORCE);
+		m_torqueIndex = data->vectors().getIndex(DataStructures::Names::TORQUE);
+	}
+
+	RigidTransform3d inputPose;
+	if (!m_hasPose || !data->poses().get(m_inputPoseIndex, &inputPose) ||
+		!data->matrices().get(m_contactModelIndex, &m_contactModel))
+	{
+		return;
+	}
+	SURGSIM_ASSERT(m_contactModel.cols() == 8) << getName() << " expects 8 columns in the contact model, not " <<
+		m_contactModel.cols() << ".";
+
+	Vector3d force = Vector3d::Zero();
+	Vector3d torque = Vector3d::Zero();
+	for (DataGroup::DynamicMatrixType::Index i = 0; i < m_contactModel.rows(); ++i)
+	{
+		const Vector3d normal = m_contactModel.block<1, 3>(i, 0).transpose();
+		const double offset = m_contactModel(i, 3);
+		const double stiffness = m_contactModel(i, 4);
+		const Vector3d localPoint = m_contactModel.block<1, 3>(i, 5).transpose();
+
+		// The penetration at the latest pose, beyond the one the physics already accounted for at the input pose
+		const Vector3d point = m_pose * localPoint;
+		const double depth = std::max(0.0, -(normal.dot(point) + offset));
+		const double inputDepth = std::max(0.0, -(normal.dot(inputPose * localPoint) + offset));
+		if (depth > inputDepth)
+		{
+			const Vector3d contactForce = stiffness * (depth - inputDepth) * normal;
+			force += contactForce;
+			torque += (point - m_pose.translation()).cross(contactForce);
+		}
+	}
+
+	Vector3d value;
+	if (data->vectors().get(m_forceIndex, &value))
+	{
+		data->vectors().set(m_forceIndex, value + force);
+	}
+	else
+	{
+		data->vectors().set(m_forceIndex, force);
+	}
+	if (data->vectors().get(m_torqueIndex, &value))
+	{
+		data->vectors().set(m_torqueIndex, value + torque);
+	}
+	else
+	{
+		data->vectors().set(m_torqueIndex, torque);
+	}
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
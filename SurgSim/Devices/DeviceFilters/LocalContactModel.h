@@ -0,0 +1,91 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_DEVICEFILTERS_LOCALCONTACTMODEL_H
+#define SURGSIM_DEVICES_DEVICEFILTERS_LOCALCONTACTMODEL_H
+
+#include <boost/thread/mutex.hpp>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
+#include "SurgSim/Math/RigidTransform.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+SURGSIM_STATIC_REGISTRATION(LocalContactModel);
+
+/// A device filter that evaluates a local contact model at the rate of the device.
+/// The physics publishes, with each output, the contacts of the tool as planes with a stiffness and a point on the
+/// tool (see DataStructures::Names::CONTACT_MODEL), along with the input pose it used (INPUT_POSE).  Between physics
+/// updates, this filter moves the tool points with the latest pose coming from the device, and adds to the force and
+/// torque the extra penetration force of each plane, so that pushing into a stiff contact is felt immediately rather
+/// than one physics update later.  Only additional penetration is rendered, the output is unchanged at the input pose
+/// and moving out of a contact is left to the physics.
+/// The filter has to see the input pose and the output data in the same frame as the physics, so in a chain it
+/// should come after the filters that transform the pose, e.g. after a PoseTransform.
+/// \sa	SurgSim::Physics::VirtualToolCoupler
+class LocalContactModel : public DeviceFilter
+{
+public:
+	/// Constructor.
+	/// \param name	Name of this device filter.
+	explicit LocalContactModel(const std::string& name);
+
+	SURGSIM_CLASSNAME(SurgSim::Devices::LocalContactModel);
+
+	/// Records the latest pose.
+	void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
+
+	/// Adds the contact forces and torques for the latest pose.
+	void filterOutputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
+
+private:
+	/// The mutex that protects the latest pose.
+	boost::mutex m_mutex;
+
+	/// The latest pose coming from the device.
+	Math::RigidTransform3d m_pose;
+
+	/// Whether a pose has been received.
+	bool m_hasPose;
+
+	/// The layout of the input data the input indices are cached for.
+	Layout m_inputLayout;
+
+	/// Cached index of the pose in the input data.
+	int m_poseIndex;
+
+	/// The layout of the output data the output indices are cached for.
+	Layout m_outputLayout;
+
+	///@{
+	/// Cached indices of the output data.
+	int m_contactModelIndex;
+	int m_inputPoseIndex;
+	int m_forceIndex;
+	int m_torqueIndex;
+	///@}
+
+	/// The contact model, kept so its storage is reused.
+	DataStructures::DataGroup::DynamicMatrixType m_contactModel;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_DEVICEFILTERS_LOCALCONTACTMODEL_H
@@ -17,8 +17,6 @@
 
 #include <boost/math/special_functions/fpclassify.hpp>
 
-#include "SurgSim/DataStructures/DataGroupBuilder.h"
-#include "SurgSim/DataStructures/DataGroupCopier.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Math/Matrix.h"
 #include "SurgSim/Math/Vector.h"
@@ -34,7 +32,11 @@ SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::PoseIntegrat
 
 PoseIntegrator::PoseIntegrator(const std::string& name) :
 	DeviceFilter(name),
-	m_poseResult(PoseType::Identity())
+	m_poseResult(PoseType::Identity()),
+	m_poseIndex(-1),
+	m_linearVelocityIndex(-1),
+	m_angularVelocityIndex(-1),
+	m_resetIndex(-1)
 {
 }
 
@@ -46,30 +48,11 @@ const PoseIntegrator::PoseType& PoseIntegrator::integrate(const PoseType& pose)
 	return m_poseResult;
 }
 
-void PoseIntegrator::initializeInput(const std::string& device, const DataStructures::DataGroup& inputData)
+void PoseIntegrator::initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+	DataStructures::DataGroup* result)
 {
-	if (getInputData().isEmpty())
-	{
-		if (!inputData.vectors().hasEntry(DataStructures::Names::LINEAR_VELOCITY) ||
-			!inputData.vectors().hasEntry(DataStructures::Names::ANGULAR_VELOCITY))
-		{
-			DataStructures::DataGroupBuilder builder;
-			builder.addEntriesFrom(inputData);
-			builder.addVector(DataStructures::Names::LINEAR_VELOCITY);
-			builder.addVector(DataStructures::Names::ANGULAR_VELOCITY);
-			getInputData() = builder.createData();
-			m_copier = std::make_shared<DataStructures::DataGroupCopier>(inputData, &getInputData());
-		}
-	}
-
-	if (m_copier == nullptr)
-	{
-		getInputData() = inputData;
-	}
-	else
-	{
-		m_copier->copy(inputData, &getInputData());
-	}
+	copyAddingVectors(inputData, {DataStructures::Names::LINEAR_VELOCITY, DataStructures::Names::ANGULAR_VELOCITY},
+		result);
 
 	PoseType pose;
 	if (inputData.poses().get(DataStructures::Names::POSE, &pose))
@@ -78,19 +61,18 @@ void PoseIntegrator::initializeInput(const std::string& device, const DataStruct
 	}
 }
 
-void PoseIntegrator::handleInput(const std::string& device, const DataStructures::DataGroup& inputData)
+void PoseIntegrator::filterInputInPlace(const std::string& device, DataStructures::DataGroup* data)
 {
-	if (m_copier == nullptr)
+	if (updateLayout(*data, &m_inputLayout))
 	{
-		getInputData() = inputData;
-	}
-	else
-	{
-		m_copier->copy(inputData, &getInputData());
+		m_poseIndex = data->poses().getIndex(DataStructures::Names::POSE);
+		m_linearVelocityIndex = data->vectors().getIndex(DataStructures::Names::LINEAR_VELOCITY);
+		m_angularVelocityIndex = data->vectors().getIndex(DataStructures::Names::ANGULAR_VELOCITY);
+		m_resetIndex = data->booleans().getIndex(m_resetName);
 	}
 
 	PoseType pose;
-	if (inputData.poses().get(DataStructures::Names::POSE, &pose))
+	if (data->poses().get(m_poseIndex, &pose))
 	{
 		m_timer.markFrame();
 		double rate = m_timer.getAverageFrameRate();
@@ -109,7 +91,7 @@ void PoseIntegrator::handleInput(const std::string& device, const DataStructures
 		}
 
 		bool reset = false;
-		inputData.booleans().get(m_resetName, &reset);
+		data->booleans().get(m_resetIndex, &reset);
 		if (reset)
 		{
 			pose.translation() = -m_poseResult.translation();
@@ -121,11 +103,10 @@ void PoseIntegrator::handleInput(const std::string& device, const DataStructures
 		double angle;
 		Math::computeAngleAndAxis(pose.rotation(), &angle, &rotationAxis);
 		rotationAxis = m_poseResult.rotation() * rotationAxis; // rotate the axis into global space
-		getInputData().vectors().set(DataStructures::Names::ANGULAR_VELOCITY, rotationAxis * angle * rate);
-		getInputData().poses().set(DataStructures::Names::POSE, integrate(pose));
-		getInputData().vectors().set(DataStructures::Names::LINEAR_VELOCITY, pose.translation() * rate);
+		data->vectors().set(m_angularVelocityIndex, rotationAxis * angle * rate);
+		data->poses().set(m_poseIndex, integrate(pose));
+		data->vectors().set(m_linearVelocityIndex, pose.translation() * rate);
 	}
-	pushInput();
 }
 
 void PoseIntegrator::setReset(const std::string& name)
@@ -26,11 +26,6 @@
 
 namespace SurgSim
 {
-namespace DataStructures
-{
-class DataGroupCopier;
-};
-
 namespace Devices
 {
 
@@ -58,14 +53,14 @@ class PoseIntegrator : public DeviceFilter
 	/// \return	The integrated pose.
 	const PoseType& integrate(const PoseType& pose);
 
-	void initializeInput(const std::string& device, const DataStructures::DataGroup& inputData) override;
+	/// Adds the linear and angular velocities to the input data, if they are not there yet.
+	void initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+		DataStructures::DataGroup* result) override;
 
-	/// Notifies the consumer that the application input coming from the device has been updated.
 	/// Treats the pose coming from the input device as a delta pose and integrates it to get the output pose.
-	/// \param device The name of the device that is producing the input.  This should only be used to identify
-	/// 	the device (e.g. if the consumer is listening to several devices at once).
-	/// \param inputData The application input state coming from the device.
-	void handleInput(const std::string& device, const DataStructures::DataGroup& inputData) override;
+	/// \param device The name of the device that is producing the input.
+	/// \param [in,out] data The data that will be filtered.
+	void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
 
 	/// Sets the string name of the boolean entry that will reset the pose to its initial value.  Such a reset can be
 	/// useful if the integrated pose is used to position an object and the integration takes the object out of view.
@@ -82,11 +77,19 @@ class PoseIntegrator : public DeviceFilter
 	/// A timer for the update rate needed for calculating velocity.
 	Framework::Timer m_timer;
 
-	/// A copier into the input DataGroup, if needed.
-	std::shared_ptr<DataStructures::DataGroupCopier> m_copier;
-
 	/// The name of the reset boolean (if any).
 	std::string m_resetName;
+
+	/// The layout of the input data the indices are cached for.
+	Layout m_inputLayout;
+
+	///@{
+	/// Cached indices of the input data.
+	int m_poseIndex;
+	int m_linearVelocityIndex;
+	int m_angularVelocityIndex;
+	int m_resetIndex;
+	///@}
 };
 
 
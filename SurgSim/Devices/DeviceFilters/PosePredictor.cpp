@@ -0,0 +1,297 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/DeviceFilters/PosePredictor.h"
+
+#include "SurgSim/Framework/Clock.h"
+#include "SurgSim/Math/Matrix.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Matrix33d;
+using SurgSim::Math::Quaterniond;
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+typedef Eigen::Matrix<double, 9, 1> StateType;
+typedef Eigen::Matrix<double, 9, 9> StateMatrixType;
+
+/// The initial variance of the velocity and acceleration, large so that they are set by the first measurements.
+const double INITIAL_DERIVATIVE_VARIANCE = 1e4;
+
+/// \param block The matrix of a model of one coordinate, for the value, its velocity and its acceleration.
+/// \return The matrix of the model of three independent coordinates.
+StateMatrixType expand(const Matrix33d& block)
+{
+	StateMatrixType result;
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			result.block<3, 3>(3 * i, 3 * j) = block(i, j) * Matrix33d::Identity();
+		}
+	}
+	return result;
+}
+
+/// \return The rotation by the norm of the rotation vector around its direction.
+Quaterniond makeRotation(const Vector3d& rotationVector)
+{
+	const double angle = rotationVector.norm();
+	return (angle > 0.0) ? SurgSim::Math::makeRotationQuaternion(angle, Vector3d(rotationVector / angle)) :
+		Quaterniond::Identity();
+}
+};
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::PosePredictor, PosePredictor);
+
+PosePredictor::PosePredictor(const std::string& name) :
+	DeviceFilter(name),
+	m_orientation(Quaterniond::Identity()),
+	m_isStarted(false),
+	m_lastTime(0.0),
+	m_horizon(0.0),
+	m_motionModel(MOTION_MODEL_CONSTANT_VELOCITY),
+	m_linearProcessNoise(1.0),
+	m_angularProcessNoise(10.0),
+	m_linearMeasurementNoise(1e-6),
+	m_angularMeasurementNoise(1e-4),
+	m_poseIndex(-1),
+	m_linearVelocityIndex(-1),
+	m_angularVelocityIndex(-1),
+	m_timestampIndex(-1)
+{
+	Eigen::Matrix<double, 3, 9> observation = Eigen::Matrix<double, 3, 9>::Zero();
+	observation.leftCols<3>().setIdentity();
+	m_linearFilter.setObservationMatrix(observation);
+	m_angularFilter.setObservationMatrix(observation);
+
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, double, Horizon, getHorizon, setHorizon);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, MotionModel, MotionModel, getMotionModel, setMotionModel);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, double, LinearProcessNoise,
+									  getLinearProcessNoise, setLinearProcessNoise);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, double, AngularProcessNoise,
+									  getAngularProcessNoise, setAngularProcessNoise);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, double, LinearMeasurementNoise,
+									  getLinearMeasurementNoise, setLinearMeasurementNoise);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PosePredictor, double, AngularMeasurementNoise,
+									  getAngularMeasurementNoise, setAngularMeasurementNoise);
+}
+
+void PosePredictor::setHorizon(double horizon)
+{
+	SURGSIM_ASSERT(horizon >= 0.0) << "The horizon of " << getName() << " can not be negative.";
+	m_horizon = horizon;
+}
+
+double PosePredictor::getHorizon() const
+{
+	return m_horizon;
+}
+
+void PosePredictor::setMotionModel(MotionModel model)
+{
+	m_motionModel = model;
+}
+
+MotionModel PosePredictor::getMotionModel() const
+{
+	return m_motionModel;
+}
+
+void PosePredictor::setLinearProcessNoise(double noise)
+{
+	SURGSIM_ASSERT(noise >= 0.0) << "The process noise of " << getName() << " can not be negative.";
+	m_linearProcessNoise = noise;
+}
+
+double PosePredictor::getLinearProcessNoise() const
+{
+	return m_linearProcessNoise;
+}
+
+void PosePredictor::setAngularProcessNoise(double noise)
+{
+	SURGSIM_ASSERT(noise >= 0.0) << "The process noise of " << getName() << " can not be negative.";
+	m_angularProcessNoise = noise;
+}
+
+double PosePredictor::getAngularProcessNoise() const
+{
+	return m_angularProcessNoise;
+}
+
+void PosePredictor::setLinearMeasurementNoise(double noise)
+{
+	SURGSIM_ASSERT(noise > 0.0) << "The measurement noise of " << getName() << " needs to be positive.";
+	m_linearMeasurementNoise = noise;
+}
+
+double PosePredictor::getLinearMeasurementNoise() const
+{
+	return m_linearMeasurementNoise;
+}
+
+void PosePredictor::setAngularMeasurementNoise(double noise)
+{
+	SURGSIM_ASSERT(noise > 0.0) << "The measurement noise of " << getName() << " needs to be positive.";
+	m_angularMeasurementNoise = noise;
+}
+
+double PosePredictor::getAngularMeasurementNoise() const
+{
+	return m_angularMeasurementNoise;
+}
+
+void PosePredictor::reset()
+{
+	m_isStarted = false;
+}
+
+void PosePredictor::initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+	DataStructures::DataGroup* result)
+{
+	copyAddingVectors(inputData, {DataStructures::Names::LINEAR_VELOCITY, DataStructures::Names::ANGULAR_VELOCITY},
+		result);
+	filterInputInPlace(device, result);
+}
+
+void PosePredictor::filterInputInPlace(const std::string& device, DataStructures::DataGroup* data)
+{
+	if (updateLayout(*data, &m_inputLayout))
+	{
+		m_poseIndex = data->poses().getIndex(DataStructures::Names::POSE);
+		m_linearVelocityIndex = data->vectors().getIndex(DataStructures::Names::LINEAR_VELOCITY);
+		m_angularVelocityIndex = data->vectors().getIndex(DataStructures::Names::ANGULAR_VELOCITY);
+		m_timestampIndex = data->scalars().getIndex(DataStructures::Names::TIMESTAMP);
+	}
+
+	PoseType pose;
+	if (data->poses().get(m_poseIndex, &pose))
+	{
+		double time;
+		if (!data->scalars().get(m_timestampIndex, &time))
+		{
+			time = Framework::getMonotonicTime();
+		}
+		addMeasurement(time, pose);
+
+		const StateType& linear = m_linearFilter.getState();
+		const StateType& angular = m_angularFilter.getState();
+		const double horizon = m_horizon;
+		const double halfSquaredHorizon = 0.5 * horizon * horizon;
+
+		pose.translation() = linear.segment<3>(0) + horizon * linear.segment<3>(3) +
+			halfSquaredHorizon * linear.segment<3>(6);
+		const Vector3d rotation = angular.segment<3>(0) + horizon * angular.segment<3>(3) +
+			halfSquaredHorizon * angular.segment<3>(6);
+		pose.linear() = (makeRotation(rotation) * m_orientation).normalized().toRotationMatrix();
+
+		data->poses().set(m_poseIndex, pose);
+		data->vectors().set(m_linearVelocityIndex, linear.segment<3>(3) + horizon * linear.segment<3>(6));
+		data->vectors().set(m_angularVelocityIndex, angular.segment<3>(3) + horizon * angular.segment<3>(6));
+	}
+}
+
+void PosePredictor::addMeasurement(double time, const PoseType& pose)
+{
+	const Quaterniond orientation(pose.linear());
+	if (!m_isStarted)
+	{
+		StateMatrixType covariance = StateMatrixType::Zero();
+		covariance.diagonal().segment<3>(3).setConstant(INITIAL_DERIVATIVE_VARIANCE);
+		covariance.diagonal().segment<3>(6).setConstant(INITIAL_DERIVATIVE_VARIANCE);
+
+		StateType state = StateType::Zero();
+		state.head<3>() = pose.translation();
+		m_linearFilter.setInitialState(state);
+		covariance.diagonal().head<3>().setConstant(m_linearMeasurementNoise);
+		m_linearFilter.setInitialStateCovariance(covariance);
+
+		m_orientation = orientation.normalized();
+		m_angularFilter.setInitialState(StateType::Zero());
+		covariance.diagonal().head<3>().setConstant(m_angularMeasurementNoise);
+		m_angularFilter.setInitialStateCovariance(covariance);
+
+		m_lastTime = time;
+		m_isStarted = true;
+		return;
+	}
+
+	const double dt = time - m_lastTime;
+	if (dt <= 0.0)
+	{
+		// The same sample again, or one out of order
+		return;
+	}
+	m_lastTime = time;
+	updateModel(dt);
+
+	m_linearFilter.update(pose.translation());
+
+	// Measure the rotation relative to the estimated orientation, then move the estimated rotation into the
+	// orientation so that the rotation vector stays small and away from the singularity at an angle of pi.
+	double angle;
+	Vector3d axis;
+	Math::computeAngleAndAxis((orientation * m_orientation.inverse()).normalized(), &angle, &axis);
+	StateType state = m_angularFilter.update(angle * axis);
+	m_orientation = (makeRotation(state.head<3>()) * m_orientation).normalized();
+	state.head<3>().setZero();
+	m_angularFilter.setInitialState(state);
+}
+
+void PosePredictor::updateModel(double dt)
+{
+	const double dt2 = dt * dt;
+	const double dt3 = dt2 * dt;
+	Matrix33d transition;
+	Matrix33d noise;
+	if (m_motionModel == MOTION_MODEL_CONSTANT_ACCELERATION)
+	{
+		// White noise on the jerk
+		transition << 1.0, dt, 0.5 * dt2,
+					  0.0, 1.0, dt,
+					  0.0, 0.0, 1.0;
+		noise << dt3 * dt2 / 20.0, dt2 * dt2 / 8.0, dt3 / 6.0,
+				 dt2 * dt2 / 8.0, dt3 / 3.0, dt2 / 2.0,
+				 dt3 / 6.0, dt2 / 2.0, dt;
+	}
+	else
+	{
+		// White noise on the acceleration, which is kept at zero
+		transition << 1.0, dt, 0.0,
+					  0.0, 1.0, 0.0,
+					  0.0, 0.0, 0.0;
+		noise << dt3 / 3.0, dt2 / 2.0, 0.0,
+				 dt2 / 2.0, dt, 0.0,
+				 0.0, 0.0, 0.0;
+	}
+
+	const StateMatrixType stateTransition = expand(transition);
+	m_linearFilter.setStateTransition(stateTransition);
+	m_linearFilter.setProcessNoiseCovariance(m_linearProcessNoise * expand(noise));
+	m_linearFilter.setMeasurementNoiseCovariance(m_linearMeasurementNoise * Matrix33d::Identity());
+	m_angularFilter.setStateTransition(stateTransition);
+	m_angularFilter.setProcessNoiseCovariance(m_angularProcessNoise * expand(noise));
+	m_angularFilter.setMeasurementNoiseCovariance(m_angularMeasurementNoise * Matrix33d::Identity());
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
@@ -0,0 +1,166 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_DEVICEFILTERS_POSEPREDICTOR_H
+#define SURGSIM_DEVICES_DEVICEFILTERS_POSEPREDICTOR_H
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
+#include "SurgSim/Framework/Accessible.h"
+#include "SurgSim/Math/KalmanFilter.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_STATIC_REGISTRATION(PosePredictor);
+
+enum MotionModel : SURGSIM_ENUM_TYPE;
+
+/// A device filter that predicts the pose of the device ahead in time, to hide the latency of the device and of the
+/// simulation, e.g. for tracked instruments that provide poses at a low rate with a large delay.
+/// The translation and the rotation are each estimated by a Kalman filter with a constant velocity or constant
+/// acceleration model.  The rotation is estimated as a rotation vector relative to the last estimated orientation,
+/// which is updated after each measurement, so that the filter is linear and never has to deal with the
+/// double cover of the quaternions.
+/// The times of the samples are taken from the DataStructures::Names::TIMESTAMP entry if the device provides it, or
+/// from the clock when the input arrives otherwise.
+///
+/// \par Application input provided by the filter:
+///   | type       | name              |                                                                         |
+///   | ----       | ----              | ---                                                                     |
+///   | pose       | "pose"            | The pose predicted at the horizon.                                      |
+///   | vector     | "linearVelocity"  | The linear velocity predicted at the horizon, added if missing.         |
+///   | vector     | "angularVelocity" | The angular velocity predicted at the horizon, added if missing.        |
+/// \sa	SurgSim::Math::KalmanFilter
+class PosePredictor : public DeviceFilter
+{
+public:
+	/// The type used for poses.
+	typedef Math::RigidTransform3d PoseType;
+
+	/// Constructor.
+	/// \param name	Name of this device filter.
+	explicit PosePredictor(const std::string& name);
+
+	SURGSIM_CLASSNAME(SurgSim::Devices::PosePredictor);
+
+	/// \param horizon How far ahead of the last input the pose is predicted, in s, e.g. the latency to hide.
+	void setHorizon(double horizon);
+
+	/// \return How far ahead of the last input the pose is predicted, in s.
+	double getHorizon() const;
+
+	/// \param model The model of the motion of the device.
+	void setMotionModel(MotionModel model);
+
+	/// \return The model of the motion of the device.
+	MotionModel getMotionModel() const;
+
+	/// \param noise The spectral density of the process noise of the translation, i.e. of the acceleration for a
+	///		constant velocity model (in m^2/s^3) or of the jerk for a constant acceleration model (in m^2/s^5).
+	///		Larger values follow changes of the motion faster but are more sensitive to the measurement noise.
+	void setLinearProcessNoise(double noise);
+
+	/// \return The spectral density of the process noise of the translation.
+	double getLinearProcessNoise() const;
+
+	/// \param noise The spectral density of the process noise of the rotation, in rad^2/s^3 or rad^2/s^5.
+	void setAngularProcessNoise(double noise);
+
+	/// \return The spectral density of the process noise of the rotation.
+	double getAngularProcessNoise() const;
+
+	/// \param noise The variance of the measured positions, in m^2.
+	void setLinearMeasurementNoise(double noise);
+
+	/// \return The variance of the measured positions.
+	double getLinearMeasurementNoise() const;
+
+	/// \param noise The variance of the measured orientations, in rad^2.
+	void setAngularMeasurementNoise(double noise);
+
+	/// \return The variance of the measured orientations.
+	double getAngularMeasurementNoise() const;
+
+	/// Adds the linear and angular velocities to the input data, if they are not there yet.
+	void initializeInputFilter(const std::string& device, const DataStructures::DataGroup& inputData,
+		DataStructures::DataGroup* result) override;
+
+	/// Filters the pose from the device and replaces it with the predicted pose.
+	/// \param device The name of the device that is producing the input.
+	/// \param [in,out] data The data that will be filtered.
+	void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
+
+	/// Start the estimation over, the next pose is taken as it is, with no velocity.
+	void reset();
+
+private:
+	/// Update the estimates with a measured pose.
+	/// \param time The time of the measurement, in s.
+	/// \param pose The measured pose.
+	void addMeasurement(double time, const PoseType& pose);
+
+	/// Set the state transitions and process noises of the filters for a time step.
+	/// \param dt The time step, in s.
+	void updateModel(double dt);
+
+	/// The Kalman filter of the translation, the state is the position, velocity and acceleration.
+	Math::KalmanFilter<9, 3> m_linearFilter;
+
+	/// The Kalman filter of the rotation, the state is the rotation vector relative to m_orientation, the angular
+	/// velocity and the angular acceleration.
+	Math::KalmanFilter<9, 3> m_angularFilter;
+
+	/// The estimated orientation.
+	Math::Quaterniond m_orientation;
+
+	/// Whether the filters have been started with a first pose.
+	bool m_isStarted;
+
+	/// The time of the last measurement.
+	double m_lastTime;
+
+	double m_horizon;
+	MotionModel m_motionModel;
+	double m_linearProcessNoise;
+	double m_angularProcessNoise;
+	double m_linearMeasurementNoise;
+	double m_angularMeasurementNoise;
+
+	/// The layout of the input data the indices are cached for.
+	Layout m_inputLayout;
+
+	///@{
+	/// Cached indices of the input data.
+	int m_poseIndex;
+	int m_linearVelocityIndex;
+	int m_angularVelocityIndex;
+	int m_timestampIndex;
+	///@}
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+SURGSIM_SERIALIZABLE_ENUM(SurgSim::Devices::MotionModel,
+						  (MOTION_MODEL_CONSTANT_VELOCITY)(MOTION_MODEL_CONSTANT_ACCELERATION));
+
+#endif  // SURGSIM_DEVICES_DEVICEFILTERS_POSEPREDICTOR_H
@@ -35,50 +35,74 @@ PoseTransform::PoseTransform(const std::string& name) :
 	DeviceFilter(name),
 	m_transform(RigidTransform3d::Identity()),
 	m_transformInverse(RigidTransform3d::Identity()),
-	m_translationScale(1.0)
+	m_translationScale(1.0),
+	m_poseIndex(-1),
+	m_linearVelocityIndex(-1),
+	m_angularVelocityIndex(-1),
+	m_forceIndex(-1),
+	m_torqueIndex(-1),
+	m_springJacobianIndex(-1),
+	m_damperJacobianIndex(-1),
+	m_inputPoseIndex(-1),
+	m_inputLinearVelocityIndex(-1),
+	m_inputAngularVelocityIndex(-1)
 {
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PoseTransform, double, TranslationScale,
 		getTranslationScale, setTranslationScale);
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(PoseTransform, RigidTransform3d, Transform, getTransform, setTransform);
 }
 
-void PoseTransform::filterInput(const std::string& device, const DataGroup& dataToFilter, DataGroup* result)
+void PoseTransform::filterInputInPlace(const std::string& device, DataGroup* data)
 {
 	boost::lock_guard<boost::mutex> lock(m_mutex); // Prevent the transform or scaling from being set simultaneously.
 
-	*result = dataToFilter;  // Pass on all the data entries.
+	if (updateLayout(*data, &m_inputLayout))
+	{
+		m_poseIndex = data->poses().getIndex(DataStructures::Names::POSE);
+		m_linearVelocityIndex = data->vectors().getIndex(DataStructures::Names::LINEAR_VELOCITY);
+		m_angularVelocityIndex = data->vectors().getIndex(DataStructures::Names::ANGULAR_VELOCITY);
+	}
 
 	RigidTransform3d pose; // If there is a pose, scale the translation, then transform the result.
-	if (dataToFilter.poses().get(DataStructures::Names::POSE, &pose))
+	if (data->poses().get(m_poseIndex, &pose))
 	{
 		pose.translation() *= m_translationScale;
 		pose = m_transform * pose;
-		result->poses().set(DataStructures::Names::POSE, pose);
+		data->poses().set(m_poseIndex, pose);
 	}
 
 	// If there is a linear velocity, scale then rotate it.  The linear velocity is scaled because it is the change
 	// in translation over time, and the translation is being scaled.
 	Vector3d linearVelocity;
-	if (dataToFilter.vectors().get(DataStructures::Names::LINEAR_VELOCITY, &linearVelocity))
+	if (data->vectors().get(m_linearVelocityIndex, &linearVelocity))
 	{
 		linearVelocity *= m_translationScale;
 		linearVelocity = m_transform.linear() * linearVelocity;
-		result->vectors().set(DataStructures::Names::LINEAR_VELOCITY, linearVelocity);
+		data->vectors().set(m_linearVelocityIndex, linearVelocity);
 	}
 
 	Vector3d angularVelocity; // If there is an angular velocity, rotate it.
-	if (dataToFilter.vectors().get(DataStructures::Names::ANGULAR_VELOCITY, &angularVelocity))
+	if (data->vectors().get(m_angularVelocityIndex, &angularVelocity))
 	{
 		angularVelocity = m_transform.linear() * angularVelocity;
-		result->vectors().set(DataStructures::Names::ANGULAR_VELOCITY, angularVelocity);
+		data->vectors().set(m_angularVelocityIndex, angularVelocity);
 	}
 }
 
-void PoseTransform::filterOutput(const std::string& device, const DataGroup& dataToFilter, DataGroup* result)
+void PoseTransform::filterOutputInPlace(const std::string& device, DataGroup* data)
 {
 	boost::lock_guard<boost::mutex> lock(m_mutex); // Prevent the transform or scaling from being set simultaneously.
 
-	*result = dataToFilter;  // Pass on all the data entries.
+	if (updateLayout(*data, &m_outputLayout))
+	{
+		m_forceIndex = data->vectors().getIndex(DataStructures::Names::FORCE);
+		m_torqueIndex = data->vectors().getIndex(DataStructures::Names::TORQUE);
+		m_springJacobianIndex = data->matrices().getIndex(DataStructures::Names::SPRING_JACOBIAN);
+		m_damperJacobianIndex = data->matrices().getIndex(DataStructures::Names::DAMPER_JACOBIAN);
+		m_inputPoseIndex = data->poses().getIndex(DataStructures::Names::INPUT_POSE);
+		m_inputLinearVelocityIndex = data->vectors().getIndex(DataStructures::Names::INPUT_LINEAR_VELOCITY);
+		m_inputAngularVelocityIndex = data->vectors().getIndex(DataStructures::Names::INPUT_ANGULAR_VELOCITY);
+	}
 
 	// Since the haptic devices will compare the data in the output DataGroup to a raw input pose, the filter must
 	// perform the reverse transform and scaling to data used by the haptic devices.
@@ -91,17 +115,17 @@ void PoseTransform::filterOutput(const std::string& device, const DataGroup& dat
 	// create forces ejecting the device's collision representation).  Therefore, a device that is having its
 	// translation scaled may required a force scaling filter to reduce the forces.
 	Vector3d force;
-	if (dataToFilter.vectors().get(DataStructures::Names::FORCE, &force))
+	if (data->vectors().get(m_forceIndex, &force))
 	{
 		force = m_transformInverse.linear() * force;
-		result->vectors().set(DataStructures::Names::FORCE, force);
+		data->vectors().set(m_forceIndex, force);
 	}
 
 	Vector3d torque;
-	if (dataToFilter.vectors().get(DataStructures::Names::TORQUE, &torque))
+	if (data->vectors().get(m_torqueIndex, &torque))
 	{
 		torque = m_transformInverse.linear() * torque;
-		result->vectors().set(DataStructures::Names::TORQUE, torque);
+		data->vectors().set(m_torqueIndex, torque);
 	}
 
 	// The Jacobians must be transformed into device space.  The Jacobians are scaled based on the translation scaling,
@@ -115,57 +139,55 @@ void PoseTransform::filterOutput(const std::string& device, const DataGroup& dat
 	// in springJacobian (or damperJacobian) also transforms from delta-translation and is treated the same, while the
 	// two 3x3 blocks on the right half (of springJacobian or damperJacobian) will be multiplied by the delta-rotation
 	// (not delta-translation) and so should not be scaled.
-	DataGroup::DynamicMatrixType springJacobian;
-	if (dataToFilter.matrices().get(DataStructures::Names::SPRING_JACOBIAN, &springJacobian))
+	if (data->matrices().get(m_springJacobianIndex, &m_jacobian))
 	{
-		springJacobian.block<3,3>(0, 0).applyOnTheLeft(m_transformInverse.linear());
-		springJacobian.block<3,3>(0, 0).applyOnTheRight(m_transform.linear());
-		springJacobian.block<3,3>(3, 0).applyOnTheLeft(m_transformInverse.linear());
-		springJacobian.block<3,3>(3, 0).applyOnTheRight(m_transform.linear());
-		springJacobian.block<3,3>(0, 3).applyOnTheLeft(m_transformInverse.linear());
-		springJacobian.block<3,3>(0, 3).applyOnTheRight(m_transform.linear());
-		springJacobian.block<3,3>(3, 3).applyOnTheLeft(m_transformInverse.linear());
-		springJacobian.block<3,3>(3, 3).applyOnTheRight(m_transform.linear());
-		springJacobian.block<6,3>(0, 0) *= m_translationScale;
-		result->matrices().set(DataStructures::Names::SPRING_JACOBIAN, springJacobian);
+		m_jacobian.block<3,3>(0, 0).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(0, 0).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(3, 0).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(3, 0).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(0, 3).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(0, 3).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(3, 3).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(3, 3).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<6,3>(0, 0) *= m_translationScale;
+		data->matrices().set(m_springJacobianIndex, m_jacobian);
 	}
 
 	RigidTransform3d inputPose;
-	if (dataToFilter.poses().get(DataStructures::Names::INPUT_POSE, &inputPose))
+	if (data->poses().get(m_inputPoseIndex, &inputPose))
 	{
 		inputPose = m_transformInverse * inputPose;
 		inputPose.translation() /= m_translationScale;
-		result->poses().set(DataStructures::Names::INPUT_POSE, inputPose);
+		data->poses().set(m_inputPoseIndex, inputPose);
 	}
 
-	DataGroup::DynamicMatrixType damperJacobian;
-	if (dataToFilter.matrices().get(DataStructures::Names::DAMPER_JACOBIAN, &damperJacobian))
+	if (data->matrices().get(m_damperJacobianIndex, &m_jacobian))
 	{
-		damperJacobian.block<3,3>(0, 0).applyOnTheLeft(m_transformInverse.linear());
-		damperJacobian.block<3,3>(0, 0).applyOnTheRight(m_transform.linear());
-		damperJacobian.block<3,3>(3, 0).applyOnTheLeft(m_transformInverse.linear());
-		damperJacobian.block<3,3>(3, 0).applyOnTheRight(m_transform.linear());
-		damperJacobian.block<3,3>(0, 3).applyOnTheLeft(m_transformInverse.linear());
-		damperJacobian.block<3,3>(0, 3).applyOnTheRight(m_transform.linear());
-		damperJacobian.block<3,3>(3, 3).applyOnTheLeft(m_transformInverse.linear());
-		damperJacobian.block<3,3>(3, 3).applyOnTheRight(m_transform.linear());
-		damperJacobian.block<6,3>(0, 0) *= m_translationScale;
-		result->matrices().set(DataStructures::Names::DAMPER_JACOBIAN, damperJacobian);
+		m_jacobian.block<3,3>(0, 0).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(0, 0).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(3, 0).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(3, 0).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(0, 3).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(0, 3).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<3,3>(3, 3).applyOnTheLeft(m_transformInverse.linear());
+		m_jacobian.block<3,3>(3, 3).applyOnTheRight(m_transform.linear());
+		m_jacobian.block<6,3>(0, 0) *= m_translationScale;
+		data->matrices().set(m_damperJacobianIndex, m_jacobian);
 	}
 
 	Vector3d inputLinearVelocity;
-	if (dataToFilter.vectors().get(DataStructures::Names::INPUT_LINEAR_VELOCITY, &inputLinearVelocity))
+	if (data->vectors().get(m_inputLinearVelocityIndex, &inputLinearVelocity))
 	{
 		inputLinearVelocity = m_transformInverse.linear() * inputLinearVelocity;
 		inputLinearVelocity /= m_translationScale;
-		result->vectors().set(DataStructures::Names::INPUT_LINEAR_VELOCITY, inputLinearVelocity);
+		data->vectors().set(m_inputLinearVelocityIndex, inputLinearVelocity);
 	}
 
 	Vector3d inputAngularVelocity;
-	if (dataToFilter.vectors().get(DataStructures::Names::INPUT_ANGULAR_VELOCITY, &inputAngularVelocity))
+	if (data->vectors().get(m_inputAngularVelocityIndex, &inputAngularVelocity))
 	{
 		inputAngularVelocity = m_transformInverse.linear() * inputAngularVelocity;
-		result->vectors().set(DataStructures::Names::INPUT_ANGULAR_VELOCITY, inputAngularVelocity);
+		data->vectors().set(m_inputAngularVelocityIndex, inputAngularVelocity);
 	}
 }
 
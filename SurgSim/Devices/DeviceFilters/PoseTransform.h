@@ -77,13 +77,11 @@ class PoseTransform : public DeviceFilter
 	///		transform even if the following output data is based off input data that used the old transform.
 	void setTransform(const Math::RigidTransform3d& transform);
 
-private:
-	void filterInput(const std::string& device, const DataStructures::DataGroup& dataToFilter,
-		DataStructures::DataGroup* result) override;
+	void filterInputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
 
-	void filterOutput(const std::string& device, const DataStructures::DataGroup& dataToFilter,
-		DataStructures::DataGroup* result) override;
+	void filterOutputInPlace(const std::string& device, DataStructures::DataGroup* data) override;
 
+private:
 	/// The mutex that protects the transform and scaling factor.
 	boost::mutex m_mutex;
 
@@ -95,6 +93,33 @@ class PoseTransform : public DeviceFilter
 
 	/// The scaling factor applied to each direction of the translation.
 	double m_translationScale;
+
+	/// The layout of the input data the input indices are cached for.
+	Layout m_inputLayout;
+
+	///@{
+	/// Cached indices of the input data.
+	int m_poseIndex;
+	int m_linearVelocityIndex;
+	int m_angularVelocityIndex;
+	///@}
+
+	/// The layout of the output data the output indices are cached for.
+	Layout m_outputLayout;
+
+	///@{
+	/// Cached indices of the output data.
+	int m_forceIndex;
+	int m_torqueIndex;
+	int m_springJacobianIndex;
+	int m_damperJacobianIndex;
+	int m_inputPoseIndex;
+	int m_inputLinearVelocityIndex;
+	int m_inputAngularVelocityIndex;
+	///@}
+
+	/// The Jacobian being transformed, kept so its storage is reused.
+	DataStructures::DataGroup::DynamicMatrixType m_jacobian;
 };
 
 };  // namespace Devices
@@ -22,11 +22,22 @@
 #include "SurgSim/DataStructures/DataGroup.h"
 #include "SurgSim/DataStructures/DataGroupBuilder.h"
 #include "SurgSim/Devices/DeviceFilters/DeviceFilter.h"
+#include "SurgSim/Devices/DeviceFilters/ForceScale.h"
+#include "SurgSim/Devices/DeviceFilters/PoseIntegrator.h"
+#include "SurgSim/Devices/DeviceFilters/PoseTransform.h"
+#include "SurgSim/Math/Matrix.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
 #include "SurgSim/Testing/MockInputOutput.h"
 
 using SurgSim::DataStructures::DataGroup;
 using SurgSim::DataStructures::DataGroupBuilder;
 using SurgSim::Devices::DeviceFilter;
+using SurgSim::Devices::ForceScale;
+using SurgSim::Devices::PoseIntegrator;
+using SurgSim::Devices::PoseTransform;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
 using SurgSim::Testing::MockInputOutput;
 
 /// Exposes protected members of CommonDevice.
@@ -92,3 +103,124 @@ TEST(DeviceFilterTest, OutputDataFilter)
 	ASSERT_TRUE(actualData.scalars().get(scalarName, &actualScalar));
 	EXPECT_EQ(initialScalar, actualScalar);
 }
+
+namespace
+{
+
+/// A device, a PoseIntegrator, a PoseTransform and a ForceScale, in this order.
+struct Filters
+{
+	Filters() :
+		device(std::make_shared<MockDeviceFilter>("device")),
+		integrator(std::make_shared<PoseIntegrator>("integrator")),
+		transform(std::make_shared<PoseTransform>("transform")),
+		scale(std::make_shared<ForceScale>("scale")),
+		inputOutput(std::make_shared<MockInputOutput>())
+	{
+		transform->setTranslationScale(2.0);
+		transform->setTransform(SurgSim::Math::makeRigidTransform(
+			SurgSim::Math::makeRotationQuaternion(0.3, Vector3d(0.0, 1.0, 0.0)), Vector3d(1.0, 2.0, 3.0)));
+		scale->setForceScale(0.5);
+		scale->setTorqueScale(3.0);
+	}
+
+	std::shared_ptr<MockDeviceFilter> device;
+	std::shared_ptr<PoseIntegrator> integrator;
+	std::shared_ptr<PoseTransform> transform;
+	std::shared_ptr<ForceScale> scale;
+	std::shared_ptr<MockInputOutput> inputOutput;
+};
+
+}; // anonymous namespace
+
+TEST(DeviceFilterTest, FilterChain)
+{
+	DataGroupBuilder inputBuilder;
+	inputBuilder.addPose(SurgSim::DataStructures::Names::POSE);
+	inputBuilder.addBoolean("button");
+	DataGroup input = inputBuilder.createData();
+	input.booleans().set("button", true);
+
+	DataGroupBuilder outputBuilder;
+	outputBuilder.addVector(SurgSim::DataStructures::Names::FORCE);
+	outputBuilder.addVector(SurgSim::DataStructures::Names::TORQUE);
+	outputBuilder.addMatrix(SurgSim::DataStructures::Names::SPRING_JACOBIAN);
+	outputBuilder.addPose(SurgSim::DataStructures::Names::INPUT_POSE);
+	DataGroup output = outputBuilder.createData();
+	output.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(1.0, 2.0, 3.0));
+	output.vectors().set(SurgSim::DataStructures::Names::TORQUE, Vector3d(4.0, 5.0, 6.0));
+	output.matrices().set(SurgSim::DataStructures::Names::SPRING_JACOBIAN,
+		SurgSim::DataStructures::DataGroup::DynamicMatrixType::Random(6, 6));
+	output.poses().set(SurgSim::DataStructures::Names::INPUT_POSE, RigidTransform3d::Identity());
+
+	// The filters connected one to the next
+	Filters connected;
+	connected.device->initializeInput("device", input);
+	ASSERT_TRUE(connected.device->addInputConsumer(connected.integrator));
+	ASSERT_TRUE(connected.integrator->addInputConsumer(connected.transform));
+	ASSERT_TRUE(connected.transform->addInputConsumer(connected.scale));
+	ASSERT_TRUE(connected.scale->addInputConsumer(connected.inputOutput));
+	ASSERT_TRUE(connected.device->setOutputProducer(connected.integrator));
+	ASSERT_TRUE(connected.integrator->setOutputProducer(connected.transform));
+	ASSERT_TRUE(connected.transform->setOutputProducer(connected.scale));
+	ASSERT_TRUE(connected.scale->setOutputProducer(connected.inputOutput));
+	connected.inputOutput->m_output.setValue(output);
+
+	// The same filters run as one chain by the last one
+	Filters chained;
+	EXPECT_THROW(chained.transform->setFilterChain(std::vector<DeviceFilter*>(1, chained.scale.get())),
+		SurgSim::Framework::AssertionFailure);
+	std::vector<DeviceFilter*> chain;
+	chain.push_back(chained.integrator.get());
+	chain.push_back(chained.transform.get());
+	chain.push_back(chained.scale.get());
+	chained.scale->setFilterChain(chain);
+	chained.device->initializeInput("device", input);
+	ASSERT_TRUE(chained.device->addInputConsumer(chained.scale));
+	ASSERT_TRUE(chained.scale->addInputConsumer(chained.inputOutput));
+	ASSERT_TRUE(chained.device->setOutputProducer(chained.scale));
+	ASSERT_TRUE(chained.scale->setOutputProducer(chained.inputOutput));
+	chained.inputOutput->m_output.setValue(output);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		input.poses().set(SurgSim::DataStructures::Names::POSE, SurgSim::Math::makeRigidTransform(
+			SurgSim::Math::makeRotationQuaternion(0.1 * i, Vector3d(1.0, 0.0, 0.0)), Vector3d(0.1, 0.2, 0.3 * i)));
+		connected.device->handleInput("device", input);
+		chained.device->handleInput("device", input);
+
+		const DataGroup& expected = connected.inputOutput->m_lastReceivedInput;
+		const DataGroup& actual = chained.inputOutput->m_lastReceivedInput;
+		RigidTransform3d expectedPose;
+		RigidTransform3d actualPose;
+		ASSERT_TRUE(expected.poses().get(SurgSim::DataStructures::Names::POSE, &expectedPose));
+		ASSERT_TRUE(actual.poses().get(SurgSim::DataStructures::Names::POSE, &actualPose));
+		EXPECT_TRUE(expectedPose.isApprox(actualPose));
+		EXPECT_TRUE(actual.vectors().hasData(SurgSim::DataStructures::Names::LINEAR_VELOCITY));
+		EXPECT_TRUE(actual.vectors().hasData(SurgSim::DataStructures::Names::ANGULAR_VELOCITY));
+		bool button = false;
+		EXPECT_TRUE(actual.booleans().get("button", &button));
+		EXPECT_TRUE(button);
+
+		DataGroup expectedOutput;
+		DataGroup actualOutput;
+		ASSERT_TRUE(connected.device->requestOutput("device", &expectedOutput));
+		ASSERT_TRUE(chained.device->requestOutput("device", &actualOutput));
+		Vector3d expectedVector;
+		Vector3d actualVector;
+		ASSERT_TRUE(expectedOutput.vectors().get(SurgSim::DataStructures::Names::FORCE, &expectedVector));
+		ASSERT_TRUE(actualOutput.vectors().get(SurgSim::DataStructures::Names::FORCE, &actualVector));
+		EXPECT_TRUE(expectedVector.isApprox(actualVector));
+		ASSERT_TRUE(expectedOutput.vectors().get(SurgSim::DataStructures::Names::TORQUE, &expectedVector));
+		ASSERT_TRUE(actualOutput.vectors().get(SurgSim::DataStructures::Names::TORQUE, &actualVector));
+		EXPECT_TRUE(expectedVector.isApprox(actualVector));
+		DataGroup::DynamicMatrixType expectedMatrix;
+		DataGroup::DynamicMatrixType actualMatrix;
+		ASSERT_TRUE(expectedOutput.matrices().get(SurgSim::DataStructures::Names::SPRING_JACOBIAN, &expectedMatrix));
+		ASSERT_TRUE(actualOutput.matrices().get(SurgSim::DataStructures::Names::SPRING_JACOBIAN, &actualMatrix));
+		EXPECT_TRUE(expectedMatrix.isApprox(actualMatrix));
+		ASSERT_TRUE(expectedOutput.poses().get(SurgSim::DataStructures::Names::INPUT_POSE, &expectedPose));
+		ASSERT_TRUE(actualOutput.poses().get(SurgSim::DataStructures::Names::INPUT_POSE, &actualPose));
+		EXPECT_TRUE(expectedPose.isApprox(actualPose));
+	}
+}
@@ -0,0 +1,136 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Tests for the InputRecorder class.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/DeviceFilters/FilteredDevice.h"
+#include "SurgSim/Devices/DeviceFilters/InputRecorder.h"
+#include "SurgSim/Devices/IdentityPoseDevice/IdentityPoseDevice.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Input/InputLog.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+#include "SurgSim/Testing/MockInputOutput.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Devices::FilteredDevice;
+using SurgSim::Devices::IdentityPoseDevice;
+using SurgSim::Devices::InputRecorder;
+using SurgSim::Input::InputLogReader;
+using SurgSim::Math::makeRigidTranslation;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Testing::MockInputOutput;
+
+namespace
+{
+const std::string FILE_NAME = "InputRecorderTest.log";
+}
+
+TEST(InputRecorderTest, Constructor)
+{
+	EXPECT_NO_THROW(InputRecorder recorder("recorder"));
+}
+
+TEST(InputRecorderTest, MissingFile)
+{
+	InputRecorder recorder("recorder");
+	recorder.setFileName("");
+	EXPECT_FALSE(recorder.initialize());
+	EXPECT_FALSE(recorder.isInitialized());
+}
+
+TEST(InputRecorderTest, Record)
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	DataGroup data = builder.createData();
+	data.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(1.0, 0.0, 0.0)));
+
+	{
+		auto recorder = std::make_shared<InputRecorder>("recorder");
+		recorder->setFileName(FILE_NAME);
+		EXPECT_EQ(FILE_NAME, recorder->getFileName());
+		ASSERT_TRUE(recorder->initialize());
+		EXPECT_THROW(recorder->setFileName("other.log"), SurgSim::Framework::AssertionFailure);
+
+		// The input passes through
+		recorder->initializeInput("device", data);
+		auto consumer = std::make_shared<MockInputOutput>();
+		recorder->addInputConsumer(consumer);
+		data.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(2.0, 0.0, 0.0)));
+		recorder->handleInput("device", data);
+
+		RigidTransform3d pose;
+		ASSERT_TRUE(consumer->m_lastReceivedInput.poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		EXPECT_TRUE(pose.isApprox(makeRigidTranslation(Vector3d(2.0, 0.0, 0.0))));
+		EXPECT_EQ(0u, recorder->getDroppedCount());
+	}
+
+	{
+		InputLogReader reader(FILE_NAME);
+		ASSERT_TRUE(reader.isValid());
+		RigidTransform3d pose;
+
+		ASSERT_TRUE(reader.readNext());
+		EXPECT_DOUBLE_EQ(0.0, reader.getTime());
+		ASSERT_TRUE(reader.getData().poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		EXPECT_TRUE(pose.isApprox(makeRigidTranslation(Vector3d(1.0, 0.0, 0.0))));
+
+		ASSERT_TRUE(reader.readNext());
+		EXPECT_LE(0.0, reader.getTime());
+		ASSERT_TRUE(reader.getData().poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		EXPECT_TRUE(pose.isApprox(makeRigidTranslation(Vector3d(2.0, 0.0, 0.0))));
+
+		EXPECT_FALSE(reader.readNext());
+	}
+	std::remove(FILE_NAME.c_str());
+}
+
+TEST(InputRecorderTest, FilteredDevice)
+{
+	{
+		// The FilteredDevice initializes the input of the recorder before it initializes the recorder
+		auto recorder = std::make_shared<InputRecorder>("recorder");
+		recorder->setFileName(FILE_NAME);
+		auto device = std::make_shared<FilteredDevice>("device");
+		device->setDevice(std::make_shared<IdentityPoseDevice>("identity"));
+		device->addFilter(recorder);
+		ASSERT_TRUE(device->initialize());
+		EXPECT_TRUE(recorder->isInitialized());
+	}
+
+	{
+		InputLogReader reader(FILE_NAME);
+		ASSERT_TRUE(reader.isValid());
+		RigidTransform3d pose;
+
+		ASSERT_TRUE(reader.readNext());
+		EXPECT_DOUBLE_EQ(0.0, reader.getTime());
+		ASSERT_TRUE(reader.getData().poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		EXPECT_TRUE(pose.isApprox(RigidTransform3d::Identity()));
+
+		EXPECT_FALSE(reader.readNext());
+	}
+	std::remove(FILE_NAME.c_str());
+}
@@ -0,0 +1,168 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Tests for the LocalContactModel class.
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/DeviceFilters/LocalContactModel.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Math/Matrix.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+#include "SurgSim/Testing/MockInputOutput.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Devices::LocalContactModel;
+using SurgSim::Math::makeRigidTranslation;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Testing::MockInputOutput;
+
+namespace
+{
+const double ERROR_EPSILON = 1e-9;
+
+/// \return Input data with a pose.
+DataGroup makeInputData(const RigidTransform3d& pose)
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	DataGroup data = builder.createData();
+	data.poses().set(SurgSim::DataStructures::Names::POSE, pose);
+	return data;
+}
+
+/// \return Output data with a force, a torque, the input pose and a contact model made of one floor plane at z = 0,
+/// touched by the point (0.1, 0, 0) of the tool.
+DataGroup makeOutputData(const RigidTransform3d& inputPose)
+{
+	DataGroupBuilder builder;
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	builder.addVector(SurgSim::DataStructures::Names::TORQUE);
+	builder.addPose(SurgSim::DataStructures::Names::INPUT_POSE);
+	builder.addMatrix(SurgSim::DataStructures::Names::CONTACT_MODEL);
+	DataGroup data = builder.createData();
+
+	SurgSim::DataStructures::DataGroup::DynamicMatrixType contactModel(1, 8);
+	contactModel << 0.0, 0.0, 1.0, 0.0, 100.0, 0.1, 0.0, 0.0;
+	data.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(1.0, 2.0, 3.0));
+	data.vectors().set(SurgSim::DataStructures::Names::TORQUE, Vector3d(-1.0, -2.0, -3.0));
+	data.poses().set(SurgSim::DataStructures::Names::INPUT_POSE, inputPose);
+	data.matrices().set(SurgSim::DataStructures::Names::CONTACT_MODEL, contactModel);
+	return data;
+}
+}
+
+TEST(LocalContactModelTest, Constructor)
+{
+	EXPECT_NO_THROW(LocalContactModel filter("filter"));
+}
+
+TEST(LocalContactModelTest, NoContactModel)
+{
+	auto filter = std::make_shared<LocalContactModel>("filter");
+	ASSERT_TRUE(filter->initialize());
+	filter->initializeInput("device", makeInputData(makeRigidTranslation(Vector3d(0.0, 0.0, -0.5))));
+
+	// Without a contact model the output passes through.
+	DataGroupBuilder builder;
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	DataGroup data = builder.createData();
+	data.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(1.0, 2.0, 3.0));
+	auto producer = std::make_shared<MockInputOutput>();
+	producer->m_output.setValue(data);
+	filter->setOutputProducer(producer);
+
+	DataGroup actualData;
+	ASSERT_TRUE(filter->requestOutput("device", &actualData));
+	Vector3d force;
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 3.0), ERROR_EPSILON));
+
+	// Without a pose from the device the output passes through.
+	auto otherFilter = std::make_shared<LocalContactModel>("otherFilter");
+	ASSERT_TRUE(otherFilter->initialize());
+	auto otherProducer = std::make_shared<MockInputOutput>();
+	otherProducer->m_output.setValue(makeOutputData(RigidTransform3d::Identity()));
+	otherFilter->setOutputProducer(otherProducer);
+	DataGroup otherData;
+	ASSERT_TRUE(otherFilter->requestOutput("device", &otherData));
+	ASSERT_TRUE(otherData.vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 3.0), ERROR_EPSILON));
+}
+
+TEST(LocalContactModelTest, Penetration)
+{
+	auto filter = std::make_shared<LocalContactModel>("filter");
+	ASSERT_TRUE(filter->initialize());
+	DataGroup input = makeInputData(RigidTransform3d::Identity());
+	filter->initializeInput("device", input);
+
+	// The physics saw the tool 1 cm into the floor.
+	auto producer = std::make_shared<MockInputOutput>();
+	producer->m_output.setValue(makeOutputData(makeRigidTranslation(Vector3d(0.0, 0.0, -0.01))));
+	filter->setOutputProducer(producer);
+
+	// At the input pose, the output is unchanged.
+	input.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(0.0, 0.0, -0.01)));
+	filter->handleInput("device", input);
+	DataGroup actualData;
+	ASSERT_TRUE(filter->requestOutput("device", &actualData));
+	Vector3d force;
+	Vector3d torque;
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::TORQUE, &torque));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 3.0), ERROR_EPSILON));
+	EXPECT_TRUE(torque.isApprox(Vector3d(-1.0, -2.0, -3.0), ERROR_EPSILON));
+
+	// Pushing 2 cm further adds the force of the extra penetration, at the point of the tool.
+	input.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(0.0, 0.0, -0.03)));
+	filter->handleInput("device", input);
+	ASSERT_TRUE(filter->requestOutput("device", &actualData));
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::TORQUE, &torque));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 5.0), ERROR_EPSILON));
+	EXPECT_TRUE(torque.isApprox(Vector3d(-1.0, -2.0 - 0.2, -3.0), ERROR_EPSILON));
+
+	// Moving out of the contact is left to the physics.
+	input.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(0.0, 0.0, 0.01)));
+	filter->handleInput("device", input);
+	ASSERT_TRUE(filter->requestOutput("device", &actualData));
+	ASSERT_TRUE(actualData.vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 3.0), ERROR_EPSILON));
+}
+
+TEST(LocalContactModelTest, BadContactModel)
+{
+	auto filter = std::make_shared<LocalContactModel>("filter");
+	ASSERT_TRUE(filter->initialize());
+	filter->initializeInput("device", makeInputData(RigidTransform3d::Identity()));
+
+	DataGroup data = makeOutputData(RigidTransform3d::Identity());
+	data.matrices().set(SurgSim::DataStructures::Names::CONTACT_MODEL,
+						SurgSim::DataStructures::DataGroup::DynamicMatrixType::Zero(1, 6));
+	auto producer = std::make_shared<MockInputOutput>();
+	producer->m_output.setValue(data);
+	filter->setOutputProducer(producer);
+
+	DataGroup actualData;
+	EXPECT_THROW(filter->requestOutput("device", &actualData), SurgSim::Framework::AssertionFailure);
+}
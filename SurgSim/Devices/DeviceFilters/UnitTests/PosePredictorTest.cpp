@@ -0,0 +1,239 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Tests for the PosePredictor class.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/DeviceFilters/PosePredictor.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Devices::PosePredictor;
+using SurgSim::Math::makeRigidTransform;
+using SurgSim::Math::makeRotationQuaternion;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+const double TIME_STEP = 1.0 / 60.0;
+
+DataGroup buildInputData()
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	builder.addScalar(SurgSim::DataStructures::Names::TIMESTAMP);
+	builder.addBoolean("extraData");
+	DataGroup data = builder.createData();
+	data.poses().set(SurgSim::DataStructures::Names::POSE, RigidTransform3d::Identity());
+	data.scalars().set(SurgSim::DataStructures::Names::TIMESTAMP, 0.0);
+	data.booleans().set("extraData", true);
+	return data;
+}
+
+/// Filter the poses of a motion sampled at 60 Hz.
+/// \param predictor The filter.
+/// \param motion The pose as a function of time.
+/// \param numSamples The number of samples.
+/// \param [out] data The filtered data of the last sample.
+template <class Motion>
+void filterMotion(PosePredictor* predictor, const Motion& motion, int numSamples, DataGroup* data)
+{
+	DataGroup input = buildInputData();
+	input.poses().set(SurgSim::DataStructures::Names::POSE, motion(0.0));
+	data->resetAll();
+	predictor->initializeInputFilter("device", input, data);
+	for (int i = 1; i < numSamples; ++i)
+	{
+		const double time = i * TIME_STEP;
+		data->poses().set(SurgSim::DataStructures::Names::POSE, motion(time));
+		data->scalars().set(SurgSim::DataStructures::Names::TIMESTAMP, time);
+		predictor->filterInputInPlace("device", data);
+	}
+}
+};
+
+TEST(PosePredictorTest, Construct)
+{
+	PosePredictor predictor("Predictor");
+	EXPECT_EQ("Predictor", predictor.getName());
+	EXPECT_EQ(0.0, predictor.getHorizon());
+	EXPECT_EQ(SurgSim::Devices::MOTION_MODEL_CONSTANT_VELOCITY, predictor.getMotionModel());
+	EXPECT_LT(0.0, predictor.getLinearMeasurementNoise());
+	EXPECT_LT(0.0, predictor.getAngularMeasurementNoise());
+}
+
+TEST(PosePredictorTest, Accessors)
+{
+	PosePredictor predictor("Predictor");
+	predictor.setHorizon(0.05);
+	EXPECT_EQ(0.05, predictor.getHorizon());
+	predictor.setMotionModel(SurgSim::Devices::MOTION_MODEL_CONSTANT_ACCELERATION);
+	EXPECT_EQ(SurgSim::Devices::MOTION_MODEL_CONSTANT_ACCELERATION, predictor.getMotionModel());
+	predictor.setLinearProcessNoise(2.0);
+	EXPECT_EQ(2.0, predictor.getLinearProcessNoise());
+	predictor.setAngularProcessNoise(3.0);
+	EXPECT_EQ(3.0, predictor.getAngularProcessNoise());
+	predictor.setLinearMeasurementNoise(4.0);
+	EXPECT_EQ(4.0, predictor.getLinearMeasurementNoise());
+	predictor.setAngularMeasurementNoise(5.0);
+	EXPECT_EQ(5.0, predictor.getAngularMeasurementNoise());
+
+	EXPECT_THROW(predictor.setHorizon(-0.1), SurgSim::Framework::AssertionFailure);
+	EXPECT_THROW(predictor.setLinearProcessNoise(-1.0), SurgSim::Framework::AssertionFailure);
+	EXPECT_THROW(predictor.setAngularMeasurementNoise(0.0), SurgSim::Framework::AssertionFailure);
+
+	predictor.setValue("Horizon", 0.1);
+	EXPECT_EQ(0.1, predictor.getHorizon());
+	predictor.setValue("MotionModel", SurgSim::Devices::MOTION_MODEL_CONSTANT_VELOCITY);
+	EXPECT_EQ(SurgSim::Devices::MOTION_MODEL_CONSTANT_VELOCITY, predictor.getMotionModel());
+}
+
+TEST(PosePredictorTest, AddVelocityDataEntries)
+{
+	PosePredictor predictor("Predictor");
+	const RigidTransform3d pose = makeRigidTransform(makeRotationQuaternion(0.3, Vector3d(Vector3d::UnitY())),
+		Vector3d(1.0, 2.0, 3.0));
+	DataGroup input = buildInputData();
+	input.poses().set(SurgSim::DataStructures::Names::POSE, pose);
+
+	DataGroup data;
+	predictor.initializeInputFilter("device", input, &data);
+	EXPECT_TRUE(data.booleans().hasData("extraData"));
+
+	// The first pose is taken as it is, with no velocity
+	RigidTransform3d actualPose;
+	ASSERT_TRUE(data.poses().get(SurgSim::DataStructures::Names::POSE, &actualPose));
+	EXPECT_TRUE(actualPose.isApprox(pose));
+	Vector3d velocity;
+	ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::LINEAR_VELOCITY, &velocity));
+	EXPECT_TRUE(velocity.isZero());
+	ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::ANGULAR_VELOCITY, &velocity));
+	EXPECT_TRUE(velocity.isZero());
+}
+
+TEST(PosePredictorTest, ConstantVelocity)
+{
+	const Vector3d linearVelocity(0.2, -0.1, 0.05);
+	const double angularVelocity = 2.0;
+	auto motion = [&](double time)
+	{
+		return makeRigidTransform(makeRotationQuaternion(angularVelocity * time, Vector3d(Vector3d::UnitZ())),
+			Vector3d(Vector3d(0.1, 0.2, 0.3) + linearVelocity * time));
+	};
+
+	const double horizon = 0.05;
+	const int numSamples = 120;
+	const double lastTime = (numSamples - 1) * TIME_STEP;
+	for (auto model : {SurgSim::Devices::MOTION_MODEL_CONSTANT_VELOCITY,
+		SurgSim::Devices::MOTION_MODEL_CONSTANT_ACCELERATION})
+	{
+		SCOPED_TRACE(model);
+		PosePredictor predictor("Predictor");
+		predictor.setMotionModel(model);
+		predictor.setHorizon(horizon);
+		DataGroup data;
+		// Two seconds of rotation go around more than half a turn, through the double cover of the quaternions
+		filterMotion(&predictor, motion, numSamples, &data);
+
+		RigidTransform3d pose;
+		ASSERT_TRUE(data.poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		const RigidTransform3d expectedPose = motion(lastTime + horizon);
+		EXPECT_TRUE(pose.translation().isApprox(expectedPose.translation(), 1e-4));
+		EXPECT_TRUE(pose.linear().isApprox(expectedPose.linear(), 1e-4));
+
+		Vector3d velocity;
+		ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::LINEAR_VELOCITY, &velocity));
+		EXPECT_TRUE(velocity.isApprox(linearVelocity, 1e-3));
+		ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::ANGULAR_VELOCITY, &velocity));
+		EXPECT_TRUE(velocity.isApprox(Vector3d(0.0, 0.0, angularVelocity), 1e-3));
+
+		// Without a horizon the filtered pose is the measured one
+		predictor.setHorizon(0.0);
+		data.scalars().set(SurgSim::DataStructures::Names::TIMESTAMP, lastTime + TIME_STEP);
+		data.poses().set(SurgSim::DataStructures::Names::POSE, motion(lastTime + TIME_STEP));
+		predictor.filterInputInPlace("device", &data);
+		ASSERT_TRUE(data.poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+		EXPECT_TRUE(pose.isApprox(motion(lastTime + TIME_STEP), 1e-4));
+	}
+}
+
+TEST(PosePredictorTest, ConstantAcceleration)
+{
+	const Vector3d acceleration(0.0, 0.0, -1.0);
+	auto motion = [&](double time)
+	{
+		return makeRigidTransform(makeRotationQuaternion(0.5 * time * time, Vector3d(Vector3d::UnitX())),
+			Vector3d(0.5 * acceleration * time * time));
+	};
+
+	const double horizon = 0.05;
+	const int numSamples = 120;
+	const double lastTime = (numSamples - 1) * TIME_STEP;
+
+	PosePredictor predictor("Predictor");
+	predictor.setMotionModel(SurgSim::Devices::MOTION_MODEL_CONSTANT_ACCELERATION);
+	predictor.setHorizon(horizon);
+	DataGroup data;
+	filterMotion(&predictor, motion, numSamples, &data);
+
+	RigidTransform3d pose;
+	ASSERT_TRUE(data.poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+	const RigidTransform3d expectedPose = motion(lastTime + horizon);
+	EXPECT_TRUE(pose.translation().isApprox(expectedPose.translation(), 1e-3));
+	EXPECT_TRUE(pose.linear().isApprox(expectedPose.linear(), 1e-3));
+
+	Vector3d velocity;
+	ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::LINEAR_VELOCITY, &velocity));
+	EXPECT_TRUE(velocity.isApprox(acceleration * (lastTime + horizon), 1e-2));
+	ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::ANGULAR_VELOCITY, &velocity));
+	EXPECT_TRUE(velocity.isApprox(Vector3d::UnitX() * (lastTime + horizon), 1e-2));
+}
+
+TEST(PosePredictorTest, Reset)
+{
+	PosePredictor predictor("Predictor");
+	predictor.setHorizon(0.1);
+	auto motion = [](double time)
+	{
+		return makeRigidTransform(SurgSim::Math::Quaterniond::Identity(), Vector3d(time, 0.0, 0.0));
+	};
+	DataGroup data;
+	filterMotion(&predictor, motion, 30, &data);
+
+	// After a reset, the next pose is taken as it is, e.g. after the device lost tracking
+	predictor.reset();
+	const RigidTransform3d pose = makeRigidTransform(SurgSim::Math::Quaterniond::Identity(), Vector3d(-5.0, 0.0, 0.0));
+	data.poses().set(SurgSim::DataStructures::Names::POSE, pose);
+	data.scalars().set(SurgSim::DataStructures::Names::TIMESTAMP, 10.0);
+	predictor.filterInputInPlace("device", &data);
+
+	RigidTransform3d actualPose;
+	ASSERT_TRUE(data.poses().get(SurgSim::DataStructures::Names::POSE, &actualPose));
+	EXPECT_TRUE(actualPose.isApprox(pose));
+	Vector3d velocity;
+	ASSERT_TRUE(data.vectors().get(SurgSim::DataStructures::Names::LINEAR_VELOCITY, &velocity));
+	EXPECT_TRUE(velocity.isZero());
+}
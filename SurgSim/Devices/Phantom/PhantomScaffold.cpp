@@ -600,6 +600,7 @@ void PhantomScaffold::setInputData(DeviceData* info)
 		(info->buttonsBuffer & HD_DEVICE_BUTTON_3) != 0);
 	inputData.booleans().set(SurgSim::DataStructures::Names::BUTTON_4,
 		(info->buttonsBuffer & HD_DEVICE_BUTTON_4) != 0);
+	info->deviceObject->stampInput();
 }
 
 bool PhantomScaffold::runHapticFrame()
@@ -685,6 +686,8 @@ SurgSim::DataStructures::DataGroup PhantomScaffold::buildDeviceInputData()
 	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_2);
 	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_3);
 	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_4);
+	builder.addScalar(SurgSim::DataStructures::Names::TIMESTAMP);
+	builder.addInteger(SurgSim::DataStructures::Names::SEQUENCE_NUMBER);
 	return builder.createData();
 }
 
@@ -0,0 +1,208 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/ReplayDevice/ReplayDevice.h"
+
+#include <boost/thread/locks.hpp>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupCopier.h"
+#include "SurgSim/Devices/ReplayDevice/ReplayThread.h"
+#include "SurgSim/Framework/Log.h"
+#include "SurgSim/Input/InputLog.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::ReplayDevice, ReplayDevice);
+
+ReplayDevice::ReplayDevice(const std::string& uniqueName) :
+	Input::CommonDevice(uniqueName),
+	m_realTime(true),
+	m_rate(1000.0),
+	m_hasSample(false),
+	m_time(0.0),
+	m_initialized(false)
+{
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(ReplayDevice, std::string, FileName, getFileName, setFileName);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(ReplayDevice, bool, RealTime, isRealTime, setRealTime);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(ReplayDevice, double, Rate, getRate, setRate);
+}
+
+ReplayDevice::~ReplayDevice()
+{
+	if (isInitialized())
+	{
+		finalize();
+	}
+}
+
+void ReplayDevice::setFileName(const std::string& fileName)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The file of " << getName() << " cannot be set once it is initialized.";
+	m_fileName = fileName;
+}
+
+const std::string& ReplayDevice::getFileName() const
+{
+	return m_fileName;
+}
+
+void ReplayDevice::setRealTime(bool realTime)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The play back of " << getName() << " cannot be changed once initialized.";
+	m_realTime = realTime;
+}
+
+bool ReplayDevice::isRealTime() const
+{
+	return m_realTime;
+}
+
+void ReplayDevice::setRate(double rate)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The rate of " << getName() << " cannot be set once it is initialized.";
+	SURGSIM_ASSERT(rate > 0.0) << "The rate of " << getName() << " has to be positive.";
+	m_rate = rate;
+}
+
+double ReplayDevice::getRate() const
+{
+	return m_rate;
+}
+
+bool ReplayDevice::initialize()
+{
+	SURGSIM_ASSERT(!isInitialized()) << getName() << " already initialized.";
+
+	auto logger = Framework::Logger::getLogger("Devices/Replay");
+	std::unique_ptr<Input::InputLogReader> log(new Input::InputLogReader(m_fileName));
+	if (!log->readNext())
+	{
+		SURGSIM_LOG_SEVERE(logger) << getName() << " could not read any input from '" << m_fileName << "'.";
+		return false;
+	}
+
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		m_log = std::move(log);
+		getInputData() = m_log->getData();
+		m_copier.reset();
+		m_hasSample = true;
+		m_time = m_log->getTime();
+		m_initialized = true;
+	}
+
+	// The consumers added before only know the layout of the input now, e.g. the filters of a FilteredDevice
+	if (initializeInputConsumers())
+	{
+		startThread();
+	}
+	SURGSIM_LOG_INFO(logger) << "Device " << getName() << " initialized.";
+	return true;
+}
+
+bool ReplayDevice::addInputConsumer(std::shared_ptr<Input::InputConsumerInterface> inputConsumer)
+{
+	if (!CommonDevice::addInputConsumer(std::move(inputConsumer)))
+	{
+		return false;
+	}
+
+	startThread();
+	return true;
+}
+
+bool ReplayDevice::isInitialized() const
+{
+	return m_initialized;
+}
+
+bool ReplayDevice::finalize()
+{
+	SURGSIM_ASSERT(isInitialized()) << getName() << " is not initialized, cannot finalize.";
+
+	if (m_thread != nullptr)
+	{
+		m_thread->stop();
+		m_thread.reset();
+	}
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_log.reset();
+	m_copier.reset();
+	m_hasSample = false;
+	m_initialized = false;
+	SURGSIM_LOG_INFO(Framework::Logger::getLogger("Devices/Replay")) << "Device " << getName() << " finalized.";
+	return true;
+}
+
+void ReplayDevice::startThread()
+{
+	if (m_realTime && isInitialized() && m_thread == nullptr)
+	{
+		m_thread.reset(new ReplayThread(this));
+		m_thread->start();
+	}
+}
+
+void ReplayDevice::advance(double dt)
+{
+	SURGSIM_ASSERT(!m_realTime) << getName() << " plays back in real time, it cannot be advanced.";
+	SURGSIM_ASSERT(isInitialized()) << getName() << " is not initialized, it cannot be advanced.";
+	pushUntil(getTime() + dt);
+}
+
+double ReplayDevice::getTime() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_time;
+}
+
+bool ReplayDevice::isFinished() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return !m_hasSample;
+}
+
+void ReplayDevice::pushUntil(double time)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	while (m_hasSample && m_log->getTime() <= time)
+	{
+		if (m_copier != nullptr)
+		{
+			m_copier->copy(m_log->getData(), &getInputData());
+		}
+		else
+		{
+			getInputData() = m_log->getData();
+		}
+		pushInput();
+
+		m_hasSample = m_log->readNext();
+		if (m_hasSample && m_log->hasNewLayout())
+		{
+			// The input data keeps the layout of the first sample, the entries with the same names are copied
+			m_copier.reset(new DataStructures::DataGroupCopier(m_log->getData(), &getInputData()));
+		}
+	}
+	m_time = time;
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
@@ -0,0 +1,159 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_REPLAYDEVICE_REPLAYDEVICE_H
+#define SURGSIM_DEVICES_REPLAYDEVICE_REPLAYDEVICE_H
+
+#include <boost/thread/mutex.hpp>
+#include <memory>
+#include <string>
+
+#include "SurgSim/Input/CommonDevice.h"
+
+namespace SurgSim
+{
+namespace DataStructures
+{
+class DataGroupCopier;
+}
+
+namespace Input
+{
+class InputLogReader;
+}
+
+namespace Devices
+{
+class ReplayThread;
+
+SURGSIM_STATIC_REGISTRATION(ReplayDevice);
+
+/// A device that plays back the input recorded by an InputRecorder, so that a session can be run again without the
+/// hardware, e.g. to profile or to test a new build against real user input.
+///
+/// The input data of the device is the first sample of the log, the input consumers added before the device is
+/// initialized get it once the log is opened.  Every sample of the log is pushed to the consumers, in order, either:
+/// - in real time (the default), by a thread that pushes the samples at the time they were recorded, starting once
+///   the device is initialized and has an input consumer, or
+/// - in lockstep, when advance() is called, e.g. once per update by a behavior run by the physics manager while the
+///   Runtime is stepped, so that the same input reaches the same physics update on every run, as fast as the
+///   simulation can go.
+///
+/// \sa SurgSim::Devices::InputRecorder, SurgSim::Input::InputLogReader
+class ReplayDevice : public Input::CommonDevice
+{
+public:
+	/// Constructor.
+	/// \param uniqueName A unique name for the device that will be used by the application.
+	explicit ReplayDevice(const std::string& uniqueName);
+
+	SURGSIM_CLASSNAME(SurgSim::Devices::ReplayDevice);
+
+	/// Destructor.
+	virtual ~ReplayDevice();
+
+	/// Set the log to play back.
+	/// \param fileName The name of the file written by an InputRecorder.
+	/// \exception Asserts if the device is already initialized.
+	void setFileName(const std::string& fileName);
+
+	/// \return The name of the log to play back.
+	const std::string& getFileName() const;
+
+	/// Set whether the samples are pushed at the time they were recorded, or when advance() is called.
+	/// \param realTime true to play back in real time.
+	/// \exception Asserts if the device is already initialized.
+	void setRealTime(bool realTime);
+
+	/// \return true if the samples are played back in real time.
+	bool isRealTime() const;
+
+	/// Set the rate at which the samples are checked for in real time, the samples recorded in between two checks
+	/// are pushed together.
+	/// \param rate The rate (in Hz).
+	/// \exception Asserts if the device is already initialized.
+	void setRate(double rate);
+
+	/// \return The rate at which the samples are checked for in real time (in Hz).
+	double getRate() const;
+
+	/// Opens the log, initializes the input of the consumers added before with its first sample, and starts playing
+	/// back the log in real time if there are consumers.
+	/// \return false if the log could not be read.
+	bool initialize() override;
+
+	/// Adds an input consumer, and starts playing back the log in real time if it is the first one.
+	bool addInputConsumer(std::shared_ptr<Input::InputConsumerInterface> inputConsumer) override;
+
+	bool isInitialized() const override;
+
+	/// Advance the play back, pushing the samples recorded up to the new time.
+	/// \param dt The time step (in s).
+	/// \exception Asserts if the play back is in real time.
+	void advance(double dt);
+
+	/// \return The time of the play back, since the first sample (in s).
+	double getTime() const;
+
+	/// \return true once all the samples have been pushed.
+	bool isFinished() const;
+
+private:
+	friend class ReplayThread;
+
+	bool finalize() override;
+
+	/// Start playing back in real time, if the device is initialized and the thread is not running yet.
+	void startThread();
+
+	/// Push the samples recorded up to a time.
+	/// \param time The time (in s).
+	void pushUntil(double time);
+
+	/// The mutex that protects the play back.
+	mutable boost::mutex m_mutex;
+
+	/// The name of the log.
+	std::string m_fileName;
+
+	/// Whether the log is played back in real time.
+	bool m_realTime;
+
+	/// The rate of the thread in real time.
+	double m_rate;
+
+	/// The log.
+	std::unique_ptr<Input::InputLogReader> m_log;
+
+	/// Whether the log has a sample that has not been pushed yet.
+	bool m_hasSample;
+
+	/// The time of the play back.
+	double m_time;
+
+	/// Copies the samples into the input data once the layout of the log changed.
+	std::unique_ptr<DataStructures::DataGroupCopier> m_copier;
+
+	/// The thread pushing the samples in real time.
+	std::unique_ptr<ReplayThread> m_thread;
+
+	/// true if initialized and not finalized.
+	bool m_initialized;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_REPLAYDEVICE_REPLAYDEVICE_H
@@ -0,0 +1,57 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/ReplayDevice/ReplayThread.h"
+
+#include "SurgSim/Devices/ReplayDevice/ReplayDevice.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+ReplayThread::ReplayThread(ReplayDevice* device) :
+	BasicThread("Replay thread"),
+	m_device(device),
+	m_startTime(0.0)
+{
+	setRate(m_device->getRate());
+}
+
+ReplayThread::~ReplayThread()
+{
+}
+
+bool ReplayThread::doInitialize()
+{
+	return true;
+}
+
+bool ReplayThread::doStartUp()
+{
+	m_startTime = m_device->getTime();
+	m_start = boost::chrono::steady_clock::now();
+	return true;
+}
+
+bool ReplayThread::doUpdate(double dt)
+{
+	m_device->pushUntil(m_startTime +
+		boost::chrono::duration<double>(boost::chrono::steady_clock::now() - m_start).count());
+	return !m_device->isFinished();
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
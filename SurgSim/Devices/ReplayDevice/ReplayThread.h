@@ -0,0 +1,60 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_REPLAYDEVICE_REPLAYTHREAD_H
+#define SURGSIM_DEVICES_REPLAYDEVICE_REPLAYTHREAD_H
+
+#include <boost/chrono.hpp>
+
+#include "SurgSim/Framework/BasicThread.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+class ReplayDevice;
+
+/// A class implementing the thread context for playing back the input log of a ReplayDevice in real time.
+/// The thread ends once all the samples have been pushed.
+/// \sa SurgSim::Devices::ReplayDevice
+class ReplayThread : public SurgSim::Framework::BasicThread
+{
+public:
+	/// Constructor.
+	/// \param device The device, it has to outlive the thread.
+	explicit ReplayThread(ReplayDevice* device);
+
+	virtual ~ReplayThread();
+
+protected:
+	bool doInitialize() override;
+	bool doStartUp() override;
+	bool doUpdate(double dt) override;
+
+private:
+	/// The device.
+	ReplayDevice* m_device;
+
+	/// The time of the device when the thread started.
+	double m_startTime;
+
+	/// The wall clock time when the thread started.
+	boost::chrono::steady_clock::time_point m_start;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_REPLAYDEVICE_REPLAYTHREAD_H
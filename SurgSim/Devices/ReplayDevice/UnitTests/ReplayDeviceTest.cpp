@@ -0,0 +1,217 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Tests for the ReplayDevice class.
+
+#include <boost/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/DeviceFilters/FilteredDevice.h"
+#include "SurgSim/Devices/DeviceFilters/PoseTransform.h"
+#include "SurgSim/Devices/ReplayDevice/ReplayDevice.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Input/InputLog.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+#include "SurgSim/Testing/MockInputOutput.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Devices::FilteredDevice;
+using SurgSim::Devices::PoseTransform;
+using SurgSim::Devices::ReplayDevice;
+using SurgSim::Input::InputLogWriter;
+using SurgSim::Math::makeRigidTranslation;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Testing::MockInputOutput;
+
+namespace
+{
+const std::string FILE_NAME = "ReplayDeviceTest.log";
+
+/// Write a log with one sample every 10 ms, the pose of sample i is a translation of i along x.
+/// \param numSamples The number of samples.
+/// \param layoutChange The sample from which the data has another layout, with the pose and a button.
+void writeLog(int numSamples, int layoutChange)
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	DataGroup data = builder.createData();
+	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_1);
+	DataGroup otherData = builder.createData();
+
+	InputLogWriter writer;
+	ASSERT_TRUE(writer.open(FILE_NAME));
+	for (int i = 0; i < numSamples; ++i)
+	{
+		DataGroup& sample = (i < layoutChange) ? data : otherData;
+		sample.poses().set(SurgSim::DataStructures::Names::POSE,
+						   makeRigidTranslation(Vector3d(static_cast<double>(i), 0.0, 0.0)));
+		ASSERT_TRUE(writer.write(0.01 * i, sample));
+	}
+}
+
+double getLastX(const MockInputOutput& consumer)
+{
+	RigidTransform3d pose;
+	EXPECT_TRUE(consumer.m_lastReceivedInput.poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+	return pose.translation().x();
+}
+}
+
+TEST(ReplayDeviceTest, CanConstruct)
+{
+	EXPECT_NO_THROW({ReplayDevice device("MyReplayDevice");});
+}
+
+TEST(ReplayDeviceTest, Factory)
+{
+	std::shared_ptr<SurgSim::Input::DeviceInterface> device;
+	ASSERT_NO_THROW(device = SurgSim::Input::DeviceInterface::getFactory().create(
+								 "SurgSim::Devices::ReplayDevice", "Device"));
+	EXPECT_NE(nullptr, device);
+}
+
+TEST(ReplayDeviceTest, Properties)
+{
+	ReplayDevice device("MyReplayDevice");
+	EXPECT_TRUE(device.isRealTime());
+	device.setRealTime(false);
+	EXPECT_FALSE(device.isRealTime());
+	device.setRate(500.0);
+	EXPECT_DOUBLE_EQ(500.0, device.getRate());
+	EXPECT_THROW(device.setRate(0.0), SurgSim::Framework::AssertionFailure);
+	device.setFileName(FILE_NAME);
+	EXPECT_EQ(FILE_NAME, device.getFileName());
+}
+
+TEST(ReplayDeviceTest, MissingFile)
+{
+	ReplayDevice device("MyReplayDevice");
+	device.setFileName("NotAFile.log");
+	EXPECT_FALSE(device.initialize());
+	EXPECT_FALSE(device.isInitialized());
+}
+
+TEST(ReplayDeviceTest, Lockstep)
+{
+	writeLog(5, 3);
+
+	{
+		ReplayDevice device("MyReplayDevice");
+		device.setFileName(FILE_NAME);
+		device.setRealTime(false);
+		ASSERT_TRUE(device.initialize());
+		EXPECT_THROW(device.setFileName(FILE_NAME), SurgSim::Framework::AssertionFailure);
+
+		// The input data of the device is the first sample
+		auto consumer = std::make_shared<MockInputOutput>();
+		ASSERT_TRUE(device.addInputConsumer(consumer));
+		EXPECT_EQ(1, consumer->m_numTimesInitializedInput);
+		EXPECT_DOUBLE_EQ(0.0, getLastX(*consumer));
+		EXPECT_EQ(0, consumer->m_numTimesReceivedInput);
+
+		device.advance(0.0);
+		EXPECT_EQ(1, consumer->m_numTimesReceivedInput);
+		EXPECT_DOUBLE_EQ(0.0, getLastX(*consumer));
+
+		device.advance(0.015);
+		EXPECT_EQ(2, consumer->m_numTimesReceivedInput);
+		EXPECT_DOUBLE_EQ(1.0, getLastX(*consumer));
+		EXPECT_DOUBLE_EQ(0.015, device.getTime());
+		EXPECT_FALSE(device.isFinished());
+
+		// Every sample is pushed, the samples with another layout are copied into the data of the device
+		device.advance(1.0);
+		EXPECT_EQ(5, consumer->m_numTimesReceivedInput);
+		EXPECT_DOUBLE_EQ(4.0, getLastX(*consumer));
+		EXPECT_FALSE(consumer->m_lastReceivedInput.booleans().hasEntry(SurgSim::DataStructures::Names::BUTTON_1));
+		EXPECT_TRUE(device.isFinished());
+
+		device.advance(1.0);
+		EXPECT_EQ(5, consumer->m_numTimesReceivedInput);
+	}
+	std::remove(FILE_NAME.c_str());
+}
+
+TEST(ReplayDeviceTest, RealTime)
+{
+	writeLog(5, 5);
+
+	{
+		ReplayDevice device("MyReplayDevice");
+		device.setFileName(FILE_NAME);
+		ASSERT_TRUE(device.initialize());
+		EXPECT_THROW(device.advance(0.1), SurgSim::Framework::AssertionFailure);
+
+		// The play back starts with the first consumer
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+		EXPECT_FALSE(device.isFinished());
+		auto consumer = std::make_shared<MockInputOutput>();
+		ASSERT_TRUE(device.addInputConsumer(consumer));
+
+		const auto start = boost::chrono::steady_clock::now();
+		while (!device.isFinished() && boost::chrono::steady_clock::now() - start < boost::chrono::seconds(5))
+		{
+			boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+		}
+		const double duration = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+		ASSERT_TRUE(device.isFinished());
+		EXPECT_LE(0.035, duration);
+		EXPECT_EQ(5, consumer->m_numTimesReceivedInput);
+		EXPECT_DOUBLE_EQ(4.0, getLastX(*consumer));
+
+	}
+	std::remove(FILE_NAME.c_str());
+}
+
+TEST(ReplayDeviceTest, FilteredDevice)
+{
+	writeLog(5, 5);
+
+	{
+		// The filter is added to the device before it is initialized, and gets the first sample only then
+		auto device = std::make_shared<ReplayDevice>("MyReplayDevice");
+		device->setFileName(FILE_NAME);
+		auto filter = std::make_shared<PoseTransform>("Filter");
+		filter->setTranslationScale(2.0);
+		auto filteredDevice = std::make_shared<FilteredDevice>("FilteredDevice");
+		filteredDevice->setDevice(device);
+		filteredDevice->addFilter(filter);
+		ASSERT_TRUE(filteredDevice->initialize());
+
+		auto consumer = std::make_shared<MockInputOutput>();
+		ASSERT_TRUE(filteredDevice->addInputConsumer(consumer));
+		EXPECT_EQ(1, consumer->m_numTimesInitializedInput);
+		EXPECT_TRUE(consumer->m_lastReceivedInput.poses().hasEntry(SurgSim::DataStructures::Names::POSE));
+
+		// The play back started with the initialization, since the device already had a consumer
+		const auto start = boost::chrono::steady_clock::now();
+		while (!device->isFinished() && boost::chrono::steady_clock::now() - start < boost::chrono::seconds(5))
+		{
+			boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+		}
+		ASSERT_TRUE(device->isFinished());
+		EXPECT_DOUBLE_EQ(8.0, getLastX(*consumer));
+	}
+	std::remove(FILE_NAME.c_str());
+}
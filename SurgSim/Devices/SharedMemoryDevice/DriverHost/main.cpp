@@ -0,0 +1,57 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Runs a device in its own process, handing its input and output over to a SharedMemoryDevice.
+/// Usage: SurgSimDriverHost <device file> <shared memory name>
+
+#include <iostream>
+#include <memory>
+
+#include "SurgSim/Devices/Devices.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDriverHost.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Input/DeviceInterface.h"
+
+using SurgSim::Devices::SharedMemoryDriverHost;
+
+int main(int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <device file> <shared memory name>" << std::endl;
+		return 1;
+	}
+
+	auto runtime = std::make_shared<SurgSim::Framework::Runtime>();
+	auto device = SurgSim::Devices::loadDevice(argv[1]);
+	if (device == nullptr)
+	{
+		std::cerr << "Could not initialize a device from " << argv[1] << std::endl;
+		return 1;
+	}
+
+	auto host = std::make_shared<SharedMemoryDriverHost>(argv[2]);
+	device->addInputConsumer(host);
+	device->setOutputProducer(host);
+
+	std::cout << "Hosting " << device->getName() << " in the shared memory " << argv[2] << "." << std::endl;
+	std::cout << "Press Enter to exit." << std::endl;
+	std::cin.get();
+
+	device->clearOutputProducer();
+	device->clearInputConsumers();
+	return 0;
+}
@@ -0,0 +1,186 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDevice.h"
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryRing.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryThread.h"
+#include "SurgSim/Framework/Log.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SURGSIM_REGISTER(SurgSim::Input::DeviceInterface, SurgSim::Devices::SharedMemoryDevice, SharedMemoryDevice);
+
+SharedMemoryDevice::SharedMemoryDevice(const std::string& uniqueName) :
+	Input::CommonDevice(uniqueName),
+	m_sharedMemoryName(uniqueName),
+	m_rate(1000.0),
+	m_isOutputRingFailed(false),
+	m_initialized(false)
+{
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SharedMemoryDevice, std::string, SharedMemoryName,
+									  getSharedMemoryName, setSharedMemoryName);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SharedMemoryDevice, double, Rate, getRate, setRate);
+}
+
+SharedMemoryDevice::~SharedMemoryDevice()
+{
+	if (isInitialized())
+	{
+		finalize();
+	}
+}
+
+void SharedMemoryDevice::setSharedMemoryName(const std::string& name)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The shared memory of " << getName() << " cannot be set once initialized.";
+	m_sharedMemoryName = name;
+}
+
+const std::string& SharedMemoryDevice::getSharedMemoryName() const
+{
+	return m_sharedMemoryName;
+}
+
+void SharedMemoryDevice::setRate(double rate)
+{
+	SURGSIM_ASSERT(!isInitialized()) << "The rate of " << getName() << " cannot be set once it is initialized.";
+	SURGSIM_ASSERT(rate > 0.0) << "The rate of " << getName() << " has to be positive.";
+	m_rate = rate;
+}
+
+double SharedMemoryDevice::getRate() const
+{
+	return m_rate;
+}
+
+bool SharedMemoryDevice::initialize()
+{
+	SURGSIM_ASSERT(!isInitialized()) << getName() << " already initialized.";
+
+	auto logger = Framework::Logger::getLogger("Devices/SharedMemory");
+	m_inputRing = SharedMemoryRing::open(getInputRingName(m_sharedMemoryName));
+	if (m_inputRing == nullptr)
+	{
+		SURGSIM_LOG_SEVERE(logger) << getName() << " could not open the shared memory " << m_sharedMemoryName <<
+			", the driver needs to be running.";
+		return false;
+	}
+
+	DataStructures::DataGroup inputData = m_inputRing->createData();
+	m_inputRing->readLatest(&inputData);
+	getInputData() = std::move(inputData);
+	m_isOutputRingFailed = false;
+	m_initialized = true;
+
+	// The consumers added before only know the layout of the input now, e.g. the filters of a FilteredDevice
+	const bool hasInputConsumers = initializeInputConsumers();
+	if (hasInputConsumers || hasOutputProducer())
+	{
+		startThread();
+	}
+	SURGSIM_LOG_INFO(logger) << "Device " << getName() << " initialized.";
+	return true;
+}
+
+bool SharedMemoryDevice::addInputConsumer(std::shared_ptr<Input::InputConsumerInterface> inputConsumer)
+{
+	if (!CommonDevice::addInputConsumer(std::move(inputConsumer)))
+	{
+		return false;
+	}
+	startThread();
+	return true;
+}
+
+bool SharedMemoryDevice::setOutputProducer(std::shared_ptr<Input::OutputProducerInterface> outputProducer)
+{
+	if (!CommonDevice::setOutputProducer(std::move(outputProducer)))
+	{
+		return false;
+	}
+	startThread();
+	return true;
+}
+
+bool SharedMemoryDevice::isInitialized() const
+{
+	return m_initialized;
+}
+
+std::string SharedMemoryDevice::getInputRingName(const std::string& sharedMemoryName)
+{
+	return "SurgSim." + sharedMemoryName + ".input";
+}
+
+std::string SharedMemoryDevice::getOutputRingName(const std::string& sharedMemoryName)
+{
+	return "SurgSim." + sharedMemoryName + ".output";
+}
+
+bool SharedMemoryDevice::finalize()
+{
+	SURGSIM_ASSERT(isInitialized()) << getName() << " is not initialized, cannot finalize.";
+
+	if (m_thread != nullptr)
+	{
+		m_thread->stop();
+		m_thread.reset();
+	}
+	m_inputRing.reset();
+	m_outputRing.reset();
+	m_initialized = false;
+	SURGSIM_LOG_INFO(Framework::Logger::getLogger("Devices/SharedMemory")) << "Device " << getName() <<
+		" finalized.";
+	return true;
+}
+
+void SharedMemoryDevice::startThread()
+{
+	if (isInitialized() && m_thread == nullptr)
+	{
+		m_thread.reset(new SharedMemoryThread(this));
+		m_thread->start();
+	}
+}
+
+void SharedMemoryDevice::update()
+{
+	if (pullOutput())
+	{
+		const DataStructures::DataGroup& outputData = getOutputData();
+		if (m_outputRing == nullptr && !m_isOutputRingFailed)
+		{
+			m_outputRing = SharedMemoryRing::create(getOutputRingName(m_sharedMemoryName), outputData);
+			m_isOutputRingFailed = (m_outputRing == nullptr);
+		}
+		if (m_outputRing != nullptr)
+		{
+			m_outputRing->write(outputData);
+		}
+	}
+
+	while (m_inputRing->read(&getInputData()))
+	{
+		pushInput();
+	}
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
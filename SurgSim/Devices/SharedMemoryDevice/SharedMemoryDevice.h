@@ -0,0 +1,130 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDEVICE_H
+#define SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDEVICE_H
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/Input/CommonDevice.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+class SharedMemoryRing;
+class SharedMemoryThread;
+
+SURGSIM_STATIC_REGISTRATION(SharedMemoryDevice);
+
+/// A device whose driver runs in another process, e.g. so that the stalls and crashes of the SDK of the device do
+/// not take the simulation down, and its threads do not compete with the simulation.  The driver process runs the
+/// actual device with a SharedMemoryDriverHost as its input consumer and output producer, see the SurgSimDriverHost
+/// executable, and the input and output are handed over through a SharedMemoryRing in each direction.
+///
+/// The driver has to be started first, the input data of the device is the layout of the input of the driver when
+/// the device is initialized.  A thread checks for the input of the driver at the rate of the device, pushes all
+/// the samples to the input consumers in order, and hands the output over to the driver, starting when the first
+/// input consumer or output producer is added.
+/// \note If the driver is restarted, the device needs to be initialized again.
+/// \sa SurgSim::Devices::SharedMemoryDriverHost, SurgSim::Devices::SharedMemoryRing
+class SharedMemoryDevice : public Input::CommonDevice
+{
+public:
+	/// Constructor.
+	/// \param uniqueName A unique name for the device that will be used by the application, and the default name of
+	///		the shared memory.
+	explicit SharedMemoryDevice(const std::string& uniqueName);
+
+	SURGSIM_CLASSNAME(SurgSim::Devices::SharedMemoryDevice);
+
+	/// Destructor.
+	virtual ~SharedMemoryDevice();
+
+	/// Set the name of the shared memory, which has to be the name given to the SharedMemoryDriverHost.
+	/// \param name The name.
+	/// \exception Asserts if the device is already initialized.
+	void setSharedMemoryName(const std::string& name);
+
+	/// \return The name of the shared memory.
+	const std::string& getSharedMemoryName() const;
+
+	/// Set the rate at which the input of the driver is checked for and the output is handed over.
+	/// \param rate The rate (in Hz).
+	/// \exception Asserts if the device is already initialized.
+	void setRate(double rate);
+
+	/// \return The rate at which the input of the driver is checked for (in Hz).
+	double getRate() const;
+
+	/// Opens the input of the driver, initializes the input of the consumers added before, and starts the thread if
+	/// there are consumers or a producer.
+	/// \return false if the driver is not running.
+	bool initialize() override;
+
+	/// Adds an input consumer, and starts the thread if it is not running yet.
+	bool addInputConsumer(std::shared_ptr<Input::InputConsumerInterface> inputConsumer) override;
+
+	/// Sets the output producer, and starts the thread if it is not running yet.
+	bool setOutputProducer(std::shared_ptr<Input::OutputProducerInterface> outputProducer) override;
+
+	bool isInitialized() const override;
+
+	/// \param sharedMemoryName The name of the shared memory.
+	/// \return The name of the ring with the input of the driver.
+	static std::string getInputRingName(const std::string& sharedMemoryName);
+
+	/// \param sharedMemoryName The name of the shared memory.
+	/// \return The name of the ring with the output to the driver.
+	static std::string getOutputRingName(const std::string& sharedMemoryName);
+
+private:
+	friend class SharedMemoryThread;
+
+	bool finalize() override;
+
+	/// Start the thread, if the device is initialized and the thread is not running yet.
+	void startThread();
+
+	/// Hand the output over to the driver, then push the input of the driver.
+	void update();
+
+	/// The name of the shared memory.
+	std::string m_sharedMemoryName;
+
+	/// The rate of the thread.
+	double m_rate;
+
+	/// The input of the driver.
+	std::unique_ptr<SharedMemoryRing> m_inputRing;
+
+	/// The output to the driver, created with the layout of the first output.
+	std::unique_ptr<SharedMemoryRing> m_outputRing;
+
+	/// Whether the output ring could not be created, so that it is not tried again.
+	bool m_isOutputRingFailed;
+
+	/// The thread exchanging the data with the driver.
+	std::unique_ptr<SharedMemoryThread> m_thread;
+
+	/// true if initialized and not finalized.
+	bool m_initialized;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDEVICE_H
@@ -0,0 +1,129 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDriverHost.h"
+
+#include <limits>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDevice.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryRing.h"
+#include "SurgSim/Framework/Clock.h"
+#include "SurgSim/Framework/Log.h"
+
+namespace
+{
+/// The time between two looks for the output of the simulation, in s
+const double OPEN_PERIOD = 0.1;
+
+/// The default longest time without new output, 50 periods of a SharedMemoryDevice running at 1 kHz, in s
+const double DEFAULT_OUTPUT_TIMEOUT = 0.05;
+};
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SharedMemoryDriverHost::SharedMemoryDriverHost(const std::string& sharedMemoryName) :
+	m_sharedMemoryName(sharedMemoryName),
+	m_lastOpenTime(-std::numeric_limits<double>::infinity()),
+	m_lastOutputTime(0.0),
+	m_outputTimeout(DEFAULT_OUTPUT_TIMEOUT),
+	m_hasOutput(false)
+{
+}
+
+SharedMemoryDriverHost::~SharedMemoryDriverHost()
+{
+}
+
+const std::string& SharedMemoryDriverHost::getSharedMemoryName() const
+{
+	return m_sharedMemoryName;
+}
+
+void SharedMemoryDriverHost::setOutputTimeout(double timeout)
+{
+	SURGSIM_ASSERT(timeout > 0.0) << "The output timeout of " << m_sharedMemoryName << " needs to be positive.";
+	m_outputTimeout = timeout;
+}
+
+double SharedMemoryDriverHost::getOutputTimeout() const
+{
+	return m_outputTimeout;
+}
+
+void SharedMemoryDriverHost::initializeInput(const std::string& device, const DataStructures::DataGroup& inputData)
+{
+	m_inputRing = SharedMemoryRing::create(SharedMemoryDevice::getInputRingName(m_sharedMemoryName), inputData);
+	SURGSIM_LOG_IF(m_inputRing == nullptr, Framework::Logger::getLogger("Devices/SharedMemory"), SEVERE) <<
+		"The input of " << device << " cannot be handed over through " << m_sharedMemoryName << ".";
+	handleInput(device, inputData);
+}
+
+void SharedMemoryDriverHost::handleInput(const std::string& device, const DataStructures::DataGroup& inputData)
+{
+	if (m_inputRing != nullptr)
+	{
+		m_inputRing->write(inputData);
+	}
+}
+
+bool SharedMemoryDriverHost::requestOutput(const std::string& device, DataStructures::DataGroup* outputData)
+{
+	const double time = Framework::getMonotonicTime();
+	if (m_outputRing == nullptr)
+	{
+		if (time - m_lastOpenTime < OPEN_PERIOD)
+		{
+			return false;
+		}
+		m_lastOpenTime = time;
+		m_outputRing = SharedMemoryRing::open(SharedMemoryDevice::getOutputRingName(m_sharedMemoryName));
+		if (m_outputRing == nullptr)
+		{
+			return false;
+		}
+		m_lastOutputTime = time;
+	}
+
+	if (m_outputRing->readLatest(outputData))
+	{
+		m_lastOutputTime = time;
+		m_hasOutput = true;
+	}
+	else if (time - m_lastOutputTime > m_outputTimeout)
+	{
+		// The simulation stopped sending output, or replaced the shared memory when it started over, the ring is
+		// opened again to find out which
+		SURGSIM_LOG_IF(m_hasOutput, Framework::Logger::getLogger("Devices/SharedMemory"), WARNING) <<
+			"No output from the simulation through " << m_sharedMemoryName << " for " << m_outputTimeout <<
+			" s, " << device << " gets no output until the simulation sends output again.";
+		m_outputRing.reset();
+		m_hasOutput = false;
+	}
+
+	// Keep the last output until the simulation sends a new one, or times out
+	return m_hasOutput;
+}
+
+bool SharedMemoryDriverHost::hasOutput() const
+{
+	return m_hasOutput;
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
@@ -0,0 +1,96 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDRIVERHOST_H
+#define SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDRIVERHOST_H
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/Input/InputConsumerInterface.h"
+#include "SurgSim/Input/OutputProducerInterface.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+class SharedMemoryRing;
+
+/// The driver side of a SharedMemoryDevice, which hands the input of any device over to the SharedMemoryDevice of
+/// the simulation, and its output back to the device, through shared memory.  Added as the input consumer and the
+/// output producer of the device, e.g. by the SurgSimDriverHost executable, or by a test standing in for a driver.
+/// The input is written to the shared memory in the thread of the device, the latest output is read from it when
+/// the device requests it.  The device gets no output until the simulation sent its first output, and none once the
+/// simulation sent no new output for longer than the output timeout, e.g. because it crashed, hangs or stopped, so
+/// that the device does not keep applying the last force.  The shared memory of the output is then opened again, to
+/// follow the simulation if it starts over.
+/// \sa SurgSim::Devices::SharedMemoryDevice
+class SharedMemoryDriverHost : public Input::InputConsumerInterface, public Input::OutputProducerInterface
+{
+public:
+	/// Constructor.
+	/// \param sharedMemoryName The name of the shared memory, which has to be the one of the SharedMemoryDevice.
+	explicit SharedMemoryDriverHost(const std::string& sharedMemoryName);
+
+	/// Destructor.
+	virtual ~SharedMemoryDriverHost();
+
+	/// \return The name of the shared memory.
+	const std::string& getSharedMemoryName() const;
+
+	/// Set the longest time without new output from the simulation before the device gets no output anymore.
+	/// \param timeout The timeout, in s.
+	void setOutputTimeout(double timeout);
+
+	/// \return The longest time without new output from the simulation before the device gets no output anymore.
+	double getOutputTimeout() const;
+
+	/// Creates the shared memory for the input, with the layout of the input of the device.
+	void initializeInput(const std::string& device, const DataStructures::DataGroup& inputData) override;
+
+	void handleInput(const std::string& device, const DataStructures::DataGroup& inputData) override;
+
+	bool requestOutput(const std::string& device, DataStructures::DataGroup* outputData) override;
+
+	/// \return true if the simulation sent output within the output timeout.
+	bool hasOutput() const;
+
+private:
+	/// The name of the shared memory.
+	const std::string m_sharedMemoryName;
+
+	/// The input of the device.
+	std::unique_ptr<SharedMemoryRing> m_inputRing;
+
+	/// The output of the simulation, once the simulation created it.
+	std::unique_ptr<SharedMemoryRing> m_outputRing;
+
+	/// The last time the output was looked for, so that it is not looked for on each request.
+	double m_lastOpenTime;
+
+	/// The last time the simulation sent output, or the output was opened.
+	double m_lastOutputTime;
+
+	/// The longest time without new output.
+	double m_outputTimeout;
+
+	/// Whether the simulation sent output within the output timeout.
+	bool m_hasOutput;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYDRIVERHOST_H
@@ -0,0 +1,522 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryRing.h"
+
+#include <atomic>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/DataStructures/IndexDirectory.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Log.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::NamedData;
+
+namespace
+{
+
+/// Identifies a ring, "SSSM"
+const uint32_t MAGIC = 0x4d535353;
+
+/// The version of the format
+const uint32_t VERSION = 1;
+
+/// Everything in the shared memory is aligned to this many bytes
+const size_t ALIGNMENT = 8;
+
+/// The size of the header of each entry, which says whether the entry has data
+const size_t ENTRY_HEADER_SIZE = sizeof(uint64_t);
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "The ring needs lock free 64 bit atomics to be shared between processes.");
+
+size_t align(size_t size)
+{
+	return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+void appendNames(const std::vector<std::string>& names, std::vector<char>* buffer)
+{
+	const uint32_t count = static_cast<uint32_t>(names.size());
+	buffer->insert(buffer->end(), reinterpret_cast<const char*>(&count), reinterpret_cast<const char*>(&count + 1));
+	for (const auto& name : names)
+	{
+		const uint32_t length = static_cast<uint32_t>(name.size());
+		buffer->insert(buffer->end(), reinterpret_cast<const char*>(&length),
+			reinterpret_cast<const char*>(&length + 1));
+		buffer->insert(buffer->end(), name.begin(), name.end());
+	}
+}
+
+bool readNames(const char** position, const char* end, std::vector<std::string>* names)
+{
+	uint32_t count;
+	if (end - *position < static_cast<std::ptrdiff_t>(sizeof(count)))
+	{
+		return false;
+	}
+	std::memcpy(&count, *position, sizeof(count));
+	*position += sizeof(count);
+	names->clear();
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		uint32_t length;
+		if (end - *position < static_cast<std::ptrdiff_t>(sizeof(length)))
+		{
+			return false;
+		}
+		std::memcpy(&length, *position, sizeof(length));
+		*position += sizeof(length);
+		if (end - *position < static_cast<std::ptrdiff_t>(length))
+		{
+			return false;
+		}
+		names->emplace_back(*position, length);
+		*position += length;
+	}
+	return true;
+}
+
+template <class T>
+std::vector<std::string> getNames(const NamedData<T>& data)
+{
+	return data.isValid() ? data.getDirectory()->getAllNames() : std::vector<std::string>();
+}
+
+bool writeValue(const DataGroup::PoseType& value, size_t size, char* destination)
+{
+	std::memcpy(destination, value.matrix().data(), sizeof(DataGroup::PoseType::MatrixType));
+	return true;
+}
+
+bool writeValue(const DataGroup::VectorType& value, size_t size, char* destination)
+{
+	std::memcpy(destination, value.data(), sizeof(DataGroup::VectorType));
+	return true;
+}
+
+bool writeValue(const DataGroup::DynamicMatrixType& value, size_t size, char* destination)
+{
+	const size_t valueSize = static_cast<size_t>(value.size()) * sizeof(double);
+	if (2 * sizeof(uint32_t) + valueSize > size)
+	{
+		return false;
+	}
+	const uint32_t dimensions[2] = {static_cast<uint32_t>(value.rows()), static_cast<uint32_t>(value.cols())};
+	std::memcpy(destination, dimensions, sizeof(dimensions));
+	std::memcpy(destination + sizeof(dimensions), value.data(), valueSize);
+	return true;
+}
+
+template <class T>
+bool writeValue(const T& value, size_t size, char* destination)
+{
+	std::memcpy(destination, &value, sizeof(T));
+	return true;
+}
+
+bool readValue(const char* source, size_t size, DataGroup::PoseType* value)
+{
+	std::memcpy(value->matrix().data(), source, sizeof(DataGroup::PoseType::MatrixType));
+	return true;
+}
+
+bool readValue(const char* source, size_t size, DataGroup::VectorType* value)
+{
+	std::memcpy(value->data(), source, sizeof(DataGroup::VectorType));
+	return true;
+}
+
+bool readValue(const char* source, size_t size, DataGroup::DynamicMatrixType* value)
+{
+	// The dimensions come from the other process, a matrix with more coefficients than the matrix capacity of the
+	// ring, i.e. than fit in the entry, is rejected
+	uint32_t dimensions[2];
+	std::memcpy(dimensions, source, sizeof(dimensions));
+	const uint64_t coefficientCount = static_cast<uint64_t>(dimensions[0]) * static_cast<uint64_t>(dimensions[1]);
+	if (coefficientCount > (size - sizeof(dimensions)) / sizeof(double))
+	{
+		return false;
+	}
+	value->resize(dimensions[0], dimensions[1]);
+	std::memcpy(value->data(), source + sizeof(dimensions), static_cast<size_t>(coefficientCount) * sizeof(double));
+	return true;
+}
+
+template <class T>
+bool readValue(const char* source, size_t size, T* value)
+{
+	std::memcpy(value, source, sizeof(T));
+	return true;
+}
+
+/// \return Whether the data of a matrix was too large for the ring
+template <class T>
+bool writeEntries(const NamedData<T>& data, size_t entrySize, T* value, char* entry)
+{
+	bool isDropped = false;
+	for (int i = 0; i < data.getNumEntries(); ++i, entry += entrySize)
+	{
+		uint64_t hasData = 0;
+		if (data.get(i, value))
+		{
+			hasData = writeValue(*value, entrySize - ENTRY_HEADER_SIZE, entry + ENTRY_HEADER_SIZE) ? 1 : 0;
+			isDropped = isDropped || (hasData == 0);
+		}
+		std::memcpy(entry, &hasData, sizeof(hasData));
+	}
+	return isDropped;
+}
+
+template <class T>
+void readEntries(const char* entry, size_t entrySize, T* value, NamedData<T>* data)
+{
+	for (int i = 0; i < data->getNumEntries(); ++i, entry += entrySize)
+	{
+		uint64_t hasData;
+		std::memcpy(&hasData, entry, sizeof(hasData));
+		if (hasData != 0 && readValue(entry + ENTRY_HEADER_SIZE, entrySize - ENTRY_HEADER_SIZE, value))
+		{
+			data->set(i, *value);
+		}
+		else
+		{
+			data->reset(i);
+		}
+	}
+}
+
+};
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+/// The start of the shared memory, followed by the layout and the slots.
+struct SharedMemoryRing::Header
+{
+	/// Set last by the creator, once the ring is ready to be opened.
+	std::atomic<uint32_t> magic;
+	uint32_t version;
+	uint64_t layoutSize;
+	uint64_t slotSize;
+	uint64_t slotCount;
+	uint64_t matrixCapacity;
+	/// The number of samples written, only changed by the writer.
+	std::atomic<uint64_t> writeCount;
+	/// The number of samples read or skipped, only changed by the reader.
+	std::atomic<uint64_t> readCount;
+	/// The number of samples dropped because the ring was full.
+	std::atomic<uint64_t> droppedCount;
+};
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::create(const std::string& name, const DataGroup& layout,
+	size_t slotCount, size_t matrixCapacity)
+{
+	SURGSIM_ASSERT(slotCount > 0) << "The ring " << name << " needs at least one slot.";
+	auto logger = Framework::Logger::getLogger("Devices/SharedMemory");
+	SURGSIM_LOG_IF(layout.strings().getNumEntries() > 0 || layout.images().getNumEntries() > 0 ||
+		layout.customData().getNumEntries() > 0, logger, WARNING) << "The strings, images and custom data of " <<
+		name << " are not handed over through the shared memory.";
+
+	std::vector<char> layoutBuffer;
+	appendNames(getNames(layout.poses()), &layoutBuffer);
+	appendNames(getNames(layout.vectors()), &layoutBuffer);
+	appendNames(getNames(layout.matrices()), &layoutBuffer);
+	appendNames(getNames(layout.scalars()), &layoutBuffer);
+	appendNames(getNames(layout.integers()), &layoutBuffer);
+	appendNames(getNames(layout.booleans()), &layoutBuffer);
+
+	const auto entrySizes = computeEntrySizes(matrixCapacity);
+	const auto counts = countEntries(layout);
+	size_t slotSize = 0;
+	for (size_t type = 0; type < TYPE_COUNT; ++type)
+	{
+		slotSize += counts[type] * entrySizes[type];
+	}
+	const size_t size = align(sizeof(Header)) + align(layoutBuffer.size()) + slotCount * slotSize;
+
+	std::unique_ptr<boost::interprocess::mapped_region> region;
+	try
+	{
+		boost::interprocess::shared_memory_object::remove(name.c_str());
+		boost::interprocess::shared_memory_object memory(boost::interprocess::create_only, name.c_str(),
+			boost::interprocess::read_write);
+		memory.truncate(static_cast<boost::interprocess::offset_t>(size));
+		region.reset(new boost::interprocess::mapped_region(memory, boost::interprocess::read_write));
+	}
+	catch (const boost::interprocess::interprocess_exception& exception)
+	{
+		SURGSIM_LOG_SEVERE(logger) << "Could not create the shared memory " << name << ": " << exception.what();
+		return nullptr;
+	}
+
+	char* memory = static_cast<char*>(region->get_address());
+	Header* header = new (memory) Header;
+	header->version = VERSION;
+	header->layoutSize = layoutBuffer.size();
+	header->slotSize = slotSize;
+	header->slotCount = slotCount;
+	header->matrixCapacity = matrixCapacity;
+	header->writeCount.store(0);
+	header->readCount.store(0);
+	header->droppedCount.store(0);
+	std::copy(layoutBuffer.begin(), layoutBuffer.end(), memory + align(sizeof(Header)));
+
+	std::unique_ptr<SharedMemoryRing> ring(new SharedMemoryRing(name, true, std::move(region)));
+	header->magic.store(MAGIC, std::memory_order_release);
+	return ring;
+}
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::open(const std::string& name)
+{
+	std::unique_ptr<boost::interprocess::mapped_region> region;
+	try
+	{
+		boost::interprocess::shared_memory_object memory(boost::interprocess::open_only, name.c_str(),
+			boost::interprocess::read_write);
+		region.reset(new boost::interprocess::mapped_region(memory, boost::interprocess::read_write));
+	}
+	catch (const boost::interprocess::interprocess_exception&)
+	{
+		return nullptr;
+	}
+
+	// The creator may not have finished, the memory is all zeros until it is sized and the header is written
+	const Header* header = static_cast<const Header*>(region->get_address());
+	if (region->get_size() < sizeof(Header) || header->magic.load(std::memory_order_acquire) != MAGIC)
+	{
+		return nullptr;
+	}
+	if (header->version != VERSION ||
+		region->get_size() < align(sizeof(Header)) + align(header->layoutSize) + header->slotCount * header->slotSize)
+	{
+		SURGSIM_LOG_SEVERE(Framework::Logger::getLogger("Devices/SharedMemory")) << "The shared memory " << name <<
+			" is not a ring of this version.";
+		return nullptr;
+	}
+
+	return std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(name, false, std::move(region)));
+}
+
+SharedMemoryRing::SharedMemoryRing(const std::string& name, bool isWriter,
+	std::unique_ptr<boost::interprocess::mapped_region> region) :
+	m_name(name),
+	m_isWriter(isWriter),
+	m_region(std::move(region)),
+	m_isCheckedLayoutCompatible(false)
+{
+	char* memory = static_cast<char*>(m_region->get_address());
+	m_header = reinterpret_cast<Header*>(memory);
+	const char* layout = memory + align(sizeof(Header));
+	m_slots = memory + align(sizeof(Header)) + align(m_header->layoutSize);
+
+	const char* position = layout;
+	const char* end = layout + m_header->layoutSize;
+	std::vector<std::string> names;
+	DataStructures::DataGroupBuilder builder;
+	bool isValid = readNames(&position, end, &names);
+	builder.poses().addEntriesFrom(names);
+	isValid = isValid && readNames(&position, end, &names);
+	builder.vectors().addEntriesFrom(names);
+	isValid = isValid && readNames(&position, end, &names);
+	builder.matrices().addEntriesFrom(names);
+	isValid = isValid && readNames(&position, end, &names);
+	builder.scalars().addEntriesFrom(names);
+	isValid = isValid && readNames(&position, end, &names);
+	builder.integers().addEntriesFrom(names);
+	isValid = isValid && readNames(&position, end, &names);
+	builder.booleans().addEntriesFrom(names);
+	SURGSIM_ASSERT(isValid) << "The layout of the shared memory " << m_name << " is invalid.";
+	m_layout = builder.createData();
+
+	computeOffsets();
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+	m_region.reset();
+	if (m_isWriter)
+	{
+		boost::interprocess::shared_memory_object::remove(m_name.c_str());
+	}
+}
+
+const std::string& SharedMemoryRing::getName() const
+{
+	return m_name;
+}
+
+bool SharedMemoryRing::isWriter() const
+{
+	return m_isWriter;
+}
+
+DataGroup SharedMemoryRing::createData() const
+{
+	return m_layout;
+}
+
+bool SharedMemoryRing::write(const DataGroup& data)
+{
+	SURGSIM_ASSERT(m_isWriter) << "Only the process that created the shared memory " << m_name << " writes to it.";
+
+	if (!checkLayout(data, &m_checkedLayout, &m_isCheckedLayoutCompatible))
+	{
+		SURGSIM_LOG_ONCE(Framework::Logger::getLogger("Devices/SharedMemory"), WARNING) << "The layout of the data "
+			<< "written to " << m_name << " changed, it is not handed over anymore.";
+		m_header->droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	const uint64_t writeCount = m_header->writeCount.load(std::memory_order_relaxed);
+	const uint64_t readCount = m_header->readCount.load(std::memory_order_acquire);
+	if (writeCount - readCount >= m_header->slotCount)
+	{
+		m_header->droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	char* slot = m_slots + (writeCount % m_header->slotCount) * m_header->slotSize;
+	writeEntries(data.poses(), m_entrySizes[0], &m_values.pose, slot + m_typeOffsets[0]);
+	writeEntries(data.vectors(), m_entrySizes[1], &m_values.vector, slot + m_typeOffsets[1]);
+	bool isMatrixDropped = writeEntries(data.matrices(), m_entrySizes[2], &m_values.matrix, slot + m_typeOffsets[2]);
+	SURGSIM_LOG_ONCE_IF(isMatrixDropped, Framework::Logger::getLogger("Devices/SharedMemory"), WARNING) <<
+		"A matrix written to " << m_name << " has more than " << m_header->matrixCapacity <<
+		" coefficients, it is not handed over.";
+	writeEntries(data.scalars(), m_entrySizes[3], &m_values.scalar, slot + m_typeOffsets[3]);
+	writeEntries(data.integers(), m_entrySizes[4], &m_values.integer, slot + m_typeOffsets[4]);
+	writeEntries(data.booleans(), m_entrySizes[5], &m_values.boolean, slot + m_typeOffsets[5]);
+
+	m_header->writeCount.store(writeCount + 1, std::memory_order_release);
+	return true;
+}
+
+bool SharedMemoryRing::read(DataGroup* data)
+{
+	const uint64_t readCount = m_header->readCount.load(std::memory_order_relaxed);
+	const uint64_t writeCount = m_header->writeCount.load(std::memory_order_acquire);
+	if (readCount == writeCount)
+	{
+		return false;
+	}
+	readSlot(readCount % m_header->slotCount, data);
+	m_header->readCount.store(readCount + 1, std::memory_order_release);
+	return true;
+}
+
+bool SharedMemoryRing::readLatest(DataGroup* data)
+{
+	const uint64_t readCount = m_header->readCount.load(std::memory_order_relaxed);
+	const uint64_t writeCount = m_header->writeCount.load(std::memory_order_acquire);
+	if (readCount == writeCount)
+	{
+		return false;
+	}
+	// The writer does not reuse the slots of the skipped samples until the read count is updated
+	readSlot((writeCount - 1) % m_header->slotCount, data);
+	m_header->readCount.store(writeCount, std::memory_order_release);
+	return true;
+}
+
+size_t SharedMemoryRing::getNumberOfDroppedSamples() const
+{
+	return static_cast<size_t>(m_header->droppedCount.load(std::memory_order_relaxed));
+}
+
+std::array<size_t, SharedMemoryRing::TYPE_COUNT> SharedMemoryRing::computeEntrySizes(size_t matrixCapacity)
+{
+	std::array<size_t, TYPE_COUNT> sizes = {{
+		ENTRY_HEADER_SIZE + align(sizeof(DataGroup::PoseType::MatrixType)),
+		ENTRY_HEADER_SIZE + align(sizeof(DataGroup::VectorType)),
+		ENTRY_HEADER_SIZE + align(2 * sizeof(uint32_t) + matrixCapacity * sizeof(double)),
+		ENTRY_HEADER_SIZE + align(sizeof(DataGroup::ScalarType)),
+		ENTRY_HEADER_SIZE + align(sizeof(DataGroup::IntegerType)),
+		ENTRY_HEADER_SIZE + align(sizeof(DataGroup::BooleanType))
+	}};
+	return sizes;
+}
+
+std::array<size_t, SharedMemoryRing::TYPE_COUNT> SharedMemoryRing::countEntries(const DataGroup& data)
+{
+	std::array<size_t, TYPE_COUNT> counts = {{
+		static_cast<size_t>(data.poses().getNumEntries()),
+		static_cast<size_t>(data.vectors().getNumEntries()),
+		static_cast<size_t>(data.matrices().getNumEntries()),
+		static_cast<size_t>(data.scalars().getNumEntries()),
+		static_cast<size_t>(data.integers().getNumEntries()),
+		static_cast<size_t>(data.booleans().getNumEntries())
+	}};
+	return counts;
+}
+
+void SharedMemoryRing::computeOffsets()
+{
+	m_entrySizes = computeEntrySizes(m_header->matrixCapacity);
+	const auto counts = countEntries(m_layout);
+	size_t offset = 0;
+	for (size_t type = 0; type < TYPE_COUNT; ++type)
+	{
+		m_typeOffsets[type] = offset;
+		offset += counts[type] * m_entrySizes[type];
+	}
+	SURGSIM_ASSERT(offset <= m_header->slotSize) << "The slots of the shared memory " << m_name << " are too small.";
+}
+
+bool SharedMemoryRing::checkLayout(const DataGroup& data, Layout* layout, bool* isCompatible) const
+{
+	const Layout dataLayout = {{data.poses().getDirectory(), data.vectors().getDirectory(),
+		data.matrices().getDirectory(), data.scalars().getDirectory(), data.integers().getDirectory(),
+		data.booleans().getDirectory()}};
+	if (dataLayout != *layout)
+	{
+		*layout = dataLayout;
+		*isCompatible = getNames(data.poses()) == getNames(m_layout.poses()) &&
+			getNames(data.vectors()) == getNames(m_layout.vectors()) &&
+			getNames(data.matrices()) == getNames(m_layout.matrices()) &&
+			getNames(data.scalars()) == getNames(m_layout.scalars()) &&
+			getNames(data.integers()) == getNames(m_layout.integers()) &&
+			getNames(data.booleans()) == getNames(m_layout.booleans());
+	}
+	return *isCompatible;
+}
+
+void SharedMemoryRing::readSlot(size_t slot, DataGroup* data)
+{
+	if (data->isEmpty())
+	{
+		*data = m_layout;
+	}
+	SURGSIM_ASSERT(checkLayout(*data, &m_checkedLayout, &m_isCheckedLayoutCompatible)) <<
+		"The data read from the shared memory " << m_name << " does not have its layout.";
+
+	const char* source = m_slots + slot * m_header->slotSize;
+	readEntries(source + m_typeOffsets[0], m_entrySizes[0], &m_values.pose, &data->poses());
+	readEntries(source + m_typeOffsets[1], m_entrySizes[1], &m_values.vector, &data->vectors());
+	readEntries(source + m_typeOffsets[2], m_entrySizes[2], &m_values.matrix, &data->matrices());
+	readEntries(source + m_typeOffsets[3], m_entrySizes[3], &m_values.scalar, &data->scalars());
+	readEntries(source + m_typeOffsets[4], m_entrySizes[4], &m_values.integer, &data->integers());
+	readEntries(source + m_typeOffsets[5], m_entrySizes[5], &m_values.boolean, &data->booleans());
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
@@ -0,0 +1,184 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYRING_H
+#define SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYRING_H
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+
+namespace boost
+{
+namespace interprocess
+{
+class mapped_region;
+}
+}
+
+namespace SurgSim
+{
+namespace DataStructures
+{
+class IndexDirectory;
+}
+
+namespace Devices
+{
+
+/// A ring of DataGroup samples in a named shared memory object, to hand the samples of a device over from one
+/// process to another, e.g. between a driver process running the SDK of the device and the simulation.
+/// The process that creates the ring sets the layout of the samples and writes them, the process that opens it reads
+/// them.  The two sides never block each other nor allocate memory: the writer drops a sample if the ring is full,
+/// and the reader can skip to the latest sample.  The samples are written straight from the DataGroup into the
+/// shared memory, and read straight from it into a DataGroup.
+/// Only the entries of a fixed size are handed over, i.e. the poses, vectors, scalars, integers, booleans, and the
+/// matrices up to a number of coefficients set when the ring is created.  The other entries are left out.
+/// \note The creator removes the shared memory object from the system when it is destroyed, the reader keeps its
+///		mapping until it is destroyed too.
+/// \sa SurgSim::Devices::SharedMemoryDevice, SurgSim::Devices::SharedMemoryDriverHost
+class SharedMemoryRing
+{
+public:
+	/// Create a ring, replacing any shared memory object with the same name.
+	/// \param name The name of the shared memory object.
+	/// \param layout Data with the layout of the samples.
+	/// \param slotCount The number of samples the ring holds.
+	/// \param matrixCapacity The largest number of coefficients of the matrices in the samples.
+	/// \return The ring, or nullptr if the shared memory object could not be created.
+	static std::unique_ptr<SharedMemoryRing> create(const std::string& name, const DataStructures::DataGroup& layout,
+		size_t slotCount = 16, size_t matrixCapacity = 512);
+
+	/// Open a ring created by another process.
+	/// \param name The name of the shared memory object.
+	/// \return The ring, or nullptr if the ring does not exist, is not completely created yet, or is invalid.
+	static std::unique_ptr<SharedMemoryRing> open(const std::string& name);
+
+	/// Destructor.
+	~SharedMemoryRing();
+
+	/// \return The name of the shared memory object.
+	const std::string& getName() const;
+
+	/// \return true if this side created the ring, and writes to it.
+	bool isWriter() const;
+
+	/// \return A DataGroup with the layout of the samples, without data.
+	DataStructures::DataGroup createData() const;
+
+	/// Write a sample, only done by the creator of the ring.
+	/// \param data The sample, needs to have the poses, vectors, matrices, scalars, integers and booleans of the
+	///		layout of the ring.
+	/// \return false if the sample was dropped, because the ring is full or the data has a different layout.
+	bool write(const DataStructures::DataGroup& data);
+
+	/// Read the oldest sample that has not been read yet.
+	/// \param [in,out] data The sample, an empty DataGroup or one with the layout of createData().
+	/// \return false if there is no new sample, data is not changed.
+	bool read(DataStructures::DataGroup* data);
+
+	/// Read the latest sample, skipping the older ones that have not been read yet.
+	/// \param [in,out] data The sample, an empty DataGroup or one with the layout of createData().
+	/// \return false if there is no new sample, data is not changed.
+	bool readLatest(DataStructures::DataGroup* data);
+
+	/// \return The number of samples the writer dropped because the ring was full.
+	size_t getNumberOfDroppedSamples() const;
+
+private:
+	struct Header;
+
+	/// The poses, vectors, matrices, scalars, integers and booleans
+	static const size_t TYPE_COUNT = 6;
+
+	/// The layout of a DataGroup, i.e., the IndexDirectory of each of the NamedData handed over.
+	typedef std::array<std::shared_ptr<const DataStructures::IndexDirectory>, TYPE_COUNT> Layout;
+
+	/// Constructor.
+	/// \param name The name of the shared memory object.
+	/// \param isWriter Whether this side created the ring.
+	/// \param region The mapping of the shared memory object.
+	SharedMemoryRing(const std::string& name, bool isWriter,
+		std::unique_ptr<boost::interprocess::mapped_region> region);
+
+	/// \param matrixCapacity The largest number of coefficients of the matrices.
+	/// \return The size in a slot of an entry of each type.
+	static std::array<size_t, TYPE_COUNT> computeEntrySizes(size_t matrixCapacity);
+
+	/// \param data The data.
+	/// \return The number of entries of each type handed over.
+	static std::array<size_t, TYPE_COUNT> countEntries(const DataStructures::DataGroup& data);
+
+	/// Compute where the entries are in the slots.
+	void computeOffsets();
+
+	/// Check whether a DataGroup has the layout of the ring, caching the result.
+	/// \param data The data.
+	/// \param [in,out] layout The layout last checked.
+	/// \param [in,out] isCompatible The result of the last check.
+	/// \return Whether data has the layout of the ring.
+	bool checkLayout(const DataStructures::DataGroup& data, Layout* layout, bool* isCompatible) const;
+
+	/// Read a slot into a DataGroup.
+	/// \param slot The index of the slot.
+	/// \param [in,out] data The sample.
+	void readSlot(size_t slot, DataStructures::DataGroup* data);
+
+	/// The name of the shared memory object.
+	const std::string m_name;
+
+	/// Whether this side created the ring.
+	const bool m_isWriter;
+
+	/// The mapping of the shared memory object.
+	std::unique_ptr<boost::interprocess::mapped_region> m_region;
+
+	/// The header, at the start of the shared memory.
+	Header* m_header;
+
+	/// The first slot.
+	char* m_slots;
+
+	/// The layout of the samples.
+	DataStructures::DataGroup m_layout;
+
+	/// The offsets in a slot of the first entry of each type.
+	std::array<size_t, TYPE_COUNT> m_typeOffsets;
+
+	/// The size in a slot of an entry of each type.
+	std::array<size_t, TYPE_COUNT> m_entrySizes;
+
+	/// The layout of the data last checked, and the result of the check.
+	Layout m_checkedLayout;
+	bool m_isCheckedLayoutCompatible;
+
+	/// Storage for the values, so that they are not allocated for each sample.
+	struct Values
+	{
+		DataStructures::DataGroup::PoseType pose;
+		DataStructures::DataGroup::VectorType vector;
+		DataStructures::DataGroup::DynamicMatrixType matrix;
+		DataStructures::DataGroup::ScalarType scalar;
+		DataStructures::DataGroup::IntegerType integer;
+		DataStructures::DataGroup::BooleanType boolean;
+	} m_values;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYRING_H
@@ -0,0 +1,53 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryThread.h"
+
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDevice.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+SharedMemoryThread::SharedMemoryThread(SharedMemoryDevice* device) :
+	BasicThread("Shared memory thread"),
+	m_device(device)
+{
+	setRate(m_device->getRate());
+}
+
+SharedMemoryThread::~SharedMemoryThread()
+{
+}
+
+bool SharedMemoryThread::doInitialize()
+{
+	return true;
+}
+
+bool SharedMemoryThread::doStartUp()
+{
+	return true;
+}
+
+bool SharedMemoryThread::doUpdate(double dt)
+{
+	m_device->update();
+	return true;
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
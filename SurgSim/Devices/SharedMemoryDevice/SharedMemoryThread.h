@@ -0,0 +1,51 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYTHREAD_H
+#define SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYTHREAD_H
+
+#include "SurgSim/Framework/BasicThread.h"
+
+namespace SurgSim
+{
+namespace Devices
+{
+class SharedMemoryDevice;
+
+/// A class implementing the thread context for exchanging the data of a SharedMemoryDevice with its driver.
+/// \sa SurgSim::Devices::SharedMemoryDevice
+class SharedMemoryThread : public SurgSim::Framework::BasicThread
+{
+public:
+	/// Constructor.
+	/// \param device The device, it has to outlive the thread.
+	explicit SharedMemoryThread(SharedMemoryDevice* device);
+
+	virtual ~SharedMemoryThread();
+
+protected:
+	bool doInitialize() override;
+	bool doStartUp() override;
+	bool doUpdate(double dt) override;
+
+private:
+	/// The device.
+	SharedMemoryDevice* m_device;
+};
+
+};  // namespace Devices
+};  // namespace SurgSim
+
+#endif  // SURGSIM_DEVICES_SHAREDMEMORYDEVICE_SHAREDMEMORYTHREAD_H
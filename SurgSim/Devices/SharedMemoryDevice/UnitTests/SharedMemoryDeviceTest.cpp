@@ -0,0 +1,250 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <memory>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/DeviceFilters/FilteredDevice.h"
+#include "SurgSim/Devices/DeviceFilters/PoseTransform.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDevice.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryDriverHost.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Input/CommonDevice.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+#include "SurgSim/Testing/MockInputOutput.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Devices::FilteredDevice;
+using SurgSim::Devices::PoseTransform;
+using SurgSim::Devices::SharedMemoryDevice;
+using SurgSim::Devices::SharedMemoryDriverHost;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+using SurgSim::Testing::MockInputOutput;
+
+namespace
+{
+const std::string SHARED_MEMORY_NAME = "SharedMemoryDeviceTest";
+
+/// Stands in for a driver process, running a device with a SharedMemoryDriverHost
+class StandInDevice : public SurgSim::Input::CommonDevice
+{
+public:
+	StandInDevice() : CommonDevice("StandInDevice", buildInputData())
+	{
+	}
+
+	bool initialize() override
+	{
+		return true;
+	}
+
+	bool isInitialized() const override
+	{
+		return true;
+	}
+
+	void push(const RigidTransform3d& pose)
+	{
+		getInputData().poses().set(SurgSim::DataStructures::Names::POSE, pose);
+		pushInput();
+	}
+
+	bool pull()
+	{
+		return pullOutput();
+	}
+
+	const DataGroup& getOutput() const
+	{
+		return getOutputData();
+	}
+
+private:
+	bool finalize() override
+	{
+		return true;
+	}
+
+	static DataGroup buildInputData()
+	{
+		DataGroupBuilder builder;
+		builder.addPose(SurgSim::DataStructures::Names::POSE);
+		builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_1);
+		DataGroup data = builder.createData();
+		data.poses().set(SurgSim::DataStructures::Names::POSE, RigidTransform3d::Identity());
+		return data;
+	}
+};
+};
+
+TEST(SharedMemoryDeviceTest, Properties)
+{
+	SharedMemoryDevice device("Device");
+	EXPECT_EQ("Device", device.getName());
+	EXPECT_EQ("SurgSim::Devices::SharedMemoryDevice", device.getClassName());
+	EXPECT_EQ("Device", device.getSharedMemoryName());
+	EXPECT_EQ(1000.0, device.getRate());
+
+	device.setValue("SharedMemoryName", SHARED_MEMORY_NAME);
+	EXPECT_EQ(SHARED_MEMORY_NAME, device.getSharedMemoryName());
+	device.setValue("Rate", 500.0);
+	EXPECT_EQ(500.0, device.getRate());
+	EXPECT_THROW(device.setRate(0.0), SurgSim::Framework::AssertionFailure);
+}
+
+TEST(SharedMemoryDeviceTest, NoDriver)
+{
+	SharedMemoryDevice device("Device");
+	device.setSharedMemoryName(SHARED_MEMORY_NAME);
+	EXPECT_FALSE(device.initialize());
+	EXPECT_FALSE(device.isInitialized());
+}
+
+TEST(SharedMemoryDeviceTest, InputAndOutput)
+{
+	auto driver = std::make_shared<StandInDevice>();
+	auto host = std::make_shared<SharedMemoryDriverHost>(SHARED_MEMORY_NAME);
+	ASSERT_TRUE(driver->addInputConsumer(host));
+	ASSERT_TRUE(driver->setOutputProducer(host));
+
+	auto device = std::make_shared<SharedMemoryDevice>("Device");
+	device->setSharedMemoryName(SHARED_MEMORY_NAME);
+	ASSERT_TRUE(device->initialize());
+	EXPECT_THROW(device->setSharedMemoryName("other"), SurgSim::Framework::AssertionFailure);
+
+	// The input data of the device has the layout of the input of the driver
+	auto inputOutput = std::make_shared<MockInputOutput>();
+	DataGroupBuilder builder;
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	DataGroup output = builder.createData();
+	output.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(1.0, 2.0, 3.0));
+	inputOutput->m_output.setValue(output);
+	ASSERT_TRUE(device->addInputConsumer(inputOutput));
+	ASSERT_TRUE(device->setOutputProducer(inputOutput));
+	EXPECT_TRUE(inputOutput->m_lastReceivedInput.poses().hasEntry(SurgSim::DataStructures::Names::POSE));
+	EXPECT_TRUE(inputOutput->m_lastReceivedInput.booleans().hasEntry(SurgSim::DataStructures::Names::BUTTON_1));
+
+	const RigidTransform3d pose = SurgSim::Math::makeRigidTransform(SurgSim::Math::Quaterniond::Identity(),
+		Vector3d(4.0, 5.0, 6.0));
+	driver->push(pose);
+	RigidTransform3d actualPose = RigidTransform3d::Identity();
+	for (int i = 0; i < 1000 && !actualPose.isApprox(pose); ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		inputOutput->m_lastReceivedInput.poses().get(SurgSim::DataStructures::Names::POSE, &actualPose);
+	}
+	EXPECT_TRUE(actualPose.isApprox(pose));
+
+	// The driver gets the output once the device created the shared memory for it
+	bool gotOutput = false;
+	for (int i = 0; i < 1000 && !gotOutput; ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		gotOutput = driver->pull();
+	}
+	ASSERT_TRUE(gotOutput);
+	EXPECT_TRUE(host->hasOutput());
+	Vector3d force;
+	ASSERT_TRUE(driver->getOutput().vectors().get(SurgSim::DataStructures::Names::FORCE, &force));
+	EXPECT_TRUE(force.isApprox(Vector3d(1.0, 2.0, 3.0)));
+
+	// Once the simulation stops, the driver gets no output after the timeout
+	EXPECT_DOUBLE_EQ(0.05, host->getOutputTimeout());
+	device.reset();
+	for (int i = 0; i < 1000 && gotOutput; ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		gotOutput = driver->pull();
+	}
+	EXPECT_FALSE(gotOutput);
+	EXPECT_FALSE(host->hasOutput());
+
+	// The driver gets the output of a simulation that starts over
+	device = std::make_shared<SharedMemoryDevice>("Device");
+	device->setSharedMemoryName(SHARED_MEMORY_NAME);
+	ASSERT_TRUE(device->initialize());
+	ASSERT_TRUE(device->setOutputProducer(inputOutput));
+	for (int i = 0; i < 1000 && !gotOutput; ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		gotOutput = driver->pull();
+	}
+	EXPECT_TRUE(gotOutput);
+
+	device.reset();
+	driver->clearInputConsumers();
+	driver->clearOutputProducer();
+}
+
+TEST(SharedMemoryDeviceTest, FilteredDevice)
+{
+	auto driver = std::make_shared<StandInDevice>();
+	auto host = std::make_shared<SharedMemoryDriverHost>(SHARED_MEMORY_NAME);
+	ASSERT_TRUE(driver->addInputConsumer(host));
+	ASSERT_TRUE(driver->setOutputProducer(host));
+
+	// The filter is added to the device before it is initialized, and knows the layout of the input only then
+	auto device = std::make_shared<SharedMemoryDevice>("Device");
+	device->setSharedMemoryName(SHARED_MEMORY_NAME);
+	auto filter = std::make_shared<PoseTransform>("Filter");
+	filter->setTranslationScale(2.0);
+	auto filteredDevice = std::make_shared<FilteredDevice>("FilteredDevice");
+	filteredDevice->setDevice(device);
+	filteredDevice->addFilter(filter);
+	ASSERT_TRUE(filteredDevice->initialize());
+
+	auto inputOutput = std::make_shared<MockInputOutput>();
+	DataGroupBuilder builder;
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	DataGroup output = builder.createData();
+	output.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(1.0, 2.0, 3.0));
+	inputOutput->m_output.setValue(output);
+	ASSERT_TRUE(filteredDevice->addInputConsumer(inputOutput));
+	ASSERT_TRUE(filteredDevice->setOutputProducer(inputOutput));
+	EXPECT_TRUE(inputOutput->m_lastReceivedInput.poses().hasEntry(SurgSim::DataStructures::Names::POSE));
+
+	// The thread of the device runs, the input goes through the filter
+	driver->push(SurgSim::Math::makeRigidTranslation(Vector3d(4.0, 5.0, 6.0)));
+	const RigidTransform3d expectedPose = SurgSim::Math::makeRigidTranslation(Vector3d(8.0, 10.0, 12.0));
+	RigidTransform3d actualPose = RigidTransform3d::Identity();
+	for (int i = 0; i < 1000 && !actualPose.isApprox(expectedPose); ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		inputOutput->m_lastReceivedInput.poses().get(SurgSim::DataStructures::Names::POSE, &actualPose);
+	}
+	EXPECT_TRUE(actualPose.isApprox(expectedPose));
+
+	// And so does the output
+	bool gotOutput = false;
+	for (int i = 0; i < 1000 && !gotOutput; ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		gotOutput = driver->pull();
+	}
+	EXPECT_TRUE(gotOutput);
+
+	filteredDevice.reset();
+	device.reset();
+	driver->clearInputConsumers();
+	driver->clearOutputProducer();
+}
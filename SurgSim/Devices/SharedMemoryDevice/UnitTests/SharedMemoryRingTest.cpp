@@ -0,0 +1,191 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Devices/SharedMemoryDevice/SharedMemoryRing.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+const std::string RING_NAME = "SurgSim.SharedMemoryRingTest";
+
+DataGroup buildData()
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	builder.addVector(SurgSim::DataStructures::Names::TORQUE);
+	builder.addMatrix(SurgSim::DataStructures::Names::SPRING_JACOBIAN);
+	builder.addScalar("scalar");
+	builder.addInteger("integer");
+	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_1);
+	builder.addString("string");
+	return builder.createData();
+}
+};
+
+namespace SurgSim
+{
+namespace Devices
+{
+
+TEST(SharedMemoryRingTest, CreateAndOpen)
+{
+	EXPECT_EQ(nullptr, SharedMemoryRing::open(RING_NAME));
+
+	auto writer = SharedMemoryRing::create(RING_NAME, buildData());
+	ASSERT_NE(nullptr, writer);
+	EXPECT_EQ(RING_NAME, writer->getName());
+	EXPECT_TRUE(writer->isWriter());
+
+	auto reader = SharedMemoryRing::open(RING_NAME);
+	ASSERT_NE(nullptr, reader);
+	EXPECT_FALSE(reader->isWriter());
+
+	// Only the entries of a fixed size are handed over
+	DataGroup data = reader->createData();
+	EXPECT_TRUE(data.poses().hasEntry(DataStructures::Names::POSE));
+	EXPECT_EQ(2, data.vectors().getNumEntries());
+	EXPECT_EQ(DataStructures::Names::TORQUE, data.vectors().getName(1));
+	EXPECT_TRUE(data.matrices().hasEntry(DataStructures::Names::SPRING_JACOBIAN));
+	EXPECT_TRUE(data.scalars().hasEntry("scalar"));
+	EXPECT_TRUE(data.integers().hasEntry("integer"));
+	EXPECT_TRUE(data.booleans().hasEntry(DataStructures::Names::BUTTON_1));
+	EXPECT_EQ(0, data.strings().getNumEntries());
+	EXPECT_FALSE(data.poses().hasData(DataStructures::Names::POSE));
+
+	// The writer removes the shared memory
+	writer.reset();
+	EXPECT_EQ(nullptr, SharedMemoryRing::open(RING_NAME));
+}
+
+TEST(SharedMemoryRingTest, WriteAndRead)
+{
+	auto writer = SharedMemoryRing::create(RING_NAME, buildData(), 4, 36);
+	ASSERT_NE(nullptr, writer);
+	auto reader = SharedMemoryRing::open(RING_NAME);
+	ASSERT_NE(nullptr, reader);
+
+	DataGroup output;
+	EXPECT_FALSE(reader->read(&output));
+	EXPECT_TRUE(output.isEmpty());
+
+	DataGroup input = buildData();
+	const Math::RigidTransform3d pose =
+		Math::makeRigidTransform(Math::makeRotationQuaternion(0.5, Vector3d(Vector3d::UnitY())), Vector3d(1, 2, 3));
+	const DataGroup::DynamicMatrixType jacobian = DataGroup::DynamicMatrixType::Random(6, 6);
+	input.poses().set(DataStructures::Names::POSE, pose);
+	input.vectors().set(DataStructures::Names::TORQUE, Vector3d(4.0, 5.0, 6.0));
+	input.matrices().set(DataStructures::Names::SPRING_JACOBIAN, jacobian);
+	input.scalars().set("scalar", 7.5);
+	input.integers().set("integer", -8);
+	input.booleans().set(DataStructures::Names::BUTTON_1, true);
+	input.strings().set("string", "not handed over");
+	EXPECT_TRUE(writer->write(input));
+
+	ASSERT_TRUE(reader->read(&output));
+	Math::RigidTransform3d actualPose;
+	ASSERT_TRUE(output.poses().get(DataStructures::Names::POSE, &actualPose));
+	EXPECT_TRUE(actualPose.isApprox(pose));
+	EXPECT_FALSE(output.vectors().hasData(DataStructures::Names::FORCE));
+	Vector3d torque;
+	ASSERT_TRUE(output.vectors().get(DataStructures::Names::TORQUE, &torque));
+	EXPECT_TRUE(torque.isApprox(Vector3d(4.0, 5.0, 6.0)));
+	DataGroup::DynamicMatrixType actualJacobian;
+	ASSERT_TRUE(output.matrices().get(DataStructures::Names::SPRING_JACOBIAN, &actualJacobian));
+	EXPECT_TRUE(actualJacobian.isApprox(jacobian));
+	double scalar;
+	ASSERT_TRUE(output.scalars().get("scalar", &scalar));
+	EXPECT_EQ(7.5, scalar);
+	int integer;
+	ASSERT_TRUE(output.integers().get("integer", &integer));
+	EXPECT_EQ(-8, integer);
+	bool button;
+	ASSERT_TRUE(output.booleans().get(DataStructures::Names::BUTTON_1, &button));
+	EXPECT_TRUE(button);
+	EXPECT_FALSE(reader->read(&output));
+
+	// Entries without data are reset, the matrices larger than the capacity are not handed over
+	input.poses().reset(DataStructures::Names::POSE);
+	input.matrices().set(DataStructures::Names::SPRING_JACOBIAN, DataGroup::DynamicMatrixType::Zero(7, 6));
+	EXPECT_TRUE(writer->write(input));
+	ASSERT_TRUE(reader->read(&output));
+	EXPECT_FALSE(output.poses().hasData(DataStructures::Names::POSE));
+	EXPECT_FALSE(output.matrices().hasData(DataStructures::Names::SPRING_JACOBIAN));
+	EXPECT_TRUE(output.vectors().hasData(DataStructures::Names::TORQUE));
+
+	// Data with another layout is not handed over
+	DataGroupBuilder builder;
+	builder.addPose(DataStructures::Names::POSE);
+	EXPECT_FALSE(writer->write(builder.createData()));
+	EXPECT_EQ(1u, writer->getNumberOfDroppedSamples());
+	EXPECT_FALSE(reader->read(&output));
+}
+
+TEST(SharedMemoryRingTest, Full)
+{
+	auto writer = SharedMemoryRing::create(RING_NAME, buildData(), 2);
+	ASSERT_NE(nullptr, writer);
+	auto reader = SharedMemoryRing::open(RING_NAME);
+	ASSERT_NE(nullptr, reader);
+
+	DataGroup input = buildData();
+	for (int i = 0; i < 3; ++i)
+	{
+		input.integers().set("integer", i);
+		EXPECT_EQ(i < 2, writer->write(input));
+	}
+	EXPECT_EQ(1u, writer->getNumberOfDroppedSamples());
+
+	DataGroup output;
+	int integer;
+	ASSERT_TRUE(reader->read(&output));
+	ASSERT_TRUE(output.integers().get("integer", &integer));
+	EXPECT_EQ(0, integer);
+
+	for (int i = 3; i < 5; ++i)
+	{
+		input.integers().set("integer", i);
+		EXPECT_EQ(i < 4, writer->write(input));
+	}
+
+	// The older samples are skipped
+	ASSERT_TRUE(reader->readLatest(&output));
+	ASSERT_TRUE(output.integers().get("integer", &integer));
+	EXPECT_EQ(3, integer);
+	EXPECT_FALSE(reader->read(&output));
+	EXPECT_FALSE(reader->readLatest(&output));
+
+	input.integers().set("integer", 5);
+	EXPECT_TRUE(writer->write(input));
+	ASSERT_TRUE(reader->read(&output));
+	ASSERT_TRUE(output.integers().get("integer", &integer));
+	EXPECT_EQ(5, integer);
+}
+
+};  // namespace Devices
+};  // namespace SurgSim
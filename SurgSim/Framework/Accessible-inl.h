@@ -54,10 +54,123 @@ T SurgSim::Framework::Accessible::getValue(const std::string& name) const
 	return result;
 }
 
+template <class T>
+void SurgSim::Framework::Accessible::setTypedGetter(const std::string& name, std::function<T(void)> func)
+{
+	SURGSIM_ASSERT(func != nullptr) << "Getter functor can't be nullptr";
+	setGetter(name, [func]() {return boost::any(func());});
+
+	auto typedGetter = std::make_shared<TypedGetter<T>>();
+	typedGetter->getter = std::move(func);
+	m_functors[name].typedGetter = std::move(typedGetter);
+}
+
+template <class T>
+void SurgSim::Framework::Accessible::setTypedSetter(const std::string& name, std::function<void(const T&)> func)
+{
+	SURGSIM_ASSERT(func != nullptr) << "Setter functor can't be nullptr";
+	auto typedSetter = std::make_shared<TypedSetter<T>>();
+	typedSetter->setter = std::move(func);
+	m_functors[name].typedSetter = std::move(typedSetter);
+}
+
+template <class T>
+SurgSim::Framework::Accessible::Property<T> SurgSim::Framework::Accessible::getProperty(const std::string& name) const
+{
+	auto functors = m_functors.find(name);
+	SURGSIM_ASSERT(functors != m_functors.end()) << "Can't get property: " << name << ". Property not found.";
+
+	Property<T> result;
+
+	auto typedGetter = std::dynamic_pointer_cast<TypedGetter<T>>(functors->second.typedGetter);
+	if (typedGetter != nullptr)
+	{
+		result.m_getter = typedGetter->getter;
+	}
+	else if (functors->second.getter != nullptr)
+	{
+		GetterType getter = functors->second.getter;
+		result.m_getter = [getter]() {return SurgSim::Framework::convert<T>(getter());};
+	}
+
+	auto typedSetter = std::dynamic_pointer_cast<TypedSetter<T>>(functors->second.typedSetter);
+	if (typedSetter != nullptr)
+	{
+		result.m_setter = typedSetter->setter;
+	}
+	else if (functors->second.setter != nullptr)
+	{
+		SetterType setter = functors->second.setter;
+		result.m_setter = [setter](const T& value) {setter(value);};
+	}
+
+	return result;
+}
+
+template <class T>
+std::function<void(void)> SurgSim::Framework::Accessible::TypedGetter<T>::bindTransfer(
+	const std::shared_ptr<TypedSetterBase>& setter) const
+{
+	std::function<void(void)> result;
+	auto typedSetter = std::dynamic_pointer_cast<TypedSetter<T>>(setter);
+	if (typedSetter != nullptr)
+	{
+		auto source = getter;
+		auto target = typedSetter->setter;
+		result = [source, target]() {target(source());};
+	}
+	return result;
+}
+
+template <class T>
+SurgSim::Framework::Accessible::Property<T>::Property()
+{
+}
+
+template <class T>
+bool SurgSim::Framework::Accessible::Property<T>::isReadable() const
+{
+	return m_getter != nullptr;
+}
+
+template <class T>
+bool SurgSim::Framework::Accessible::Property<T>::isWriteable() const
+{
+	return m_setter != nullptr;
+}
+
+template <class T>
+T SurgSim::Framework::Accessible::Property<T>::getValue() const
+{
+	SURGSIM_ASSERT(m_getter != nullptr) << "Can't get the value of a property that is not readable.";
+	return m_getter();
+}
+
+template <class T>
+void SurgSim::Framework::Accessible::Property<T>::setValue(const T& value)
+{
+	SURGSIM_ASSERT(m_setter != nullptr) << "Can't set the value of a property that is not writeable.";
+	m_setter(value);
+}
+
 template <class T>
 T SurgSim::Framework::convert(boost::any val)
 {
 	return boost::any_cast<T>(val);
 }
 
+template <class Object, class Class, class Result>
+std::function<typename std::decay<Result>::type(void)> SurgSim::Framework::bindGetter(Object* object,
+		Result(Class::*getter)() const)
+{
+	return std::bind(getter, object);
+}
+
+template <class Object, class Class, class Result>
+std::function<typename std::decay<Result>::type(void)> SurgSim::Framework::bindGetter(Object* object,
+		Result(Class::*getter)())
+{
+	return std::bind(getter, object);
+}
+
 #endif
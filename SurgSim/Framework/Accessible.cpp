@@ -75,12 +75,14 @@ void Accessible::setGetter(const std::string& name, GetterType func)
 {
 	SURGSIM_ASSERT(func != nullptr) << "Getter functor can't be nullptr";
 	m_functors[name].getter = func;
+	m_functors[name].typedGetter = nullptr;
 }
 
 void Accessible::setSetter(const std::string& name, SetterType func)
 {
 	SURGSIM_ASSERT(func != nullptr) << "Setter functor can't be nullptr";
 	m_functors[name].setter = func;
+	m_functors[name].typedSetter = nullptr;
 }
 
 void Accessible::setAccessors(const std::string& name, GetterType getter, SetterType setter)
@@ -97,9 +99,37 @@ void Accessible::removeAccessors(const std::string& name)
 	{
 		functors->second.setter = nullptr;
 		functors->second.getter = nullptr;
+		functors->second.typedSetter = nullptr;
+		functors->second.typedGetter = nullptr;
 	}
 }
 
+std::function<void(void)> Accessible::getTransfer(const std::string& name, const Accessible& target,
+		const std::string& targetName) const
+{
+	auto source = m_functors.find(name);
+	SURGSIM_ASSERT(source != m_functors.end() && source->second.getter != nullptr)
+			<< "Source does not have a readable property called <" << name << ">.";
+
+	auto destination = target.m_functors.find(targetName);
+	SURGSIM_ASSERT(destination != target.m_functors.end() && destination->second.setter != nullptr)
+			<< "Target does not have a writeable property called <" << targetName << ">.";
+
+	std::function<void(void)> result;
+	if (source->second.typedGetter != nullptr && destination->second.typedSetter != nullptr)
+	{
+		result = source->second.typedGetter->bindTransfer(destination->second.typedSetter);
+	}
+
+	if (result == nullptr)
+	{
+		GetterType getter = source->second.getter;
+		SetterType setter = destination->second.setter;
+		result = [getter, setter]() {setter(getter());};
+	}
+	return result;
+}
+
 
 bool Accessible::isReadable(const std::string& name) const
 {
@@ -198,6 +228,8 @@ void Accessible::forwardProperty(const std::string& name, const Accessible& targ
 		functors.setter = found->second.setter;
 		functors.encoder = found->second.encoder;
 		functors.decoder = found->second.decoder;
+		functors.typedGetter = found->second.typedGetter;
+		functors.typedSetter = found->second.typedSetter;
 		m_functors[name] = std::move(functors);
 	}
 	else
@@ -21,6 +21,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <yaml-cpp/yaml.h>
 
@@ -44,6 +45,9 @@ class Accessible
 	/// Destructor
 	~Accessible();
 
+	template <class T>
+	class Property;
+
 	typedef std::function<boost::any(void)> GetterType;
 	typedef std::function<void (boost::any)> SetterType;
 
@@ -109,6 +113,49 @@ class Accessible
 	/// \param	setter	The setter.
 	void setAccessors(const std::string& name, GetterType getter, SetterType setter);
 
+	/// Sets a typed getter for a given property, this also sets the untyped getter used by getValue().
+	/// The typed getter lets getProperty() and getTransfer() access the value without conversion through boost::any.
+	/// \throws SurgSim::Framework::AssertionFailure if func is a nullptr.
+	/// \tparam T The type of the property.
+	/// \param	name	The name of the property.
+	/// \param	func	The getter function.
+	template <class T>
+	void setTypedGetter(const std::string& name, std::function<T(void)> func);
+
+	/// Sets a typed setter for a given property, this does not change the untyped setter used by setValue().
+	/// \throws SurgSim::Framework::AssertionFailure if func is a nullptr.
+	/// \tparam T The type of the property.
+	/// \param	name	The name of the property.
+	/// \param	func	The setter function.
+	template <class T>
+	void setTypedSetter(const std::string& name, std::function<void(const T&)> func);
+
+	/// Resolves a property into a typed handle, the handle can be used to read and write the value without looking
+	/// up the name. If the property was registered with typed accessors of type T, the value will not be converted
+	/// through boost::any either.
+	/// \note The handle holds the accessors that were registered when it was created, changing the accessors later
+	///       will not affect it. Like forwardProperty() the handle does not keep this instance alive, if the instance
+	///       goes out of scope, the behavior is undefined.
+	/// \throws SurgSim::Framework::AssertionFailure if the property cannot be found.
+	/// \tparam T The type of the property.
+	/// \param name The name of the property.
+	/// \return The handle to the property.
+	template <class T>
+	Property<T> getProperty(const std::string& name) const;
+
+	/// Resolves the transfer of the value of a property of this instance into a property of another instance. If
+	/// the getter and the setter were registered with typed accessors of the same type, the value is copied directly,
+	/// otherwise it is converted through boost::any as with setValue(name, getValue(name)).
+	/// \note As with getProperty(), the instances need to outlive the returned function.
+	/// \throws SurgSim::Framework::AssertionFailure if the property of this instance is not readable or the
+	///         property of the target is not writeable.
+	/// \param name The name of the property of this instance.
+	/// \param target The instance that receives the value.
+	/// \param targetName The name of the property of the target.
+	/// \return A function that copies the current value from this instance to the target.
+	std::function<void(void)> getTransfer(const std::string& name, const Accessible& target,
+										  const std::string& targetName) const;
+
 	/// Removes all the accessors (getter and setter) for a given property
 	/// \param name The name of the property
 	void removeAccessors(const std::string& name);
@@ -160,6 +207,38 @@ class Accessible
 	Accessible& operator=(const Accessible& other) /*= delete*/;
 	/// @}
 
+	/// Type erased base for the typed setter of a property
+	struct TypedSetterBase
+	{
+		virtual ~TypedSetterBase() {}
+	};
+
+	/// Typed setter of a property
+	template <class T>
+	struct TypedSetter : public TypedSetterBase
+	{
+		std::function<void(const T&)> setter;
+	};
+
+	/// Type erased base for the typed getter of a property
+	struct TypedGetterBase
+	{
+		virtual ~TypedGetterBase() {}
+
+		/// \param setter The typed setter of the target property.
+		/// \return A function copying the value from this getter into the setter, nullptr if the types do not match.
+		virtual std::function<void(void)> bindTransfer(const std::shared_ptr<TypedSetterBase>& setter) const = 0;
+	};
+
+	/// Typed getter of a property
+	template <class T>
+	struct TypedGetter : public TypedGetterBase
+	{
+		std::function<void(void)> bindTransfer(const std::shared_ptr<TypedSetterBase>& setter) const override;
+
+		std::function<T(void)> getter;
+	};
+
 	/// Private struct to keep the map under control
 	struct Functors
 	{
@@ -168,12 +247,50 @@ class Accessible
 		SetterType setter;
 		EncoderType encoder;
 		DecoderType decoder;
+		std::shared_ptr<TypedGetterBase> typedGetter;
+		std::shared_ptr<TypedSetterBase> typedSetter;
 	};
 
 	std::unordered_map<std::string, Functors> m_functors;
 
 };
 
+/// Typed handle to a property of an Accessible, created by Accessible::getProperty(). Reading and writing through
+/// the handle does not look up the name of the property.
+/// \tparam T The type of the property.
+template <class T>
+class Accessible::Property
+{
+public:
+	/// Constructor, creates a handle that can neither read nor write.
+	Property();
+
+	/// \return true if the property has a getter
+	bool isReadable() const;
+
+	/// \return true if the property has a setter
+	bool isWriteable() const;
+
+	/// Retrieves the value of the property.
+	/// \throws SurgSim::Framework::AssertionFailure if the property is not readable.
+	/// \return The value of the property.
+	T getValue() const;
+
+	/// Sets the value of the property.
+	/// \throws SurgSim::Framework::AssertionFailure if the property is not writeable.
+	/// \param value The value that it should be set to.
+	void setValue(const T& value);
+
+private:
+	friend class Accessible;
+
+	/// The getter of the property
+	std::function<T(void)> m_getter;
+
+	/// The setter of the property
+	std::function<void(const T&)> m_setter;
+};
+
 /// Public struct to pair an accessible with its appropriate property
 struct Property
 {
@@ -207,18 +324,35 @@ SurgSim::Math::Matrix44f convert(boost::any val);
 template <>
 std::string convert(boost::any val);
 
+/// Bind a getter of an object to a function that returns the value of the getter, the return type of the function
+/// is deduced from the getter. This is used by the property macros to register typed getters.
+/// \param object The object whose getter should be called.
+/// \param getter The member function pointer of the getter.
+/// \return A function returning the value of the getter.
+template <class Object, class Class, class Result>
+std::function<typename std::decay<Result>::type(void)> bindGetter(Object* object, Result(Class::*getter)() const);
+
+/// Bind a non-const getter of an object to a function that returns the value of the getter, the return type of the
+/// function is deduced from the getter.
+/// \param object The object whose getter should be called.
+/// \param getter The member function pointer of the getter.
+/// \return A function returning the value of the getter.
+template <class Object, class Class, class Result>
+std::function<typename std::decay<Result>::type(void)> bindGetter(Object* object, Result(Class::*getter)());
+
 /// A macro to register getter and setter for a property that is readable and writeable,
 /// order of getter and setter agrees with 'RW'. Note that the property should not be quoted in the original
 /// macro call.
 #define SURGSIM_ADD_RW_PROPERTY(class, type, property, getter, setter) \
 	setAccessors(#property, \
 				std::bind(&class::getter, this),\
-				std::bind(&class::setter, this, std::bind(SurgSim::Framework::convert<type>,std::placeholders::_1)))
+				std::bind(&class::setter, this, std::bind(SurgSim::Framework::convert<type>,std::placeholders::_1)));\
+	setTypedGetter(#property, SurgSim::Framework::bindGetter(this, &class::getter));\
+	setTypedSetter<type>(#property, std::bind(&class::setter, this, std::placeholders::_1))
 
 /// A macro to register a getter for a property that is read only
 #define SURGSIM_ADD_RO_PROPERTY(class, type, property, getter) \
-	setGetter(#property, \
-	std::bind(&class::getter, this))
+	setTypedGetter(#property, SurgSim::Framework::bindGetter(this, &class::getter))
 
 /// A macro to register a serializable property, this needs to support reading, writing and all the
 /// conversions to and from YAML::Node
@@ -226,6 +360,8 @@ std::string convert(boost::any val);
 	setAccessors(#property, \
 				std::bind(&class::getter, this),\
 				std::bind(&class::setter, this, std::bind(SurgSim::Framework::convert<type>,std::placeholders::_1)));\
+	setTypedGetter(#property, SurgSim::Framework::bindGetter(this, &class::getter));\
+	setTypedSetter<type>(#property, std::bind(&class::setter, this, std::placeholders::_1));\
 	setSerializable(#property,\
 				std::bind(&YAML::convert<type>::encode, std::bind(&class::getter, this)),\
 				std::bind(&class::setter, this, std::bind(&YAML::Node::as<type>,std::placeholders::_1)))
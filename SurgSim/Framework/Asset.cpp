@@ -15,11 +15,26 @@
 
 #include "SurgSim/Framework/Asset.h"
 
+#include <boost/thread/lock_guard.hpp>
+
 #include "SurgSim/Framework/Accessible.h"
 #include "SurgSim/Framework/ApplicationData.h"
 #include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/AssetCache.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
+#include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/Runtime.h"
 
+namespace
+{
+/// Identifies a binary cache file
+const std::string BinaryCacheMagic = "OpenSurgSim binary cache";
+
+/// Version of the binary cache file format, increase it when the binary data written by any asset changes
+const uint32_t BinaryCacheVersion = 2;
+}
+
 namespace SurgSim
 {
 namespace Framework
@@ -47,7 +62,46 @@ void Asset::load(const std::string& fileName, const SurgSim::Framework::Applicat
 	std::string path = data.findFile(m_fileName);
 
 	SURGSIM_ASSERT(!path.empty()) << "Can not locate file " << m_fileName;
-	SURGSIM_ASSERT(doLoad(path)) << "Failed to load file " << m_fileName;
+
+	auto cache = SurgSim::Framework::Runtime::getAssetCache();
+	auto& factory = getFactory();
+	const std::string className = getClassName();
+
+	// Only hash the file for classes that can keep their data in the cache, in memory or in a binary cache file
+	size_t contentHash = 0;
+	if (cache->isEnabled() && isCacheable() && (factory.isRegistered(className) || cache->isBinaryCacheEnabled()) &&
+		cache->getContentHash(path, &contentHash))
+	{
+		boost::lock_guard<boost::mutex> lock(cache->getEntryMutex(className, path));
+
+		auto cached = cache->get(className, path, contentHash);
+		if (cached == nullptr || !doCopyData(*cached))
+		{
+			const bool useBinaryCache = cache->isBinaryCacheEnabled();
+			const std::string cacheFileName = cache->getBinaryCacheFileName(className, path);
+			if (!useBinaryCache || !tryReadBinaryCache(cacheFileName, contentHash))
+			{
+				SURGSIM_ASSERT(doLoad(path)) << "Failed to load file " << m_fileName;
+				if (useBinaryCache)
+				{
+					writeBinaryCache(cacheFileName, contentHash);
+				}
+			}
+
+			if (factory.isRegistered(className))
+			{
+				std::shared_ptr<Asset> copy = factory.create(className);
+				if (copy->doCopyData(*this))
+				{
+					cache->set(className, path, contentHash, copy);
+				}
+			}
+		}
+	}
+	else
+	{
+		SURGSIM_ASSERT(doLoad(path)) << "Failed to load file " << m_fileName;
+	}
 }
 
 void Asset::load(const std::string& fileName)
@@ -60,6 +114,57 @@ std::string Asset::getFileName() const
 	return m_fileName;
 }
 
+bool Asset::isCacheable() const
+{
+	return false;
+}
+
+bool Asset::doCopyData(const Asset& other)
+{
+	return false;
+}
+
+bool Asset::doWriteBinary(BinaryWriter* writer) const
+{
+	return false;
+}
+
+bool Asset::doReadBinary(BinaryReader* reader)
+{
+	return false;
+}
+
+bool Asset::tryReadBinaryCache(const std::string& cacheFileName, size_t contentHash)
+{
+	BinaryReader reader(cacheFileName);
+
+	std::string magic;
+	uint32_t version = 0;
+	std::string className;
+	uint64_t hash = 0;
+	bool result = reader.readString(&magic) && magic == BinaryCacheMagic &&
+				  reader.read(&version) && version == BinaryCacheVersion &&
+				  reader.readString(&className) && className == getClassName() &&
+				  reader.read(&hash) && hash == static_cast<uint64_t>(contentHash);
+
+	return result && doReadBinary(&reader) && reader.isValid();
+}
+
+void Asset::writeBinaryCache(const std::string& cacheFileName, size_t contentHash) const
+{
+	BinaryWriter writer;
+	writer.writeString(BinaryCacheMagic);
+	writer.write(BinaryCacheVersion);
+	writer.writeString(getClassName());
+	writer.write(static_cast<uint64_t>(contentHash));
+
+	if (doWriteBinary(&writer) && !writer.save(cacheFileName))
+	{
+		SURGSIM_LOG_WARNING(Logger::getLogger("Framework/Asset"))
+				<< "Could not write the binary cache file " << cacheFileName << " for " << m_fileName;
+	}
+}
+
 void Asset::serializeFileName(SurgSim::Framework::Accessible* accessible)
 {
 	// Special treatment to let std::bind() deal with overloaded function.
@@ -27,6 +27,8 @@ namespace Framework
 class Accessible;
 class ApplicationData;
 class AssetTest;
+class BinaryReader;
+class BinaryWriter;
 
 /// This class is used to facilitate file loading. It uses the static ApplicationData
 /// in SurgSim::Framework::Runtime to load file.
@@ -50,7 +52,11 @@ class Asset : virtual public Accessible, public FactoryBase<Asset>
 	virtual ~Asset();
 
 	/// Load a file with given name using 'data' as look up path(s).
-	/// If 'fileName' is not empty and the file is found, this method calls 'doLoad()' to load the file.
+	/// If 'fileName' is not empty and the file is found, this method calls 'doLoad()' to load the file. If the class
+	/// supports it (see isCacheable() and doCopyData()) and the same file has already been loaded for this class, the data is taken
+	/// from the AssetCache of the Runtime instead. If binary cache files are enabled in the AssetCache and the class
+	/// supports them (see doWriteBinary()), the data is read from the binary cache file of the file if it is up to
+	/// date, otherwise the binary cache file is written after loading.
 	/// Assertions will fail if 'fileName' is empty or file is not found or file loading is unsuccessful.
 	/// \note As a side effect, the name of the file will be recorded in
 	/// \note Asset::m_fileName and can be retrieved by Asset::getFileName().
@@ -77,12 +83,51 @@ class Asset : virtual public Accessible, public FactoryBase<Asset>
 	/// \return True if loading is successful; Otherwise, false.
 	virtual bool doLoad(const std::string& filePath) = 0;
 
+	/// Derived classes that overwrite doCopyData() or doWriteBinary() need to overwrite this method to return true.
+	/// Asset::load() only hashes the file and looks it up in the AssetCache for classes that support the cache.
+	/// \return True if the class supports the AssetCache; the default returns false.
+	virtual bool isCacheable() const;
+
+	/// Derived classes can overwrite this method to let Asset::load() use the AssetCache, it should copy all the
+	/// data that doLoad() produces from another instance of the same class. Large data should be shared with the
+	/// other instance until it is modified (e.g. TriangleMesh::shareData()), rather than copied.
+	/// \note Classes supporting this need to be registered in the Asset factory, so that the cache can create the
+	/// instance holding its copy of the data.
+	/// \param other An instance of the same class as this one.
+	/// \return True if the data was copied; the default does not copy anything and returns false, in which case the
+	/// files are always loaded with doLoad().
+	virtual bool doCopyData(const Asset& other);
+
+	/// Derived classes can overwrite this method to support binary cache files, it should write all the data that
+	/// doLoad() produces, including data derived from the file that is expensive to compute.
+	/// \param writer The writer for the binary cache file.
+	/// \return True if the data was written; the default writes nothing and returns false, in which case no binary
+	/// cache file is written.
+	virtual bool doWriteBinary(BinaryWriter* writer) const;
+
+	/// Derived classes that overwrite doWriteBinary() need to overwrite this method to read the data back, the asset
+	/// should only be modified if all the data could be read.
+	/// \param reader The reader for the binary cache file.
+	/// \return True if the data was read, otherwise the file will be loaded with doLoad().
+	virtual bool doReadBinary(BinaryReader* reader);
+
 private:
 	/// Wrap the registration calls for the filename property, which is more complicated due to the overloaded
 	/// function call load()
 	/// \param accessible 'this' pointer of derived class.
 	void serializeFileName(SurgSim::Framework::Accessible* accessible);
 
+	/// Try to read the data from a binary cache file.
+	/// \param cacheFileName The name of the binary cache file.
+	/// \param contentHash The hash of the content of the source file.
+	/// \return true if the cache file was up to date and the data was read.
+	bool tryReadBinaryCache(const std::string& cacheFileName, size_t contentHash);
+
+	/// Write the data to a binary cache file, if the class supports it.
+	/// \param cacheFileName The name of the binary cache file.
+	/// \param contentHash The hash of the content of the source file.
+	void writeBinaryCache(const std::string& cacheFileName, size_t contentHash) const;
+
 	/// Name of the file to be loaded.
 	std::string m_fileName;
 };
@@ -0,0 +1,275 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/AssetCache.h"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <vector>
+
+#include "SurgSim/Framework/Asset.h"
+
+namespace
+{
+/// The size of the chunks the files are read in to hash them
+const size_t HASH_CHUNK_SIZE = 64 * 1024;
+
+std::string makeKey(const std::string& className, const std::string& path)
+{
+	return className + "|" + path;
+}
+}
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+AssetCache::AssetCache() :
+	m_useCounter(0),
+	m_maxSize(64),
+	m_isEnabled(true),
+	m_isBinaryCacheEnabled(false),
+	m_hitCount(0)
+{
+}
+
+AssetCache::~AssetCache()
+{
+}
+
+void AssetCache::setEnabled(bool enabled)
+{
+	m_isEnabled = enabled;
+}
+
+bool AssetCache::isEnabled() const
+{
+	return m_isEnabled;
+}
+
+void AssetCache::setBinaryCacheEnabled(bool enabled)
+{
+	m_isBinaryCacheEnabled = enabled;
+}
+
+bool AssetCache::isBinaryCacheEnabled() const
+{
+	return m_isBinaryCacheEnabled;
+}
+
+void AssetCache::setBinaryCacheDirectory(const std::string& directory)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_binaryCacheDirectory = directory;
+}
+
+std::string AssetCache::getBinaryCacheDirectory() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_binaryCacheDirectory;
+}
+
+std::string AssetCache::getBinaryCacheFileName(const std::string& className, const std::string& path) const
+{
+	auto isNotAlphanumeric = [](char c) {return !std::isalnum(static_cast<unsigned char>(c));};
+	std::string suffix = className;
+	std::replace_if(suffix.begin(), suffix.end(), isNotAlphanumeric, '_');
+	suffix += ".osscache";
+
+	std::string directory = getBinaryCacheDirectory();
+	if (directory.empty())
+	{
+		return path + "." + suffix;
+	}
+
+	// All cache files share one directory, the hash of the full source path keeps them apart
+	std::ostringstream fileName;
+	fileName << boost::filesystem::path(path).filename().string() << "." << std::hex
+			 << std::hash<std::string>()(path) << "." << suffix;
+	return (boost::filesystem::path(directory) / fileName.str()).string();
+}
+
+boost::mutex& AssetCache::getEntryMutex(const std::string& className, const std::string& path)
+{
+	return getEntry(className, path)->loadingMutex;
+}
+
+std::shared_ptr<const Asset> AssetCache::get(const std::string& className, const std::string& path,
+		size_t contentHash) const
+{
+	std::shared_ptr<const Asset> result;
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	auto found = m_entries.find(makeKey(className, path));
+	if (found != m_entries.end() && found->second->asset != nullptr && found->second->contentHash == contentHash)
+	{
+		result = found->second->asset;
+		found->second->lastUse = ++m_useCounter;
+		++m_hitCount;
+	}
+	return result;
+}
+
+void AssetCache::set(const std::string& className, const std::string& path, size_t contentHash,
+					 std::shared_ptr<const Asset> asset)
+{
+	Entry* entry = getEntry(className, path);
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	entry->contentHash = contentHash;
+	entry->asset = std::move(asset);
+	entry->lastUse = ++m_useCounter;
+	evict();
+}
+
+void AssetCache::clear()
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		it->second->asset = nullptr;
+	}
+	m_fileHashes.clear();
+}
+
+size_t AssetCache::getSize() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	size_t result = 0;
+	for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it)
+	{
+		if (it->second->asset != nullptr)
+		{
+			++result;
+		}
+	}
+	return result;
+}
+
+size_t AssetCache::getHitCount() const
+{
+	return m_hitCount;
+}
+
+void AssetCache::setMaxSize(size_t maxSize)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_maxSize = maxSize;
+	evict();
+}
+
+size_t AssetCache::getMaxSize() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_maxSize;
+}
+
+bool AssetCache::getContentHash(const std::string& path, size_t* contentHash)
+{
+	boost::system::error_code error;
+	const std::time_t modificationTime = boost::filesystem::last_write_time(path, error);
+	const uintmax_t size = error ? 0 : boost::filesystem::file_size(path, error);
+	if (error)
+	{
+		return tryHashFile(path, contentHash);
+	}
+
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		auto found = m_fileHashes.find(path);
+		if (found != m_fileHashes.end() && found->second.modificationTime == modificationTime &&
+			found->second.size == size)
+		{
+			*contentHash = found->second.contentHash;
+			return true;
+		}
+	}
+
+	if (!tryHashFile(path, contentHash))
+	{
+		return false;
+	}
+
+	FileHash fileHash = {modificationTime, size, *contentHash};
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_fileHashes[path] = fileHash;
+	return true;
+}
+
+bool AssetCache::tryHashFile(const std::string& path, size_t* contentHash)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	// Hash the file in chunks, so that large files are not held in memory
+	std::vector<char> buffer(HASH_CHUNK_SIZE);
+	size_t hash = 0;
+	while (file)
+	{
+		file.read(buffer.data(), buffer.size());
+		const std::streamsize count = file.gcount();
+		boost::hash_range(hash, buffer.data(), buffer.data() + count);
+	}
+	*contentHash = hash;
+	return !file.bad();
+}
+
+void AssetCache::evict()
+{
+	std::vector<Entry*> cached;
+	for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if (it->second->asset != nullptr)
+		{
+			cached.push_back(it->second.get());
+		}
+	}
+	if (cached.size() <= m_maxSize)
+	{
+		return;
+	}
+
+	auto isOlder = [](const Entry* lhs, const Entry* rhs) {return lhs->lastUse < rhs->lastUse;};
+	auto last = cached.begin() + (cached.size() - m_maxSize);
+	std::nth_element(cached.begin(), last, cached.end(), isOlder);
+	for (auto it = cached.begin(); it != last; ++it)
+	{
+		(*it)->asset = nullptr;
+	}
+}
+
+AssetCache::Entry* AssetCache::getEntry(const std::string& className, const std::string& path)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	auto& entry = m_entries[makeKey(className, path)];
+	if (entry == nullptr)
+	{
+		entry.reset(new Entry);
+	}
+	return entry.get();
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
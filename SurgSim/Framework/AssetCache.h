@@ -0,0 +1,215 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_ASSETCACHE_H
+#define SURGSIM_FRAMEWORK_ASSETCACHE_H
+
+#include <atomic>
+#include <boost/thread/mutex.hpp>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+class Asset;
+
+/// Process wide cache of loaded assets, used by Asset::load() so that a file that is referenced by many components
+/// is only read and parsed once. Entries are keyed by the class of the asset and the resolved path of the file, and
+/// are only used while the content of the file still matches the hash that was recorded when it was loaded. The file
+/// is only hashed again when its modification time or size changed, see getContentHash().
+/// The cache holds a private instance of the loaded data, instances that load the same file share its storage where
+/// the asset supports it (e.g. TriangleMesh::shareData()) until they modify it. The cache keeps at most getMaxSize()
+/// files, the least recently used ones are evicted first.
+/// Additionally the cache can store the preprocessed data of assets in binary cache files on disk, so that the next
+/// start of the application can skip parsing and preprocessing the source files, see setBinaryCacheEnabled().
+/// All functions are thread safe.
+/// \sa Runtime::getAssetCache()
+class AssetCache
+{
+public:
+	/// Constructor
+	AssetCache();
+
+	/// Destructor
+	~AssetCache();
+
+	/// Enable or disable the cache, when disabled Asset::load() always loads the file.
+	/// \param enabled Whether the cache should be used.
+	void setEnabled(bool enabled);
+
+	/// \return true if the cache is used by Asset::load()
+	bool isEnabled() const;
+
+	/// Enable or disable the binary cache files, this is disabled by default. When enabled, Asset::load() reads the
+	/// preprocessed data of assets that support it (see Asset::doWriteBinary()) from a binary cache file if its
+	/// recorded hash matches the content of the source file, and otherwise writes the cache file after loading.
+	/// The binary cache files are only used while the cache itself is enabled.
+	/// \param enabled Whether the binary cache files should be used.
+	void setBinaryCacheEnabled(bool enabled);
+
+	/// \return true if binary cache files are used by Asset::load()
+	bool isBinaryCacheEnabled() const;
+
+	/// Set the directory for the binary cache files.
+	/// \param directory The directory, if empty (the default) the cache files are written next to the source files.
+	void setBinaryCacheDirectory(const std::string& directory);
+
+	/// \return The directory for the binary cache files, empty if they are written next to the source files
+	std::string getBinaryCacheDirectory() const;
+
+	/// Get the name of the binary cache file for a source file.
+	/// \param className The class name of the asset.
+	/// \param path The resolved path of the source file.
+	/// \return The name of the binary cache file.
+	std::string getBinaryCacheFileName(const std::string& className, const std::string& path) const;
+
+	/// Get the mutex for loading the given file as the given class, it should be held while looking up and loading
+	/// the file. Concurrent loads of the same file then wait for the first one and use its data, while different
+	/// files can be loaded in parallel.
+	/// \param className The class name of the asset.
+	/// \param path The resolved path of the file.
+	/// \return The mutex for the entry.
+	boost::mutex& getEntryMutex(const std::string& className, const std::string& path);
+
+	/// Look up the data loaded from a file.
+	/// \param className The class name of the asset.
+	/// \param path The resolved path of the file.
+	/// \param contentHash The hash of the current content of the file.
+	/// \return The cached copy of the asset, nullptr if the file was not loaded or its content has changed since.
+	std::shared_ptr<const Asset> get(const std::string& className, const std::string& path, size_t contentHash) const;
+
+	/// Store the data loaded from a file, replacing any previous data for the same entry.
+	/// \param className The class name of the asset.
+	/// \param path The resolved path of the file.
+	/// \param contentHash The hash of the content of the file.
+	/// \param asset A copy of the loaded asset, the cache needs to be the only owner of this instance.
+	void set(const std::string& className, const std::string& path, size_t contentHash,
+			 std::shared_ptr<const Asset> asset);
+
+	/// Remove all the cached data.
+	void clear();
+
+	/// \return The number of files with cached data.
+	size_t getSize() const;
+
+	/// \return The number of lookups that found cached data.
+	size_t getHitCount() const;
+
+	/// Set the maximum number of files with cached data, the least recently used files are evicted when it is
+	/// exceeded. The default is 64.
+	/// \param maxSize The maximum number of files with cached data.
+	void setMaxSize(size_t maxSize);
+
+	/// \return The maximum number of files with cached data.
+	size_t getMaxSize() const;
+
+	/// Get the hash of the content of a file, the file is only read and hashed if its modification time or size
+	/// changed since the last call for the same path.
+	/// \param path The path of the file.
+	/// \param [out] contentHash The hash of the content of the file.
+	/// \return true if the file could be read.
+	bool getContentHash(const std::string& path, size_t* contentHash);
+
+	/// Compute the hash of the content of a file.
+	/// \param path The path of the file.
+	/// \param [out] contentHash The hash of the content of the file.
+	/// \return true if the file could be read.
+	static bool tryHashFile(const std::string& path, size_t* contentHash);
+
+private:
+	/// @{
+	/// Prevent default copy construction and default assignment
+	AssetCache(const AssetCache& other);
+	AssetCache& operator=(const AssetCache& other);
+	/// @}
+
+	/// Cached data for one file
+	struct Entry
+	{
+		Entry() : contentHash(0), lastUse(0) {}
+
+		/// Lock held while the file is looked up or loaded
+		boost::mutex loadingMutex;
+
+		/// Hash of the content of the file
+		size_t contentHash;
+
+		/// The copy of the loaded asset, nullptr if nothing is cached yet or it was evicted
+		std::shared_ptr<const Asset> asset;
+
+		/// Value of the use counter when the entry was last looked up or set
+		mutable size_t lastUse;
+	};
+
+	/// Hash of the content of a file, with the state of the file when it was computed
+	struct FileHash
+	{
+		/// Modification time of the file
+		std::time_t modificationTime;
+
+		/// Size of the file
+		uintmax_t size;
+
+		/// Hash of the content of the file
+		size_t contentHash;
+	};
+
+	/// Evict the least recently used data until no more than m_maxSize files are cached, m_mutex must be held
+	void evict();
+
+	/// Find an entry, creating it if it does not exist yet
+	/// \param className The class name of the asset.
+	/// \param path The resolved path of the file.
+	/// \return The entry, entries are never removed so the pointer stays valid
+	Entry* getEntry(const std::string& className, const std::string& path);
+
+	/// Protects the map of entries and the data in the entries
+	mutable boost::mutex m_mutex;
+
+	/// The entries, keyed by class name and path
+	std::unordered_map<std::string, std::unique_ptr<Entry>> m_entries;
+
+	/// The hashes of the files, keyed by path
+	std::unordered_map<std::string, FileHash> m_fileHashes;
+
+	/// Incremented on every lookup or store, to find the least recently used entries
+	mutable size_t m_useCounter;
+
+	/// The maximum number of files with cached data
+	size_t m_maxSize;
+
+	/// Whether the cache is used
+	std::atomic<bool> m_isEnabled;
+
+	/// Whether the binary cache files are used
+	std::atomic<bool> m_isBinaryCacheEnabled;
+
+	/// The directory for the binary cache files
+	std::string m_binaryCacheDirectory;
+
+	/// The number of lookups that found cached data
+	mutable std::atomic<size_t> m_hitCount;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_ASSETCACHE_H
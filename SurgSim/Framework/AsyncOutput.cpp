@@ -0,0 +1,138 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/AsyncOutput.h"
+
+#include <sstream>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace
+{
+/// Time the background thread sleeps when there is nothing to write
+const boost::posix_time::milliseconds idlePeriod(1);
+}
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+AsyncOutput::AsyncOutput(std::shared_ptr<LogOutput> output, size_t capacity, FullQueuePolicy policy) :
+	m_output(output),
+	m_policy(policy),
+	m_queue(capacity),
+	m_isRunning(true),
+	m_queuedCount(0),
+	m_writtenCount(0),
+	m_droppedCount(0)
+{
+	SURGSIM_ASSERT(m_output != nullptr) << "AsyncOutput needs an output to write to.";
+	m_thread = boost::thread(&AsyncOutput::run, this);
+}
+
+AsyncOutput::~AsyncOutput()
+{
+	m_isRunning = false;
+	m_thread.join();
+}
+
+bool AsyncOutput::writeMessage(const std::string& message)
+{
+	if (m_queue.tryPush(message))
+	{
+		++m_queuedCount;
+		return true;
+	}
+
+	if (m_policy == FULL_QUEUE_BLOCK)
+	{
+		while (!m_queue.tryPush(message))
+		{
+			boost::this_thread::yield();
+		}
+		++m_queuedCount;
+		return true;
+	}
+
+	++m_droppedCount;
+	return false;
+}
+
+void AsyncOutput::flush()
+{
+	size_t queued = m_queuedCount;
+	while (m_writtenCount < queued)
+	{
+		boost::this_thread::sleep(idlePeriod);
+	}
+}
+
+std::shared_ptr<LogOutput> AsyncOutput::getOutput() const
+{
+	return m_output;
+}
+
+AsyncOutput::FullQueuePolicy AsyncOutput::getFullQueuePolicy() const
+{
+	return m_policy;
+}
+
+size_t AsyncOutput::getDroppedMessageCount() const
+{
+	return m_droppedCount;
+}
+
+size_t AsyncOutput::getWrittenMessageCount() const
+{
+	return m_writtenCount;
+}
+
+void AsyncOutput::run()
+{
+	std::string message;
+	size_t reportedDrops = 0;
+	while (true)
+	{
+		if (m_queue.tryPop(&message))
+		{
+			m_output->writeMessage(message);
+			++m_writtenCount;
+		}
+		else
+		{
+			// Report drops once the queue was drained, there is space again at this point
+			size_t drops = m_droppedCount;
+			if (drops != reportedDrops)
+			{
+				std::ostringstream report;
+				report << "AsyncOutput dropped " << drops - reportedDrops << " messages, the queue was full.";
+				m_output->writeMessage(report.str());
+				reportedDrops = drops;
+			}
+			else if (!m_isRunning)
+			{
+				break;
+			}
+			else
+			{
+				boost::this_thread::sleep(idlePeriod);
+			}
+		}
+	}
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
@@ -0,0 +1,99 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_ASYNCOUTPUT_H
+#define SURGSIM_FRAMEWORK_ASYNCOUTPUT_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <boost/thread.hpp>
+
+#include "SurgSim/Framework/LockFreeQueue.h"
+#include "SurgSim/Framework/LogOutput.h"
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Log output that decouples the logging threads from the actual output, e.g. a FileOutput or a StreamOutput.
+/// Messages are put into a lock free queue and written to the wrapped output by a background thread, so that
+/// logging from a high rate thread never waits for disk or console I/O.
+/// When the queue is full the message is either dropped or the caller waits until there is space, depending on
+/// the policy. Dropped messages are counted and reported through the wrapped output once there is space again.
+class AsyncOutput : public LogOutput
+{
+public:
+	/// Policies for handling messages when the queue is full
+	enum FullQueuePolicy
+	{
+		/// Discard the message and count it as dropped, the caller never waits
+		FULL_QUEUE_DROP,
+		/// Wait until the background thread made space in the queue, no message is lost
+		FULL_QUEUE_BLOCK
+	};
+
+	/// Constructor
+	/// \param output the output that the messages will be written to by the background thread
+	/// \param capacity the maximum number of messages waiting to be written, rounded up to the next power of 2
+	/// \param policy what to do with messages when the queue is full
+	explicit AsyncOutput(std::shared_ptr<LogOutput> output, size_t capacity = 4096,
+						 FullQueuePolicy policy = FULL_QUEUE_DROP);
+
+	/// Destructor, writes out all the messages that are still queued
+	virtual ~AsyncOutput();
+
+	/// Queue a message to be written out, the formatting and the copy of the message happen on the calling thread.
+	/// \param message to be written out
+	/// \return true if the message was queued, false if it was dropped
+	bool writeMessage(const std::string& message) override;
+
+	/// Block until all the messages queued so far have been written out
+	void flush();
+
+	/// \return the output that the messages are written to
+	std::shared_ptr<LogOutput> getOutput() const;
+
+	/// \return the policy used when the queue is full
+	FullQueuePolicy getFullQueuePolicy() const;
+
+	/// \return the number of messages that were dropped because the queue was full
+	size_t getDroppedMessageCount() const;
+
+	/// \return the number of messages that were written to the output
+	size_t getWrittenMessageCount() const;
+
+private:
+	/// Loop of the background thread
+	void run();
+
+	std::shared_ptr<LogOutput> m_output;
+	FullQueuePolicy m_policy;
+	LockFreeQueue<std::string> m_queue;
+
+	std::atomic<bool> m_isRunning;
+	std::atomic<size_t> m_queuedCount;
+	std::atomic<size_t> m_writtenCount;
+	std::atomic<size_t> m_droppedCount;
+
+	boost::thread m_thread;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_ASYNCOUTPUT_H
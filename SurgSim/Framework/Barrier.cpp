@@ -50,6 +50,12 @@ bool SurgSim::Framework::Barrier::wait(bool success)
 		return m_successResult;
 	}
 
+	if (m_count == 1)
+	{
+		// Wake up a thread in waitForOthers()
+		m_cond.notify_all();
+	}
+
 	while (gen == m_generation)
 	{
 		m_cond.wait(lock);
@@ -57,3 +63,34 @@ bool SurgSim::Framework::Barrier::wait(bool success)
 	return m_successResult;
 }
 
+void SurgSim::Framework::Barrier::drop()
+{
+	boost::mutex::scoped_lock lock(m_mutex);
+	SURGSIM_ASSERT(m_threshold > 1) << "Cannot drop the last thread of a barrier";
+
+	--m_threshold;
+	--m_count;
+
+	if (m_count == 0)
+	{
+		m_generation++;
+		m_count = m_threshold;
+		m_successResult = m_success;
+		m_success = true;
+		m_cond.notify_all();
+	}
+	else if (m_count == 1)
+	{
+		m_cond.notify_all();
+	}
+}
+
+void SurgSim::Framework::Barrier::waitForOthers()
+{
+	boost::mutex::scoped_lock lock(m_mutex);
+	while (m_count > 1)
+	{
+		m_cond.wait(lock);
+	}
+}
+
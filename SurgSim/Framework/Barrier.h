@@ -60,6 +60,14 @@ class Barrier
 	/// \return true if all threads claimed success, false otherwise.
 	bool wait(bool success);
 
+	/// Removes the calling thread from the synchronized threads, the other threads do not wait for it anymore.
+	/// If all the remaining threads are already waiting they are released.
+	void drop();
+
+	/// Blocks until all the other threads are waiting at the barrier, without waiting at the barrier itself. This
+	/// lets one of the synchronized threads act while all the others are parked, until it calls wait().
+	void waitForOthers();
+
 private:
 	boost::mutex m_mutex;
 	boost::condition_variable m_cond;
@@ -22,6 +22,14 @@
 #include "SurgSim/Framework/Clock.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/Tracer.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace SurgSim
 {
@@ -35,8 +43,16 @@ BasicThread::BasicThread(const std::string& name) :
 	m_isIdle(false),
 	m_isInitialized(false),
 	m_isRunning(false),
+	m_hasQuit(false),
 	m_stopExecution(false),
-	m_isSynchronous(false)
+	m_isSynchronous(false),
+	m_timingPolicy(TIMING_POLICY_SLEEP),
+	m_spinWindow(0.002),
+	m_cpuAffinity(-1),
+	m_realTimePriority(0),
+	m_virtualFramePeriod(0.0),
+	m_virtualFrameCount(0),
+	m_virtualUpdateCount(0)
 {
 	// The maximum number of frames in the timer is set to 1,000,000
 	// + If the timer is reset every second, that is enough frame to measure real rates up to 1MHz
@@ -72,6 +88,11 @@ bool BasicThread::isRunning() const
 	return m_isRunning;
 }
 
+bool BasicThread::hasQuit() const
+{
+	return m_hasQuit;
+}
+
 bool BasicThread::initialize()
 {
 	m_isInitialized = doInitialize();
@@ -89,6 +110,7 @@ void BasicThread::start(std::shared_ptr<Barrier> startupBarrier, bool isSynchron
 	m_startupBarrier = startupBarrier;
 	m_stopExecution = false;
 	m_isRunning = false;
+	m_hasQuit = false;
 	m_isSynchronous = isSynchronized;
 
 	// Start the thread with a reference to this
@@ -103,30 +125,39 @@ boost::thread& BasicThread::getThread()
 
 void BasicThread::operator()()
 {
+	Tracer::setThreadName(getName());
+	applySchedulingSettings();
+
 	bool success = executeInitialization();
 	if (! success)
 	{
+		quit();
 		return;
 	}
 
-
 	size_t numUpdates = 0;
 	boost::chrono::duration<double> totalFrameTime(0.0);
 	boost::chrono::duration<double> sleepTime(0.0);
 	boost::chrono::duration<double> totalSleepTime(0.0);
 	Clock::time_point start;
+	bool isVirtualFrame = false;
 
 	m_isRunning = true;
 	m_timer.start();
 	while (m_isRunning && !m_stopExecution)
 	{
 		start = Clock::now();
-		if (! m_isSynchronous)
+		// After a virtual frame the stepping thread expects this thread back on the barrier, even if it was
+		// switched to asynchronous execution in the meantime
+		if (! m_isSynchronous && ! isVirtualFrame)
 		{
 			if (!m_isIdle)
 			{
 				m_timer.beginFrame();
-				m_isRunning = doUpdate(m_period.count());
+				{
+					SURGSIM_TRACE_SCOPE("Thread", "Update");
+					m_isRunning = doUpdate(m_period.count());
+				}
 				m_timer.endFrame();
 			}
 
@@ -135,7 +166,13 @@ void BasicThread::operator()()
 			if (sleepTime.count() > 0.0)
 			{
 				totalSleepTime += sleepTime;
-				SurgSim::Framework::sleep_until(start + m_period);
+				Clock::time_point end = boost::chrono::time_point_cast<Clock::duration>(start + m_period);
+				waitUntil(end);
+				m_frameTimingStatistics.addFrame(boost::chrono::duration<double>(Clock::now() - end).count(), 0.0);
+			}
+			else
+			{
+				m_frameTimingStatistics.addFrame(0.0, -sleepTime.count());
 			}
 		}
 		else
@@ -147,11 +184,28 @@ void BasicThread::operator()()
 			bool success = waitForBarrier(true);
 			totalSleepTime += Clock::now() - start;
 
+			// The virtual clock has to be checked after the barrier, it might have been changed while waiting
+			isVirtualFrame = m_virtualFramePeriod.count() > 0.0;
 			if (success && !m_isIdle)
 			{
-				m_timer.beginFrame();
-				m_isRunning = doUpdate(m_period.count());
-				m_timer.endFrame();
+				if (isVirtualFrame)
+				{
+					doVirtualFrame();
+				}
+				else
+				{
+					m_timer.beginFrame();
+					{
+						SURGSIM_TRACE_SCOPE("Thread", "Update");
+						m_isRunning = doUpdate(m_period.count());
+					}
+					m_timer.endFrame();
+				}
+			}
+			if (success && isVirtualFrame)
+			{
+				// Signal the end of the frame, even when stopping, otherwise the stepping thread would never return
+				success = waitForBarrier(true);
 			}
 			if (! success || !m_isRunning)
 			{
@@ -177,6 +231,7 @@ void BasicThread::operator()()
 			}
 		}
 	}
+	quit();
 
 	doBeforeStop();
 
@@ -248,10 +303,21 @@ bool BasicThread::executeInitialization()
 	return success;
 }
 
+void BasicThread::quit()
+{
+	m_hasQuit = true;
+	// The other threads on the barrier must not wait for this one anymore
+	if (m_startupBarrier != nullptr)
+	{
+		m_startupBarrier->drop();
+	}
+}
+
 bool BasicThread::waitForBarrier(bool success)
 {
 	if (m_startupBarrier != nullptr)
 	{
+		SURGSIM_TRACE_SCOPE("Thread", "Barrier");
 		success = m_startupBarrier->wait(success);
 	}
 	return success;
@@ -271,6 +337,157 @@ bool BasicThread::isSynchronous()
 	return m_isSynchronous;
 }
 
+void BasicThread::setTimingPolicy(TimingPolicy policy, double spinWindow)
+{
+	SURGSIM_ASSERT(spinWindow >= 0.0) << "The spin window cannot be negative, got " << spinWindow;
+	m_timingPolicy = policy;
+	m_spinWindow = boost::chrono::duration<double>(spinWindow);
+}
+
+TimingPolicy BasicThread::getTimingPolicy() const
+{
+	return m_timingPolicy;
+}
+
+double BasicThread::getSpinWindow() const
+{
+	return m_spinWindow.count();
+}
+
+void BasicThread::setCpuAffinity(int cpu)
+{
+	SURGSIM_ASSERT(!m_isRunning) << "Cannot change the cpu affinity of thread " << m_name << " while it is running.";
+	m_cpuAffinity = cpu;
+}
+
+int BasicThread::getCpuAffinity() const
+{
+	return m_cpuAffinity;
+}
+
+void BasicThread::setRealTimePriority(int priority)
+{
+	SURGSIM_ASSERT(!m_isRunning) << "Cannot change the priority of thread " << m_name << " while it is running.";
+	SURGSIM_ASSERT(priority >= 0) << "The real time priority cannot be negative, got " << priority;
+	m_realTimePriority = priority;
+}
+
+int BasicThread::getRealTimePriority() const
+{
+	return m_realTimePriority;
+}
+
+const FrameTimingStatistics& BasicThread::getFrameTimingStatistics() const
+{
+	return m_frameTimingStatistics;
+}
+
+void BasicThread::resetFrameTimingStatistics()
+{
+	m_frameTimingStatistics.reset();
+}
+
+void BasicThread::waitUntil(const Clock::time_point& time)
+{
+	switch (m_timingPolicy)
+	{
+	case TIMING_POLICY_HYBRID:
+		hybrid_sleep_until(time, m_spinWindow);
+		break;
+	case TIMING_POLICY_BUSY_WAIT:
+		spin_until(time);
+		break;
+	default:
+		SurgSim::Framework::sleep_until(time);
+		break;
+	}
+}
+
+void BasicThread::applySchedulingSettings()
+{
+#if defined(_WIN32)
+	HANDLE handle = GetCurrentThread();
+	if (m_cpuAffinity >= 0 && SetThreadAffinityMask(handle, DWORD_PTR(1) << m_cpuAffinity) == 0)
+	{
+		SURGSIM_LOG_WARNING(m_logger) << "Could not set the affinity of thread " << m_name << " to cpu "
+			<< m_cpuAffinity << ", error " << GetLastError();
+	}
+	if (m_realTimePriority > 0 && !SetThreadPriority(handle, THREAD_PRIORITY_TIME_CRITICAL))
+	{
+		SURGSIM_LOG_WARNING(m_logger) << "Could not raise the priority of thread " << m_name
+			<< ", error " << GetLastError();
+	}
+#elif defined(__linux__)
+	if (m_cpuAffinity >= 0)
+	{
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(m_cpuAffinity, &cpus);
+		int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus);
+		if (error != 0)
+		{
+			SURGSIM_LOG_WARNING(m_logger) << "Could not set the affinity of thread " << m_name << " to cpu "
+				<< m_cpuAffinity << ", error " << error;
+		}
+	}
+	if (m_realTimePriority > 0)
+	{
+		sched_param parameters;
+		parameters.sched_priority = m_realTimePriority;
+		int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters);
+		if (error != 0)
+		{
+			SURGSIM_LOG_WARNING(m_logger) << "Could not set SCHED_FIFO priority " << m_realTimePriority
+				<< " for thread " << m_name << ", error " << error;
+		}
+	}
+#else
+	if (m_cpuAffinity >= 0 || m_realTimePriority > 0)
+	{
+		SURGSIM_LOG_WARNING(m_logger) << "Cpu affinity and real time priority are not supported on this platform, "
+			<< "ignored for thread " << m_name;
+	}
+#endif
+}
+
+void BasicThread::setVirtualFramePeriod(double period)
+{
+	SURGSIM_ASSERT(period >= 0.0) << "The virtual frame period cannot be negative, got " << period;
+	m_virtualFramePeriod = boost::chrono::duration<double>(period);
+	m_virtualFrameCount = 0;
+	m_virtualUpdateCount = 0;
+}
+
+double BasicThread::getVirtualFramePeriod() const
+{
+	return m_virtualFramePeriod.count();
+}
+
+double BasicThread::getSimulatedTime() const
+{
+	return static_cast<double>(m_virtualUpdateCount) * m_period.count();
+}
+
+void BasicThread::doVirtualFrame()
+{
+	++m_virtualFrameCount;
+
+	// Counting frames and updates rather than accumulating time keeps the number of updates per frame exact, the
+	// tolerance absorbs the rounding of periods that are integer fractions of the frame period.
+	const double frameEnd = static_cast<double>(m_virtualFrameCount) * m_virtualFramePeriod.count();
+	const double tolerance = 1e-9 * m_virtualFramePeriod.count();
+	while (m_isRunning && static_cast<double>(m_virtualUpdateCount + 1) * m_period.count() <= frameEnd + tolerance)
+	{
+		m_timer.beginFrame();
+		{
+			SURGSIM_TRACE_SCOPE("Thread", "Update");
+			m_isRunning = doUpdate(m_period.count());
+		}
+		m_timer.endFrame();
+		++m_virtualUpdateCount;
+	}
+}
+
 double BasicThread::getCpuTime() const
 {
 	return m_timer.getCumulativeTime();
@@ -23,6 +23,8 @@
 #include <boost/chrono.hpp>
 
 #include "SurgSim/Framework/Barrier.h"
+#include "SurgSim/Framework/Clock.h"
+#include "SurgSim/Framework/FrameTimingStatistics.h"
 #include "SurgSim/Framework/Timer.h"
 
 namespace SurgSim
@@ -33,6 +35,17 @@ namespace Framework
 class Component;
 class Runtime;
 
+/// Policies for waiting out the remainder of the update period of a thread
+enum TimingPolicy
+{
+	/// Sleep, yielding for the last few milliseconds to account for scheduler errors, uses little cpu
+	TIMING_POLICY_SLEEP,
+	/// Sleep until shortly before the end of the period then busy wait, precise at a moderate cpu cost
+	TIMING_POLICY_HYBRID,
+	/// Busy wait for the whole remainder of the period, the most precise but keeps a core fully busy
+	TIMING_POLICY_BUSY_WAIT
+};
+
 /// Basic thread implementation, tries to maintain a constant rate, supplies
 /// startup an initialization, can be synchronized with other threads at startup
 /// after calling doRun() a thread be be set off and doInit() and doStartup() will
@@ -89,6 +102,10 @@ class BasicThread
 	/// \return	true if the threads update() function is being called
 	bool isRunning() const;
 
+	/// Query if this object left its update loop, it will not update or wait on the startup barrier anymore.
+	/// \return true if the initialization failed, doUpdate() returned false or the thread was stopped
+	bool hasQuit() const;
+
 	/// This is what boost::thread executes on thread creation.
 	void operator()();
 
@@ -105,6 +122,12 @@ class BasicThread
 		m_period = boost::chrono::duration<double>(1.0 / val);
 	}
 
+	/// \return the update rate of the thread in hertz
+	double getRate() const
+	{
+		return 1.0 / m_period.count();
+	}
+
 	/// Sets the thread to synchronized execution in concert with the startup
 	/// barrier, the startup barrier has to exist for this call to succeed.
 	/// When the thread is set to run synchronized it will only execute one update at a time
@@ -119,6 +142,21 @@ class BasicThread
 	/// \return	true if synchronized, false if not.
 	bool isSynchronous();
 
+	/// Drive the thread from a virtual simulation clock while it is running synchronously. Each release of the
+	/// barrier advances the virtual clock by one frame, the thread then performs, back to back, as many updates
+	/// of its own period as fit into the simulated time elapsed so far, and waits on the barrier a second time
+	/// to signal that the frame is done. This keeps the ratio of update counts between threads of different
+	/// rates deterministic, independently of wall clock time.
+	/// \param period duration of one virtual frame in seconds, 0 reverts to one update per barrier release.
+	/// \note Should only be changed while the thread is waiting on the barrier or before it is started.
+	void setVirtualFramePeriod(double period);
+
+	/// \return the duration of one virtual frame in seconds, 0 if the thread is not driven by a virtual clock
+	double getVirtualFramePeriod() const;
+
+	/// \return the simulated time in seconds covered by the updates done under the current virtual clock
+	double getSimulatedTime() const;
+
 	/// \return the cumulated cpu time taken to run all update since last reset or thread creation
 	/// \note Only the latest 1,000,000 frames since last reset are cumulated, so if the timer is never reset,
 	/// \note the Cpu time will not increase past that limit.
@@ -131,6 +169,44 @@ class BasicThread
 	/// Reset the cpu time and the update count to 0
 	void resetCpuTimeAndUpdateCount();
 
+	/// Set the way the thread waits for the end of its update period when running asynchronously, this
+	/// trades cpu usage for a more stable period, e.g. for high rate haptic loops.
+	/// \param policy the timing policy
+	/// \param spinWindow the time in seconds spent busy waiting before the end of the period, only used for
+	/// 	TIMING_POLICY_HYBRID, should be larger than the scheduler granularity.
+	void setTimingPolicy(TimingPolicy policy, double spinWindow = 0.002);
+
+	/// \return the timing policy of the thread
+	TimingPolicy getTimingPolicy() const;
+
+	/// \return the spin window in seconds used with TIMING_POLICY_HYBRID
+	double getSpinWindow() const;
+
+	/// Pin the thread to a cpu, needs to be set before the thread is started.
+	/// \param cpu the index of the cpu the thread should run on, -1 lets the operating system decide
+	/// \note Failures to apply the affinity, e.g. an invalid cpu index, are logged and otherwise ignored
+	void setCpuAffinity(int cpu);
+
+	/// \return the index of the cpu the thread is pinned to, -1 if it is not pinned
+	int getCpuAffinity() const;
+
+	/// Run the thread with a real time scheduling priority, needs to be set before the thread is started.
+	/// On linux this uses the SCHED_FIFO policy with the given priority (1-99), on windows the thread priority
+	/// is raised to time critical for any positive value.
+	/// \param priority the real time priority, 0 uses the default scheduling of the operating system
+	/// \note This usually requires elevated privileges, failures are logged and otherwise ignored
+	void setRealTimePriority(int priority);
+
+	/// \return the real time priority of the thread, 0 if it uses the default scheduling
+	int getRealTimePriority() const;
+
+	/// \return the histograms of the lateness and the overrun of each frame while running asynchronously, these
+	/// 	are thread safe and can be queried while the thread is running.
+	const FrameTimingStatistics& getFrameTimingStatistics() const;
+
+	/// Clear the frame timing statistics
+	void resetFrameTimingStatistics();
+
 protected:
 
 	/// Timer to measure the actual time taken to doUpdate
@@ -164,9 +240,35 @@ class BasicThread
 	bool m_isIdle;
 	bool m_isInitialized;
 	bool m_isRunning;
+	bool m_hasQuit;
 	bool m_stopExecution;
 	bool m_isSynchronous;
 
+	/// Timing of the asynchronous loop
+	TimingPolicy m_timingPolicy;
+	boost::chrono::duration<double> m_spinWindow;
+	int m_cpuAffinity;
+	int m_realTimePriority;
+	FrameTimingStatistics m_frameTimingStatistics;
+
+	/// Wait until the given time using the current timing policy
+	void waitUntil(const Clock::time_point& time);
+
+	/// Apply the cpu affinity and the real time priority to the calling thread
+	void applySchedulingSettings();
+
+	/// Mark the thread as having left its update loop and leave the startup barrier
+	void quit();
+
+	/// Virtual clock, duration of a frame, the number of frames released and the number of updates done
+	boost::chrono::duration<double> m_virtualFramePeriod;
+	size_t m_virtualFrameCount;
+	size_t m_virtualUpdateCount;
+
+	/// Execute the updates for one virtual frame, the number of updates depends on the ratio of the frame
+	/// period and the update period.
+	void doVirtualFrame();
+
 	virtual bool doInitialize() = 0;
 	virtual bool doStartUp() = 0;
 
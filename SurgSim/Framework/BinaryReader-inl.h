@@ -0,0 +1,60 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_BINARYREADER_INL_H
+#define SURGSIM_FRAMEWORK_BINARYREADER_INL_H
+
+#include <cstdint>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+template <class T>
+bool BinaryReader::read(T* value)
+{
+	return readBytes(value, sizeof(T));
+}
+
+template <class T>
+bool BinaryReader::readArray(std::vector<T>* values)
+{
+	uint64_t size = 0;
+	if (!read(&size) || size > (m_size - m_position) / sizeof(T))
+	{
+		m_isValid = false;
+		return false;
+	}
+	values->resize(static_cast<size_t>(size));
+	return size == 0 || readBytes(values->data(), sizeof(T) * values->size());
+}
+
+template <class T>
+bool BinaryReader::readArray(T* values, size_t count)
+{
+	uint64_t size = 0;
+	if (!read(&size) || size != count)
+	{
+		m_isValid = false;
+		return false;
+	}
+	return count == 0 || readBytes(values, sizeof(T) * count);
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_BINARYREADER_INL_H
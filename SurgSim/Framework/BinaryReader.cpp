@@ -0,0 +1,103 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/BinaryReader.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+struct BinaryReader::Mapping
+{
+	boost::interprocess::file_mapping file;
+	boost::interprocess::mapped_region region;
+};
+
+BinaryReader::BinaryReader(const char* data, size_t size) :
+	m_data(data),
+	m_size(size),
+	m_position(0),
+	m_isValid(data != nullptr || size == 0)
+{
+}
+
+BinaryReader::BinaryReader(const std::string& fileName) :
+	m_data(nullptr),
+	m_size(0),
+	m_position(0),
+	m_isValid(false)
+{
+	try
+	{
+		std::unique_ptr<Mapping> mapping(new Mapping);
+		mapping->file = boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only);
+		mapping->region = boost::interprocess::mapped_region(mapping->file, boost::interprocess::read_only);
+		m_data = static_cast<const char*>(mapping->region.get_address());
+		m_size = mapping->region.get_size();
+		m_mapping = std::move(mapping);
+		m_isValid = true;
+	}
+	catch (const boost::interprocess::interprocess_exception&)
+	{
+		// The file does not exist or cannot be mapped, e.g. because it is empty
+	}
+}
+
+BinaryReader::~BinaryReader()
+{
+}
+
+bool BinaryReader::isValid() const
+{
+	return m_isValid;
+}
+
+bool BinaryReader::isAtEnd() const
+{
+	return m_position == m_size;
+}
+
+bool BinaryReader::readString(std::string* value)
+{
+	uint64_t size = 0;
+	if (!read(&size) || size > m_size - m_position)
+	{
+		m_isValid = false;
+		return false;
+	}
+	value->assign(m_data + m_position, static_cast<size_t>(size));
+	m_position += static_cast<size_t>(size);
+	return true;
+}
+
+bool BinaryReader::readBytes(void* data, size_t size)
+{
+	if (!m_isValid || size > m_size - m_position)
+	{
+		m_isValid = false;
+		return false;
+	}
+	std::memcpy(data, m_data + m_position, size);
+	m_position += size;
+	return true;
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
@@ -0,0 +1,115 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_BINARYREADER_H
+#define SURGSIM_FRAMEWORK_BINARYREADER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Reads data written by a BinaryWriter, either from a buffer in memory or from a file that is mapped into memory.
+/// All reads are checked against the end of the data, once a read fails all subsequent reads fail as well, so
+/// the result only needs to be checked with isValid() at the end.
+/// \sa BinaryWriter
+class BinaryReader
+{
+public:
+	/// Constructor, reads from a buffer, the buffer needs to outlive the reader.
+	/// \param data The data.
+	/// \param size The size of the data in bytes.
+	BinaryReader(const char* data, size_t size);
+
+	/// Constructor, maps a file into memory and reads from it.
+	/// \param fileName The name of the file, if it cannot be mapped, the reader will not be valid.
+	explicit BinaryReader(const std::string& fileName);
+
+	/// Destructor
+	~BinaryReader();
+
+	/// \return true if all reads so far succeeded
+	bool isValid() const;
+
+	/// \return true if all the data has been read
+	bool isAtEnd() const;
+
+	/// Read a single value.
+	/// \tparam T The type of the value.
+	/// \param [out] value The value.
+	/// \return true if the value was read.
+	template <class T>
+	bool read(T* value);
+
+	/// Read an array of values written by BinaryWriter::writeArray().
+	/// \tparam T The type of the values.
+	/// \param [out] values The values.
+	/// \return true if the values were read.
+	template <class T>
+	bool readArray(std::vector<T>* values);
+
+	/// Read an array of values written by BinaryWriter::writeArray() into existing storage.
+	/// \tparam T The type of the values.
+	/// \param [out] values The storage for the values.
+	/// \param count The number of values, the read fails if the array has a different size.
+	/// \return true if the values were read.
+	template <class T>
+	bool readArray(T* values, size_t count);
+
+	/// Read a string written by BinaryWriter::writeString().
+	/// \param [out] value The string.
+	/// \return true if the string was read.
+	bool readString(std::string* value);
+
+private:
+	/// @{
+	/// Prevent default copy construction and default assignment
+	BinaryReader(const BinaryReader& other);
+	BinaryReader& operator=(const BinaryReader& other);
+	/// @}
+
+	/// Copy raw bytes out of the data and advance
+	/// \param [out] data The destination.
+	/// \param size The number of bytes.
+	/// \return true if there was enough data left.
+	bool readBytes(void* data, size_t size);
+
+	/// The mapping of the file, if the reader reads from a file
+	struct Mapping;
+	std::unique_ptr<Mapping> m_mapping;
+
+	/// The data
+	const char* m_data;
+
+	/// The size of the data
+	size_t m_size;
+
+	/// The position of the next read
+	size_t m_position;
+
+	/// Whether all reads succeeded
+	bool m_isValid;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#include "SurgSim/Framework/BinaryReader-inl.h"
+
+#endif // SURGSIM_FRAMEWORK_BINARYREADER_H
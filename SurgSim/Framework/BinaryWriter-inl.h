@@ -0,0 +1,51 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_BINARYWRITER_INL_H
+#define SURGSIM_FRAMEWORK_BINARYWRITER_INL_H
+
+#include <cstdint>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+template <class T>
+void BinaryWriter::write(const T& value)
+{
+	writeBytes(&value, sizeof(T));
+}
+
+template <class T>
+void BinaryWriter::writeArray(const std::vector<T>& values)
+{
+	writeArray(values.data(), values.size());
+}
+
+template <class T>
+void BinaryWriter::writeArray(const T* values, size_t count)
+{
+	write(static_cast<uint64_t>(count));
+	if (count > 0)
+	{
+		writeBytes(values, sizeof(T) * count);
+	}
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_BINARYWRITER_INL_H
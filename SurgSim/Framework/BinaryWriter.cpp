@@ -0,0 +1,95 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/BinaryWriter.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+BinaryWriter::BinaryWriter()
+{
+}
+
+BinaryWriter::~BinaryWriter()
+{
+}
+
+void BinaryWriter::writeString(const std::string& value)
+{
+	write(static_cast<uint64_t>(value.size()));
+	writeBytes(value.data(), value.size());
+}
+
+void BinaryWriter::clear()
+{
+	m_buffer.clear();
+}
+
+const std::vector<char>& BinaryWriter::getBuffer() const
+{
+	return m_buffer;
+}
+
+bool BinaryWriter::save(const std::string& fileName) const
+{
+	std::ostringstream temporaryName;
+	temporaryName << fileName << "." << boost::this_thread::get_id() << ".tmp";
+
+	{
+		std::ofstream out(temporaryName.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+		{
+			return false;
+		}
+		out.write(m_buffer.data(), m_buffer.size());
+		if (!out.good())
+		{
+			out.close();
+			std::remove(temporaryName.str().c_str());
+			return false;
+		}
+	}
+
+	boost::system::error_code error;
+	boost::filesystem::rename(temporaryName.str(), fileName, error);
+	if (error)
+	{
+		std::remove(temporaryName.str().c_str());
+		return false;
+	}
+	return true;
+}
+
+void BinaryWriter::writeBytes(const void* data, size_t size)
+{
+	size_t offset = m_buffer.size();
+	m_buffer.resize(offset + size);
+	if (size > 0)
+	{
+		std::memcpy(&m_buffer[offset], data, size);
+	}
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
@@ -0,0 +1,91 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_BINARYWRITER_H
+#define SURGSIM_FRAMEWORK_BINARYWRITER_H
+
+#include <string>
+#include <vector>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Writes plain data into a contiguous binary buffer, used for the binary cache files of assets.
+/// Values are written in the native byte order and layout of the platform, the buffer can only be read back by
+/// a BinaryReader on the same platform. Only types that can be copied with memcpy (numbers, fixed size Eigen
+/// matrices and structs thereof) should be written.
+/// \sa BinaryReader
+class BinaryWriter
+{
+public:
+	/// Constructor
+	BinaryWriter();
+
+	/// Destructor
+	~BinaryWriter();
+
+	/// Write a single value.
+	/// \tparam T The type of the value.
+	/// \param value The value.
+	template <class T>
+	void write(const T& value);
+
+	/// Write an array of values, preceded by its size.
+	/// \tparam T The type of the values.
+	/// \param values The values.
+	template <class T>
+	void writeArray(const std::vector<T>& values);
+
+	/// Write an array of values, preceded by its size.
+	/// \tparam T The type of the values.
+	/// \param values The values.
+	/// \param count The number of values.
+	template <class T>
+	void writeArray(const T* values, size_t count);
+
+	/// Write a string, preceded by its size.
+	/// \param value The string.
+	void writeString(const std::string& value);
+
+	/// Remove all the data written so far, the allocated memory is kept for further writes.
+	void clear();
+
+	/// \return The data written so far.
+	const std::vector<char>& getBuffer() const;
+
+	/// Save the data to a file. The data is first written to a temporary file which then replaces the file, so that
+	/// readers never see a partially written file.
+	/// \param fileName The name of the file.
+	/// \return true if the file was written.
+	bool save(const std::string& fileName) const;
+
+private:
+	/// Append raw bytes to the buffer
+	/// \param data The bytes.
+	/// \param size The number of bytes.
+	void writeBytes(const void* data, size_t size);
+
+	/// The data
+	std::vector<char> m_buffer;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#include "SurgSim/Framework/BinaryWriter-inl.h"
+
+#endif // SURGSIM_FRAMEWORK_BINARYWRITER_H
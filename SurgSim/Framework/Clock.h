@@ -31,6 +31,13 @@ namespace Framework
 /// Wraps around the actual clock we are using.
 typedef boost::chrono::high_resolution_clock Clock;
 
+/// \return The time in seconds on a monotonic clock that is the same for all the threads, e.g. to timestamp data
+/// handed over from one thread to another.  Only differences between these times are meaningful.
+inline double getMonotonicTime()
+{
+	return boost::chrono::duration<double>(boost::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 /// A more accurate sleep_until that accounts for scheduler errors
 /// \tparam C Clock type
 /// \tparam D Duration type
@@ -41,7 +48,7 @@ void sleep_until(const boost::chrono::time_point<C, D>& time)
 	// 2ms gives good results on windows and linux
 	static const boost::chrono::duration<double> schedulerError(0.002);
 
-	boost::chrono::time_point<C, D> earlierTime = time - schedulerError;
+	auto earlierTime = time - schedulerError;
 	if (earlierTime > C::now())
 	{
 		boost::this_thread::sleep_until(earlierTime);
@@ -53,6 +60,36 @@ void sleep_until(const boost::chrono::time_point<C, D>& time)
 	}
 }
 
+/// Busy wait until the given time, without giving up the processor, this is the most precise way of waiting but
+/// uses up a whole core while waiting.
+/// \tparam C Clock type
+/// \tparam D Duration type
+/// \param time The time point in absolute time to wait until
+template <class C, class D>
+void spin_until(const boost::chrono::time_point<C, D>& time)
+{
+	while (C::now() < time)
+	{
+	}
+}
+
+/// Sleep until shortly before the given time, then busy wait for the remainder. Trades cpu usage during the
+/// spin window for a wake up time that does not depend on the granularity of the scheduler.
+/// \tparam C Clock type
+/// \tparam D Duration type
+/// \param time The time point in absolute time to wait until
+/// \param spinWindow The duration before time that will be spent busy waiting
+template <class C, class D>
+void hybrid_sleep_until(const boost::chrono::time_point<C, D>& time, const boost::chrono::duration<double>& spinWindow)
+{
+	auto earlierTime = time - spinWindow;
+	if (earlierTime > C::now())
+	{
+		boost::this_thread::sleep_until(earlierTime);
+	}
+	spin_until(time);
+}
+
 }; // Framework
 }; // SurgSim
 
@@ -113,6 +113,26 @@ void Component::doRetire()
 	return;
 }
 
+bool Component::saveState(BinaryWriter* writer) const
+{
+	return m_isInitialized && doSaveState(writer);
+}
+
+bool Component::restoreState(BinaryReader* reader)
+{
+	return m_isInitialized && doRestoreState(reader);
+}
+
+bool Component::doSaveState(BinaryWriter* writer) const
+{
+	return false;
+}
+
+bool Component::doRestoreState(BinaryReader* reader)
+{
+	return false;
+}
+
 void Component::setScene(std::weak_ptr<Scene> scene)
 {
 	m_scene = scene;
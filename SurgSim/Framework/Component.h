@@ -30,6 +30,8 @@ namespace Framework
 {
 
 // Forward References
+class BinaryReader;
+class BinaryWriter;
 class PoseComponent;
 class Runtime;
 class Scene;
@@ -89,6 +91,17 @@ class Component :
 	/// responsible for handling this component. This gives the component a chance to get rid of all shared objects
 	void retire();
 
+	/// Write the dynamic state of this component, i.e. the data that changes while the simulation is running, this
+	/// is used for snapshots of the scene (see Scene::saveState()).
+	/// \param writer The writer for the state.
+	/// \return True if the component has dynamic state and wrote it; otherwise, false.
+	bool saveState(BinaryWriter* writer) const;
+
+	/// Restore the dynamic state of this component in place, from data written by saveState() on this component.
+	/// \param reader The reader for the state.
+	/// \return True if the state was restored; otherwise, false.
+	bool restoreState(BinaryReader* reader);
+
 	/// Sets the scene.
 	/// \param scene The scene for this component
 	void setScene(std::weak_ptr<Scene> scene);
@@ -149,6 +162,18 @@ class Component :
 	bool isLocalActive() const;
 
 protected:
+	/// Interface to be implemented by derived classes that have dynamic state
+	/// Has a default implementation, writes nothing and returns false
+	/// \param writer The writer for the state.
+	/// \return True if the state was written; otherwise, false.
+	virtual bool doSaveState(BinaryWriter* writer) const;
+
+	/// Interface to be implemented by derived classes that have dynamic state
+	/// Has a default implementation, reads nothing and returns false
+	/// \param reader The reader for the state.
+	/// \return True if the state was restored; otherwise, false.
+	virtual bool doRestoreState(BinaryReader* reader);
+
 	/// Get the PoseComponent for this component
 	/// \return The PoseComponent
 	virtual std::shared_ptr<PoseComponent> getPoseComponent();
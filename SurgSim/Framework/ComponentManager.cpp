@@ -17,6 +17,7 @@
 #include "SurgSim/Framework/Component.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/Tracer.h"
 
 #include <boost/thread/locks.hpp>
 
@@ -92,6 +93,7 @@ void ComponentManager::processBehaviors(const double dt)
 	{
 		if ((*it)->isActive())
 		{
+			SURGSIM_TRACE_SCOPE_DYNAMIC("Behavior", (*it)->getFullName());
 			(*it)->update(dt);
 		}
 	}
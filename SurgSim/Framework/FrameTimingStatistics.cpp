@@ -0,0 +1,97 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/FrameTimingStatistics.h"
+
+#include <algorithm>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+FrameTimingStatistics::FrameTimingStatistics(double binWidth, size_t binCount) :
+	m_lateness(binWidth, binCount),
+	m_overrun(binWidth, binCount)
+{
+}
+
+void FrameTimingStatistics::addFrame(double lateness, double overrun)
+{
+	m_lateness.addSample(lateness);
+	if (overrun > 0.0)
+	{
+		m_overrun.addSample(overrun);
+	}
+}
+
+void FrameTimingStatistics::reset()
+{
+	m_lateness.reset();
+	m_overrun.reset();
+}
+
+double FrameTimingStatistics::getBinWidth() const
+{
+	return m_lateness.getBinWidth();
+}
+
+size_t FrameTimingStatistics::getBinCount() const
+{
+	return m_lateness.getBinCount();
+}
+
+size_t FrameTimingStatistics::getNumberOfFrames() const
+{
+	return m_lateness.getNumberOfSamples();
+}
+
+size_t FrameTimingStatistics::getNumberOfOverruns() const
+{
+	return m_overrun.getNumberOfSamples();
+}
+
+std::vector<size_t> FrameTimingStatistics::getLatenessHistogram() const
+{
+	return m_lateness.getBins();
+}
+
+std::vector<size_t> FrameTimingStatistics::getOverrunHistogram() const
+{
+	std::vector<size_t> histogram = m_overrun.getBins();
+	// The two histograms are read one after the other, the loop can add a frame in between
+	const size_t frames = getNumberOfFrames();
+	const size_t overruns = getNumberOfOverruns();
+	histogram[0] += (frames > overruns) ? frames - overruns : 0;
+	return histogram;
+}
+
+double FrameTimingStatistics::getMaxLateness() const
+{
+	return m_lateness.getMax();
+}
+
+double FrameTimingStatistics::getMaxOverrun() const
+{
+	return m_overrun.getMax();
+}
+
+double FrameTimingStatistics::getAverageLateness() const
+{
+	return m_lateness.getAverage();
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
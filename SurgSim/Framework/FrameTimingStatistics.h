@@ -0,0 +1,88 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_FRAMETIMINGSTATISTICS_H
+#define SURGSIM_FRAMEWORK_FRAMETIMINGSTATISTICS_H
+
+#include <vector>
+
+#include "SurgSim/Framework/Histogram.h"
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Histograms of the timing errors of a periodic loop, collects for each frame the lateness, i.e. how much later
+/// than scheduled the frame started, and the overrun, i.e. how much longer than the period the work of the frame
+/// took. Both histograms use the same bins of fixed width starting at 0, the last bin collects all the values that
+/// are larger than the range of the histogram.
+/// Frames are added by the thread running the loop without locking, all the accessors are thread safe and can be
+/// used while the loop is running, see Histogram.
+class FrameTimingStatistics
+{
+public:
+	/// Constructor
+	/// \param binWidth the width of each bin in seconds
+	/// \param binCount the number of bins, needs to be at least 1
+	explicit FrameTimingStatistics(double binWidth = 50e-6, size_t binCount = 40);
+
+	/// Add the timing of one frame, only called by the thread running the loop.
+	/// \param lateness the delay in seconds between the scheduled and the actual start of the frame
+	/// \param overrun the time in seconds by which the frame exceeded its period, 0 if it did not
+	void addFrame(double lateness, double overrun);
+
+	/// Clear all the collected frames.
+	void reset();
+
+	/// \return the width of each bin in seconds
+	double getBinWidth() const;
+
+	/// \return the number of bins in each histogram
+	size_t getBinCount() const;
+
+	/// \return the number of frames collected since construction or the last reset
+	size_t getNumberOfFrames() const;
+
+	/// \return the number of frames that exceeded their period since construction or the last reset
+	size_t getNumberOfOverruns() const;
+
+	/// \return the lateness histogram, entry i counts the frames with lateness in [i * width, (i + 1) * width)
+	std::vector<size_t> getLatenessHistogram() const;
+
+	/// \return the overrun histogram, entry i counts the frames with overrun in [i * width, (i + 1) * width)
+	std::vector<size_t> getOverrunHistogram() const;
+
+	/// \return the largest lateness in seconds since construction or the last reset
+	double getMaxLateness() const;
+
+	/// \return the largest overrun in seconds since construction or the last reset
+	double getMaxOverrun() const;
+
+	/// \return the mean lateness in seconds, 0 if there are no frames
+	double getAverageLateness() const;
+
+private:
+	/// The lateness of every frame
+	Histogram m_lateness;
+
+	/// The overrun of the frames that exceeded their period, the other frames are added to the first bin on access
+	Histogram m_overrun;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_FRAMETIMINGSTATISTICS_H
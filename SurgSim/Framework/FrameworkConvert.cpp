@@ -20,6 +20,7 @@
 #include "SurgSim/Framework/Scene.h"
 #include "SurgSim/Framework/Asset.h"
 
+#include <boost/thread/lock_guard.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 namespace
@@ -68,6 +69,7 @@ bool convert<std::shared_ptr<SurgSim::Framework::Component>>::decode(
 			if (data[IdPropertyName].IsDefined())
 			{
 				std::string id = data[IdPropertyName].as<std::string>();
+				boost::lock_guard<boost::mutex> lock(getRegistryMutex());
 				RegistryType& registry = getRegistry();
 				auto sharedComponent = registry.find(id);
 				if (sharedComponent != registry.end())
@@ -82,7 +84,7 @@ bool convert<std::shared_ptr<SurgSim::Framework::Component>>::decode(
 				else
 				{
 					rhs = factory.create(className, name);
-					getRegistry()[id] = rhs;
+					registry[id] = rhs;
 				}
 			}
 			else
@@ -108,6 +110,12 @@ convert<std::shared_ptr<SurgSim::Framework::Component>>::RegistryType&
 	return registry;
 }
 
+boost::mutex& convert<std::shared_ptr<SurgSim::Framework::Component>>::getRegistryMutex()
+{
+	static boost::mutex mutex;
+	return mutex;
+}
+
 Node convert<SurgSim::Framework::Component>::encode(const SurgSim::Framework::Component& rhs)
 {
 	YAML::Node data(rhs.encode());
@@ -16,6 +16,7 @@
 #ifndef SURGSIM_FRAMEWORK_FRAMEWORKCONVERT_H
 #define SURGSIM_FRAMEWORK_FRAMEWORKCONVERT_H
 
+#include <boost/thread/mutex.hpp>
 #include <memory>
 #include <unordered_map>
 #include <yaml-cpp/yaml.h>
@@ -73,6 +74,9 @@ struct convert<std::shared_ptr<SurgSim::Framework::Component>>
 
 	/// \return The static registry for shared instances
 	static RegistryType& getRegistry();
+
+	/// \return The mutex protecting the registry while decoding, scene elements may be decoded in parallel
+	static boost::mutex& getRegistryMutex();
 };
 
 /// Override of the convert structure for an Component, use this form to write out a full version
@@ -0,0 +1,150 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+Histogram::Histogram(double binWidth, size_t binCount) :
+	m_binWidth(binWidth),
+	m_binCount(binCount),
+	m_bins(new std::atomic<size_t>[binCount]),
+	m_isResetRequested(false)
+{
+	SURGSIM_ASSERT(binWidth > 0.0) << "The bin width needs to be positive, got " << binWidth;
+	SURGSIM_ASSERT(binCount > 0) << "There needs to be at least one bin.";
+	clear();
+}
+
+void Histogram::addSample(double value)
+{
+	if (m_isResetRequested.load(std::memory_order_acquire))
+	{
+		clear();
+		m_isResetRequested.store(false, std::memory_order_release);
+	}
+
+	value = std::max(value, 0.0);
+
+	// Compare as double first, a very large value would overflow the conversion to size_t
+	const double bin = value / m_binWidth;
+	const size_t index = (bin < static_cast<double>(m_binCount - 1)) ? static_cast<size_t>(bin) : m_binCount - 1;
+
+	// This is the only thread writing, plain loads and stores are enough
+	m_bins[index].store(m_bins[index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	m_max.store(std::max(m_max.load(std::memory_order_relaxed), value), std::memory_order_relaxed);
+	m_total.store(m_total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	m_count.store(m_count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void Histogram::reset()
+{
+	m_isResetRequested.store(true, std::memory_order_release);
+}
+
+double Histogram::getBinWidth() const
+{
+	return m_binWidth;
+}
+
+size_t Histogram::getBinCount() const
+{
+	return m_binCount;
+}
+
+size_t Histogram::getNumberOfSamples() const
+{
+	return m_isResetRequested.load(std::memory_order_acquire) ? 0 : m_count.load(std::memory_order_acquire);
+}
+
+std::vector<size_t> Histogram::getBins() const
+{
+	std::vector<size_t> bins(m_binCount, 0);
+	if (!m_isResetRequested.load(std::memory_order_acquire))
+	{
+		for (size_t i = 0; i < m_binCount; ++i)
+		{
+			bins[i] = m_bins[i].load(std::memory_order_relaxed);
+		}
+	}
+	return bins;
+}
+
+double Histogram::getMax() const
+{
+	return m_isResetRequested.load(std::memory_order_acquire) ? 0.0 : m_max.load(std::memory_order_relaxed);
+}
+
+double Histogram::getAverage() const
+{
+	if (m_isResetRequested.load(std::memory_order_acquire))
+	{
+		return 0.0;
+	}
+	const size_t count = m_count.load(std::memory_order_acquire);
+	return (count > 0) ? m_total.load(std::memory_order_relaxed) / static_cast<double>(count) : 0.0;
+}
+
+double Histogram::getPercentile(double fraction) const
+{
+	SURGSIM_ASSERT(fraction >= 0.0 && fraction <= 1.0) << "The fraction needs to be in [0, 1], got " << fraction;
+
+	// Count the copied bins rather than using m_count, so that the two agree
+	const std::vector<size_t> bins = getBins();
+	size_t total = 0;
+	for (auto count : bins)
+	{
+		total += count;
+	}
+	if (total == 0)
+	{
+		return 0.0;
+	}
+
+	const double max = getMax();
+	const double target = std::ceil(fraction * static_cast<double>(total));
+	size_t count = 0;
+	for (size_t bin = 0; bin < m_binCount - 1; ++bin)
+	{
+		count += bins[bin];
+		if (static_cast<double>(count) >= target)
+		{
+			return std::min(static_cast<double>(bin + 1) * m_binWidth, max);
+		}
+	}
+	return max;
+}
+
+void Histogram::clear()
+{
+	for (size_t i = 0; i < m_binCount; ++i)
+	{
+		m_bins[i].store(0, std::memory_order_relaxed);
+	}
+	m_max.store(0.0, std::memory_order_relaxed);
+	m_total.store(0.0, std::memory_order_relaxed);
+	m_count.store(0, std::memory_order_release);
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
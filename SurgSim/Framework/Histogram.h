@@ -0,0 +1,94 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_HISTOGRAM_H
+#define SURGSIM_FRAMEWORK_HISTOGRAM_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Histogram of a non negative quantity sampled by one thread, e.g. the timing of the frames of a loop. The bins
+/// have a fixed width and start at 0, the last bin collects all the values that are larger than the range of the
+/// histogram.  Next to the bins it keeps the number of samples, the largest and the sum of the values.
+/// Lock free, samples are added by a single thread without ever blocking it, all the accessors can be used from
+/// any thread at any time. A reader running concurrently with addSample() can see a sample in some of the
+/// statistics and not yet in the others.
+class Histogram
+{
+public:
+	/// Constructor
+	/// \param binWidth the width of each bin
+	/// \param binCount the number of bins, needs to be at least 1
+	Histogram(double binWidth, size_t binCount);
+
+	/// Add a sample, only one thread may add samples.
+	/// \param value the value of the sample, negative values count as 0
+	void addSample(double value);
+
+	/// Clear all the samples, can be called from any thread. The accessors report an empty histogram right away,
+	/// the data is cleared by the thread adding the samples, when it adds the next one.
+	void reset();
+
+	/// \return the width of each bin
+	double getBinWidth() const;
+
+	/// \return the number of bins
+	size_t getBinCount() const;
+
+	/// \return the number of samples since construction or the last reset
+	size_t getNumberOfSamples() const;
+
+	/// \return the bins, entry i counts the samples with values in [i * width, (i + 1) * width)
+	std::vector<size_t> getBins() const;
+
+	/// \return the largest value since construction or the last reset, 0 if there are no samples
+	double getMax() const;
+
+	/// \return the mean value, 0 if there are no samples
+	double getAverage() const;
+
+	/// \param fraction the fraction of the samples, in [0, 1]
+	/// \return the value below which the fraction of the samples fall, rounded up to the end of a bin, or the
+	///		largest value if it falls in the last bin, 0 if there are no samples
+	double getPercentile(double fraction) const;
+
+private:
+	/// Clear all the data, only called by the thread adding the samples
+	void clear();
+
+	const double m_binWidth;
+	const size_t m_binCount;
+
+	/// The data is only written by the thread adding the samples, the atomics are there so it can be read at the
+	/// same time, the writer does not need any read-modify-write operation.
+	std::unique_ptr<std::atomic<size_t>[]> m_bins;
+	std::atomic<size_t> m_count;
+	std::atomic<double> m_max;
+	std::atomic<double> m_total;
+
+	/// Set by reset(), cleared by the writer once it cleared the data
+	std::atomic<bool> m_isResetRequested;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_HISTOGRAM_H
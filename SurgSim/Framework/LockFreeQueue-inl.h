@@ -0,0 +1,160 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_LOCKFREEQUEUE_INL_H
+#define SURGSIM_FRAMEWORK_LOCKFREEQUEUE_INL_H
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+template <typename T>
+LockFreeQueue<T>::LockFreeQueue(size_t capacity) :
+	m_pushPosition(0),
+	m_popPosition(0)
+{
+	SURGSIM_ASSERT(capacity > 0) << "The capacity of a LockFreeQueue cannot be 0.";
+
+	size_t size = 1;
+	while (size < capacity)
+	{
+		size <<= 1;
+	}
+	m_mask = size - 1;
+	m_buffer.reset(new Cell[size]);
+	for (size_t i = 0; i < size; ++i)
+	{
+		m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+template <typename T>
+typename LockFreeQueue<T>::Cell* LockFreeQueue<T>::claimForPush(size_t* position)
+{
+	size_t pushPosition = m_pushPosition.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Cell* cell = &m_buffer[pushPosition & m_mask];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pushPosition);
+		if (difference == 0)
+		{
+			// The slot is free, try to claim it, on failure pushPosition is updated and we retry
+			if (m_pushPosition.compare_exchange_weak(pushPosition, pushPosition + 1, std::memory_order_relaxed))
+			{
+				*position = pushPosition;
+				return cell;
+			}
+		}
+		else if (difference < 0)
+		{
+			// The slot still contains an element that has not been popped, the queue is full
+			return nullptr;
+		}
+		else
+		{
+			// Another producer claimed the slot, catch up
+			pushPosition = m_pushPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+template <typename T>
+bool LockFreeQueue<T>::tryPush(T&& value)
+{
+	size_t position;
+	Cell* cell = claimForPush(&position);
+	if (cell == nullptr)
+	{
+		return false;
+	}
+	cell->data = std::move(value);
+	cell->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+bool LockFreeQueue<T>::tryPush(const T& value)
+{
+	size_t position;
+	Cell* cell = claimForPush(&position);
+	if (cell == nullptr)
+	{
+		return false;
+	}
+	cell->data = value;
+	cell->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+bool LockFreeQueue<T>::tryPop(T* value)
+{
+	size_t popPosition = m_popPosition.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Cell* cell = &m_buffer[popPosition & m_mask];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t difference =
+			static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(popPosition + 1);
+		if (difference == 0)
+		{
+			if (m_popPosition.compare_exchange_weak(popPosition, popPosition + 1, std::memory_order_relaxed))
+			{
+				*value = std::move(cell->data);
+				// Mark the slot as free for the producer that wraps around to it
+				cell->sequence.store(popPosition + m_mask + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (difference < 0)
+		{
+			// Nothing has been written to this slot yet, the queue is empty
+			return false;
+		}
+		else
+		{
+			popPosition = m_popPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+template <typename T>
+size_t LockFreeQueue<T>::getCapacity() const
+{
+	return m_mask + 1;
+}
+
+template <typename T>
+size_t LockFreeQueue<T>::size() const
+{
+	size_t pushPosition = m_pushPosition.load(std::memory_order_relaxed);
+	size_t popPosition = m_popPosition.load(std::memory_order_relaxed);
+	return (pushPosition > popPosition) ? pushPosition - popPosition : 0;
+}
+
+template <typename T>
+bool LockFreeQueue<T>::isEmpty() const
+{
+	return size() == 0;
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_LOCKFREEQUEUE_INL_H
@@ -0,0 +1,102 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_LOCKFREEQUEUE_H
+#define SURGSIM_FRAMEWORK_LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <memory>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// A bounded, lock free queue that supports multiple producers and multiple consumers. The storage is a ring
+/// buffer that is allocated once at construction, every slot carries a sequence number that tells producers and
+/// consumers whether it is free or filled, so neither side ever blocks and the queue itself never allocates.
+/// Values are moved in and out of the slots, this does not keep the memory owned by the values around: a value
+/// like std::string that is copied in by tryPush(const T&) allocates, and a slot that was moved from has lost its
+/// capacity.
+/// \tparam T Type of the elements, needs to be default constructible and move assignable.
+template <typename T>
+class LockFreeQueue
+{
+public:
+	/// Constructor
+	/// \param capacity the maximum number of elements in the queue, rounded up to the next power of 2
+	explicit LockFreeQueue(size_t capacity);
+
+	/// Try to add an element to the back of the queue.
+	/// \param value the element, will be moved from on success
+	/// \return true if the element was added, false if the queue was full
+	bool tryPush(T&& value);
+
+	/// Try to add an element to the back of the queue.
+	/// \param value the element to be copied
+	/// \return true if the element was added, false if the queue was full
+	bool tryPush(const T& value);
+
+	/// Try to remove the element at the front of the queue.
+	/// \param [out] value receives the element
+	/// \return true if an element was removed, false if the queue was empty
+	bool tryPop(T* value);
+
+	/// \return the maximum number of elements in the queue
+	size_t getCapacity() const;
+
+	/// \return an approximation of the number of elements in the queue, only exact when no other thread is
+	/// 	accessing the queue
+	size_t size() const;
+
+	/// \return true if the queue is empty, same restrictions as size() apply
+	bool isEmpty() const;
+
+private:
+	/// Prevent copying
+	LockFreeQueue(const LockFreeQueue&);
+	LockFreeQueue& operator=(const LockFreeQueue&);
+
+	/// Slot of the ring buffer, the sequence number is equal to the push position when the slot is free and to
+	/// the push position + 1 when it contains data
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T data;
+	};
+
+	/// Claim a free slot for writing
+	/// \param [out] position the push position of the claimed slot
+	/// \return the claimed slot or nullptr if the queue is full
+	Cell* claimForPush(size_t* position);
+
+	/// Keep the positions on different cache lines, they are written by different threads
+	static const size_t CacheLineSize = 64;
+
+	std::unique_ptr<Cell[]> m_buffer;
+	size_t m_mask;
+	char m_padding0[CacheLineSize];
+	std::atomic<size_t> m_pushPosition;
+	char m_padding1[CacheLineSize];
+	std::atomic<size_t> m_popPosition;
+	char m_padding2[CacheLineSize];
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#include "SurgSim/Framework/LockFreeQueue-inl.h"
+
+#endif // SURGSIM_FRAMEWORK_LOCKFREEQUEUE_H
@@ -23,6 +23,7 @@
 
 #include "SurgSim/Framework/Logger.h"
 #include "SurgSim/Framework/LogMessage.h"
+#include "SurgSim/Framework/LogRateLimiter.h"
 
 namespace SurgSim
 {
@@ -208,6 +209,39 @@ namespace Framework
 		/* important: no curly braces around this! */ \
 		SURGSIM_LOG(logger, level)
 
+/// Define a variable name for the rate limiter of a logging statement that depends on the line number.
+/// \ingroup logInternals
+#define SURGSIM_LOG_RATE_LIMITER_VARIABLE  SURGSIM_FLAG_VARIABLE_NAME(surgsimLogRateLimiter, __LINE__)
+
+/// Logs a message to the specified \c logger with the short \c level name, but at most once per \c interval
+/// seconds for this particular statement, further messages within the interval are suppressed. Use this for
+/// messages that can be triggered every frame by a high rate thread.
+/// \param logger Logger used to log the message.
+/// \param level Level of this log message
+/// 	(\link SurgSim::Framework::LOG_LEVEL_DEBUG DEBUG\endlink,
+/// 	\link SurgSim::Framework::LOG_LEVEL_INFO INFO\endlink,
+/// 	\link SurgSim::Framework::LOG_LEVEL_WARNING WARNING\endlink,
+/// 	\link SurgSim::Framework::LOG_LEVEL_SEVERE SEVERE\endlink or
+/// 	\link SurgSim::Framework::LOG_LEVEL_CRITICAL CRITICAL\endlink).
+/// \param interval Minimum time in seconds between two messages from this statement.
+/// \return Stream to output the log message
+///
+/// \b Example
+/// ~~~~
+///   SURGSIM_LOG_RATE_LIMITED(logger, WARNING, 1.0) << messageTextShownAtMostOncePerSecond;
+/// ~~~~
+#define SURGSIM_LOG_RATE_LIMITED(logger, level, interval) \
+	static ::SurgSim::Framework::LogRateLimiter SURGSIM_LOG_RATE_LIMITER_VARIABLE(interval); \
+	if (SURGSIM_LOG_LEVEL(level) < (logger)->getThreshold()) \
+	{ \
+	} \
+	else if (! SURGSIM_LOG_RATE_LIMITER_VARIABLE.tryAcquire()) \
+	{ \
+	} \
+	else \
+		/* important: no curly braces around this! */ \
+		::SurgSim::Framework::LogMessage((logger), SURGSIM_LOG_LEVEL(level))
+
 
 /// @}
 
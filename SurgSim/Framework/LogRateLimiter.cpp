@@ -0,0 +1,54 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/LogRateLimiter.h"
+
+#include <boost/chrono.hpp>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+LogRateLimiter::LogRateLimiter(double interval) :
+	m_interval(static_cast<int64_t>(interval * 1e9)),
+	m_nextAllowed(0),
+	m_suppressedCount(0)
+{
+}
+
+bool LogRateLimiter::tryAcquire()
+{
+	int64_t now = boost::chrono::duration_cast<boost::chrono::nanoseconds>(
+					  boost::chrono::steady_clock::now().time_since_epoch()).count();
+	int64_t nextAllowed = m_nextAllowed.load(std::memory_order_relaxed);
+
+	// Only one of the threads racing for the same interval wins the exchange
+	if (now >= nextAllowed && m_nextAllowed.compare_exchange_strong(nextAllowed, now + m_interval))
+	{
+		return true;
+	}
+
+	++m_suppressedCount;
+	return false;
+}
+
+std::size_t LogRateLimiter::getSuppressedCount() const
+{
+	return m_suppressedCount;
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
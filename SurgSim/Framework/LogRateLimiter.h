@@ -0,0 +1,62 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_LOGRATELIMITER_H
+#define SURGSIM_FRAMEWORK_LOGRATELIMITER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// \addtogroup logInternals
+/// @{
+
+/// Lets at most one message through per time interval, used by SURGSIM_LOG_RATE_LIMITED to throttle a single
+/// logging statement. Thread safe and lock free.
+class LogRateLimiter
+{
+public:
+	/// Constructor
+	/// \param interval the minimum time in seconds between two messages
+	explicit LogRateLimiter(double interval);
+
+	/// Ask whether a message may be logged now, if so the next message will only be allowed after the interval
+	/// \return true if the message may be logged, false if it should be suppressed
+	bool tryAcquire();
+
+	/// \return the number of messages that were suppressed since construction
+	std::size_t getSuppressedCount() const;
+
+private:
+	/// The interval in nanoseconds
+	const int64_t m_interval;
+
+	/// Time of the steady clock in nanoseconds from which on the next message is allowed
+	std::atomic<int64_t> m_nextAllowed;
+
+	std::atomic<std::size_t> m_suppressedCount;
+};
+
+/// @}
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_LOGRATELIMITER_H
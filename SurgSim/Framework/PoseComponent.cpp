@@ -15,6 +15,8 @@
 
 #include "SurgSim/Framework/PoseComponent.h"
 
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Math/MathConvert.h"
 
 namespace SurgSim
@@ -48,6 +50,17 @@ std::shared_ptr<PoseComponent> PoseComponent::getPoseComponent()
 	return nullptr;
 }
 
+bool PoseComponent::doSaveState(BinaryWriter* writer) const
+{
+	writer->write(m_pose);
+	return true;
+}
+
+bool PoseComponent::doRestoreState(BinaryReader* reader)
+{
+	return reader->read(&m_pose);
+}
+
 bool PoseComponent::doInitialize()
 {
 	return true;
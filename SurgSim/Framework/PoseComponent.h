@@ -61,6 +61,9 @@ class PoseComponent : public Component
 	/// \return The PoseComponent
 	std::shared_ptr<const PoseComponent> getPoseComponent() const override;
 
+	bool doSaveState(BinaryWriter* writer) const override;
+	bool doRestoreState(BinaryReader* reader) override;
+
 private:
 	bool doInitialize() override;
 	bool doWakeUp() override;
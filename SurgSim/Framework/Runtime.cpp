@@ -14,13 +14,19 @@
 // limitations under the License.
 
 
+#include <algorithm>
 #include <boost/thread/thread.hpp>
 #include <boost/thread/locks.hpp>
+#include <cmath>
+#include <iomanip>
 
 #include "SurgSim/Framework/Runtime.h"
 
 #include "SurgSim/Framework/ApplicationData.h"
+#include "SurgSim/Framework/AssetCache.h"
 #include "SurgSim/Framework/Barrier.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/ComponentManager.h"
 #include "SurgSim/Framework/Component.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
@@ -39,7 +45,11 @@ std::shared_ptr<ApplicationData> Runtime::m_applicationData;
 Runtime::Runtime() :
 	m_isRunning(false),
 	m_isPaused(false),
-	m_isStopped(false)
+	m_isStopped(false),
+	m_isVirtualTime(false),
+	m_virtualFramePeriod(0.0),
+	m_virtualFrameCount(0),
+	m_virtualWallTime(0.0)
 {
 	initSearchPaths("");
 }
@@ -47,7 +57,11 @@ Runtime::Runtime() :
 Runtime::Runtime(const std::string& configFilePath) :
 	m_isRunning(false),
 	m_isPaused(false),
-	m_isStopped(false)
+	m_isStopped(false),
+	m_isVirtualTime(false),
+	m_virtualFramePeriod(0.0),
+	m_virtualFrameCount(0),
+	m_virtualWallTime(0.0)
 {
 	initSearchPaths(configFilePath);
 }
@@ -186,9 +200,71 @@ bool Runtime::start(bool paused)
 	SURGSIM_LOG_INFO(logger) << "All component wakeUp() succeeded";
 	SURGSIM_LOG_INFO(logger) << "Scene is initialized. All managers updating";
 
+	if (m_isPaused)
+	{
+		waitForManagers();
+	}
+
 	return true;
 }
 
+bool Runtime::startVirtualTime(double framePeriod)
+{
+	SURGSIM_ASSERT(framePeriod >= 0.0) << "The virtual frame period cannot be negative, got " << framePeriod;
+
+	if (framePeriod == 0.0)
+	{
+		for (auto it = m_managers.cbegin(); it != m_managers.cend(); ++it)
+		{
+			framePeriod = std::max(framePeriod, 1.0 / (*it)->getRate());
+		}
+	}
+	SURGSIM_ASSERT(framePeriod > 0.0) << "Cannot start with a virtual clock without any managers.";
+
+	m_isVirtualTime = true;
+	m_virtualFramePeriod = framePeriod;
+	m_virtualFrameCount = 0;
+	m_virtualWallTime = 0.0;
+	for (auto it = m_managers.begin(); it != m_managers.end(); ++it)
+	{
+		(*it)->setVirtualFramePeriod(m_virtualFramePeriod);
+	}
+
+	SURGSIM_LOG_INFO(Logger::getDefaultLogger()) << "Starting with a virtual clock, frame period "
+			<< m_virtualFramePeriod << "s";
+
+	return start(true);
+}
+
+size_t Runtime::advance(double duration)
+{
+	SURGSIM_ASSERT(m_isVirtualTime) << "Cannot advance the virtual clock, the runtime is not running on it.";
+	SURGSIM_ASSERT(duration >= 0.0) << "Cannot advance the virtual clock by a negative duration, got " << duration;
+
+	size_t frames = static_cast<size_t>(std::ceil(duration / m_virtualFramePeriod - 1e-9));
+	size_t frame = 0;
+	while (frame < frames && step())
+	{
+		++frame;
+	}
+	return frame;
+}
+
+bool Runtime::isVirtualTime() const
+{
+	return m_isVirtualTime;
+}
+
+double Runtime::getSimulatedTime() const
+{
+	return static_cast<double>(m_virtualFrameCount) * m_virtualFramePeriod;
+}
+
+double Runtime::getVirtualTimeThroughput() const
+{
+	return (m_virtualWallTime > 0.0) ? getSimulatedTime() / m_virtualWallTime : 0.0;
+}
+
 bool Runtime::stop()
 {
 	if (m_isStopped == true)
@@ -196,6 +272,13 @@ bool Runtime::stop()
 		return false;
 	}
 
+	if (m_isVirtualTime)
+	{
+		SURGSIM_LOG_INFO(Logger::getDefaultLogger()) << std::setprecision(4)
+				<< "Virtual clock simulated " << getSimulatedTime() << "s in " << m_virtualWallTime << "s, "
+				<< getVirtualTimeThroughput() << " simulated s/s";
+	}
+
 	if (isPaused())
 	{
 		resume();
@@ -236,6 +319,7 @@ void Runtime::pause()
 	{
 		(*it)->setSynchronous(true);
 	}
+	waitForManagers();
 }
 
 void Runtime::resume()
@@ -243,8 +327,10 @@ void Runtime::resume()
 	if (isPaused())
 	{
 		m_isPaused = false;
+		m_isVirtualTime = false;
 		for (auto it = std::begin(m_managers); it != std::end(m_managers); ++it)
 		{
+			(*it)->setVirtualFramePeriod(0.0);
 			(*it)->setSynchronous(false);
 		}
 		// HS-2014-feb-21 if there are threads that are not waiting this will hang, this can happen if the above call
@@ -254,12 +340,43 @@ void Runtime::resume()
 	}
 }
 
-void Runtime::step()
+bool Runtime::step()
 {
-	if (isPaused())
+	if (!isPaused())
+	{
+		return false;
+	}
+
+	// Managers that quit are not waiting on the barrier anymore, waiting for them would block forever
+	auto it = std::find_if(m_managers.cbegin(), m_managers.cend(),
+						   [](const std::shared_ptr<ComponentManager>& manager)
+	{
+		return manager->hasQuit();
+	});
+	if (it != m_managers.cend())
+	{
+		SURGSIM_LOG_WARNING(Logger::getDefaultLogger()) << "Manager " << (*it)->getName()
+				<< " is not running anymore, cannot step the runtime.";
+		return false;
+	}
+
+	if (m_isVirtualTime)
 	{
+		// The managers wait a second time once they are done with the frame
+		Timer timer;
+		timer.start();
+		m_barrier->wait(true);
 		m_barrier->wait(true);
+		timer.endFrame();
+		m_virtualWallTime += timer.getCumulativeTime();
+		++m_virtualFrameCount;
 	}
+	else
+	{
+		m_barrier->wait(true);
+	}
+	waitForManagers();
+	return true;
 }
 
 bool Runtime::isRunning() const
@@ -272,6 +389,24 @@ bool Runtime::isPaused() const
 	return m_isPaused;
 }
 
+void Runtime::waitForManagers() const
+{
+	if (!m_isRunning || m_barrier == nullptr)
+	{
+		return;
+	}
+
+	const auto threadId = boost::this_thread::get_id();
+	for (auto it = m_managers.cbegin(); it != m_managers.cend(); ++it)
+	{
+		if ((*it)->getThread().get_id() == threadId)
+		{
+			return;
+		}
+	}
+	m_barrier->waitForOthers();
+}
+
 void Runtime::preprocessSceneElements()
 {
 	// Collect all the Components
@@ -332,6 +467,12 @@ std::shared_ptr<ThreadPool> Runtime::getThreadPool()
 	return threadPool;
 }
 
+std::shared_ptr<AssetCache> Runtime::getAssetCache()
+{
+	static auto assetCache = std::make_shared<AssetCache>();
+	return assetCache;
+}
+
 void Runtime::addComponent(const std::shared_ptr<Component>& component)
 {
 	if (m_isRunning)
@@ -447,6 +588,36 @@ bool tryLoadNode(const std::string& fileName, YAML::Node* node)
 	return result;
 }
 
+std::vector<std::shared_ptr<SceneElement>> decodeSceneElements(const YAML::Node& node)
+{
+	SURGSIM_ASSERT(node.IsSequence()) << "Scene elements need to be a YAML sequence.";
+
+	// The nodes of a YAML document share their memory, reading them from multiple threads is not safe, every
+	// task gets its own copy of its element
+	auto threadPool = Runtime::getThreadPool();
+	std::vector<std::future<std::shared_ptr<SceneElement>>> futures;
+	for (auto it = node.begin(); it != node.end(); ++it)
+	{
+		YAML::Node element = YAML::Clone(*it);
+		futures.push_back(threadPool->enqueue<std::shared_ptr<SceneElement>>([element]()
+		{
+			return element.as<std::shared_ptr<SceneElement>>();
+		}));
+	}
+
+	std::vector<std::shared_ptr<SceneElement>> result;
+	result.reserve(futures.size());
+	for (auto future = futures.begin(); future != futures.end(); ++future)
+	{
+		future->wait();
+	}
+	for (auto future = futures.begin(); future != futures.end(); ++future)
+	{
+		result.push_back(future->get());
+	}
+	return result;
+}
+
 bool Runtime::tryConvertElements(const std::string& filename, const YAML::Node& node,
 								 std::vector<std::shared_ptr<SceneElement>>* elements)
 {
@@ -455,7 +626,7 @@ bool Runtime::tryConvertElements(const std::string& filename, const YAML::Node&
 	{
 		try
 		{
-			*elements = node.as<std::vector<std::shared_ptr<SceneElement>>>();
+			*elements = decodeSceneElements(node);
 			result = true;
 		}
 		catch (YAML::Exception e)
@@ -486,5 +657,24 @@ void Runtime::saveScene(const std::string& fileName) const
 	}
 }
 
+std::vector<char> Runtime::takeSnapshot() const
+{
+	SURGSIM_ASSERT(!m_isRunning || m_isPaused) << "The runtime needs to be paused to take a snapshot.";
+	waitForManagers();
+
+	BinaryWriter writer;
+	m_scene->saveState(&writer);
+	return writer.getBuffer();
+}
+
+bool Runtime::restoreSnapshot(const std::vector<char>& snapshot)
+{
+	SURGSIM_ASSERT(!m_isRunning || m_isPaused) << "The runtime needs to be paused to restore a snapshot.";
+	waitForManagers();
+
+	BinaryReader reader(snapshot.data(), snapshot.size());
+	return m_scene->restoreState(&reader) && reader.isAtEnd();
+}
+
 }; // namespace Framework
 }; // namespace SurgSim
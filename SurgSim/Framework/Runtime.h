@@ -34,6 +34,7 @@ namespace Framework
 {
 
 class ApplicationData;
+class AssetCache;
 class Barrier;
 class ComponentManager;
 class Component;
@@ -83,23 +84,54 @@ class Runtime : public std::enable_shared_from_this<Runtime>
 	bool execute();
 
 	/// Start all the threads non returns after the startup as succeeded
+	/// \param paused whether to start paused, start() then returns once all the managers wait for step().
 	/// \return	true if it succeeds, false if it fails.
 	bool start(bool paused = false);
 
+	/// Start all the threads driven by a virtual simulation clock rather than the wall clock, returns after the
+	/// startup has succeeded. The managers will only update when step() or advance() is called, each step advances
+	/// the simulated time by one frame of the slowest manager and every manager performs, back to back and as fast
+	/// as possible, as many updates of its own rate as fit into that frame. This keeps the ratio of the update
+	/// counts deterministic, e.g. a 1000Hz physics manager always performs 10 updates per frame of a 100Hz
+	/// graphics manager. Use this for headless batch processing, the managers do not need to include graphics.
+	/// \param framePeriod the duration of a virtual frame in seconds, 0 to use the period of the slowest manager.
+	/// \return	true if it succeeds, false if it fails.
+	bool startVirtualTime(double framePeriod = 0.0);
+
+	/// Advance the virtual clock, blocks until the managers have caught up with the new simulated time.
+	/// Stops early if one of the managers quits.
+	/// \param duration the simulated time to advance in seconds, rounded up to a whole number of frames, cannot be
+	/// 	negative
+	/// \return the number of frames that were executed
+	size_t advance(double duration);
+
+	/// Query if the managers are driven by a virtual clock.
+	/// \return true if the runtime was started with startVirtualTime() and has not been resumed since.
+	bool isVirtualTime() const;
+
+	/// \return the simulated time in seconds that the virtual clock has advanced
+	double getSimulatedTime() const;
+
+	/// \return the throughput of the virtual clock, in simulated seconds per wall clock second spent stepping
+	double getVirtualTimeThroughput() const;
+
 	/// Pause all managers, this will set all managers to synchronous execution, they will all complete
 	/// their updates and then wait for step() to proceed, call resume to go back to uninterupted execution.
+	/// Blocks until all the managers wait, unless it is called from the thread of one of the managers.
 	/// \note HS-2013-nov-01 this is mostly to be used as a facillity for testing and debugging, the threads
 	/// 	  are not executed at the correct rates against each other, this is an issue that can be resolved
 	/// 	  but is not necessary right now.
 	void pause();
 
-	/// Resume from pause, causes all managers to resume normal processing
-	/// \warning This function is not thread safe, if stop is called when there are threads that are not waiting,
-	///          this call will hang indefinitely.
+	/// Resume from pause, causes all managers to resume normal processing, this also ends virtual time stepping
+	/// \warning This function is not thread safe, it has to be called from the thread that paused the runtime.
 	void resume();
 
 	/// Make all managers execute 1 update loop, afterwards they will wait for another step() call or resume()
-	void step();
+	/// Blocks until all the managers have finished their update and wait again. When running on a virtual clock
+	/// this advances the simulated time by one frame.
+	/// \return false if the runtime is not paused or one of the managers quit, the managers were not stepped.
+	bool step();
 
 	/// Stops the simulation.
 	/// The call will wait for all the threads to finish, except for any threads that have been detached.
@@ -124,6 +156,10 @@ class Runtime : public std::enable_shared_from_this<Runtime>
 	/// \return	The thread pool.
 	static std::shared_ptr<ThreadPool> getThreadPool();
 
+	/// Gets the process wide cache of loaded assets.
+	/// \return	The asset cache.
+	static std::shared_ptr<AssetCache> getAssetCache();
+
 	/// Adds a component.
 	/// \param	component	The component.
 	void addComponent(const std::shared_ptr<Component>& component);
@@ -172,8 +208,26 @@ class Runtime : public std::enable_shared_from_this<Runtime>
 	/// \param fileName the name of the scene-file if no path is given, uses the current path of the executable
 	void saveScene(const std::string& fileName) const;
 
+	/// Take a snapshot of the dynamic state of the scene, e.g. the states of the physics representations and the
+	/// poses, see Scene::saveState(). Restoring a snapshot is much faster than loading the scene again.
+	/// \note The runtime has to be paused or not running, so that all the managers wait at a frame boundary. pause(),
+	/// step() and advance() only return once all the managers wait, this also blocks until they do.
+	/// \return The snapshot, a contiguous buffer.
+	std::vector<char> takeSnapshot() const;
+
+	/// Restore a snapshot taken with takeSnapshot() in place, the scene needs to contain the same components as
+	/// when the snapshot was taken.
+	/// \note The runtime has to be paused or not running, see takeSnapshot().
+	/// \param snapshot The snapshot.
+	/// \return true if the state of all the components in the snapshot was restored.
+	bool restoreSnapshot(const std::vector<char>& snapshot);
+
 private:
 
+	/// Block until all the managers wait at the barrier, so that no manager is in the middle of an update. Returns
+	/// immediately if the runtime is not running or when called from the thread of one of the managers.
+	void waitForManagers() const;
+
 	/// Preprocess scene elements. This is called during the startup sequence
 	/// and installs all the Components of the SceneElements in the worker threads
 	void preprocessSceneElements();
@@ -210,6 +264,15 @@ class Runtime : public std::enable_shared_from_this<Runtime>
 	bool m_isPaused;
 
 	bool m_isStopped;
+
+	///@{
+	/// Virtual clock, whether it is used, the duration of a frame, the number of frames executed and the wall
+	/// clock time in seconds spent executing them
+	bool m_isVirtualTime;
+	double m_virtualFramePeriod;
+	size_t m_virtualFrameCount;
+	double m_virtualWallTime;
+	///@}
 };
 
 /// Perform a YAML load operation
@@ -218,6 +281,13 @@ class Runtime : public std::enable_shared_from_this<Runtime>
 /// \return true if the loading succeeded
 bool tryLoadNode(const std::string& fileName, YAML::Node* node);
 
+/// Decode a YAML sequence of scene elements. The elements are decoded in parallel on the thread pool of the runtime,
+/// this loads the assets used by the components of different elements in parallel.
+/// \throws SurgSim::Framework::AssertionFailure or YAML::Exception if one of the elements cannot be decoded
+/// \param node The sequence of scene elements
+/// \return The decoded scene elements in the order of the sequence
+std::vector<std::shared_ptr<SceneElement>> decodeSceneElements(const YAML::Node& node);
+
 
 }; // namespace Framework
 }; // namespace SurgSim
@@ -17,10 +17,13 @@
 
 #include <boost/thread/locks.hpp>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <yaml-cpp/yaml.h>
 
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Component.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Framework/Log.h"
@@ -147,6 +150,77 @@ YAML::Node Scene::encode() const
 	return result;
 }
 
+void Scene::saveState(BinaryWriter* writer) const
+{
+	boost::lock_guard<boost::mutex> lock(m_sceneElementsMutex);
+
+	BinaryWriter componentWriter;
+	for (auto element = m_elements.cbegin(); element != m_elements.cend(); ++element)
+	{
+		auto components = (*element)->getComponents();
+		for (auto component = components.cbegin(); component != components.cend(); ++component)
+		{
+			componentWriter.clear();
+			if ((*component)->saveState(&componentWriter))
+			{
+				writer->writeString((*component)->getFullName());
+				writer->writeArray(componentWriter.getBuffer());
+			}
+		}
+	}
+
+	// An empty name terminates the list of components
+	writer->writeString("");
+}
+
+bool Scene::restoreState(BinaryReader* reader)
+{
+	boost::lock_guard<boost::mutex> lock(m_sceneElementsMutex);
+
+	std::unordered_map<std::string, std::shared_ptr<Component>> components;
+	for (auto element = m_elements.cbegin(); element != m_elements.cend(); ++element)
+	{
+		auto elementComponents = (*element)->getComponents();
+		for (auto component = elementComponents.cbegin(); component != elementComponents.cend(); ++component)
+		{
+			components[(*component)->getFullName()] = *component;
+		}
+	}
+
+	bool result = true;
+	std::string name;
+	std::vector<char> state;
+	while (reader->readString(&name) && !name.empty())
+	{
+		if (!reader->readArray(&state))
+		{
+			break;
+		}
+
+		auto found = components.find(name);
+		if (found == components.end())
+		{
+			SURGSIM_LOG_WARNING(m_logger) << "Cannot restore the state of " << name << ", it is not in the scene.";
+			result = false;
+			continue;
+		}
+
+		BinaryReader componentReader(state.data(), state.size());
+		if (!found->second->restoreState(&componentReader) || !componentReader.isAtEnd())
+		{
+			SURGSIM_LOG_WARNING(m_logger) << "Failed to restore the state of " << name << ".";
+			result = false;
+		}
+	}
+
+	if (!reader->isValid())
+	{
+		SURGSIM_LOG_WARNING(m_logger) << "The scene state is incomplete.";
+		result = false;
+	}
+	return result;
+}
+
 bool Scene::decode(const YAML::Node& node)
 {
 	bool result = false;
@@ -156,7 +230,7 @@ bool Scene::decode(const YAML::Node& node)
 
 		if (data["SceneElements"].IsDefined())
 		{
-			auto sceneElements = data["SceneElements"].as<std::vector<std::shared_ptr<SceneElement>>>();
+			auto sceneElements = decodeSceneElements(data["SceneElements"]);
 
 			std::for_each(sceneElements.begin(), sceneElements.end(),
 						  [&](std::shared_ptr<SceneElement> element)
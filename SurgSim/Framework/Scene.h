@@ -35,6 +35,8 @@ namespace SurgSim
 namespace Framework
 {
 
+class BinaryReader;
+class BinaryWriter;
 class Logger;
 class Runtime;
 
@@ -91,6 +93,20 @@ class Scene : public std::enable_shared_from_this<Scene>
 	/// \return true if the decoding succeeded and the node was formatted correctly, false otherwise
 	bool decode(const YAML::Node& node);
 
+	/// Write the dynamic state of all the components in the scene (see Component::saveState()) into one contiguous
+	/// buffer. Each component's state is stored with the full name of the component.
+	/// \note To get a consistent state this should only be called at a frame boundary, e.g. while the runtime is
+	/// paused, see Runtime::takeSnapshot().
+	/// \param writer The writer for the state.
+	void saveState(BinaryWriter* writer) const;
+
+	/// Restore the dynamic state of the components in place, from data written by saveState() on this scene.
+	/// \note This should only be called at a frame boundary, see Runtime::restoreSnapshot().
+	/// \param reader The reader for the state.
+	/// \return true if the state of all the components was restored, false if the data could not be read or did not
+	/// match the components of the scene.
+	bool restoreState(BinaryReader* reader);
+
 	/// \return the groups of the scene
 	std::shared_ptr<GroupsType> getGroups();
 
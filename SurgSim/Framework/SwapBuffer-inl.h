@@ -0,0 +1,76 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_SWAPBUFFER_INL_H
+#define SURGSIM_FRAMEWORK_SWAPBUFFER_INL_H
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+template <typename T>
+SwapBuffer<T>::SwapBuffer() :
+	m_back(0),
+	m_front(2),
+	m_pending(1)
+{
+}
+
+template <typename T>
+T& SwapBuffer<T>::getBack()
+{
+	return m_buffers[m_back];
+}
+
+template <typename T>
+void SwapBuffer<T>::publish()
+{
+	// Release makes the writes to the back buffer visible to the consumer, acquire makes sure the consumer is
+	// done with the buffer that we get back
+	size_t previous = m_pending.exchange(m_back | NewDataFlag, std::memory_order_acq_rel);
+	m_back = previous & IndexMask;
+}
+
+template <typename T>
+bool SwapBuffer<T>::tryTakeFront()
+{
+	if ((m_pending.load(std::memory_order_relaxed) & NewDataFlag) == 0)
+	{
+		return false;
+	}
+
+	// Only the consumer clears the flag, so the exchange always returns new data
+	size_t previous = m_pending.exchange(m_front, std::memory_order_acq_rel);
+	m_front = previous & IndexMask;
+	return true;
+}
+
+template <typename T>
+T& SwapBuffer<T>::getFront()
+{
+	return m_buffers[m_front];
+}
+
+template <typename T>
+const T& SwapBuffer<T>::getFront() const
+{
+	return m_buffers[m_front];
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#endif // SURGSIM_FRAMEWORK_SWAPBUFFER_INL_H
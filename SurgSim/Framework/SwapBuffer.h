@@ -0,0 +1,89 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_SWAPBUFFER_H
+#define SURGSIM_FRAMEWORK_SWAPBUFFER_H
+
+#include <array>
+#include <atomic>
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// Lock free hand over of data from one producer thread to one consumer thread, for data that is rewritten
+/// completely every frame, like the vertex positions of a deforming mesh.
+/// The producer fills its back buffer in place and publishes it with a single atomic exchange, the consumer takes
+/// the most recently published buffer with another atomic exchange. A third buffer sits between the two, so
+/// neither side ever waits on or writes into the buffer that the other side is using, and nothing is copied.
+/// Buffers that were published but not taken before the next publish are skipped.
+/// The buffers are recycled, so the producer will find the data of an older frame in its back buffer.
+/// \tparam T Type of the buffers, needs to be default constructible.
+template <typename T>
+class SwapBuffer
+{
+public:
+	/// Constructor, the buffers are default constructed
+	SwapBuffer();
+
+	/// Producer side, the buffer to write the next frame into, valid until publish()
+	/// \return the back buffer
+	T& getBack();
+
+	/// Producer side, hand the back buffer over to the consumer and get a new back buffer
+	void publish();
+
+	/// Consumer side, make the most recently published buffer the front buffer
+	/// \return true if a buffer was published since the last call, false if the front buffer did not change
+	bool tryTakeFront();
+
+	/// Consumer side, the last buffer that was taken, valid until the next successful tryTakeFront()
+	/// \return the front buffer
+	T& getFront();
+
+	/// Consumer side, the last buffer that was taken, valid until the next successful tryTakeFront()
+	/// \return the front buffer
+	const T& getFront() const;
+
+private:
+	/// Prevent copying
+	SwapBuffer(const SwapBuffer&);
+	SwapBuffer& operator=(const SwapBuffer&);
+
+	/// Set in m_pending when the pending buffer was published and not taken yet
+	static const size_t NewDataFlag = 4;
+
+	/// Masks the index of the buffer in m_pending
+	static const size_t IndexMask = 3;
+
+	std::array<T, 3> m_buffers;
+
+	/// Index of the buffer owned by the producer
+	size_t m_back;
+
+	/// Index of the buffer owned by the consumer
+	size_t m_front;
+
+	/// Index of the buffer in between, and whether it contains new data
+	std::atomic<size_t> m_pending;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+#include "SurgSim/Framework/SwapBuffer-inl.h"
+
+#endif // SURGSIM_FRAMEWORK_SWAPBUFFER_H
@@ -0,0 +1,265 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Framework/Tracer.h"
+
+#include <boost/chrono.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <vector>
+
+#include "SurgSim/Framework/LockFreeQueue.h"
+
+namespace
+{
+
+/// The events of one thread, only the owning thread pushes, the export pops
+struct ThreadBuffer
+{
+	ThreadBuffer(size_t capacity, size_t id) : events(capacity), threadId(id)
+	{
+	}
+
+	SurgSim::Framework::LockFreeQueue<SurgSim::Framework::TraceEvent> events;
+
+	/// Sequential id of the thread, used as the thread id in the trace
+	size_t threadId;
+
+	/// Name of the thread, protected by the registry mutex
+	std::string name;
+};
+
+/// All the thread buffers and the events that were collected from them
+struct Registry
+{
+	Registry() : capacity(16384), droppedCount(0)
+	{
+	}
+
+	boost::mutex mutex;
+
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+	/// Collected events with the id of their thread
+	std::vector<std::pair<size_t, SurgSim::Framework::TraceEvent>> events;
+
+	size_t capacity;
+
+	std::atomic<size_t> droppedCount;
+};
+
+Registry& getRegistry()
+{
+	static Registry registry;
+	return registry;
+}
+
+/// The tracing state of a thread
+struct ThreadState
+{
+	/// The buffer of the thread, only created once the thread records an event, the registry keeps it alive after
+	/// the thread ended, so that its events can still be exported
+	std::shared_ptr<ThreadBuffer> buffer;
+
+	/// The name of the thread
+	std::string name;
+};
+
+ThreadState* getThreadState()
+{
+	static boost::thread_specific_ptr<ThreadState> threadState;
+	if (threadState.get() == nullptr)
+	{
+		threadState.reset(new ThreadState);
+	}
+	return threadState.get();
+}
+
+ThreadBuffer* getThreadBuffer()
+{
+	ThreadState* state = getThreadState();
+	if (state->buffer == nullptr)
+	{
+		auto& registry = getRegistry();
+		boost::lock_guard<boost::mutex> lock(registry.mutex);
+		state->buffer = std::make_shared<ThreadBuffer>(registry.capacity, registry.buffers.size());
+		state->buffer->name = state->name;
+		registry.buffers.push_back(state->buffer);
+	}
+	return state->buffer.get();
+}
+
+/// Move the events from the thread buffers into the registry, needs to be called with the registry locked
+void collect(Registry* registry)
+{
+	SurgSim::Framework::TraceEvent event;
+	for (auto buffer = registry->buffers.begin(); buffer != registry->buffers.end(); ++buffer)
+	{
+		while ((*buffer)->events.tryPop(&event))
+		{
+			registry->events.emplace_back((*buffer)->threadId, std::move(event));
+		}
+	}
+}
+
+void writeJsonString(std::ostream& out, const char* value)
+{
+	out << '"';
+	for (const char* c = value; *c != '\0'; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			out << '\\' << *c;
+		}
+		else if (static_cast<unsigned char>(*c) < 0x20)
+		{
+			out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*c)
+				<< std::dec << std::setfill(' ');
+		}
+		else
+		{
+			out << *c;
+		}
+	}
+	out << '"';
+}
+
+}
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+std::atomic<bool> Tracer::m_isEnabled(false);
+
+void Tracer::setEnabled(bool enabled)
+{
+	m_isEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Tracer::isEnabled()
+{
+	return m_isEnabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::setBufferCapacity(size_t capacity)
+{
+	auto& registry = getRegistry();
+	boost::lock_guard<boost::mutex> lock(registry.mutex);
+	registry.capacity = capacity;
+}
+
+void Tracer::setThreadName(const std::string& name)
+{
+	// The buffer is only allocated when the thread records an event, until then only the name is kept
+	ThreadState* state = getThreadState();
+	auto& registry = getRegistry();
+	boost::lock_guard<boost::mutex> lock(registry.mutex);
+	state->name = name;
+	if (state->buffer != nullptr)
+	{
+		state->buffer->name = name;
+	}
+}
+
+void Tracer::record(TraceEvent&& event)
+{
+	if (!getThreadBuffer()->events.tryPush(std::move(event)))
+	{
+		getRegistry().droppedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void Tracer::writeChromeTrace(std::ostream& out)
+{
+	auto& registry = getRegistry();
+	boost::lock_guard<boost::mutex> lock(registry.mutex);
+	collect(&registry);
+
+	out << "{\"traceEvents\":[";
+	bool isFirst = true;
+	for (auto buffer = registry.buffers.cbegin(); buffer != registry.buffers.cend(); ++buffer)
+	{
+		if (!(*buffer)->name.empty())
+		{
+			out << (isFirst ? "\n" : ",\n");
+			out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << (*buffer)->threadId
+				<< ",\"args\":{\"name\":";
+			writeJsonString(out, (*buffer)->name.c_str());
+			out << "}}";
+			isFirst = false;
+		}
+	}
+
+	// Chrome trace timestamps and durations are in microseconds
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+	out << std::fixed << std::setprecision(3);
+	for (auto it = registry.events.cbegin(); it != registry.events.cend(); ++it)
+	{
+		const TraceEvent& event = it->second;
+		out << (isFirst ? "\n" : ",\n");
+		out << "{\"name\":";
+		writeJsonString(out, (event.staticName != nullptr) ? event.staticName : event.dynamicName.c_str());
+		out << ",\"cat\":";
+		writeJsonString(out, (event.category != nullptr) ? event.category : "");
+		out << ",\"ph\":\"X\",\"ts\":" << static_cast<double>(event.begin) / 1000.0
+			<< ",\"dur\":" << static_cast<double>(event.end - event.begin) / 1000.0
+			<< ",\"pid\":1,\"tid\":" << it->first << "}";
+		isFirst = false;
+	}
+	out << "\n]}\n";
+	out.flags(flags);
+	out.precision(precision);
+}
+
+bool Tracer::exportChromeTrace(const std::string& fileName)
+{
+	std::ofstream out(fileName);
+	if (!out.is_open())
+	{
+		return false;
+	}
+	writeChromeTrace(out);
+	return out.good();
+}
+
+void Tracer::clear()
+{
+	auto& registry = getRegistry();
+	boost::lock_guard<boost::mutex> lock(registry.mutex);
+	collect(&registry);
+	registry.events.clear();
+	registry.droppedCount = 0;
+}
+
+size_t Tracer::getDroppedCount()
+{
+	return getRegistry().droppedCount.load(std::memory_order_relaxed);
+}
+
+int64_t Tracer::now()
+{
+	return boost::chrono::duration_cast<boost::chrono::nanoseconds>(
+			   boost::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}; // namespace Framework
+}; // namespace SurgSim
@@ -0,0 +1,190 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_FRAMEWORK_TRACER_H
+#define SURGSIM_FRAMEWORK_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "SurgSim/Framework/Macros.h"
+
+namespace SurgSim
+{
+namespace Framework
+{
+
+/// A single timed section of code on one thread, as recorded by a TraceScope
+struct TraceEvent
+{
+	TraceEvent() : category(nullptr), staticName(nullptr), begin(0), end(0)
+	{
+	}
+
+	/// The category of the event, needs to be a string with static lifetime
+	const char* category;
+
+	/// The name of the event if it has static lifetime, nullptr if the name is stored in dynamicName
+	const char* staticName;
+
+	/// The name of the event if it was created at runtime
+	std::string dynamicName;
+
+	/// Start time of the event in nanoseconds of the steady clock
+	int64_t begin;
+
+	/// End time of the event in nanoseconds of the steady clock
+	int64_t end;
+};
+
+/// Process wide recorder of timed sections of code (see TraceScope and SURGSIM_TRACE_SCOPE), to correlate what the
+/// different threads are doing over time. The recording is always compiled in but disabled by default, while
+/// disabled a trace scope costs one atomic load.
+/// Every thread records into its own lock free buffer, so recording threads never wait on each other or on the
+/// export. When a buffer is full, further events of that thread are dropped until the next export or clear().
+/// The recorded events can be exported in the Chrome trace event format, which can be viewed in chrome://tracing
+/// or https://ui.perfetto.dev.
+class Tracer
+{
+public:
+	/// Enable or disable the recording of events
+	/// \param enabled Whether events should be recorded.
+	static void setEnabled(bool enabled);
+
+	/// \return true if events are recorded
+	static bool isEnabled();
+
+	/// Set the number of events that can be buffered per thread between two exports, only affects threads that did
+	/// not record any events yet. The default is 16384.
+	/// \param capacity The number of events per thread.
+	static void setBufferCapacity(size_t capacity);
+
+	/// Set the name of the calling thread, used as the name of the thread's track in the exported trace.
+	/// \param name The name of the thread.
+	static void setThreadName(const std::string& name);
+
+	/// Record an event on the calling thread.
+	/// \param event The event, will be moved from.
+	static void record(TraceEvent&& event);
+
+	/// Write all the events recorded since the last clear() in the Chrome trace event format (JSON).
+	/// \param out The stream to write to.
+	static void writeChromeTrace(std::ostream& out);
+
+	/// Write all the events recorded since the last clear() to a file in the Chrome trace event format (JSON).
+	/// \param fileName The name of the file.
+	/// \return true if the file was written.
+	static bool exportChromeTrace(const std::string& fileName);
+
+	/// Discard all the recorded events
+	static void clear();
+
+	/// \return The number of events that were dropped because a buffer was full, since the last clear()
+	static size_t getDroppedCount();
+
+	/// \return The current time of the steady clock in nanoseconds, the time base of the events
+	static int64_t now();
+
+private:
+	/// Whether events are recorded
+	static std::atomic<bool> m_isEnabled;
+};
+
+/// Measures the time between its construction and destruction and records it with the Tracer, if the Tracer is
+/// enabled at construction.
+class TraceScope
+{
+public:
+	/// Constructor
+	/// \param category The category of the event, needs to be a string with static lifetime.
+	/// \param name The name of the event, needs to be a string with static lifetime.
+	TraceScope(const char* category, const char* name) :
+		m_isRecording(Tracer::isEnabled())
+	{
+		if (m_isRecording)
+		{
+			m_event.category = category;
+			m_event.staticName = name;
+			m_event.begin = Tracer::now();
+		}
+	}
+
+	/// Constructor for names that are only known at runtime, use SURGSIM_TRACE_SCOPE_DYNAMIC to avoid building the
+	/// name while the Tracer is disabled.
+	/// \param category The category of the event, needs to be a string with static lifetime.
+	/// \param name The name of the event.
+	TraceScope(const char* category, std::string&& name) :
+		m_isRecording(Tracer::isEnabled())
+	{
+		if (m_isRecording)
+		{
+			m_event.category = category;
+			m_event.dynamicName = std::move(name);
+			m_event.begin = Tracer::now();
+		}
+	}
+
+	/// Destructor, records the event
+	~TraceScope()
+	{
+		if (m_isRecording)
+		{
+			m_event.end = Tracer::now();
+			Tracer::record(std::move(m_event));
+		}
+	}
+
+private:
+	/// @{
+	/// Prevent copying
+	TraceScope(const TraceScope&);
+	TraceScope& operator=(const TraceScope&);
+	/// @}
+
+	/// Whether the Tracer was enabled at construction
+	bool m_isRecording;
+
+	/// The event that is being recorded
+	TraceEvent m_event;
+};
+
+}; // namespace Framework
+}; // namespace SurgSim
+
+/// Record the time until the end of the enclosing block with the Tracer.
+/// \param category The category of the event, a string literal.
+/// \param name The name of the event, a string literal.
+///
+/// \b Example
+/// ~~~~
+///   {
+///       SURGSIM_TRACE_SCOPE("Physics", "Solve");
+///       solve();
+///   }
+/// ~~~~
+#define SURGSIM_TRACE_SCOPE(category, name) \
+	::SurgSim::Framework::TraceScope SURGSIM_MAKE_UNIQUE(surgsimTraceScope)((category), (name))
+
+/// Record the time until the end of the enclosing block with the Tracer, for names that are built at runtime. The
+/// name expression is only evaluated while the Tracer is enabled.
+/// \param category The category of the event, a string literal.
+/// \param name An expression that evaluates to a std::string.
+#define SURGSIM_TRACE_SCOPE_DYNAMIC(category, name) \
+	::SurgSim::Framework::TraceScope SURGSIM_MAKE_UNIQUE(surgsimTraceScope)((category), \
+		::SurgSim::Framework::Tracer::isEnabled() ? std::string(name) : std::string())
+
+#endif // SURGSIM_FRAMEWORK_TRACER_H
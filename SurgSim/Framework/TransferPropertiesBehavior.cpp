@@ -45,11 +45,11 @@ void TransferPropertiesBehavior::update(double dt)
 
 	for (auto it = std::begin(m_connections); it != std::end(m_connections); ++it)
 	{
-		if (!it->first.accessible.expired() && !it->second.accessible.expired())
+		auto source = it->source.accessible.lock();
+		auto target = it->target.accessible.lock();
+		if (source != nullptr && target != nullptr)
 		{
-			auto source = it->first.accessible.lock();
-			auto target = it->second.accessible.lock();
-			target->setValue(it->second.name, source->getValue(it->first.name));
+			it->transfer();
 		}
 	}
 }
@@ -63,13 +63,14 @@ bool TransferPropertiesBehavior::connect(
 	SURGSIM_ASSERT(sourceAccessible != nullptr && targetAccessible != nullptr) <<
 			"Accessibles cannot be nullptr";
 
-	Property source = {sourceAccessible, sourcePropertyName};
-	Property target = {targetAccessible, targetPropertyName};
+	SurgSim::Framework::Property source = {sourceAccessible, sourcePropertyName};
+	SurgSim::Framework::Property target = {targetAccessible, targetPropertyName};
 
 	return connect(source, target);
 }
 
-bool TransferPropertiesBehavior::connect(const Property& source, const Property& target)
+bool TransferPropertiesBehavior::connect(const SurgSim::Framework::Property& source,
+		const SurgSim::Framework::Property& target)
 {
 	// Early outs
 	if (source.accessible.expired() || target.accessible.expired())
@@ -91,7 +92,7 @@ bool TransferPropertiesBehavior::connect(const Property& source, const Property&
 
 	// \note HS-2013-nov-26 should also that the type of the output can be converted to the input
 
-	auto entry = std::make_pair(source, target);
+	Connection entry = {source, target, sharedSource->getTransfer(source.name, *sharedTarget, target.name)};
 
 	boost::lock_guard<boost::mutex> lock(m_incomingMutex);
 	m_incomingConnections.push_back(std::move(entry));
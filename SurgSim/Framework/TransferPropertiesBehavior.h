@@ -65,7 +65,7 @@ class TransferPropertiesBehavior : public SurgSim::Framework::Behavior
 	/// \param source Source property.
 	/// \param target Target property.
 	/// \return true if the connection was created
-	bool connect(const Property& source, const Property& target);
+	bool connect(const SurgSim::Framework::Property& source, const SurgSim::Framework::Property& target);
 
 	/// Sets the type of manager that this behavior should use, this cannot be done after
 	/// initialization has occurred.
@@ -85,8 +85,13 @@ class TransferPropertiesBehavior : public SurgSim::Framework::Behavior
 	virtual int getTargetManagerType() const;
 	///@}
 
-	/// Local typedefs
-	typedef std::pair<Property, Property> Connection;
+	/// A connection between two properties, the transfer function is resolved once when the connection is created
+	struct Connection
+	{
+		SurgSim::Framework::Property source;
+		SurgSim::Framework::Property target;
+		std::function<void(void)> transfer;
+	};
 
 	/// List of connections in this object
 	std::vector<Connection> m_connections;
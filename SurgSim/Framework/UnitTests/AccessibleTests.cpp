@@ -242,6 +242,84 @@ TEST(AccessibleTest, TransferTest)
 	EXPECT_EQ(a.normal, b.normal);
 }
 
+TEST(AccessibleTest, ResolvedTransferTest)
+{
+	TestClass a, b;
+
+	// Typed accessors on both sides
+	a.readWrite = 100.0;
+	b.readWrite = 0.0;
+	auto transfer = a.getTransfer("readWrite", b, "readWrite");
+	ASSERT_NE(nullptr, transfer);
+	transfer();
+	EXPECT_EQ(100.0, b.readWrite);
+
+	// Untyped accessors
+	a.normal = 100;
+	b.normal = 0;
+	transfer = a.getTransfer("normal", b, "normal");
+	transfer();
+	EXPECT_EQ(100, b.normal);
+
+	// Typed getter, untyped setter
+	a.readOnly = 50;
+	transfer = a.getTransfer("readOnly", b, "normal");
+	transfer();
+	EXPECT_EQ(50, b.normal);
+
+	// Mismatched types still go through the conversion of the setter
+	transfer = a.getTransfer("readOnly", b, "readWrite");
+	EXPECT_ANY_THROW(transfer());
+
+	EXPECT_ANY_THROW(a.getTransfer("xxxx", b, "normal"));
+	EXPECT_ANY_THROW(a.getTransfer("normal", b, "readOnly"));
+}
+
+TEST(AccessibleTest, TypedProperty)
+{
+	TestClass a;
+
+	Accessible::Property<double> empty;
+	EXPECT_FALSE(empty.isReadable());
+	EXPECT_FALSE(empty.isWriteable());
+	EXPECT_ANY_THROW(empty.getValue());
+	EXPECT_ANY_THROW(empty.setValue(1.0));
+
+	EXPECT_ANY_THROW(a.getProperty<double>("xxxx"));
+
+	auto readWrite = a.getProperty<double>("readWrite");
+	EXPECT_TRUE(readWrite.isReadable());
+	EXPECT_TRUE(readWrite.isWriteable());
+	a.readWrite = 10.0;
+	EXPECT_EQ(10.0, readWrite.getValue());
+	readWrite.setValue(20.0);
+	EXPECT_EQ(20.0, a.readWrite);
+
+	auto readOnly = a.getProperty<int>("readOnly");
+	EXPECT_TRUE(readOnly.isReadable());
+	EXPECT_FALSE(readOnly.isWriteable());
+	EXPECT_EQ(a.readOnly, readOnly.getValue());
+	EXPECT_ANY_THROW(readOnly.setValue(1));
+
+	// Properties without typed accessors are converted
+	auto normal = a.getProperty<int>("normal");
+	a.normal = 5;
+	EXPECT_EQ(5, normal.getValue());
+	normal.setValue(6);
+	EXPECT_EQ(6, a.normal);
+
+	auto wrongType = a.getProperty<int>("readWrite");
+	EXPECT_ANY_THROW(wrongType.getValue());
+	EXPECT_ANY_THROW(wrongType.setValue(1));
+
+	auto sharedPtr = a.getProperty<std::shared_ptr<int>>("sharedPtr");
+	EXPECT_EQ(a.sharedPtr, sharedPtr.getValue());
+
+	auto serializableEnum = a.getProperty<TestEnum>("serializableEnum");
+	serializableEnum.setValue(TEST_ENUM_B);
+	EXPECT_EQ(TEST_ENUM_B, a.serializableEnum);
+}
+
 TEST(AccessibleTest, ReadWriteMacroTest)
 {
 	TestClass a;
@@ -320,6 +398,10 @@ TEST(AccessibleTest, Forwarding)
 	EXPECT_EQ(543, a.getValue<int>("forwarded"));
 	ASSERT_NO_THROW(a.setValue("forwarded", 345));
 	EXPECT_EQ(345, b.normal);
+
+	ASSERT_NO_THROW(a.forwardProperty("forwardedReadWrite", b, "readWrite"));
+	a.getProperty<double>("forwardedReadWrite").setValue(12.0);
+	EXPECT_EQ(12.0, b.readWrite);
 }
 
 TEST(AccessibleTest, RemoveAccessors)
@@ -346,6 +428,9 @@ TEST(AccessibleTests, VirtualFunctionTest)
 	EXPECT_EQ(derived->otherValue, base->getValue<int>("virtualProperty"));
 	EXPECT_EQ(derived->otherValue, base->getValue<int>("overriddenProperty"));
 
+	EXPECT_EQ(derived->otherValue, base->getProperty<int>("virtualProperty").getValue());
+	EXPECT_EQ(derived->otherValue, base->getProperty<int>("overriddenProperty").getValue());
+
 }
 
 TEST(AccessibleTest, ConvertDoubleToFloat)
@@ -16,6 +16,9 @@
 /// \file
 /// Tests for SURGSIM_ASSERT() and SURGSIM_FAILURE().
 
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <ctime>
 #include <fstream>
 #include <string>
 
@@ -23,6 +26,9 @@
 
 #include "SurgSim/Framework/ApplicationData.h"
 #include "SurgSim/Framework/Asset.h"
+#include "SurgSim/Framework/AssetCache.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Runtime.h"
 
 class MockAsset: public SurgSim::Framework::Asset
@@ -46,6 +52,69 @@ class MockAsset: public SurgSim::Framework::Asset
 	}
 };
 
+/// Asset that supports the asset cache, counts the number of times a file was actually loaded
+class CachedMockAsset: public SurgSim::Framework::Asset
+{
+public:
+	CachedMockAsset() {}
+	~CachedMockAsset() {}
+
+	SURGSIM_CLASSNAME(CachedMockAsset)
+
+	std::string content;
+
+	static int loadCount;
+
+protected:
+	bool doLoad(const std::string& fileName) override
+	{
+		std::ifstream in(fileName);
+		if (!in.is_open())
+		{
+			return false;
+		}
+		std::getline(in, content);
+		++loadCount;
+		return true;
+	}
+
+	bool isCacheable() const override
+	{
+		return true;
+	}
+
+	bool doCopyData(const SurgSim::Framework::Asset& other) override
+	{
+		auto asset = dynamic_cast<const CachedMockAsset*>(&other);
+		if (asset != nullptr)
+		{
+			content = asset->content;
+		}
+		return asset != nullptr;
+	}
+
+	bool doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const override
+	{
+		writer->writeString(content);
+		return true;
+	}
+
+	bool doReadBinary(SurgSim::Framework::BinaryReader* reader) override
+	{
+		std::string value;
+		if (!reader->readString(&value))
+		{
+			return false;
+		}
+		content = value;
+		return true;
+	}
+};
+
+int CachedMockAsset::loadCount = 0;
+
+SURGSIM_REGISTER(SurgSim::Framework::Asset, CachedMockAsset, CachedMockAsset);
+
 namespace SurgSim
 {
 namespace Framework
@@ -59,6 +128,11 @@ class AssetTest : public ::testing::Test
 		runtime = std::make_shared<SurgSim::Framework::Runtime>("config.txt");
 	}
 
+	static bool isCacheable(const Asset& asset)
+	{
+		return asset.isCacheable();
+	}
+
 	std::shared_ptr<SurgSim::Framework::Runtime> runtime;
 };
 
@@ -68,6 +142,8 @@ TEST_F(AssetTest, InitTest)
 
 	MockAsset test;
 	EXPECT_EQ("", test.getFileName());
+	EXPECT_FALSE(isCacheable(test));
+	EXPECT_TRUE(isCacheable(CachedMockAsset()));
 }
 
 TEST_F(AssetTest, LoadAndFileNameTest)
@@ -99,5 +175,248 @@ TEST_F(AssetTest, LoadAndFileNameTest)
 	EXPECT_EQ(validDummyFile, test.getFileName());
 }
 
+TEST_F(AssetTest, Cache)
+{
+	auto cache = Runtime::getAssetCache();
+	cache->clear();
+	ApplicationData data(std::vector<std::string>(1, "."));
+
+	const std::string fileName("AssetCacheTestFile.txt");
+	{
+		std::ofstream out(fileName);
+		out << "First" << std::endl;
+	}
+
+	CachedMockAsset::loadCount = 0;
+	size_t hits = cache->getHitCount();
+
+	auto first = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(first->load(fileName, data));
+	EXPECT_EQ("First", first->content);
+	EXPECT_EQ(1, CachedMockAsset::loadCount);
+
+	// The second instance gets a copy of the data without loading the file
+	auto second = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(second->load(fileName, data));
+	EXPECT_EQ("First", second->content);
+	EXPECT_EQ(fileName, second->getFileName());
+	EXPECT_EQ(1, CachedMockAsset::loadCount);
+	EXPECT_EQ(hits + 1, cache->getHitCount());
+
+	// Changing one instance does not affect the cached data
+	first->content = "Changed";
+	auto third = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(third->load(fileName, data));
+	EXPECT_EQ("First", third->content);
+	EXPECT_EQ(1, CachedMockAsset::loadCount);
+
+	// A changed file is loaded again
+	{
+		std::ofstream out(fileName);
+		out << "Second" << std::endl;
+	}
+	auto fourth = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(fourth->load(fileName, data));
+	EXPECT_EQ("Second", fourth->content);
+	EXPECT_EQ(2, CachedMockAsset::loadCount);
+
+	// Without the cache every load reads the file
+	cache->setEnabled(false);
+	auto fifth = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(fifth->load(fileName, data));
+	EXPECT_EQ("Second", fifth->content);
+	EXPECT_EQ(3, CachedMockAsset::loadCount);
+	cache->setEnabled(true);
+
+	// Assets that don't support the cache are not stored
+	size_t size = cache->getSize();
+	MockAsset mock;
+	ASSERT_NO_THROW(mock.load(fileName, data));
+	EXPECT_EQ(size, cache->getSize());
+
+	cache->clear();
+	EXPECT_EQ(0u, cache->getSize());
+	std::remove(fileName.c_str());
+}
+
+TEST_F(AssetTest, CacheEviction)
+{
+	auto cache = Runtime::getAssetCache();
+	cache->clear();
+	ApplicationData data(std::vector<std::string>(1, "."));
+	const size_t maxSize = cache->getMaxSize();
+
+	const std::vector<std::string> fileNames = {"AssetEvictionTestFile0.txt", "AssetEvictionTestFile1.txt",
+												"AssetEvictionTestFile2.txt"
+											   };
+	for (const auto& fileName : fileNames)
+	{
+		std::ofstream out(fileName);
+		out << fileName << std::endl;
+	}
+
+	CachedMockAsset::loadCount = 0;
+	cache->setMaxSize(2);
+	EXPECT_EQ(2u, cache->getMaxSize());
+
+	CachedMockAsset asset;
+	ASSERT_NO_THROW(asset.load(fileNames[0], data));
+	ASSERT_NO_THROW(asset.load(fileNames[1], data));
+	EXPECT_EQ(2u, cache->getSize());
+
+	// Using the first file makes the second one the least recently used
+	ASSERT_NO_THROW(asset.load(fileNames[0], data));
+	EXPECT_EQ(2, CachedMockAsset::loadCount);
+	ASSERT_NO_THROW(asset.load(fileNames[2], data));
+	EXPECT_EQ(3, CachedMockAsset::loadCount);
+	EXPECT_EQ(2u, cache->getSize());
+
+	ASSERT_NO_THROW(asset.load(fileNames[0], data));
+	EXPECT_EQ(3, CachedMockAsset::loadCount);
+	ASSERT_NO_THROW(asset.load(fileNames[1], data));
+	EXPECT_EQ(4, CachedMockAsset::loadCount);
+	EXPECT_EQ(fileNames[1], asset.content);
+
+	// Reducing the size evicts immediately
+	cache->setMaxSize(0);
+	EXPECT_EQ(0u, cache->getSize());
+
+	cache->setMaxSize(maxSize);
+	for (const auto& fileName : fileNames)
+	{
+		std::remove(fileName.c_str());
+	}
+}
+
+TEST_F(AssetTest, ContentHash)
+{
+	auto cache = Runtime::getAssetCache();
+	cache->clear();
+
+	const std::string fileName("AssetContentHashTestFile.txt");
+	{
+		std::ofstream out(fileName);
+		out << "First" << std::endl;
+	}
+
+	size_t hash = 0;
+	size_t expected = 0;
+	EXPECT_FALSE(cache->getContentHash("Nonexistent file", &hash));
+	ASSERT_TRUE(cache->getContentHash(fileName, &hash));
+	ASSERT_TRUE(AssetCache::tryHashFile(fileName, &expected));
+	EXPECT_EQ(expected, hash);
+
+	// The file is not hashed again while its modification time and size are unchanged
+	const std::time_t modificationTime = boost::filesystem::last_write_time(fileName);
+	{
+		std::ofstream out(fileName);
+		out << "Other" << std::endl;
+	}
+	boost::filesystem::last_write_time(fileName, modificationTime);
+	ASSERT_TRUE(cache->getContentHash(fileName, &hash));
+	EXPECT_EQ(expected, hash);
+
+	// A different size or modification time is detected
+	{
+		std::ofstream out(fileName);
+		out << "Second" << std::endl;
+	}
+	boost::filesystem::last_write_time(fileName, modificationTime);
+	ASSERT_TRUE(cache->getContentHash(fileName, &hash));
+	ASSERT_TRUE(AssetCache::tryHashFile(fileName, &expected));
+	EXPECT_EQ(expected, hash);
+
+	{
+		std::ofstream out(fileName);
+		out << "Third!" << std::endl;
+	}
+	boost::filesystem::last_write_time(fileName, modificationTime + 10);
+	ASSERT_TRUE(cache->getContentHash(fileName, &hash));
+	ASSERT_TRUE(AssetCache::tryHashFile(fileName, &expected));
+	EXPECT_EQ(expected, hash);
+
+	// Files larger than one chunk are hashed completely
+	const std::string largeContent(200 * 1024, 'a');
+	{
+		std::ofstream out(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+		out << largeContent;
+	}
+	ASSERT_TRUE(AssetCache::tryHashFile(fileName, &expected));
+	{
+		std::ofstream out(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+		out << largeContent.substr(1) << 'b';
+	}
+	ASSERT_TRUE(AssetCache::tryHashFile(fileName, &hash));
+	EXPECT_NE(expected, hash);
+
+	cache->clear();
+	std::remove(fileName.c_str());
+}
+
+TEST_F(AssetTest, BinaryCache)
+{
+	auto cache = Runtime::getAssetCache();
+	cache->clear();
+	cache->setBinaryCacheEnabled(true);
+	ApplicationData data(std::vector<std::string>(1, "."));
+
+	const std::string fileName("AssetBinaryCacheTestFile.txt");
+	{
+		std::ofstream out(fileName);
+		out << "First" << std::endl;
+	}
+	const std::string cacheFileName = cache->getBinaryCacheFileName("CachedMockAsset", data.findFile(fileName));
+	std::remove(cacheFileName.c_str());
+
+	CachedMockAsset::loadCount = 0;
+
+	// The first load reads the file and writes the binary cache file
+	auto first = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(first->load(fileName, data));
+	EXPECT_EQ("First", first->content);
+	EXPECT_EQ(1, CachedMockAsset::loadCount);
+	EXPECT_TRUE(std::ifstream(cacheFileName).good());
+
+	// The second load reads the binary cache file, the data in memory is cleared before every load
+	cache->clear();
+	auto second = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(second->load(fileName, data));
+	EXPECT_EQ("First", second->content);
+	EXPECT_EQ(1, CachedMockAsset::loadCount);
+
+	// A changed file makes the binary cache file outdated
+	{
+		std::ofstream out(fileName);
+		out << "Second" << std::endl;
+	}
+	cache->clear();
+	auto third = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(third->load(fileName, data));
+	EXPECT_EQ("Second", third->content);
+	EXPECT_EQ(2, CachedMockAsset::loadCount);
+
+	// A corrupted binary cache file is ignored
+	{
+		std::ofstream out(cacheFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+		out << "Garbage";
+	}
+	cache->clear();
+	auto fourth = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(fourth->load(fileName, data));
+	EXPECT_EQ("Second", fourth->content);
+	EXPECT_EQ(3, CachedMockAsset::loadCount);
+
+	// Without the binary cache every load reads the file
+	cache->setBinaryCacheEnabled(false);
+	cache->clear();
+	auto fifth = std::make_shared<CachedMockAsset>();
+	ASSERT_NO_THROW(fifth->load(fileName, data));
+	EXPECT_EQ(4, CachedMockAsset::loadCount);
+
+	cache->clear();
+	std::remove(cacheFileName.c_str());
+	std::remove(fileName.c_str());
+}
+
 }; // Framework
-}; // SurgSim
\ No newline at end of file
+}; // SurgSim
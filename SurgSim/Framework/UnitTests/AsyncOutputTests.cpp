@@ -0,0 +1,167 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <string>
+#include <vector>
+
+#include "SurgSim/Framework/AsyncOutput.h"
+#include "SurgSim/Framework/Log.h"
+
+using SurgSim::Framework::AsyncOutput;
+using SurgSim::Framework::Logger;
+
+namespace
+{
+
+/// Output that records the messages, can be blocked to simulate slow I/O
+class RecordingOutput : public SurgSim::Framework::LogOutput
+{
+public:
+	RecordingOutput() : isBlocked(false)
+	{
+	}
+
+	bool writeMessage(const std::string& message) override
+	{
+		while (isBlocked)
+		{
+			boost::this_thread::yield();
+		}
+		boost::lock_guard<boost::mutex> lock(mutex);
+		messages.push_back(message);
+		return true;
+	}
+
+	std::vector<std::string> getMessages()
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+		return messages;
+	}
+
+	std::atomic<bool> isBlocked;
+
+private:
+	boost::mutex mutex;
+	std::vector<std::string> messages;
+};
+
+}
+
+TEST(AsyncOutputTests, Constructor)
+{
+	auto output = std::make_shared<RecordingOutput>();
+	EXPECT_THROW(AsyncOutput(nullptr), SurgSim::Framework::AssertionFailure);
+
+	AsyncOutput async(output, 16, AsyncOutput::FULL_QUEUE_BLOCK);
+	EXPECT_EQ(output, async.getOutput());
+	EXPECT_EQ(AsyncOutput::FULL_QUEUE_BLOCK, async.getFullQueuePolicy());
+	EXPECT_EQ(0u, async.getDroppedMessageCount());
+	EXPECT_EQ(0u, async.getWrittenMessageCount());
+}
+
+TEST(AsyncOutputTests, WriteInOrder)
+{
+	auto output = std::make_shared<RecordingOutput>();
+	{
+		AsyncOutput async(output, 16);
+		for (int i = 0; i < 10; ++i)
+		{
+			EXPECT_TRUE(async.writeMessage(std::to_string(i)));
+		}
+		async.flush();
+		EXPECT_EQ(10u, async.getWrittenMessageCount());
+		EXPECT_EQ(10u, output->getMessages().size());
+
+		EXPECT_TRUE(async.writeMessage("last"));
+	}
+
+	// The destructor writes out the remaining messages
+	auto messages = output->getMessages();
+	ASSERT_EQ(11u, messages.size());
+	for (int i = 0; i < 10; ++i)
+	{
+		EXPECT_EQ(std::to_string(i), messages[i]);
+	}
+	EXPECT_EQ("last", messages[10]);
+}
+
+TEST(AsyncOutputTests, DropWhenFull)
+{
+	auto output = std::make_shared<RecordingOutput>();
+	output->isBlocked = true;
+	AsyncOutput async(output, 4, AsyncOutput::FULL_QUEUE_DROP);
+
+	// The background thread takes at most one message out of the queue while the output is blocked
+	size_t accepted = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		if (async.writeMessage(std::to_string(i)))
+		{
+			++accepted;
+		}
+	}
+	EXPECT_GE(5u, accepted);
+	EXPECT_EQ(10u - accepted, async.getDroppedMessageCount());
+
+	output->isBlocked = false;
+	async.flush();
+	EXPECT_EQ(accepted, async.getWrittenMessageCount());
+}
+
+TEST(AsyncOutputTests, BlockWhenFull)
+{
+	auto output = std::make_shared<RecordingOutput>();
+	output->isBlocked = true;
+	AsyncOutput async(output, 4, AsyncOutput::FULL_QUEUE_BLOCK);
+
+	boost::thread writer([&async]()
+	{
+		for (int i = 0; i < 10; ++i)
+		{
+			async.writeMessage(std::to_string(i));
+		}
+	});
+
+	boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+	EXPECT_EQ(0u, async.getWrittenMessageCount());
+
+	output->isBlocked = false;
+	writer.join();
+	async.flush();
+
+	EXPECT_EQ(0u, async.getDroppedMessageCount());
+	EXPECT_EQ(10u, async.getWrittenMessageCount());
+	EXPECT_EQ(10u, output->getMessages().size());
+}
+
+TEST(AsyncOutputTests, LoggerOutput)
+{
+	auto output = std::make_shared<RecordingOutput>();
+	auto async = std::make_shared<AsyncOutput>(output);
+	auto logger = Logger::getLogger("AsyncOutputTests");
+	logger->setOutput(async);
+	logger->setThreshold(SurgSim::Framework::LOG_LEVEL_INFO);
+
+	SURGSIM_LOG_INFO(logger) << "Message " << 1;
+	async->flush();
+
+	auto messages = output->getMessages();
+	ASSERT_EQ(1u, messages.size());
+	EXPECT_NE(std::string::npos, messages[0].find("Message 1"));
+	EXPECT_NE(std::string::npos, messages[0].find("AsyncOutputTests"));
+}
@@ -62,3 +62,19 @@ TEST(BarrierTest, FailureTest)
 	boost::thread thread(threadFailureFunc);
 	EXPECT_FALSE(barrier->wait(true));
 }
+
+TEST(BarrierTest, WaitForOthersTest)
+{
+	barrier = std::make_shared<Barrier>(3);
+	boost::thread first(threadSuccessFunc);
+	boost::thread second(threadSuccessFunc);
+
+	// Returns once both threads are waiting, without releasing them
+	barrier->waitForOthers();
+	EXPECT_FALSE(first.try_join_for(boost::chrono::milliseconds(50)));
+	EXPECT_FALSE(second.try_join_for(boost::chrono::milliseconds(50)));
+
+	EXPECT_TRUE(barrier->wait(true));
+	first.join();
+	second.join();
+}
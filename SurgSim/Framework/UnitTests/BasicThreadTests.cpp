@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 #include <boost/thread.hpp>
+#include <numeric>
 
 
 #include "SurgSim/Framework/BasicThread.h"
@@ -297,6 +298,47 @@ TEST(BasicThreadTest, RealTimings)
 	m.stop();
 }
 
+TEST(BasicThreadTest, TimingPolicy)
+{
+	MockThread m;
+	EXPECT_EQ(TIMING_POLICY_SLEEP, m.getTimingPolicy());
+	EXPECT_EQ(-1, m.getCpuAffinity());
+	EXPECT_EQ(0, m.getRealTimePriority());
+	EXPECT_THROW(m.setTimingPolicy(TIMING_POLICY_HYBRID, -1.0), AssertionFailure);
+	EXPECT_THROW(m.setRealTimePriority(-1), AssertionFailure);
+
+	m.setTimingPolicy(TIMING_POLICY_HYBRID, 0.001);
+	EXPECT_EQ(TIMING_POLICY_HYBRID, m.getTimingPolicy());
+	EXPECT_DOUBLE_EQ(0.001, m.getSpinWindow());
+
+	m.setCpuAffinity(0);
+	EXPECT_EQ(0, m.getCpuAffinity());
+
+	std::vector<TimingPolicy> policies;
+	policies.push_back(TIMING_POLICY_SLEEP);
+	policies.push_back(TIMING_POLICY_HYBRID);
+	policies.push_back(TIMING_POLICY_BUSY_WAIT);
+	for (auto policy = policies.cbegin(); policy != policies.cend(); ++policy)
+	{
+		MockThread thread;
+		thread.setRate(1000.0);
+		thread.setTimingPolicy(*policy);
+		thread.start(nullptr);
+		boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+		thread.stop();
+
+		const FrameTimingStatistics& statistics = thread.getFrameTimingStatistics();
+		EXPECT_LT(0u, statistics.getNumberOfFrames());
+		EXPECT_EQ(statistics.getNumberOfFrames(), thread.getUpdateCount());
+
+		auto histogram = statistics.getLatenessHistogram();
+		EXPECT_EQ(statistics.getNumberOfFrames(), std::accumulate(histogram.begin(), histogram.end(), size_t(0)));
+
+		thread.resetFrameTimingStatistics();
+		EXPECT_EQ(0u, statistics.getNumberOfFrames());
+	}
+}
+
 // HS-2013-jun-25 Can't figure out how to make this work or what is going wrong with the test
 class BasicThreadDeathTest : public ::testing::Test
 {
@@ -0,0 +1,110 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Framework::BinaryReader;
+using SurgSim::Framework::BinaryWriter;
+using SurgSim::Math::Vector3d;
+
+TEST(BinaryReaderWriterTests, RoundTrip)
+{
+	std::vector<Vector3d> positions;
+	positions.push_back(Vector3d(1.0, 2.0, 3.0));
+	positions.push_back(Vector3d(4.0, 5.0, 6.0));
+
+	BinaryWriter writer;
+	writer.write(static_cast<uint32_t>(42));
+	writer.writeString("Text");
+	writer.writeArray(positions);
+	writer.writeArray(std::vector<size_t>());
+
+	auto& buffer = writer.getBuffer();
+	BinaryReader reader(buffer.data(), buffer.size());
+
+	uint32_t number = 0;
+	std::string text;
+	std::vector<Vector3d> readPositions;
+	std::vector<size_t> empty(3);
+	EXPECT_TRUE(reader.read(&number));
+	EXPECT_TRUE(reader.readString(&text));
+	EXPECT_TRUE(reader.readArray(&readPositions));
+	EXPECT_TRUE(reader.readArray(&empty));
+
+	EXPECT_TRUE(reader.isValid());
+	EXPECT_TRUE(reader.isAtEnd());
+	EXPECT_EQ(42u, number);
+	EXPECT_EQ("Text", text);
+	EXPECT_EQ(positions, readPositions);
+	EXPECT_TRUE(empty.empty());
+}
+
+TEST(BinaryReaderWriterTests, ReadPastEnd)
+{
+	BinaryWriter writer;
+	writer.write(1.0);
+	writer.write(static_cast<uint64_t>(1000));
+
+	auto& buffer = writer.getBuffer();
+	BinaryReader reader(buffer.data(), buffer.size());
+
+	double value = 0.0;
+	EXPECT_TRUE(reader.read(&value));
+	EXPECT_TRUE(reader.isValid());
+
+	// The size is larger than the remaining data
+	std::vector<double> values;
+	EXPECT_FALSE(reader.readArray(&values));
+	EXPECT_FALSE(reader.isValid());
+
+	// Once invalid, all reads fail
+	EXPECT_FALSE(reader.read(&value));
+	EXPECT_FALSE(reader.isValid());
+}
+
+TEST(BinaryReaderWriterTests, File)
+{
+	const std::string fileName("BinaryReaderWriterTestFile.bin");
+	std::remove(fileName.c_str());
+
+	{
+		BinaryReader reader(fileName);
+		EXPECT_FALSE(reader.isValid());
+	}
+
+	BinaryWriter writer;
+	writer.writeString("Content");
+	ASSERT_TRUE(writer.save(fileName));
+
+	{
+		BinaryReader reader(fileName);
+		EXPECT_TRUE(reader.isValid());
+
+		std::string text;
+		EXPECT_TRUE(reader.readString(&text));
+		EXPECT_EQ("Content", text);
+		EXPECT_TRUE(reader.isAtEnd());
+	}
+
+	std::remove(fileName.c_str());
+}
@@ -0,0 +1,67 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/FrameTimingStatistics.h"
+
+using SurgSim::Framework::FrameTimingStatistics;
+
+TEST(FrameTimingStatisticsTests, Constructor)
+{
+	EXPECT_NO_THROW(FrameTimingStatistics statistics);
+	EXPECT_THROW(FrameTimingStatistics statistics(0.0, 10), SurgSim::Framework::AssertionFailure);
+	EXPECT_THROW(FrameTimingStatistics statistics(1e-3, 0), SurgSim::Framework::AssertionFailure);
+
+	FrameTimingStatistics statistics(1e-3, 10);
+	EXPECT_DOUBLE_EQ(1e-3, statistics.getBinWidth());
+	EXPECT_EQ(10u, statistics.getBinCount());
+	EXPECT_EQ(0u, statistics.getNumberOfFrames());
+	EXPECT_EQ(0u, statistics.getNumberOfOverruns());
+	EXPECT_EQ(std::vector<size_t>(10, 0), statistics.getLatenessHistogram());
+	EXPECT_EQ(std::vector<size_t>(10, 0), statistics.getOverrunHistogram());
+	EXPECT_DOUBLE_EQ(0.0, statistics.getAverageLateness());
+}
+
+TEST(FrameTimingStatisticsTests, AddFrames)
+{
+	FrameTimingStatistics statistics(1e-3, 4);
+
+	statistics.addFrame(0.5e-3, 0.0);
+	statistics.addFrame(1.5e-3, 0.0);
+	statistics.addFrame(0.0, 2.5e-3);
+	statistics.addFrame(1.0, 10.0);
+	statistics.addFrame(-1.0, -1.0);
+
+	EXPECT_EQ(5u, statistics.getNumberOfFrames());
+	EXPECT_EQ(2u, statistics.getNumberOfOverruns());
+
+	std::vector<size_t> expectedLateness = {3, 1, 0, 1};
+	EXPECT_EQ(expectedLateness, statistics.getLatenessHistogram());
+	std::vector<size_t> expectedOverrun = {3, 0, 1, 1};
+	EXPECT_EQ(expectedOverrun, statistics.getOverrunHistogram());
+
+	EXPECT_DOUBLE_EQ(1.0, statistics.getMaxLateness());
+	EXPECT_DOUBLE_EQ(10.0, statistics.getMaxOverrun());
+	EXPECT_DOUBLE_EQ((0.5e-3 + 1.5e-3 + 1.0) / 5.0, statistics.getAverageLateness());
+
+	statistics.reset();
+	EXPECT_EQ(0u, statistics.getNumberOfFrames());
+	EXPECT_EQ(0u, statistics.getNumberOfOverruns());
+	EXPECT_EQ(std::vector<size_t>(4, 0), statistics.getLatenessHistogram());
+	EXPECT_EQ(std::vector<size_t>(4, 0), statistics.getOverrunHistogram());
+	EXPECT_DOUBLE_EQ(0.0, statistics.getMaxLateness());
+	EXPECT_DOUBLE_EQ(0.0, statistics.getMaxOverrun());
+}
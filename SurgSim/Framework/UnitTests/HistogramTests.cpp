@@ -0,0 +1,109 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <numeric>
+#include <vector>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Histogram.h"
+
+using SurgSim::Framework::Histogram;
+
+TEST(HistogramTests, Constructor)
+{
+	EXPECT_THROW(Histogram histogram(0.0, 10), SurgSim::Framework::AssertionFailure);
+	EXPECT_THROW(Histogram histogram(1e-3, 0), SurgSim::Framework::AssertionFailure);
+
+	Histogram histogram(1e-3, 10);
+	EXPECT_DOUBLE_EQ(1e-3, histogram.getBinWidth());
+	EXPECT_EQ(10u, histogram.getBinCount());
+	EXPECT_EQ(0u, histogram.getNumberOfSamples());
+	EXPECT_EQ(std::vector<size_t>(10, 0), histogram.getBins());
+	EXPECT_DOUBLE_EQ(0.0, histogram.getMax());
+	EXPECT_DOUBLE_EQ(0.0, histogram.getAverage());
+	EXPECT_DOUBLE_EQ(0.0, histogram.getPercentile(0.5));
+}
+
+TEST(HistogramTests, AddSample)
+{
+	Histogram histogram(1.0, 4);
+	histogram.addSample(0.5);
+	histogram.addSample(1.5);
+	histogram.addSample(1.7);
+	histogram.addSample(100.0);
+	histogram.addSample(-1.0);
+
+	EXPECT_EQ(5u, histogram.getNumberOfSamples());
+	std::vector<size_t> expected = {2, 2, 0, 1};
+	EXPECT_EQ(expected, histogram.getBins());
+	EXPECT_DOUBLE_EQ(100.0, histogram.getMax());
+	EXPECT_DOUBLE_EQ(103.7 / 5.0, histogram.getAverage());
+
+	EXPECT_DOUBLE_EQ(1.0, histogram.getPercentile(0.4));
+	EXPECT_DOUBLE_EQ(2.0, histogram.getPercentile(0.8));
+	EXPECT_DOUBLE_EQ(100.0, histogram.getPercentile(1.0));
+	EXPECT_THROW(histogram.getPercentile(-0.1), SurgSim::Framework::AssertionFailure);
+
+	// The reset shows right away, the data is cleared with the next sample
+	histogram.reset();
+	EXPECT_EQ(0u, histogram.getNumberOfSamples());
+	EXPECT_EQ(std::vector<size_t>(4, 0), histogram.getBins());
+	EXPECT_DOUBLE_EQ(0.0, histogram.getMax());
+
+	histogram.addSample(2.5);
+	EXPECT_EQ(1u, histogram.getNumberOfSamples());
+	expected = {0, 0, 1, 0};
+	EXPECT_EQ(expected, histogram.getBins());
+	EXPECT_DOUBLE_EQ(2.5, histogram.getMax());
+	EXPECT_DOUBLE_EQ(2.5, histogram.getAverage());
+}
+
+TEST(HistogramTests, ConcurrentReaders)
+{
+	Histogram histogram(1.0, 8);
+	const size_t numSamples = 200000;
+
+	boost::thread writer([&histogram, numSamples]()
+	{
+		for (size_t i = 0; i < numSamples; ++i)
+		{
+			histogram.addSample(static_cast<double>(i % 10));
+		}
+	});
+
+	// The counts seen by a reader only grow
+	size_t previous = 0;
+	while (previous < numSamples)
+	{
+		std::vector<size_t> bins = histogram.getBins();
+		size_t count = std::accumulate(bins.begin(), bins.end(), size_t(0));
+		EXPECT_LE(previous, count);
+		previous = count;
+		if (writer.timed_join(boost::posix_time::milliseconds(0)))
+		{
+			break;
+		}
+	}
+	writer.join();
+
+	EXPECT_EQ(numSamples, histogram.getNumberOfSamples());
+	std::vector<size_t> bins = histogram.getBins();
+	EXPECT_EQ(numSamples, std::accumulate(bins.begin(), bins.end(), size_t(0)));
+	EXPECT_EQ(3 * numSamples / 10, bins[7]);
+	EXPECT_DOUBLE_EQ(9.0, histogram.getMax());
+}
@@ -0,0 +1,106 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <string>
+#include <vector>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/LockFreeQueue.h"
+
+using SurgSim::Framework::LockFreeQueue;
+
+TEST(LockFreeQueueTests, Constructor)
+{
+	EXPECT_THROW(LockFreeQueue<int> queue(0), SurgSim::Framework::AssertionFailure);
+
+	LockFreeQueue<int> queue(5);
+	EXPECT_EQ(8u, queue.getCapacity());
+	EXPECT_TRUE(queue.isEmpty());
+	EXPECT_EQ(0u, queue.size());
+}
+
+TEST(LockFreeQueueTests, PushPop)
+{
+	LockFreeQueue<std::string> queue(4);
+	std::string value;
+	EXPECT_FALSE(queue.tryPop(&value));
+
+	for (int i = 0; i < 4; ++i)
+	{
+		EXPECT_TRUE(queue.tryPush(std::to_string(i)));
+	}
+	EXPECT_EQ(4u, queue.size());
+	EXPECT_FALSE(queue.tryPush(std::string("full")));
+
+	EXPECT_TRUE(queue.tryPop(&value));
+	EXPECT_EQ("0", value);
+
+	std::string moved("4");
+	EXPECT_TRUE(queue.tryPush(std::move(moved)));
+
+	for (int i = 1; i < 5; ++i)
+	{
+		EXPECT_TRUE(queue.tryPop(&value));
+		EXPECT_EQ(std::to_string(i), value);
+	}
+	EXPECT_FALSE(queue.tryPop(&value));
+	EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(LockFreeQueueTests, MultipleProducers)
+{
+	const int producerCount = 4;
+	const int valuesPerProducer = 10000;
+	LockFreeQueue<int> queue(64);
+
+	boost::thread_group producers;
+	for (int producer = 0; producer < producerCount; ++producer)
+	{
+		producers.create_thread([&queue, producer, valuesPerProducer]()
+		{
+			for (int i = 0; i < valuesPerProducer; ++i)
+			{
+				while (!queue.tryPush(producer * valuesPerProducer + i))
+				{
+					boost::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	// Every value has to arrive exactly once, and in order for each producer
+	std::vector<int> received(producerCount * valuesPerProducer, 0);
+	std::vector<int> last(producerCount, -1);
+	int count = 0;
+	int value;
+	while (count < producerCount * valuesPerProducer)
+	{
+		if (queue.tryPop(&value))
+		{
+			++received[value];
+			int producer = value / valuesPerProducer;
+			EXPECT_LT(last[producer], value);
+			last[producer] = value;
+			++count;
+		}
+	}
+	producers.join_all();
+
+	EXPECT_TRUE(queue.isEmpty());
+	EXPECT_EQ(std::vector<int>(producerCount * valuesPerProducer, 1), received);
+}
@@ -20,6 +20,7 @@
 #include "SurgSim/Framework/Log.h"
 
 #include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
 
 #include <fstream>
 #include <string>
@@ -240,6 +241,50 @@ TEST(LoggerTest, OnceIfMacroTest)
 	}
 }
 
+TEST(LoggerTest, RateLimitedMacroTest)
+{
+	auto logger = Logger::getLogger("TestLogger");
+	auto output = std::make_shared<MockOutput>();
+	logger->setOutput(output);
+	logger->setThreshold(SurgSim::Framework::LOG_LEVEL_WARNING);
+
+	for (int i = 0;  i < 3; ++i)
+	{
+		output->reset();
+		SURGSIM_LOG_RATE_LIMITED(logger, CRITICAL, 10.0) << "Test Text";
+		if (i == 0)
+		{
+			EXPECT_TRUE(isContained("Test Text", output->logMessage));
+		}
+		else
+		{
+			EXPECT_EQ("", output->logMessage);
+		}
+
+		output->reset();
+		SURGSIM_LOG_RATE_LIMITED(logger, DEBUG, 0.1) << "Missing Text";
+		EXPECT_EQ("", output->logMessage);
+
+		// After the interval the statement logs again, but only once
+		boost::this_thread::sleep(boost::posix_time::milliseconds(150));
+		for (int j = 0; j < 2; ++j)
+		{
+			output->reset();
+			SURGSIM_LOG_RATE_LIMITED(logger, CRITICAL, 0.1) << "More Text";
+			EXPECT_EQ(j == 0, isContained("More Text", output->logMessage));
+		}
+	}
+}
+
+TEST(LoggerTest, LogRateLimiter)
+{
+	SurgSim::Framework::LogRateLimiter limiter(10.0);
+	EXPECT_TRUE(limiter.tryAcquire());
+	EXPECT_FALSE(limiter.tryAcquire());
+	EXPECT_FALSE(limiter.tryAcquire());
+	EXPECT_EQ(2u, limiter.getSuppressedCount());
+}
+
 TEST(LoggerTest, EndOfLineTest)
 {
 	auto logger = Logger::getLogger("TestLogger");
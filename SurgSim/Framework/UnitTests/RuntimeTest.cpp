@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <boost/thread/thread.hpp>
 #include <gtest/gtest.h>
 #include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Framework/Scene.h"
@@ -23,6 +25,49 @@ using SurgSim::Framework::Runtime;
 using SurgSim::Framework::Scene;
 using SurgSim::Framework::Logger;
 
+namespace
+{
+/// Manager that quits after a number of updates
+class QuittingManager : public MockManager
+{
+public:
+	explicit QuittingManager(int numUpdates) : m_numUpdates(numUpdates)
+	{
+	}
+
+private:
+	bool doUpdate(double dt) override
+	{
+		++count;
+		return count < m_numUpdates;
+	}
+
+	int m_numUpdates;
+};
+
+/// Manager with slow updates, to check when they are running
+class SlowManager : public MockManager
+{
+public:
+	SlowManager() : updates(0), isUpdating(false)
+	{
+	}
+
+	std::atomic<int> updates;
+	std::atomic<bool> isUpdating;
+
+private:
+	bool doUpdate(double dt) override
+	{
+		isUpdating = true;
+		boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+		++updates;
+		isUpdating = false;
+		return true;
+	}
+};
+}
+
 TEST(RuntimeTest, Constructor)
 {
 	EXPECT_NO_THROW({std::shared_ptr<Runtime> runtime(new Runtime());});
@@ -200,6 +245,136 @@ TEST(RuntimeTest, PauseResume)
 	runtime->stop();
 }
 
+TEST(RuntimeTest, VirtualTime)
+{
+	std::shared_ptr<Runtime> runtime(new Runtime());
+	std::shared_ptr<MockManager> fast(new MockManager());
+	std::shared_ptr<MockManager> slow(new MockManager());
+	fast->setRate(1000.0);
+	slow->setRate(60.0);
+
+	runtime->addManager(fast);
+	runtime->addManager(slow);
+
+	EXPECT_TRUE(runtime->startVirtualTime());
+	EXPECT_TRUE(runtime->isVirtualTime());
+	EXPECT_TRUE(runtime->isPaused());
+	EXPECT_DOUBLE_EQ(1.0 / 60.0, fast->getVirtualFramePeriod());
+
+	int fastCount = fast->count;
+	int slowCount = slow->count;
+
+	// Step blocks until all managers are done with the frame, no need to wait
+	runtime->step();
+	EXPECT_EQ(slowCount + 1, slow->count);
+	EXPECT_EQ(fastCount + 16, fast->count);
+
+	runtime->step();
+	EXPECT_EQ(slowCount + 2, slow->count);
+	EXPECT_EQ(fastCount + 33, fast->count);
+
+	EXPECT_EQ(58u, runtime->advance(58.0 / 60.0));
+	EXPECT_EQ(slowCount + 60, slow->count);
+	EXPECT_EQ(fastCount + 1000, fast->count);
+	EXPECT_NEAR(1.0, runtime->getSimulatedTime(), 1e-12);
+	EXPECT_NEAR(1.0, fast->getSimulatedTime(), 1e-12);
+	EXPECT_NEAR(1.0, slow->getSimulatedTime(), 1e-12);
+	EXPECT_LT(0.0, runtime->getVirtualTimeThroughput());
+
+	runtime->resume();
+	EXPECT_FALSE(runtime->isVirtualTime());
+	EXPECT_FALSE(fast->isSynchronous());
+	EXPECT_DOUBLE_EQ(0.0, fast->getVirtualFramePeriod());
+
+	runtime->stop();
+}
+
+TEST(RuntimeTest, VirtualTimeFramePeriod)
+{
+	std::shared_ptr<Runtime> runtime(new Runtime());
+	std::shared_ptr<MockManager> manager(new MockManager());
+	manager->setRate(100.0);
+	runtime->addManager(manager);
+
+	EXPECT_TRUE(runtime->startVirtualTime(0.1));
+	int count = manager->count;
+
+	EXPECT_EQ(3u, runtime->advance(0.25));
+	EXPECT_EQ(count + 30, manager->count);
+	EXPECT_NEAR(0.3, runtime->getSimulatedTime(), 1e-12);
+
+	EXPECT_THROW(runtime->advance(-0.1), SurgSim::Framework::AssertionFailure);
+	EXPECT_EQ(0u, runtime->advance(0.0));
+
+	runtime->stop();
+}
+
+TEST(RuntimeTest, StepAfterManagerQuit)
+{
+	std::shared_ptr<Runtime> runtime(new Runtime());
+	std::shared_ptr<MockManager> manager(new MockManager());
+	std::shared_ptr<QuittingManager> quitting(new QuittingManager(3));
+	manager->setRate(10.0);
+	quitting->setRate(10.0);
+	runtime->addManager(manager);
+	runtime->addManager(quitting);
+
+	EXPECT_TRUE(runtime->startVirtualTime());
+
+	// Stepping stops instead of waiting for the manager that quit
+	EXPECT_GT(10u, runtime->advance(1.0));
+	EXPECT_FALSE(quitting->isRunning());
+	EXPECT_FALSE(runtime->step());
+	EXPECT_FALSE(runtime->step());
+
+	runtime->stop();
+}
+
+TEST(RuntimeTest, PauseAndStepWaitForManagers)
+{
+	auto runtime = std::make_shared<Runtime>();
+	auto manager = std::make_shared<SlowManager>();
+	manager->setRate(1000.0);
+	runtime->addManager(manager);
+
+	ASSERT_TRUE(runtime->start(false));
+	boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+
+	// Once pause() returns the manager is not updating anymore
+	runtime->pause();
+	EXPECT_FALSE(manager->isUpdating);
+	int updates = manager->updates;
+	boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+	EXPECT_EQ(updates, manager->updates);
+
+	// step() returns once the update is done
+	for (int i = 1; i <= 3; ++i)
+	{
+		EXPECT_TRUE(runtime->step());
+		EXPECT_FALSE(manager->isUpdating);
+		EXPECT_EQ(updates + i, manager->updates);
+	}
+
+	EXPECT_NO_THROW(runtime->restoreSnapshot(runtime->takeSnapshot()));
+	EXPECT_EQ(updates + 3, manager->updates);
+
+	runtime->stop();
+}
+
+TEST(RuntimeTest, StartPausedWaitsForManagers)
+{
+	auto runtime = std::make_shared<Runtime>();
+	auto manager = std::make_shared<SlowManager>();
+	runtime->addManager(manager);
+
+	ASSERT_TRUE(runtime->start(true));
+	EXPECT_EQ(0, manager->updates);
+	EXPECT_TRUE(runtime->step());
+	EXPECT_EQ(1, manager->updates);
+
+	runtime->stop();
+}
+
 TEST(RuntimeTest, AddComponentAddDuringRuntime)
 {
 	std::shared_ptr<Runtime> runtime = std::make_shared<Runtime>();
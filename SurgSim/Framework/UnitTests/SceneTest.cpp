@@ -21,6 +21,8 @@
 #include "SurgSim/Framework/BasicSceneElement.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Framework/UnitTests/MockObjects.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
 #include "SurgSim/Testing/Utilities.h"
 
 
@@ -232,5 +234,41 @@ TEST(SceneTest, SceneElementGroups)
 
 }
 
+TEST(SceneTest, Snapshot)
+{
+	auto runtime = std::make_shared<Runtime>();
+	auto scene = runtime->getScene();
+
+	auto element0 = std::make_shared<BasicSceneElement>("element0");
+	auto element1 = std::make_shared<BasicSceneElement>("element1");
+	auto pose0 = SurgSim::Math::makeRigidTranslation(SurgSim::Math::Vector3d(1.0, 2.0, 3.0));
+	auto pose1 = SurgSim::Math::makeRigidTranslation(SurgSim::Math::Vector3d(4.0, 5.0, 6.0));
+	element0->setPose(pose0);
+	element1->setPose(pose1);
+	scene->addSceneElement(element0);
+	scene->addSceneElement(element1);
+
+	std::vector<char> snapshot;
+	ASSERT_NO_THROW(snapshot = runtime->takeSnapshot());
+	EXPECT_FALSE(snapshot.empty());
+
+	element0->setPose(SurgSim::Math::RigidTransform3d::Identity());
+	element1->setPose(SurgSim::Math::RigidTransform3d::Identity());
+
+	EXPECT_TRUE(runtime->restoreSnapshot(snapshot));
+	EXPECT_TRUE(element0->getPose().isApprox(pose0));
+	EXPECT_TRUE(element1->getPose().isApprox(pose1));
+
+	// A truncated snapshot fails to restore
+	std::vector<char> truncated(snapshot.begin(), snapshot.begin() + snapshot.size() / 2);
+	EXPECT_FALSE(runtime->restoreSnapshot(truncated));
+
+	// A snapshot of components that are not in the scene anymore fails to restore, the others are restored
+	element0->setPose(SurgSim::Math::RigidTransform3d::Identity());
+	scene->removeSceneElement(element1);
+	EXPECT_FALSE(runtime->restoreSnapshot(snapshot));
+	EXPECT_TRUE(element0->getPose().isApprox(pose0));
+}
+
 }
 }
@@ -0,0 +1,101 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <vector>
+
+#include "SurgSim/Framework/SwapBuffer.h"
+
+using SurgSim::Framework::SwapBuffer;
+
+TEST(SwapBufferTests, TakeFront)
+{
+	SwapBuffer<int> buffer;
+	EXPECT_FALSE(buffer.tryTakeFront());
+
+	buffer.getBack() = 1;
+	buffer.publish();
+	EXPECT_TRUE(buffer.tryTakeFront());
+	EXPECT_EQ(1, buffer.getFront());
+
+	// Nothing new was published
+	EXPECT_FALSE(buffer.tryTakeFront());
+	EXPECT_EQ(1, buffer.getFront());
+
+	// Only the most recent buffer is taken
+	buffer.getBack() = 2;
+	buffer.publish();
+	buffer.getBack() = 3;
+	buffer.publish();
+	EXPECT_TRUE(buffer.tryTakeFront());
+	EXPECT_EQ(3, buffer.getFront());
+	EXPECT_FALSE(buffer.tryTakeFront());
+}
+
+TEST(SwapBufferTests, BuffersAreDistinct)
+{
+	SwapBuffer<int> buffer;
+	buffer.getBack() = 1;
+	buffer.publish();
+	buffer.getBack() = 2;
+	EXPECT_TRUE(buffer.tryTakeFront());
+
+	// The producer keeps writing without touching the front buffer
+	EXPECT_NE(&buffer.getFront(), &buffer.getBack());
+	EXPECT_EQ(1, buffer.getFront());
+	EXPECT_EQ(2, buffer.getBack());
+}
+
+TEST(SwapBufferTests, Threads)
+{
+	const size_t numFrames = 20000;
+	const size_t size = 64;
+	SwapBuffer<std::vector<size_t>> buffer;
+
+	auto producer = [&buffer, numFrames, size]()
+	{
+		for (size_t frame = 1; frame <= numFrames; ++frame)
+		{
+			auto& values = buffer.getBack();
+			values.assign(size, frame);
+			buffer.publish();
+		}
+	};
+	boost::thread thread(producer);
+
+	// Every taken buffer needs to be complete, and frames can only move forward
+	size_t lastFrame = 0;
+	bool isConsistent = true;
+	while (lastFrame < numFrames)
+	{
+		if (buffer.tryTakeFront())
+		{
+			const auto& values = buffer.getFront();
+			ASSERT_EQ(size, values.size());
+			for (auto value : values)
+			{
+				isConsistent = isConsistent && value == values[0];
+			}
+			isConsistent = isConsistent && values[0] > lastFrame;
+			lastFrame = values[0];
+		}
+	}
+	thread.join();
+
+	EXPECT_TRUE(isConsistent);
+	EXPECT_EQ(numFrames, lastFrame);
+}
@@ -0,0 +1,138 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/thread.hpp>
+#include <sstream>
+#include <string>
+
+#include "SurgSim/Framework/Tracer.h"
+
+using SurgSim::Framework::Tracer;
+
+namespace
+{
+
+size_t countOccurrences(const std::string& text, const std::string& pattern)
+{
+	size_t result = 0;
+	for (size_t position = text.find(pattern); position != std::string::npos;
+		 position = text.find(pattern, position + pattern.size()))
+	{
+		++result;
+	}
+	return result;
+}
+
+std::string getTrace()
+{
+	std::ostringstream out;
+	Tracer::writeChromeTrace(out);
+	return out.str();
+}
+
+}
+
+class TracerTests : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		Tracer::clear();
+		Tracer::setEnabled(true);
+	}
+
+	void TearDown() override
+	{
+		Tracer::setEnabled(false);
+		Tracer::clear();
+	}
+};
+
+TEST_F(TracerTests, Disabled)
+{
+	Tracer::setEnabled(false);
+	{
+		SURGSIM_TRACE_SCOPE("Test", "NotRecorded");
+	}
+	{
+		SURGSIM_TRACE_SCOPE_DYNAMIC("Test", std::string("Dynamic") + "NotRecorded");
+	}
+	EXPECT_EQ(0u, countOccurrences(getTrace(), "NotRecorded"));
+}
+
+TEST_F(TracerTests, Scopes)
+{
+	{
+		SURGSIM_TRACE_SCOPE("Test", "Outer");
+		SURGSIM_TRACE_SCOPE_DYNAMIC("Test", std::string("Inner") + "\"Quoted\"");
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+	}
+
+	std::string trace = getTrace();
+	EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+	EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"Outer\""));
+	EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"Inner\\\"Quoted\\\"\""));
+	EXPECT_EQ(2u, countOccurrences(trace, "\"cat\":\"Test\""));
+	EXPECT_EQ(2u, countOccurrences(trace, "\"ph\":\"X\""));
+
+	// Exported events are kept until they are cleared
+	EXPECT_EQ(1u, countOccurrences(getTrace(), "\"name\":\"Outer\""));
+	Tracer::clear();
+	EXPECT_EQ(0u, countOccurrences(getTrace(), "\"name\":\"Outer\""));
+}
+
+TEST_F(TracerTests, Threads)
+{
+	auto work = [](const std::string& name)
+	{
+		Tracer::setThreadName(name);
+		for (int i = 0; i < 10; ++i)
+		{
+			SURGSIM_TRACE_SCOPE("Test", "Work");
+		}
+	};
+
+	boost::thread thread1(work, "TracerThread1");
+	boost::thread thread2(work, "TracerThread2");
+	thread1.join();
+	thread2.join();
+
+	// The events of threads that ended can still be exported
+	std::string trace = getTrace();
+	EXPECT_EQ(20u, countOccurrences(trace, "\"name\":\"Work\""));
+	EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"TracerThread1\""));
+	EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"TracerThread2\""));
+	EXPECT_EQ(0u, Tracer::getDroppedCount());
+}
+
+TEST_F(TracerTests, FullBuffer)
+{
+	Tracer::setBufferCapacity(4);
+	auto work = []()
+	{
+		for (int i = 0; i < 10; ++i)
+		{
+			SURGSIM_TRACE_SCOPE("Test", "Overflow");
+		}
+	};
+	boost::thread thread(work);
+	thread.join();
+	Tracer::setBufferCapacity(16384);
+
+	EXPECT_EQ(4u, countOccurrences(getTrace(), "\"name\":\"Overflow\""));
+	EXPECT_EQ(6u, Tracer::getDroppedCount());
+}
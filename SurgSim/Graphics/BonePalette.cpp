@@ -0,0 +1,89 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/BonePalette.h"
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+BonePalette::BonePalette()
+{
+}
+
+void BonePalette::setBones(const std::vector<int>& parents, const Transforms& inverseBindMatrices)
+{
+	SURGSIM_ASSERT(parents.size() == inverseBindMatrices.size())
+			<< "There are " << parents.size() << " parents for " << inverseBindMatrices.size() << " bind matrices.";
+	for (size_t bone = 0; bone < parents.size(); ++bone)
+	{
+		SURGSIM_ASSERT(parents[bone] < static_cast<int>(bone))
+				<< "The parent of bone " << bone << " is bone " << parents[bone] << ", it has to come before.";
+	}
+
+	m_parents = parents;
+	m_inverseBindMatrices = inverseBindMatrices;
+	m_skeletonTransforms.assign(parents.size(), Math::Matrix44d::Identity());
+	m_palette.resize(parents.size());
+	for (size_t bone = 0; bone < parents.size(); ++bone)
+	{
+		m_palette[bone] = m_inverseBindMatrices[bone].cast<float>();
+	}
+}
+
+size_t BonePalette::getNumBones() const
+{
+	return m_parents.size();
+}
+
+int BonePalette::getParent(size_t bone) const
+{
+	return m_parents[bone];
+}
+
+void BonePalette::update(const Transforms& localTransforms)
+{
+	SURGSIM_ASSERT(localTransforms.size() == m_parents.size())
+			<< "There are " << localTransforms.size() << " transforms for " << m_parents.size() << " bones.";
+
+	for (size_t bone = 0; bone < m_parents.size(); ++bone)
+	{
+		if (m_parents[bone] < 0)
+		{
+			m_skeletonTransforms[bone] = localTransforms[bone];
+		}
+		else
+		{
+			m_skeletonTransforms[bone] = m_skeletonTransforms[m_parents[bone]] * localTransforms[bone];
+		}
+		m_palette[bone] = (m_skeletonTransforms[bone] * m_inverseBindMatrices[bone]).cast<float>();
+	}
+}
+
+const BonePalette::Transforms& BonePalette::getSkeletonTransforms() const
+{
+	return m_skeletonTransforms;
+}
+
+const BonePalette::Palette& BonePalette::getPalette() const
+{
+	return m_palette;
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
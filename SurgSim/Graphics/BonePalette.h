@@ -0,0 +1,86 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_BONEPALETTE_H
+#define SURGSIM_GRAPHICS_BONEPALETTE_H
+
+#include <Eigen/StdVector>
+#include <vector>
+
+#include "SurgSim/Math/Matrix.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Computes the skinning matrices of all the bones of a skeleton in one pass. The bones are kept in a flat array in
+/// which every parent comes before its children, so the transform of each bone in skeleton space only needs the
+/// already computed transform of its parent. The skinning matrices, which take a vertex from the bind pose to the
+/// current pose of a bone, are stored contiguously in the order of the bones, the layout of the matrix palette of
+/// the hardware skinning shader.
+/// All the matrices act on column vectors.
+class BonePalette
+{
+public:
+	/// Transforms of the bones
+	typedef std::vector<Math::Matrix44d, Eigen::aligned_allocator<Math::Matrix44d>> Transforms;
+
+	/// Skinning matrices, in single precision as used for drawing
+	typedef std::vector<Math::Matrix44f, Eigen::aligned_allocator<Math::Matrix44f>> Palette;
+
+	/// Constructor
+	BonePalette();
+
+	/// Set the hierarchy of the bones
+	/// \param parents The index of the parent of each bone, -1 for the roots, parents come before their children
+	/// \param inverseBindMatrices The inverse of the transform in skeleton space of each bone in the bind pose
+	void setBones(const std::vector<int>& parents, const Transforms& inverseBindMatrices);
+
+	/// \return The number of bones
+	size_t getNumBones() const;
+
+	/// \param bone The index of a bone
+	/// \return The index of its parent, -1 for a root
+	int getParent(size_t bone) const;
+
+	/// Compute the transforms in skeleton space and the skinning matrices of all the bones
+	/// \param localTransforms The transform of each bone relative to its parent
+	void update(const Transforms& localTransforms);
+
+	/// \return The transform of each bone in skeleton space, as of the last update
+	const Transforms& getSkeletonTransforms() const;
+
+	/// \return The skinning matrix of each bone, as of the last update
+	const Palette& getPalette() const;
+
+private:
+	/// The index of the parent of each bone
+	std::vector<int> m_parents;
+
+	/// The inverse of the transform in skeleton space of each bone in the bind pose
+	Transforms m_inverseBindMatrices;
+
+	/// The transform of each bone in skeleton space
+	Transforms m_skeletonTransforms;
+
+	/// The skinning matrix of each bone
+	Palette m_palette;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_BONEPALETTE_H
@@ -0,0 +1,41 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_CPUSKINNING_INL_H
+#define SURGSIM_GRAPHICS_CPUSKINNING_INL_H
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+template <class Data>
+void CpuSkinning::copyPositions(DataStructures::Vertices<Data>* vertices) const
+{
+	SURGSIM_ASSERT(vertices->getNumVertices() == m_positions.size())
+			<< "Cannot copy " << m_positions.size() << " skinned positions into " << vertices->getNumVertices()
+			<< " vertices.";
+	for (size_t i = 0; i < m_positions.size(); ++i)
+	{
+		vertices->setVertexPosition(i, m_positions[i].cast<double>());
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_CPUSKINNING_INL_H
@@ -0,0 +1,157 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/CpuSkinning.h"
+
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <future>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/ThreadPool.h"
+
+namespace
+{
+
+/// Smallest number of vertices worth handing to another thread
+const size_t MIN_VERTICES_PER_TASK = 4096;
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+CpuSkinning::CpuSkinning() :
+	m_bonesPerVertex(0),
+	m_numBones(0)
+{
+}
+
+void CpuSkinning::setBindPose(const std::vector<Math::Vector3f>& positions,
+							  const std::vector<Math::Vector3f>& normals,
+							  size_t bonesPerVertex, const std::vector<unsigned int>& boneIds,
+							  const std::vector<float>& weights)
+{
+	SURGSIM_ASSERT(normals.empty() || normals.size() == positions.size())
+			<< "There are " << normals.size() << " normals for " << positions.size() << " positions.";
+	SURGSIM_ASSERT(boneIds.size() == bonesPerVertex * positions.size() && weights.size() == boneIds.size())
+			<< "There have to be " << bonesPerVertex << " bone ids and weights per vertex.";
+
+	m_bindPositions.resize(positions.size());
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		m_bindPositions[i] << positions[i], 1.0f;
+	}
+	m_bindNormals.resize(normals.size());
+	for (size_t i = 0; i < normals.size(); ++i)
+	{
+		m_bindNormals[i] << normals[i], 0.0f;
+	}
+	m_bonesPerVertex = bonesPerVertex;
+	m_boneIds = boneIds;
+	m_weights = weights;
+	m_numBones = boneIds.empty() ? 0 : *std::max_element(boneIds.begin(), boneIds.end()) + 1;
+	m_positions.resize(positions.size());
+	m_normals.resize(normals.size());
+}
+
+size_t CpuSkinning::getNumVertices() const
+{
+	return m_bindPositions.size();
+}
+
+size_t CpuSkinning::getBonesPerVertex() const
+{
+	return m_bonesPerVertex;
+}
+
+void CpuSkinning::update(const BonePalette::Palette& palette)
+{
+	SURGSIM_ASSERT(palette.size() >= m_numBones)
+			<< "The vertices refer to " << m_numBones << " bones, the palette only has " << palette.size() << ".";
+
+	size_t count = m_bindPositions.size();
+	size_t numTasks = std::min(count / MIN_VERTICES_PER_TASK,
+							   static_cast<size_t>(std::max(boost::thread::hardware_concurrency(), 1u)));
+	if (numTasks < 2)
+	{
+		skin(palette, 0, count);
+		return;
+	}
+
+	auto threadPool = Framework::Runtime::getThreadPool();
+	std::vector<std::future<void>> tasks;
+	size_t blockSize = (count + numTasks - 1) / numTasks;
+	for (size_t begin = blockSize; begin < count; begin += blockSize)
+	{
+		size_t end = std::min(begin + blockSize, count);
+		tasks.push_back(threadPool->enqueue<void>([this, &palette, begin, end]()
+		{
+			skin(palette, begin, end);
+		}));
+	}
+
+	// The calling thread handles the first block instead of waiting idle
+	skin(palette, 0, blockSize);
+
+	for (auto& task : tasks)
+	{
+		task.get();
+	}
+}
+
+const std::vector<Math::Vector3f>& CpuSkinning::getPositions() const
+{
+	return m_positions;
+}
+
+const std::vector<Math::Vector3f>& CpuSkinning::getNormals() const
+{
+	return m_normals;
+}
+
+void CpuSkinning::skin(const BonePalette::Palette& palette, size_t begin, size_t end)
+{
+	const bool hasNormals = !m_bindNormals.empty();
+	Math::Vector4f position;
+	Math::Vector4f normal;
+	for (size_t vertex = begin; vertex < end; ++vertex)
+	{
+		position.setZero();
+		normal.setZero();
+		const unsigned int* boneIds = m_boneIds.data() + m_bonesPerVertex * vertex;
+		const float* weights = m_weights.data() + m_bonesPerVertex * vertex;
+		for (size_t i = 0; i < m_bonesPerVertex; ++i)
+		{
+			const Math::Matrix44f& matrix = palette[boneIds[i]];
+			position += weights[i] * (matrix * m_bindPositions[vertex]);
+			if (hasNormals)
+			{
+				normal += weights[i] * (matrix * m_bindNormals[vertex]);
+			}
+		}
+		m_positions[vertex] = position.head<3>();
+		if (hasNormals)
+		{
+			m_normals[vertex] = normal.head<3>();
+		}
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
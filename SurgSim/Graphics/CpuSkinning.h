@@ -0,0 +1,115 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_CPUSKINNING_H
+#define SURGSIM_GRAPHICS_CPUSKINNING_H
+
+#include <Eigen/StdVector>
+#include <vector>
+
+#include "SurgSim/DataStructures/Vertices.h"
+#include "SurgSim/Graphics/BonePalette.h"
+#include "SurgSim/Math/Vector.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Skins vertices on the CPU with a bone palette, computing exactly what the hardware skinning shader computes: the
+/// weighted sum of the vertex transformed by each of its bones, and likewise for the normal with the rotation part
+/// of the matrices. Normals are not normalized again.
+/// It is meant for the meshes that have to follow a skeleton without a GPU, collision meshes for instance, and for
+/// checking the skinning in tests. The bind pose is kept as 4 component vectors so that each transformation is a
+/// single vectorized matrix product, and large meshes are spread over the Runtime thread pool.
+class CpuSkinning
+{
+public:
+	/// Constructor
+	CpuSkinning();
+
+	/// Set the vertices in the bind pose and the bones influencing them
+	/// \param positions The vertex positions in the bind pose
+	/// \param normals The vertex normals in the bind pose, empty if the normals are not needed
+	/// \param bonesPerVertex The number of bones influencing each vertex
+	/// \param boneIds The index of the bones in the palette, bonesPerVertex for each vertex
+	/// \param weights The weights of the bones, bonesPerVertex for each vertex, use 0 for unused influences
+	void setBindPose(const std::vector<Math::Vector3f>& positions, const std::vector<Math::Vector3f>& normals,
+					 size_t bonesPerVertex, const std::vector<unsigned int>& boneIds,
+					 const std::vector<float>& weights);
+
+	/// \return The number of vertices
+	size_t getNumVertices() const;
+
+	/// \return The number of bones influencing each vertex
+	size_t getBonesPerVertex() const;
+
+	/// Skin the vertices
+	/// \param palette The skinning matrices, indexed by the bone ids
+	void update(const BonePalette::Palette& palette);
+
+	/// \return The skinned positions, as of the last update
+	const std::vector<Math::Vector3f>& getPositions() const;
+
+	/// \return The skinned normals, as of the last update, empty if there are no normals in the bind pose
+	const std::vector<Math::Vector3f>& getNormals() const;
+
+	/// Copy the skinned positions into vertices, e.g. the vertices of a collision mesh, which then need to be
+	/// updated as after any other deformation
+	/// \tparam Data The type of data stored with the vertices
+	/// \param [in,out] vertices The vertices to move, there have to be as many as skinned vertices
+	template <class Data>
+	void copyPositions(DataStructures::Vertices<Data>* vertices) const;
+
+private:
+	/// Skin a range of vertices
+	/// \param palette The skinning matrices
+	/// \param begin, end The range of vertices
+	void skin(const BonePalette::Palette& palette, size_t begin, size_t end);
+
+	/// 4 component vectors with the alignment required for vectorization
+	typedef std::vector<Math::Vector4f, Eigen::aligned_allocator<Math::Vector4f>> Vectors4;
+
+	/// The positions in the bind pose, with w = 1
+	Vectors4 m_bindPositions;
+
+	/// The normals in the bind pose, with w = 0
+	Vectors4 m_bindNormals;
+
+	/// The number of bones influencing each vertex
+	size_t m_bonesPerVertex;
+
+	/// The bones influencing each vertex
+	std::vector<unsigned int> m_boneIds;
+
+	/// The weights of the bones influencing each vertex
+	std::vector<float> m_weights;
+
+	/// One more than the largest bone id
+	size_t m_numBones;
+
+	/// The skinned positions
+	std::vector<Math::Vector3f> m_positions;
+
+	/// The skinned normals
+	std::vector<Math::Vector3f> m_normals;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#include "SurgSim/Graphics/CpuSkinning-inl.h"
+
+#endif // SURGSIM_GRAPHICS_CPUSKINNING_H
@@ -27,8 +27,8 @@ namespace Graphics
 {
 
 /// This implements a graphical object to draw an interpolated curve, it accepts a series of control points, the
-/// number of segments in the curve will depend on the number of control points and the value returned from
-/// getSubdivisions().
+/// number of segments in the curve will depend on the number of control points, the curvature between them and the
+/// values returned from getSubdivisions() and getTolerance().
 /// This class also provides the ad-hoc "Vertices" property, this means it can receive a
 /// \sa DataStructures::VerticesPlain structure as a property via setValue()
 class CurveRepresentation : public virtual Representation
@@ -38,13 +38,21 @@ class CurveRepresentation : public virtual Representation
 	/// \param name the name of the representation
 	explicit CurveRepresentation(const std::string& name);
 
-	/// Sets the number of intermediate points the get generated between each two control points
-	/// \param num number of interpolated points
+	/// Sets the maximum number of intermediate points that get generated between each two control points
+	/// \param num maximum number of interpolated points
 	virtual void setSubdivisions(size_t num) = 0;
 
-	/// \return the number of interpolated points between control points
+	/// \return the maximum number of interpolated points between control points
 	virtual size_t getSubdivisions() const = 0;
 
+	/// Sets the largest distance allowed between the interpolated curve and the drawn lines, segments with less
+	/// curvature get fewer intermediate points, 0.0 always uses the maximum number of subdivisions. Default is 0.0.
+	/// \param tolerance the tolerance in the units of the control points
+	virtual void setTolerance(double tolerance) = 0;
+
+	/// \return the largest distance allowed between the interpolated curve and the drawn lines
+	virtual double getTolerance() const = 0;
+
 	/// Sets the tension (tau) parameter of the Catmull Rom interpolation, needs to be between 0.0 and 1.0
 	/// \param tension the tension
 	virtual void setTension(double tension) = 0;
@@ -0,0 +1,290 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/CurveTessellator.h"
+
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <cmath>
+#include <future>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/ThreadPool.h"
+#include "SurgSim/Math/Matrix.h"
+
+namespace
+{
+
+/// Minimum number of vertices written by one task, smaller updates are processed on the calling thread
+const size_t MIN_VERTICES_PER_TASK = 4096;
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+CurveTessellator::CurveTessellator() :
+	m_maxSubdivisions(100),
+	m_tension(0.4),
+	m_tolerance(0.0),
+	m_isParameterChanged(true),
+	m_changedBegin(0),
+	m_changedEnd(0)
+{
+}
+
+void CurveTessellator::setMaxSubdivisions(size_t subdivisions)
+{
+	SURGSIM_ASSERT(subdivisions > 0) << "The number of subdivisions has to be at least 1.";
+	m_isParameterChanged = m_isParameterChanged || subdivisions != m_maxSubdivisions;
+	m_maxSubdivisions = subdivisions;
+}
+
+size_t CurveTessellator::getMaxSubdivisions() const
+{
+	return m_maxSubdivisions;
+}
+
+void CurveTessellator::setTension(double tension)
+{
+	m_isParameterChanged = m_isParameterChanged || tension != m_tension;
+	m_tension = tension;
+}
+
+double CurveTessellator::getTension() const
+{
+	return m_tension;
+}
+
+void CurveTessellator::setTolerance(double tolerance)
+{
+	SURGSIM_ASSERT(tolerance >= 0.0) << "The tolerance cannot be negative.";
+	m_isParameterChanged = m_isParameterChanged || tolerance != m_tolerance;
+	m_tolerance = tolerance;
+}
+
+double CurveTessellator::getTolerance() const
+{
+	return m_tolerance;
+}
+
+bool CurveTessellator::update(const DataStructures::VerticesPlain& controlPoints)
+{
+	const size_t numPoints = controlPoints.getNumVertices();
+	SURGSIM_ASSERT(numPoints >= 2) << "Cannot apply CatmullRom with less than 2 points";
+	const size_t numSegments = numPoints - 1;
+
+	const bool isAllDirty = m_isParameterChanged || m_controlPoints.size() != numPoints + 2;
+	m_isParameterChanged = false;
+	m_controlPoints.resize(numPoints + 2);
+	m_subdivisions.resize(numSegments);
+	m_offsets.resize(numSegments + 1);
+	m_isSegmentDirty.assign(numSegments, isAllDirty ? 1 : 0);
+
+	// Segment i is interpolated from the control points [i, i + 3], ghost points included
+	auto setControlPoint = [this, numSegments](size_t index, const Math::Vector3d& point)
+	{
+		Math::Vector3d& current = m_controlPoints[index];
+		if (current != point)
+		{
+			current = point;
+			size_t first = (index < 3) ? 0 : index - 3;
+			size_t last = std::min(index, numSegments - 1);
+			std::fill(m_isSegmentDirty.begin() + first, m_isSegmentDirty.begin() + last + 1, 1);
+		}
+	};
+	setControlPoint(0, 2.0 * controlPoints.getVertexPosition(0) - controlPoints.getVertexPosition(1));
+	for (size_t i = 0; i < numPoints; ++i)
+	{
+		setControlPoint(i + 1, controlPoints.getVertexPosition(i));
+	}
+	setControlPoint(numPoints + 1, 2.0 * controlPoints.getVertexPosition(numPoints - 1) -
+					controlPoints.getVertexPosition(numPoints - 2));
+
+	// The number of subdivisions keeps the chord error, bounded by h^2 / 8 * max|p''| for a step h, under the
+	// tolerance. The second derivative is linear over a segment, so its largest norm is at one of the ends. Only the
+	// part normal to the segment bends the curve away from the strip, the rest moves the vertices along it.
+	Eigen::Matrix<double, 3, 4> coefficients;
+	for (size_t segment = 0; segment < numSegments; ++segment)
+	{
+		if (m_isSegmentDirty[segment] != 0)
+		{
+			size_t subdivisions = m_maxSubdivisions;
+			if (m_tolerance > 0.0)
+			{
+				computeCoefficients(segment, &coefficients);
+				Math::Vector3d chord = m_controlPoints[segment + 2] - m_controlPoints[segment + 1];
+				Math::Matrix33d normalProjection = Math::Matrix33d::Identity();
+				if (chord.squaredNorm() > 0.0)
+				{
+					normalProjection -= chord * chord.transpose() / chord.squaredNorm();
+				}
+				Math::Vector3d start = normalProjection * (2.0 * coefficients.col(2));
+				Math::Vector3d end = normalProjection * (2.0 * coefficients.col(2) + 6.0 * coefficients.col(3));
+				double maxCurvature = std::max(start.norm(), end.norm());
+				double minSubdivisions = std::ceil(std::sqrt(maxCurvature / (8.0 * m_tolerance)));
+				subdivisions = static_cast<size_t>(std::max(1.0, std::min(minSubdivisions,
+											   static_cast<double>(m_maxSubdivisions))));
+			}
+			m_subdivisions[segment] = subdivisions;
+		}
+	}
+
+	// Segments that did not move still have to be written again when earlier segments changed their size
+	size_t offset = 0;
+	m_dirtySegments.clear();
+	for (size_t segment = 0; segment < numSegments; ++segment)
+	{
+		if (isAllDirty || m_isSegmentDirty[segment] != 0 || m_offsets[segment] != offset)
+		{
+			m_offsets[segment] = offset;
+			m_dirtySegments.push_back(segment);
+		}
+		offset += m_subdivisions[segment];
+	}
+	m_offsets[numSegments] = offset;
+
+	if (m_dirtySegments.empty())
+	{
+		m_changedBegin = 0;
+		m_changedEnd = 0;
+		return false;
+	}
+
+	const size_t numVertices = offset + 1;
+	m_vertices.resize(numVertices);
+	m_directions.resize(numVertices);
+	m_vertices.back() = m_controlPoints[numPoints].cast<float>();
+	m_directions.back() = (m_controlPoints[numPoints + 1] - m_controlPoints[numPoints]).cast<float>();
+
+	m_changedBegin = m_offsets[m_dirtySegments.front()];
+	m_changedEnd = (m_dirtySegments.back() == numSegments - 1) ? numVertices :
+				   m_offsets[m_dirtySegments.back() + 1];
+
+	size_t numTasks = std::min((m_changedEnd - m_changedBegin) / MIN_VERTICES_PER_TASK,
+							   static_cast<size_t>(std::max(boost::thread::hardware_concurrency(), 1u)));
+	numTasks = std::min(numTasks, m_dirtySegments.size());
+	auto tessellateBlock = [this](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			tessellate(m_dirtySegments[i]);
+		}
+	};
+	if (numTasks < 2)
+	{
+		tessellateBlock(0, m_dirtySegments.size());
+	}
+	else
+	{
+		auto threadPool = Framework::Runtime::getThreadPool();
+		std::vector<std::future<void>> tasks;
+		size_t count = m_dirtySegments.size();
+		size_t blockSize = (count + numTasks - 1) / numTasks;
+		for (size_t begin = blockSize; begin < count; begin += blockSize)
+		{
+			size_t end = std::min(begin + blockSize, count);
+			tasks.push_back(threadPool->enqueue<void>([&tessellateBlock, begin, end]()
+			{
+				tessellateBlock(begin, end);
+			}));
+		}
+
+		// The calling thread handles the first block instead of waiting idle
+		tessellateBlock(0, blockSize);
+
+		for (auto& task : tasks)
+		{
+			task.get();
+		}
+	}
+
+	return true;
+}
+
+const std::vector<Math::Vector3f>& CurveTessellator::getVertices() const
+{
+	return m_vertices;
+}
+
+const std::vector<Math::Vector3f>& CurveTessellator::getDirections() const
+{
+	return m_directions;
+}
+
+size_t CurveTessellator::getChangedBegin() const
+{
+	return m_changedBegin;
+}
+
+size_t CurveTessellator::getChangedEnd() const
+{
+	return m_changedEnd;
+}
+
+size_t CurveTessellator::getNumSegments() const
+{
+	return m_subdivisions.size();
+}
+
+size_t CurveTessellator::getNumSubdivisions(size_t segment) const
+{
+	return m_subdivisions[segment];
+}
+
+void CurveTessellator::computeCoefficients(size_t segment, Eigen::Matrix<double, 3, 4>* coefficients) const
+{
+	const double tau = m_tension;
+	const Math::Vector3d& p0 = m_controlPoints[segment];
+	const Math::Vector3d& p1 = m_controlPoints[segment + 1];
+	const Math::Vector3d& p2 = m_controlPoints[segment + 2];
+	const Math::Vector3d& p3 = m_controlPoints[segment + 3];
+
+	coefficients->col(0) = p1;
+	coefficients->col(1) = tau * (p2 - p0);
+	coefficients->col(2) = 2.0 * tau * p0 + (tau - 3.0) * p1 + (3.0 - 2.0 * tau) * p2 - tau * p3;
+	coefficients->col(3) = -tau * p0 + (2.0 - tau) * p1 + (tau - 2.0) * p2 + tau * p3;
+}
+
+void CurveTessellator::tessellate(size_t segment)
+{
+	Eigen::Matrix<double, 3, 4> coefficients;
+	computeCoefficients(segment, &coefficients);
+
+	const size_t subdivisions = m_subdivisions[segment];
+	const double step = 1.0 / static_cast<double>(subdivisions);
+	Math::Vector3f* vertices = m_vertices.data() + m_offsets[segment];
+	Math::Vector3f* directions = m_directions.data() + m_offsets[segment];
+
+	Math::Vector3d previous = coefficients.col(0);
+	vertices[0] = previous.cast<float>();
+	for (size_t i = 1; i < subdivisions; ++i)
+	{
+		const double t = static_cast<double>(i) * step;
+		Math::Vector3d position = coefficients * Eigen::Vector4d(1.0, t, t * t, t * t * t);
+		vertices[i] = position.cast<float>();
+		directions[i - 1] = (position - previous).cast<float>();
+		previous = position;
+	}
+
+	// The segment ends on the first vertex of the next segment, i.e. its second control point
+	directions[subdivisions - 1] = (m_controlPoints[segment + 2] - previous).cast<float>();
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,139 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_CURVETESSELLATOR_H
+#define SURGSIM_GRAPHICS_CURVETESSELLATOR_H
+
+#include <vector>
+
+#include "SurgSim/DataStructures/Vertices.h"
+#include "SurgSim/Math/Vector.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Turns control points into the vertices of a line strip following the Catmull Rom spline through them.
+/// Every segment between two control points is subdivided just enough to keep the distance between the spline and
+/// the line strip under a tolerance, up to a maximum number of subdivisions. The vertices are kept between updates,
+/// only the segments whose control points moved are evaluated again, and large updates are spread over the
+/// Runtime thread pool.
+/// The first and last segments use ghost control points, the symmetric of the second control point from the first,
+/// and of the second to last from the last.
+class CurveTessellator
+{
+public:
+	/// Constructor
+	CurveTessellator();
+
+	/// \param subdivisions The maximum number of vertices generated for each segment, at least 1
+	void setMaxSubdivisions(size_t subdivisions);
+
+	/// \return The maximum number of vertices generated for each segment
+	size_t getMaxSubdivisions() const;
+
+	/// \param tension The tension (tau) of the Catmull Rom interpolation
+	void setTension(double tension);
+
+	/// \return The tension of the Catmull Rom interpolation
+	double getTension() const;
+
+	/// \param tolerance The largest allowed distance between the spline and the line strip, every segment uses the
+	/// 	maximum number of subdivisions when it is 0
+	void setTolerance(double tolerance);
+
+	/// \return The largest allowed distance between the spline and the line strip
+	double getTolerance() const;
+
+	/// Tessellate the spline through new control points
+	/// \param controlPoints The control points, at least 2
+	/// \return true if any vertex changed
+	bool update(const DataStructures::VerticesPlain& controlPoints);
+
+	/// \return The vertices of the line strip, the last one is the last control point
+	const std::vector<Math::Vector3f>& getVertices() const;
+
+	/// \return The vector from each vertex to the next one, the last vertex points to the last ghost control point
+	const std::vector<Math::Vector3f>& getDirections() const;
+
+	/// \return The first vertex that was changed by the last update
+	size_t getChangedBegin() const;
+
+	/// \return One past the last vertex that was changed by the last update
+	size_t getChangedEnd() const;
+
+	/// \return The number of segments, i.e. the number of control points minus one
+	size_t getNumSegments() const;
+
+	/// \param segment The index of a segment
+	/// \return The number of vertices generated for the segment
+	size_t getNumSubdivisions(size_t segment) const;
+
+private:
+	/// Compute the polynomial coefficients of a segment, its position at t is a + b t + c t^2 + d t^3
+	/// \param segment The index of the segment
+	/// \param [out] coefficients The coefficients a, b, c and d as columns
+	void computeCoefficients(size_t segment, Eigen::Matrix<double, 3, 4>* coefficients) const;
+
+	/// Evaluate the spline along a segment and write its vertices
+	/// \param segment The index of the segment
+	void tessellate(size_t segment);
+
+	/// Maximum number of vertices per segment
+	size_t m_maxSubdivisions;
+
+	/// Tension of the interpolation
+	double m_tension;
+
+	/// Maximum distance between the spline and the line strip
+	double m_tolerance;
+
+	/// Whether the parameters changed since the last update, i.e. all the segments need to be computed again
+	bool m_isParameterChanged;
+
+	/// The control points of the last update, including the ghost points at both ends
+	std::vector<Math::Vector3d> m_controlPoints;
+
+	/// Number of vertices of each segment
+	std::vector<size_t> m_subdivisions;
+
+	/// Index of the first vertex of each segment
+	std::vector<size_t> m_offsets;
+
+	/// Whether each segment needs to be written during the current update, not a vector<bool> so that
+	/// segments can be flagged from several threads
+	std::vector<unsigned char> m_isSegmentDirty;
+
+	/// The segments written during the current update
+	std::vector<size_t> m_dirtySegments;
+
+	/// Vertices of the line strip
+	std::vector<Math::Vector3f> m_vertices;
+
+	/// Vector from each vertex to the next
+	std::vector<Math::Vector3f> m_directions;
+
+	///@{
+	/// The range of vertices changed by the last update
+	size_t m_changedBegin;
+	size_t m_changedEnd;
+	///@}
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_CURVETESSELLATOR_H
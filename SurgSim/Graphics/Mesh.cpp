@@ -13,11 +13,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include "SurgSim/DataStructures/EmptyData.h"
 #include "SurgSim/DataStructures/PlyReader.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Graphics/Mesh.h"
 #include "SurgSim/Graphics/MeshPlyReaderDelegate.h"
+#include "SurgSim/Graphics/MeshSimplifier.h"
 
 using SurgSim::DataStructures::EmptyData;
 
@@ -34,18 +39,30 @@ namespace Graphics
 SURGSIM_REGISTER(SurgSim::Framework::Asset, SurgSim::Graphics::Mesh, Mesh);
 
 Mesh::Mesh() :
-	m_updateCount(1)
+	m_updateCount(1),
+	m_levelsOfDetailRevision(0),
+	m_numLevelsOfDetailOnLoad(1)
 {
 }
 
-Mesh::Mesh( const Mesh& other ) : BaseType(other)
+Mesh::Mesh( const Mesh& other ) : BaseType(other),
+	m_levelsOfDetailRevision(0),
+	m_numLevelsOfDetailOnLoad(other.m_numLevelsOfDetailOnLoad)
 {
-
+	copyLevelsOfDetail(other);
 }
 
-Mesh::Mesh( Mesh&& other ) : BaseType(std::move(other))
+Mesh::Mesh( Mesh&& other ) : BaseType(std::move(other)),
+	m_levelsOfDetailRevision(0),
+	m_numLevelsOfDetailOnLoad(other.m_numLevelsOfDetailOnLoad)
 {
-
+	// Moving the triangles does not change the revision of the other mesh
+	if (other.m_levelsOfDetailRevision == other.getTrianglesRevision())
+	{
+		m_levelsOfDetail = std::move(other.m_levelsOfDetail);
+	}
+	other.m_levelsOfDetail.clear();
+	m_levelsOfDetailRevision = getTrianglesRevision();
 }
 
 void Mesh::initialize(
@@ -123,6 +140,178 @@ bool Mesh::doLoad(const std::string& fileName)
 		return false;
 	}
 
+	if (m_numLevelsOfDetailOnLoad > 1)
+	{
+		buildLevelsOfDetail(m_numLevelsOfDetailOnLoad);
+	}
+	return true;
+}
+
+bool Mesh::doCopyData(const SurgSim::Framework::Asset& other)
+{
+	auto mesh = dynamic_cast<const Mesh*>(&other);
+	if (mesh == nullptr || (m_numLevelsOfDetailOnLoad > 1 && mesh->getNumLevelsOfDetail() != m_numLevelsOfDetailOnLoad))
+	{
+		return false;
+	}
+	shareData(*mesh);
+	copyLevelsOfDetail(*mesh);
+	return true;
+}
+
+bool Mesh::doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const
+{
+	std::vector<SurgSim::Math::Vector3d> positions;
+	std::vector<uint8_t> flags;
+	std::vector<SurgSim::Math::Vector4d> colors;
+	std::vector<SurgSim::Math::Vector2d> textures;
+	positions.reserve(getNumVertices());
+	flags.reserve(getNumVertices());
+	for (auto const& vertex : getVertices())
+	{
+		positions.push_back(vertex.position);
+		flags.push_back((vertex.data.color.hasValue() ? 1 : 0) | (vertex.data.texture.hasValue() ? 2 : 0));
+		if (vertex.data.color.hasValue())
+		{
+			colors.push_back(vertex.data.color.getValue());
+		}
+		if (vertex.data.texture.hasValue())
+		{
+			textures.push_back(vertex.data.texture.getValue());
+		}
+	}
+
+	std::vector<EdgeType::IdType> edges;
+	edges.reserve(getEdges().size());
+	for (auto const& edge : getEdges())
+	{
+		edges.push_back(edge.verticesId);
+	}
+
+	std::vector<TriangleType::IdType> triangles;
+	std::vector<uint8_t> validities;
+	triangles.reserve(getTriangles().size());
+	validities.reserve(getTriangles().size());
+	for (auto const& triangle : getTriangles())
+	{
+		triangles.push_back(triangle.verticesId);
+		validities.push_back(triangle.isValid ? 1 : 0);
+	}
+
+	writer->writeArray(positions);
+	writer->writeArray(flags);
+	writer->writeArray(colors);
+	writer->writeArray(textures);
+	writer->writeArray(edges);
+	writer->writeArray(triangles);
+	writer->writeArray(validities);
+	writer->write(static_cast<uint64_t>(getNumLevelsOfDetail() - 1));
+	for (size_t level = 1; level < getNumLevelsOfDetail(); ++level)
+	{
+		writer->writeArray(m_levelsOfDetail[level - 1]);
+	}
+	return true;
+}
+
+bool Mesh::doReadBinary(SurgSim::Framework::BinaryReader* reader)
+{
+	std::vector<SurgSim::Math::Vector3d> positions;
+	std::vector<uint8_t> flags;
+	std::vector<SurgSim::Math::Vector4d> colors;
+	std::vector<SurgSim::Math::Vector2d> textures;
+	std::vector<EdgeType::IdType> edges;
+	std::vector<TriangleType::IdType> triangles;
+	std::vector<uint8_t> validities;
+	uint64_t numLevels = 0;
+
+	reader->readArray(&positions);
+	reader->readArray(&flags);
+	reader->readArray(&colors);
+	reader->readArray(&textures);
+	reader->readArray(&edges);
+	reader->readArray(&triangles);
+	reader->readArray(&validities);
+	reader->read(&numLevels);
+	if (!reader->isValid() || flags.size() != positions.size() || validities.size() != triangles.size() ||
+		(m_numLevelsOfDetailOnLoad > 1 && numLevels + 1 != m_numLevelsOfDetailOnLoad))
+	{
+		return false;
+	}
+
+	std::vector<std::vector<unsigned int>> levels;
+	for (uint64_t level = 0; level < numLevels; ++level)
+	{
+		levels.emplace_back();
+		if (!reader->readArray(&levels.back()) || levels.back().size() % 3 != 0)
+		{
+			return false;
+		}
+	}
+
+	const size_t numColors = std::count_if(flags.begin(), flags.end(), [](uint8_t flag) {return (flag & 1) != 0;});
+	const size_t numTextures = std::count_if(flags.begin(), flags.end(), [](uint8_t flag) {return (flag & 2) != 0;});
+	if (numColors != colors.size() || numTextures != textures.size())
+	{
+		return false;
+	}
+	auto isOutOfRange = [&positions](size_t id) {return id >= positions.size();};
+	for (auto const& edge : edges)
+	{
+		if (std::any_of(edge.begin(), edge.end(), isOutOfRange))
+		{
+			return false;
+		}
+	}
+	for (auto const& triangle : triangles)
+	{
+		if (std::any_of(triangle.begin(), triangle.end(), isOutOfRange))
+		{
+			return false;
+		}
+	}
+	for (auto const& level : levels)
+	{
+		if (std::any_of(level.begin(), level.end(), isOutOfRange))
+		{
+			return false;
+		}
+	}
+
+	clear();
+	auto color = colors.cbegin();
+	auto texture = textures.cbegin();
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		VertexData data;
+		if ((flags[i] & 1) != 0)
+		{
+			data.color.setValue(*color++);
+		}
+		if ((flags[i] & 2) != 0)
+		{
+			data.texture.setValue(*texture++);
+		}
+		addVertex(VertexType(positions[i], data));
+	}
+	for (auto const& edge : edges)
+	{
+		addEdge(EdgeType(edge));
+	}
+	for (auto const& triangle : triangles)
+	{
+		addTriangle(TriangleType(triangle));
+	}
+	// Removed triangles are added first to keep the ids of the following ones, then removed again
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		if (validities[i] == 0)
+		{
+			removeTriangle(i);
+		}
+	}
+
+	m_levelsOfDetail = std::move(levels);
+	m_levelsOfDetailRevision = getTrianglesRevision();
 	return true;
 }
 
@@ -136,17 +325,112 @@ size_t Mesh::getUpdateCount() const
 	return m_updateCount;
 }
 
+void Mesh::buildLevelsOfDetail(size_t numLevels, double ratio)
+{
+	SURGSIM_ASSERT(numLevels > 0) << "There has to be at least one level of detail.";
+	SURGSIM_ASSERT(ratio > 0.0 && ratio < 1.0) << "The ratio between levels of detail has to be in (0, 1).";
+
+	// Only read the mesh through const access, so that vertices and triangles shared with other meshes are not copied
+	const Mesh& mesh = *this;
+	std::vector<SurgSim::Math::Vector3d> positions;
+	positions.reserve(getNumVertices());
+	for (const auto& vertex : mesh.getVertices())
+	{
+		positions.push_back(vertex.position);
+	}
+
+	std::vector<unsigned int> triangles;
+	triangles.reserve(3 * getNumTriangles());
+	for (const auto& triangle : mesh.getTriangles())
+	{
+		if (triangle.isValid)
+		{
+			for (size_t id : triangle.verticesId)
+			{
+				triangles.push_back(static_cast<unsigned int>(id));
+			}
+		}
+	}
+
+	m_levelsOfDetail.resize(numLevels - 1);
+	m_levelsOfDetailRevision = getTrianglesRevision();
+	if (numLevels > 1)
+	{
+		MeshSimplifier simplifier(positions, triangles);
+		double numTriangles = static_cast<double>(triangles.size() / 3);
+		for (auto& level : m_levelsOfDetail)
+		{
+			numTriangles *= ratio;
+			simplifier.simplify(static_cast<size_t>(numTriangles), &level);
+		}
+	}
+}
+
+size_t Mesh::getNumLevelsOfDetail() const
+{
+	return (m_levelsOfDetailRevision == getTrianglesRevision()) ? m_levelsOfDetail.size() + 1 : 1;
+}
+
+void Mesh::setNumLevelsOfDetailOnLoad(size_t numLevels)
+{
+	SURGSIM_ASSERT(numLevels > 0) << "There has to be at least one level of detail.";
+	m_numLevelsOfDetailOnLoad = numLevels;
+}
+
+size_t Mesh::getNumLevelsOfDetailOnLoad() const
+{
+	return m_numLevelsOfDetailOnLoad;
+}
+
+const std::vector<unsigned int>& Mesh::getLevelOfDetail(size_t level) const
+{
+	SURGSIM_ASSERT(level > 0 && level < getNumLevelsOfDetail())
+			<< "Level of detail " << level << " does not exist, the mesh has " << getNumLevelsOfDetail() << " levels.";
+	return m_levelsOfDetail[level - 1];
+}
+
 Mesh& Mesh::operator=( const Mesh& other )
 {
+	if (this == &other)
+	{
+		return *this;
+	}
 	BaseType::operator=(other);
+	copyLevelsOfDetail(other);
+	m_numLevelsOfDetailOnLoad = other.m_numLevelsOfDetailOnLoad;
 	return *this;
 }
 
 Mesh& Mesh::operator=( Mesh&& other )
 {
+	const bool isOtherUpToDate = (other.m_levelsOfDetailRevision == other.getTrianglesRevision());
 	BaseType::operator=(std::move(other));
+	if (isOtherUpToDate)
+	{
+		m_levelsOfDetail = std::move(other.m_levelsOfDetail);
+	}
+	else
+	{
+		m_levelsOfDetail.clear();
+	}
+	other.m_levelsOfDetail.clear();
+	m_levelsOfDetailRevision = getTrianglesRevision();
+	m_numLevelsOfDetailOnLoad = other.m_numLevelsOfDetailOnLoad;
 	return *this;
 }
 
+void Mesh::copyLevelsOfDetail(const Mesh& other)
+{
+	if (other.m_levelsOfDetailRevision == other.getTrianglesRevision())
+	{
+		m_levelsOfDetail = other.m_levelsOfDetail;
+	}
+	else
+	{
+		m_levelsOfDetail.clear();
+	}
+	m_levelsOfDetailRevision = getTrianglesRevision();
+}
+
 }; // Graphics
 }; // SurgSim
@@ -108,12 +108,60 @@ class Mesh : public SurgSim::DataStructures::TriangleMesh<VertexData, SurgSim::D
 	/// Return the update count, please note that it will silently roll over when the range of size_t has been exceeded
 	size_t getUpdateCount() const;
 
+	/// Build simplified versions of the triangles for drawing the mesh with less detail, see MeshSimplifier. The
+	/// simplified triangles use the vertices of the mesh, they stay valid when vertices move but not when triangles
+	/// are added or removed. The levels are kept in the mesh, so that the representations sharing the mesh share them,
+	/// and are copied with it.
+	/// \param numLevels The number of levels including the full mesh as level 0
+	/// \param ratio The number of triangles of each level relative to the previous level
+	void buildLevelsOfDetail(size_t numLevels, double ratio = 0.25);
+
+	/// \return The number of levels of detail including the full mesh, 1 if the levels were not built or the
+	/// 	triangles may have changed since, see getTrianglesRevision()
+	size_t getNumLevelsOfDetail() const;
+
+	/// \param level The level of detail, at least 1 and less than getNumLevelsOfDetail()
+	/// \return The vertex ids of the triangles of the level, three per triangle
+	const std::vector<unsigned int>& getLevelOfDetail(size_t level) const;
+
+	/// Sets the number of levels of detail that load() builds, see buildLevelsOfDetail(). The levels are built by
+	/// the thread loading the mesh, and are stored with the mesh in the AssetCache and in the binary cache file, so
+	/// that loading the file again does not build them again. Default is 1, i.e. no simplified levels.
+	/// \param numLevels The number of levels including the full mesh
+	void setNumLevelsOfDetailOnLoad(size_t numLevels);
+
+	/// \return The number of levels of detail that load() builds
+	size_t getNumLevelsOfDetailOnLoad() const;
 
 protected:
 	bool doLoad(const std::string& fileName) override;
 
+	/// Shares the vertices and triangles of another mesh, the levels of detail are copied. Fails when the other mesh
+	/// does not have the number of levels that load() needs to build.
+	bool doCopyData(const SurgSim::Framework::Asset& other) override;
+
+	bool doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const override;
+
+	/// Fails when the file does not have the number of levels that load() needs to build.
+	bool doReadBinary(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// For checking whether the mesh has changed
 	size_t m_updateCount;
+
+	/// The triangles of each level of detail after the full mesh
+	std::vector<std::vector<unsigned int>> m_levelsOfDetail;
+
+	/// The revision of the triangles the levels of detail were built for
+	size_t m_levelsOfDetailRevision;
+
+	/// The number of levels of detail that load() builds
+	size_t m_numLevelsOfDetailOnLoad;
+
+private:
+	/// Copies the levels of detail of another mesh whose triangles were just copied or shared, unless they are out of
+	/// date in the other mesh.
+	/// \param other The mesh the triangles came from
+	void copyLevelsOfDetail(const Mesh& other);
 };
 
 
@@ -54,6 +54,10 @@ class MeshRepresentation : public virtual Representation
 										  setMesh);
 		SURGSIM_ADD_SERIALIZABLE_PROPERTY(MeshRepresentation, int, UpdateOptions, getUpdateOptions, setUpdateOptions);
 		SURGSIM_ADD_SETTER(MeshRepresentation, std::string, MeshFileName, loadMesh);
+		SURGSIM_ADD_SERIALIZABLE_PROPERTY(MeshRepresentation, size_t, LevelsOfDetail, getLevelsOfDetail,
+										  setLevelsOfDetail);
+		SURGSIM_ADD_SERIALIZABLE_PROPERTY(MeshRepresentation, double, LevelOfDetailPixelSize,
+										  getLevelOfDetailPixelSize, setLevelOfDetailPixelSize);
 	}
 
 	/// Destructor
@@ -86,7 +90,37 @@ class MeshRepresentation : public virtual Representation
 	/// \return	The update options.
 	virtual int getUpdateOptions() const = 0;
 
+	/// Sets the number of levels of detail used to draw the mesh, the simplified levels are built with
+	/// Mesh::buildLevelsOfDetail(), each keeps a quarter of the triangles of the previous level. A mesh loaded from a
+	/// file gets its levels while loading, see Mesh::setNumLevelsOfDetailOnLoad(), setting the levels before wake up
+	/// loads the file again to get them. Other meshes get their levels when this is called before wake up, or on the
+	/// graphics thread when the triangles change. Default is 1, i.e. the full mesh is always drawn.
+	/// \param numLevels The number of levels including the full mesh
+	virtual void setLevelsOfDetail(size_t numLevels) = 0;
+
+	/// \return The number of levels of detail including the full mesh
+	virtual size_t getLevelsOfDetail() const = 0;
+
+	/// Sets the size of the mesh on the screen below which the first simplified level is drawn, every following
+	/// level is drawn once the size halves again
+	/// \param pixelSize The size of the bounding sphere on the screen, in pixels
+	virtual void setLevelOfDetailPixelSize(double pixelSize) = 0;
+
+	/// \return The size of the mesh on the screen below which the first simplified level is drawn
+	virtual double getLevelOfDetailPixelSize() const = 0;
+
 	virtual void updateMesh(const Mesh& mesh) = 0;
+
+	/// Direct path for vertex positions that change every frame, e.g. the nodes of a physics simulation. The
+	/// positions are written in single precision straight into a vertex buffer of the renderer, instead of going
+	/// through the Mesh. Vertices that are not written keep the position they had in the mesh at the first call.
+	/// \note Only one thread may write vertex positions, the Mesh of the representation is not updated.
+	/// \param numVertices The number of vertices, needs to match the number of vertices of the mesh
+	/// \return Buffer for 3 * numVertices floats (x, y and z of each vertex), valid until publishVertexPositions()
+	virtual float* getVertexPositionBuffer(size_t numVertices) = 0;
+
+	/// Hand the positions written into the buffer from getVertexPositionBuffer() over to the renderer
+	virtual void publishVertexPositions() = 0;
 };
 
 }; // Graphics
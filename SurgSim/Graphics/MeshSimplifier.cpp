@@ -0,0 +1,304 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/MeshSimplifier.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace
+{
+
+/// Weight of the quadrics that keep the borders in place, relative to the quadrics of the triangles
+const double BORDER_WEIGHT = 1000.0;
+
+/// Smallest ratio between the area of a triangle and the square of its longest edge that is not degenerate
+const double MIN_TRIANGLE_SHAPE = 1e-8;
+
+/// \return A key identifying the undirected edge between two vertices
+uint64_t getEdgeKey(unsigned int v0, unsigned int v1)
+{
+	return (static_cast<uint64_t>(std::min(v0, v1)) << 32) | static_cast<uint64_t>(std::max(v0, v1));
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+MeshSimplifier::MeshSimplifier(const std::vector<Math::Vector3d>& positions,
+							   const std::vector<unsigned int>& triangles) :
+	m_positions(positions),
+	m_triangles(triangles),
+	m_isTriangleRemoved(triangles.size() / 3, false),
+	m_vertexTriangles(positions.size()),
+	m_quadrics(positions.size(), Quadric::Zero()),
+	m_versions(positions.size(), 0),
+	m_isVertexRemoved(positions.size(), false),
+	m_numTriangles(triangles.size() / 3)
+{
+	SURGSIM_ASSERT(triangles.size() % 3 == 0) << "The number of triangle vertex ids has to be a multiple of 3.";
+
+	std::unordered_map<uint64_t, unsigned int> edgeTriangles;
+	for (unsigned int triangle = 0; triangle < m_numTriangles; ++triangle)
+	{
+		const unsigned int* ids = &m_triangles[3 * triangle];
+		for (int i = 0; i < 3; ++i)
+		{
+			SURGSIM_ASSERT(ids[i] < positions.size()) << "Triangle " << triangle << " refers to vertex " << ids[i]
+					<< ", but there are only " << positions.size() << " vertices.";
+			m_vertexTriangles[ids[i]].push_back(triangle);
+			++edgeTriangles[getEdgeKey(ids[i], ids[(i + 1) % 3])];
+		}
+
+		// The distance to the plane of the triangle, weighted by its area
+		Math::Vector3d normal = (m_positions[ids[1]] - m_positions[ids[0]]).cross(m_positions[ids[2]] -
+								m_positions[ids[0]]);
+		double area = 0.5 * normal.norm();
+		if (area > 0.0)
+		{
+			Eigen::Vector4d plane;
+			plane << normal / (2.0 * area), -normal.dot(m_positions[ids[0]]) / (2.0 * area);
+			Quadric quadric = area * plane * plane.transpose();
+			for (int i = 0; i < 3; ++i)
+			{
+				m_quadrics[ids[i]] += quadric;
+			}
+		}
+	}
+
+	// Edges that belong to a single triangle are on a border, the distance to the plane through the edge that is
+	// orthogonal to the triangle keeps them in place
+	for (unsigned int triangle = 0; triangle < m_numTriangles; ++triangle)
+	{
+		const unsigned int* ids = &m_triangles[3 * triangle];
+		Math::Vector3d normal = (m_positions[ids[1]] - m_positions[ids[0]]).cross(m_positions[ids[2]] -
+								m_positions[ids[0]]);
+		for (int i = 0; i < 3; ++i)
+		{
+			unsigned int v0 = ids[i];
+			unsigned int v1 = ids[(i + 1) % 3];
+			if (edgeTriangles[getEdgeKey(v0, v1)] == 1)
+			{
+				Math::Vector3d edge = m_positions[v1] - m_positions[v0];
+				Math::Vector3d borderNormal = edge.cross(normal);
+				if (borderNormal.squaredNorm() > 0.0)
+				{
+					borderNormal.normalize();
+					Eigen::Vector4d plane;
+					plane << borderNormal, -borderNormal.dot(m_positions[v0]);
+					Quadric quadric = BORDER_WEIGHT * edge.squaredNorm() * plane * plane.transpose();
+					m_quadrics[v0] += quadric;
+					m_quadrics[v1] += quadric;
+				}
+			}
+		}
+	}
+
+	for (auto it = edgeTriangles.cbegin(); it != edgeTriangles.cend(); ++it)
+	{
+		pushEdge(static_cast<unsigned int>(it->first >> 32), static_cast<unsigned int>(it->first & 0xffffffff));
+	}
+}
+
+void MeshSimplifier::simplify(size_t numTriangles, std::vector<unsigned int>* triangles)
+{
+	while (m_numTriangles > numTriangles && !m_queue.empty())
+	{
+		Collapse candidate = m_queue.top();
+		m_queue.pop();
+		if (m_isVertexRemoved[candidate.from] || m_isVertexRemoved[candidate.to] ||
+			m_versions[candidate.from] != candidate.fromVersion || m_versions[candidate.to] != candidate.toVersion)
+		{
+			continue;
+		}
+		if (isCollapseValid(candidate.from, candidate.to))
+		{
+			collapse(candidate.from, candidate.to);
+		}
+	}
+
+	triangles->clear();
+	triangles->reserve(3 * m_numTriangles);
+	for (size_t triangle = 0; triangle < m_isTriangleRemoved.size(); ++triangle)
+	{
+		if (!m_isTriangleRemoved[triangle])
+		{
+			triangles->insert(triangles->end(), m_triangles.begin() + 3 * triangle,
+							  m_triangles.begin() + 3 * (triangle + 1));
+		}
+	}
+}
+
+size_t MeshSimplifier::getNumTriangles() const
+{
+	return m_numTriangles;
+}
+
+void MeshSimplifier::pushEdge(unsigned int v0, unsigned int v1)
+{
+	Quadric quadric = m_quadrics[v0] + m_quadrics[v1];
+	Collapse candidate;
+	candidate.fromVersion = m_versions[v0];
+	candidate.toVersion = m_versions[v1];
+
+	// Both directions are queued, the cheaper one can still be rejected because it flips a triangle
+	Eigen::Vector4d position;
+	position << m_positions[v1], 1.0;
+	candidate.cost = position.dot(quadric * position);
+	candidate.from = v0;
+	candidate.to = v1;
+	m_queue.push(candidate);
+
+	position << m_positions[v0], 1.0;
+	candidate.cost = position.dot(quadric * position);
+	candidate.from = v1;
+	candidate.to = v0;
+	std::swap(candidate.fromVersion, candidate.toVersion);
+	m_queue.push(candidate);
+}
+
+bool MeshSimplifier::isCollapseValid(unsigned int from, unsigned int to) const
+{
+	// Link condition, the only vertices connected to both have to be the third vertices of the triangles that are
+	// removed with the edge, otherwise the surface would not stay a manifold
+	std::vector<unsigned int> wings;
+	std::vector<unsigned int> fromNeighbors;
+	for (unsigned int triangle : m_vertexTriangles[from])
+	{
+		if (m_isTriangleRemoved[triangle])
+		{
+			continue;
+		}
+		const unsigned int* ids = &m_triangles[3 * triangle];
+		bool isShared = (ids[0] == to || ids[1] == to || ids[2] == to);
+		for (int i = 0; i < 3; ++i)
+		{
+			if (ids[i] != from && ids[i] != to)
+			{
+				fromNeighbors.push_back(ids[i]);
+				if (isShared)
+				{
+					wings.push_back(ids[i]);
+				}
+			}
+		}
+		if (isShared)
+		{
+			continue;
+		}
+
+		// The triangle must not flip or degenerate into a sliver once 'from' is moved onto 'to'
+		Math::Vector3d corners[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			corners[i] = m_positions[ids[i]];
+		}
+		Math::Vector3d before = (corners[1] - corners[0]).cross(corners[2] - corners[0]);
+		for (int i = 0; i < 3; ++i)
+		{
+			if (ids[i] == from)
+			{
+				corners[i] = m_positions[to];
+			}
+		}
+		Math::Vector3d after = (corners[1] - corners[0]).cross(corners[2] - corners[0]);
+		double longestEdge = std::max((corners[1] - corners[0]).squaredNorm(),
+									  std::max((corners[2] - corners[1]).squaredNorm(),
+											   (corners[0] - corners[2]).squaredNorm()));
+		if (before.dot(after) <= 0.0 || after.norm() <= MIN_TRIANGLE_SHAPE * longestEdge)
+		{
+			return false;
+		}
+	}
+	if (wings.empty())
+	{
+		return false;
+	}
+
+	std::sort(wings.begin(), wings.end());
+	std::sort(fromNeighbors.begin(), fromNeighbors.end());
+	fromNeighbors.erase(std::unique(fromNeighbors.begin(), fromNeighbors.end()), fromNeighbors.end());
+	for (unsigned int triangle : m_vertexTriangles[to])
+	{
+		if (m_isTriangleRemoved[triangle])
+		{
+			continue;
+		}
+		const unsigned int* ids = &m_triangles[3 * triangle];
+		for (int i = 0; i < 3; ++i)
+		{
+			if (ids[i] != to && ids[i] != from &&
+				std::binary_search(fromNeighbors.begin(), fromNeighbors.end(), ids[i]) &&
+				!std::binary_search(wings.begin(), wings.end(), ids[i]))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void MeshSimplifier::collapse(unsigned int from, unsigned int to)
+{
+	std::vector<unsigned int>& toTriangles = m_vertexTriangles[to];
+	for (unsigned int triangle : m_vertexTriangles[from])
+	{
+		if (m_isTriangleRemoved[triangle])
+		{
+			continue;
+		}
+		unsigned int* ids = &m_triangles[3 * triangle];
+		if (ids[0] == to || ids[1] == to || ids[2] == to)
+		{
+			m_isTriangleRemoved[triangle] = true;
+			--m_numTriangles;
+		}
+		else
+		{
+			std::replace(ids, ids + 3, from, to);
+			toTriangles.push_back(triangle);
+		}
+	}
+	m_vertexTriangles[from].clear();
+	toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+									 [this](unsigned int triangle) { return m_isTriangleRemoved[triangle]; }),
+					  toTriangles.end());
+
+	m_isVertexRemoved[from] = true;
+	m_quadrics[to] += m_quadrics[from];
+	++m_versions[from];
+	++m_versions[to];
+
+	for (unsigned int triangle : toTriangles)
+	{
+		const unsigned int* ids = &m_triangles[3 * triangle];
+		for (int i = 0; i < 3; ++i)
+		{
+			if (ids[i] != to)
+			{
+				pushEdge(to, ids[i]);
+			}
+		}
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
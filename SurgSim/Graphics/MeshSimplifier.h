@@ -0,0 +1,120 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_MESHSIMPLIFIER_H
+#define SURGSIM_GRAPHICS_MESHSIMPLIFIER_H
+
+#include <Eigen/Core>
+#include <queue>
+#include <vector>
+
+#include "SurgSim/Math/Vector.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Reduces the number of triangles of a mesh by collapsing edges in the order of their quadric error
+/// (Garland and Heckbert, Surface Simplification Using Quadric Error Metrics, 1997).
+/// An edge is always collapsed onto one of its vertices, so the simplified triangles only refer to vertices of the
+/// original mesh, and the vertex arrays with all their attributes can be shared between the original mesh and its
+/// simplified versions. Open borders, including the seams where vertices are split for different texture
+/// coordinates, are preserved by additional quadrics orthogonal to the border. Collapses that would flip a triangle
+/// are rejected.
+/// The simplification is progressive, each call to simplify() continues from the result of the previous one.
+class MeshSimplifier
+{
+public:
+	/// Constructor
+	/// \param positions The vertex positions
+	/// \param triangles The vertex ids of the triangles, three per triangle
+	MeshSimplifier(const std::vector<Math::Vector3d>& positions, const std::vector<unsigned int>& triangles);
+
+	/// Collapse edges until the mesh has at most the given number of triangles, or no edge can be collapsed
+	/// \param numTriangles The number of triangles to reach
+	/// \param [out] triangles The vertex ids of the remaining triangles, three per triangle
+	void simplify(size_t numTriangles, std::vector<unsigned int>* triangles);
+
+	/// \return The number of triangles remaining
+	size_t getNumTriangles() const;
+
+private:
+	/// A candidate collapse of the vertex 'from' onto the vertex 'to'
+	struct Collapse
+	{
+		double cost;
+		unsigned int from;
+		unsigned int to;
+		/// The versions of the vertices when the cost was computed, the entry is outdated if any changed since
+		size_t fromVersion;
+		size_t toVersion;
+
+		bool operator<(const Collapse& other) const
+		{
+			// Highest priority for the lowest cost
+			return cost > other.cost;
+		}
+	};
+
+	/// Queue the collapses of an edge in both directions
+	/// \param v0, v1 The vertices of the edge
+	void pushEdge(unsigned int v0, unsigned int v1);
+
+	/// \param from The vertex that would be removed
+	/// \param to The vertex it would be moved onto
+	/// \return true if moving the vertex does not flip or degenerate any of the triangles that remain
+	bool isCollapseValid(unsigned int from, unsigned int to) const;
+
+	/// Collapse a vertex onto another, removing the triangles that contain both
+	/// \param from The vertex that is removed
+	/// \param to The vertex it is moved onto
+	void collapse(unsigned int from, unsigned int to);
+
+	/// The vertex positions
+	std::vector<Math::Vector3d> m_positions;
+
+	/// The vertex ids of all the triangles, triangles that were removed are kept
+	std::vector<unsigned int> m_triangles;
+
+	/// Whether each triangle has been removed
+	std::vector<bool> m_isTriangleRemoved;
+
+	/// The ids of the triangles around each vertex, including removed ones
+	std::vector<std::vector<unsigned int>> m_vertexTriangles;
+
+	/// The error quadric of a vertex, unaligned so that it can be stored in a std::vector
+	typedef Eigen::Matrix<double, 4, 4, Eigen::DontAlign> Quadric;
+
+	/// The error quadric of each vertex
+	std::vector<Quadric> m_quadrics;
+
+	/// Incremented every time the neighborhood of a vertex changes
+	std::vector<size_t> m_versions;
+
+	/// Whether each vertex has been collapsed onto another one
+	std::vector<bool> m_isVertexRemoved;
+
+	/// The candidate collapses, outdated entries are skipped when they come up
+	std::priority_queue<Collapse> m_queue;
+
+	/// The number of triangles remaining
+	size_t m_numTriangles;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_MESHSIMPLIFIER_H
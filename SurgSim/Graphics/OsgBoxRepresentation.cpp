@@ -100,5 +100,15 @@ std::shared_ptr<OsgUnitBox> OsgBoxRepresentation::getSharedUnitBox()
 	return shared.get();
 }
 
+InstanceShape OsgBoxRepresentation::getInstanceShape() const
+{
+	return INSTANCE_SHAPE_BOX;
+}
+
+osg::Vec4f OsgBoxRepresentation::getInstanceScale() const
+{
+	return osg::Vec4f(osg::Vec3f(m_scale), 0.0f);
+}
+
 }; // Graphics
 }; // SurgSim
\ No newline at end of file
@@ -92,6 +92,10 @@ class OsgBoxRepresentation : public OsgRepresentation, public BoxRepresentation
 	/// \return Size of the box
 	SurgSim::Math::Vector3d getSize() const override;
 
+	InstanceShape getInstanceShape() const override;
+
+	osg::Vec4f getInstanceScale() const override;
+
 private:
 	/// The OSG box shape is a unit box and this transform scales it to the size set.
 	osg::Vec3d m_scale;
@@ -118,5 +118,16 @@ std::shared_ptr<OsgUnitSphere> OsgCapsuleRepresentation::getSharedUnitSphere()
 	return sharedSphere.get();
 }
 
+InstanceShape OsgCapsuleRepresentation::getInstanceShape() const
+{
+	return INSTANCE_SHAPE_CAPSULE;
+}
+
+osg::Vec4f OsgCapsuleRepresentation::getInstanceScale() const
+{
+	float radius = static_cast<float>(m_scale.x());
+	return osg::Vec4f(radius, radius, radius, static_cast<float>(m_scale.y() / 2.0));
+}
+
 }; // Graphics
 }; // SurgSim
\ No newline at end of file
@@ -80,6 +80,10 @@ class OsgCapsuleRepresentation : public OsgRepresentation, public CapsuleReprese
 	/// \return Size of the capsule
 	SurgSim::Math::Vector2d getSize() const override;
 
+	InstanceShape getInstanceShape() const override;
+
+	osg::Vec4f getInstanceScale() const override;
+
 private:
 	/// The OSG Capsule shape consist of one unit cylinder and two unit spheres
 	/// This transform scales it to the size set.
@@ -15,8 +15,6 @@
 
 #include "SurgSim/Graphics/OsgCurveRepresentation.h"
 
-#include <array>
-
 #include <osg/Array>
 #include <osg/Geode>
 #include <osg/Geometry>
@@ -27,69 +25,6 @@
 #include "SurgSim/DataStructures/Vertices.h"
 #include "SurgSim/Graphics/OsgConversions.h"
 
-namespace
-{
-
-void retrievePoints(
-	const SurgSim::DataStructures::VerticesPlain& points,
-	std::vector<SurgSim::Math::Vector3d>* result)
-{
-	SURGSIM_ASSERT(points.getNumVertices() >= 2) << "Cannot apply CatmullRom with less than 2 points";
-	result->clear();
-	result->reserve(points.getNumVertices() + 2);
-
-	// Interpolate the 1st point (ghost) as the symmetric of P1 from P0: P-1 = P0 + P1P0
-	result->push_back(2.0 * points.getVertexPosition(0) - points.getVertexPosition(1));
-	for (size_t i = 0; i < points.getNumVertices(); ++i)
-	{
-		result->push_back(points.getVertexPosition(i));
-	}
-	// Interpolate the last point (ghost) as the symmetric of Pn-1 from Pn: Pn+1 = Pn + Pn-1Pn
-	result->push_back(2.0 * points.getVertexPosition(points.getNumVertices() - 1) -
-					  points.getVertexPosition(points.getNumVertices() - 2));
-
-}
-
-void computePoints(int subdivisions,
-				   const std::vector<SurgSim::Math::Vector3d>& controlPoints,
-				   std::vector<SurgSim::Math::Vector3d>* points,
-				   double tau = 0.4)
-{
-	size_t numPoints = controlPoints.size();
-	double stepsize = 1.0 / static_cast<double>(subdivisions);
-	size_t pointIndex = 0;
-	while (pointIndex < numPoints - 3)
-	{
-		std::array<SurgSim::Math::Vector3d, 4> p =
-		{
-			controlPoints[pointIndex] ,
-			controlPoints[pointIndex + 1],
-			controlPoints[pointIndex + 2],
-			controlPoints[pointIndex + 3]
-		};
-
-		double abscissa = 0.0;
-		while (abscissa < 1.0)
-		{
-			double abcissaSquared = abscissa * abscissa;
-			double abcissaCubed = abcissaSquared * abscissa;
-
-			SurgSim::Math::Vector3d result =
-				p[1] +
-				abscissa * (tau * (p[2] - p[0])) +
-				abcissaSquared * (2.0 * tau * p[0] + (tau - 3.0) * p[1] + (3.0 - 2.0 * tau) * p[2] - tau * p[3]) +
-				abcissaCubed * (-tau * p[0] + (2.0 - tau) * p[1] + (tau - 2.0) * p[2] + tau * p[3]);
-
-			points->push_back(std::move(result));
-
-			abscissa += stepsize;
-		}
-		++pointIndex;
-	}
-}
-
-}
-
 namespace SurgSim
 {
 
@@ -100,8 +35,7 @@ OsgCurveRepresentation::OsgCurveRepresentation(const std::string& name) :
 	Representation(name),
 	OsgRepresentation(name),
 	CurveRepresentation(name),
-	m_subdivision(100),
-	m_tension(0.4)
+	m_isParameterChanged(false)
 {
 	osg::Geode* geode = new osg::Geode();
 	m_geometry = new osg::Geometry();
@@ -144,47 +78,57 @@ bool OsgCurveRepresentation::doWakeUp()
 
 void OsgCurveRepresentation::doUpdate(double dt)
 {
-	DataStructures::VerticesPlain controlPoints;
-	if (m_locker.tryTakeChanged(&controlPoints))
+	bool isChanged = m_locker.tryTakeChanged(&m_controlPoints);
+	if (isChanged || (m_isParameterChanged && m_controlPoints.getNumVertices() > 1))
 	{
-		updateGraphics(controlPoints);
+		m_isParameterChanged = false;
+		updateGraphics(m_controlPoints);
 	}
 }
 
 void OsgCurveRepresentation::setSubdivisions(size_t num)
 {
-	m_subdivision = num;
+	m_tessellator.setMaxSubdivisions(num);
+	m_isParameterChanged = true;
 }
 
 size_t OsgCurveRepresentation::getSubdivisions() const
 {
-	return m_subdivision;
+	return m_tessellator.getMaxSubdivisions();
 }
 
 void OsgCurveRepresentation::setTension(double tension)
 {
-	m_tension = tension;
+	m_tessellator.setTension(tension);
+	m_isParameterChanged = true;
 }
 
 double OsgCurveRepresentation::getTension() const
 {
-	return m_tension;
+	return m_tessellator.getTension();
 }
 
-void OsgCurveRepresentation::updateGraphics(const DataStructures::VerticesPlain& controlPoints)
+void OsgCurveRepresentation::setTolerance(double tolerance)
 {
-	const double stepsize = 1.0 / (m_subdivision + 1);
-
-	retrievePoints(controlPoints, &m_controlPoints);
-
-	size_t numPoints = static_cast<size_t>(static_cast<double>(m_controlPoints.size() - 3) / stepsize);
+	m_tessellator.setTolerance(tolerance);
+	m_isParameterChanged = true;
+}
 
-	m_vertices.clear();
-	m_vertices.reserve(numPoints);
+double OsgCurveRepresentation::getTolerance() const
+{
+	return m_tessellator.getTolerance();
+}
 
-	computePoints(getSubdivisions(), m_controlPoints, &m_vertices, getTension());
+void OsgCurveRepresentation::updateGraphics(const DataStructures::VerticesPlain& controlPoints)
+{
+	if (!m_tessellator.update(controlPoints))
+	{
+		return;
+	}
 
-	size_t vertexCount = m_vertices.size();
+	const auto& vertices = m_tessellator.getVertices();
+	const auto& directions = m_tessellator.getDirections();
+	size_t vertexCount = vertices.size();
 	if (m_vertexData->size() != vertexCount)
 	{
 		m_vertexData->resize(vertexCount);
@@ -194,23 +138,15 @@ void OsgCurveRepresentation::updateGraphics(const DataStructures::VerticesPlain&
 		m_drawArrays->dirty();
 	}
 
-	// #performance
-	// Calculate the bounding box while iterating over the vertices, this will save osg time in the update traversal
-	for (size_t i = 0; i < vertexCount; ++i)
+	// The vertices outside of the changed range are still in the arrays from the previous updates
+	for (size_t i = m_tessellator.getChangedBegin(); i < m_tessellator.getChangedEnd(); ++i)
 	{
-		const auto& vertex0 = m_vertices[i];
-		const auto& vertex1 = (i < vertexCount - 1) ? m_vertices[i + 1] : m_controlPoints.back();
+		const auto& vertex = vertices[i];
+		const auto& direction = directions[i];
 
 		// Assign the segment into the normal for use in the shader
-		const auto& normal = vertex1 - vertex0;
-
-		(*m_normalData)[i][0] = static_cast<float>(normal[0]);
-		(*m_normalData)[i][1] = static_cast<float>(normal[1]);
-		(*m_normalData)[i][2] = static_cast<float>(normal[2]);
-
-		(*m_vertexData)[i][0] = static_cast<float>(vertex0[0]);
-		(*m_vertexData)[i][1] = static_cast<float>(vertex0[1]);
-		(*m_vertexData)[i][2] = static_cast<float>(vertex0[2]);
+		(*m_normalData)[i].set(direction[0], direction[1], direction[2]);
+		(*m_vertexData)[i].set(vertex[0], vertex[1], vertex[2]);
 	}
 
 	m_vertexData->dirty();
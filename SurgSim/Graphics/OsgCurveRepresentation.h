@@ -17,6 +17,7 @@
 #define SURGSIM_GRAPHICS_OSGCURVEREPRESENTATION_H
 
 #include "SurgSim/Graphics/CurveRepresentation.h"
+#include "SurgSim/Graphics/CurveTessellator.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
 
 #include <osg/Array>
@@ -42,6 +43,7 @@ namespace Graphics
 /// Implements the CurveRepresentation for OpenSceneGraph, it uses Catmull Rom interpolation, to draw the line
 /// as a GL_LINESTRIP. use the material_curve.vert shader for rendering. This class will also deposit the information
 /// of the segment in the normal information for the vertex.
+/// Only the segments whose control points moved are interpolated again, see CurveTessellator.
 class OsgCurveRepresentation : public OsgRepresentation, public CurveRepresentation
 {
 public:
@@ -65,6 +67,10 @@ class OsgCurveRepresentation : public OsgRepresentation, public CurveRepresentat
 
 	double getTension() const override;
 
+	void setTolerance(double tolerance) override;
+
+	double getTolerance() const override;
+
 	void setColor(const SurgSim::Math::Vector4d& color) override;
 
 	Math::Vector4d getColor() const override;
@@ -79,7 +85,7 @@ class OsgCurveRepresentation : public OsgRepresentation, public CurveRepresentat
 
 private:
 
-	/// Update the OSG structure with the information of the control points
+	/// Update the OSG structure with the vertices that changed in the tessellation of the control points
 	/// \param controlPoints to use
 	void updateGraphics(const DataStructures::VerticesPlain& controlPoints);
 
@@ -94,16 +100,17 @@ class OsgCurveRepresentation : public OsgRepresentation, public CurveRepresentat
 	/// @{
 	/// Members for the CurveRepresentation properties
 	Math::Vector4d m_color;
-	size_t m_subdivision;
-	double m_tension;
 	double m_width;
 	///@}
 
-	///@{
-	/// Local structures to keep allocations to a minimum
-	std::vector<Math::Vector3d> m_controlPoints;
-	std::vector<Math::Vector3d> m_vertices;
-	///@}
+	/// Interpolates the control points, keeps the vertices between updates
+	CurveTessellator m_tessellator;
+
+	/// The last control points, kept to reuse their storage
+	DataStructures::VerticesPlain m_controlPoints;
+
+	/// Whether the curve has to be interpolated again because the interpolation parameters changed
+	bool m_isParameterChanged;
 
 };
 
@@ -93,5 +93,16 @@ std::shared_ptr<OsgUnitCylinder> OsgCylinderRepresentation::getSharedUnitCylinde
 	return shared.get();
 }
 
+InstanceShape OsgCylinderRepresentation::getInstanceShape() const
+{
+	return INSTANCE_SHAPE_CYLINDER;
+}
+
+osg::Vec4f OsgCylinderRepresentation::getInstanceScale() const
+{
+	float radius = static_cast<float>(m_scale.x());
+	return osg::Vec4f(radius, static_cast<float>(m_scale.y()), radius, 0.0f);
+}
+
 }; // Graphics
 }; // SurgSim
\ No newline at end of file
@@ -76,6 +76,10 @@ class OsgCylinderRepresentation : public OsgRepresentation, public CylinderRepre
 	/// \return Size of the cylinder
 	SurgSim::Math::Vector2d getSize() const override;
 
+	InstanceShape getInstanceShape() const override;
+
+	osg::Vec4f getInstanceScale() const override;
+
 private:
 	/// The OSG Cylinder shape is a unit Cylinder and this transform scales it to the size set.
 	osg::Vec2d m_scale;
@@ -15,15 +15,20 @@
 
 #include "SurgSim/Graphics/OsgGroup.h"
 
+#include <vector>
+
 #include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Graphics/OsgInstanceBatch.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
 
+using SurgSim::Graphics::OsgInstanceBatch;
 using SurgSim::Graphics::OsgRepresentation;
 using SurgSim::Graphics::OsgGroup;
 
 OsgGroup::OsgGroup(const std::string& name) : SurgSim::Graphics::Group(name),
 	m_isVisible(true),
-	m_switch(new osg::Switch())
+	m_switch(new osg::Switch()),
+	m_isInstancingEnabled(false)
 {
 	m_switch->getOrCreateStateSet()->setGlobalDefaults();
 	m_switch->setName(name + " Switch");
@@ -54,8 +59,14 @@ bool OsgGroup::add(std::shared_ptr<SurgSim::Graphics::Representation> representa
 
 	if (osgRepresentation && Group::add(osgRepresentation))
 	{
-		m_switch->addChild(osgRepresentation->getOsgNode());
-		m_switch->setChildValue(osgRepresentation->getOsgNode(), m_isVisible);
+		if (m_isInstancingEnabled && osgRepresentation->isInstanceable())
+		{
+			addInstance(osgRepresentation);
+		}
+		else
+		{
+			addNode(osgRepresentation);
+		}
 		return true;
 	}
 	else
@@ -84,7 +95,11 @@ bool OsgGroup::remove(std::shared_ptr<SurgSim::Graphics::Representation> represe
 
 	if (osgRepresentation && Group::remove(osgRepresentation))
 	{
-		m_switch->removeChild(osgRepresentation->getOsgNode());
+		auto shape = osgRepresentation->getInstanceShape();
+		if (shape == INSTANCE_SHAPE_NONE || m_batches[shape] == nullptr || !m_batches[shape]->remove(osgRepresentation))
+		{
+			m_switch->removeChild(osgRepresentation->getOsgNode());
+		}
 		return true;
 	}
 	else
@@ -106,4 +121,87 @@ void OsgGroup::clear()
 osg::ref_ptr<osg::Group> OsgGroup::getOsgGroup() const
 {
 	return m_switch;
-}
\ No newline at end of file
+}
+
+void OsgGroup::updateInstances()
+{
+	std::vector<std::shared_ptr<OsgRepresentation>> removed;
+	for (auto batch = m_batches.cbegin(); batch != m_batches.cend(); ++batch)
+	{
+		if (*batch != nullptr)
+		{
+			(*batch)->update(&removed);
+			for (auto representation = removed.cbegin(); representation != removed.cend(); ++representation)
+			{
+				addNode(*representation);
+			}
+		}
+	}
+}
+
+void OsgGroup::setInstancingEnabled(bool enabled)
+{
+	if (enabled == m_isInstancingEnabled)
+	{
+		return;
+	}
+	m_isInstancingEnabled = enabled;
+
+	if (enabled)
+	{
+		for (auto member = getMembers().cbegin(); member != getMembers().cend(); ++member)
+		{
+			auto osgRepresentation = std::static_pointer_cast<OsgRepresentation>(*member);
+			if (osgRepresentation->isInstanceable())
+			{
+				m_switch->removeChild(osgRepresentation->getOsgNode());
+				addInstance(osgRepresentation);
+			}
+		}
+	}
+	else
+	{
+		for (auto batch = m_batches.begin(); batch != m_batches.end(); ++batch)
+		{
+			if (*batch != nullptr)
+			{
+				auto& representations = (*batch)->getRepresentations();
+				for (auto representation = representations.cbegin(); representation != representations.cend();
+					 ++representation)
+				{
+					addNode(*representation);
+				}
+				m_switch->removeChild((*batch)->getOsgNode());
+				batch->reset();
+			}
+		}
+	}
+}
+
+bool OsgGroup::isInstancingEnabled() const
+{
+	return m_isInstancingEnabled;
+}
+
+std::shared_ptr<OsgInstanceBatch> OsgGroup::getInstanceBatch(InstanceShape shape) const
+{
+	return m_batches[shape];
+}
+
+void OsgGroup::addNode(std::shared_ptr<OsgRepresentation> representation)
+{
+	m_switch->addChild(representation->getOsgNode());
+	m_switch->setChildValue(representation->getOsgNode(), m_isVisible);
+}
+
+void OsgGroup::addInstance(std::shared_ptr<OsgRepresentation> representation)
+{
+	auto& batch = m_batches[representation->getInstanceShape()];
+	if (batch == nullptr)
+	{
+		batch = std::make_shared<OsgInstanceBatch>(representation->getInstanceShape());
+		m_switch->addChild(batch->getOsgNode());
+		m_switch->setChildValue(batch->getOsgNode(), m_isVisible);
+	}
+	batch->add(representation);
+}
@@ -17,6 +17,10 @@
 #define SURGSIM_GRAPHICS_OSGGROUP_H
 
 #include "SurgSim/Graphics/Group.h"
+#include "SurgSim/Graphics/OsgRepresentation.h"
+
+#include <array>
+#include <memory>
 
 #include <osg/Group>
 #include <osg/Switch>
@@ -27,9 +31,14 @@ namespace SurgSim
 namespace Graphics
 {
 
+class OsgInstanceBatch;
+
 /// OSG implementation of a graphics group.
 ///
 /// A Graphics::OsgGroup wraps a osg::Switch to provide group functionality.
+/// When instancing is enabled, representations that are instanceable when they are added (see
+/// OsgRepresentation::isInstanceable()) do not get their own node in the group, they are drawn by one OsgInstanceBatch
+/// per shape instead.
 class OsgGroup : public Group
 {
 public:
@@ -69,7 +78,32 @@ class OsgGroup : public Group
 	/// Returns the root OSG group node
 	osg::ref_ptr<osg::Group> getOsgGroup() const;
 
+	/// Update the instance attributes of the batched representations, representations that stopped being
+	/// instanceable get their own node in the group again. Called once per frame by the OsgManager.
+	void updateInstances();
+
+	/// Sets whether the instanceable representations are drawn by instance batches, the representations already in
+	/// the group are moved between the batches and their own nodes. Instancing changes the shading of these
+	/// representations to the one of Shaders/instanced_lit.vert, it is disabled by default.
+	/// \param enabled Whether to draw the instanceable representations with instancing
+	void setInstancingEnabled(bool enabled);
+
+	/// \return true if the instanceable representations are drawn by instance batches
+	bool isInstancingEnabled() const;
+
+	/// \param shape The shape of the instances
+	/// \return The batch drawing the representations of the given shape, nullptr if there is none
+	std::shared_ptr<OsgInstanceBatch> getInstanceBatch(InstanceShape shape) const;
+
 private:
+	/// Add the node of a representation to the group
+	/// \param representation The representation
+	void addNode(std::shared_ptr<OsgRepresentation> representation);
+
+	/// Add a representation to the batch of its shape, the batch is created if needed
+	/// \param representation The instanceable representation
+	void addInstance(std::shared_ptr<OsgRepresentation> representation);
+
 	/// Whether the group is currently visible or not
 	/// Newly added representations or groups will have this visibility.
 	bool m_isVisible;
@@ -77,6 +111,12 @@ class OsgGroup : public Group
 	/// OSG group node
 	/// A switch is used to provide visibility functionality.
 	osg::ref_ptr<osg::Switch> m_switch;
+
+	/// Whether the instanceable representations are drawn by instance batches
+	bool m_isInstancingEnabled;
+
+	/// The batch of each instance shape, created when the first representation of that shape is added
+	std::array<std::shared_ptr<OsgInstanceBatch>, INSTANCE_SHAPE_COUNT> m_batches;
 };
 
 };  // namespace Graphics
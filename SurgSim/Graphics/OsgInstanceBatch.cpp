@@ -0,0 +1,389 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/OsgInstanceBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <osg/BoundingBox>
+#include <osg/Math>
+#include <osg/Program>
+#include <osg/Shader>
+#include <osg/VertexAttribDivisor>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Log.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Math/Matrix.h"
+#include "SurgSim/Math/RigidTransform.h"
+
+namespace
+{
+
+const unsigned int NumSlices = 24;
+const unsigned int NumStacks = 16;
+
+/// The shaders placing the instances, lighting is done like basic_lit.vert
+const char* const VertexShaderName = "Shaders/instanced_lit.vert";
+const char* const FragmentShaderName = "Shaders/basic_lit.frag";
+
+/// Geometry of a unit shape
+struct UnitShape
+{
+	UnitShape() :
+		vertices(new osg::Vec3Array()),
+		normals(new osg::Vec3Array()),
+		sides(new osg::FloatArray()),
+		triangles(new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES))
+	{
+	}
+
+	void addVertex(const osg::Vec3f& vertex, const osg::Vec3f& normal, float side)
+	{
+		vertices->push_back(vertex);
+		normals->push_back(normal);
+		sides->push_back(side);
+	}
+
+	void addTriangle(unsigned int a, unsigned int b, unsigned int c)
+	{
+		triangles->push_back(a);
+		triangles->push_back(b);
+		triangles->push_back(c);
+	}
+
+	/// Connect two rings of NumSlices + 1 vertices, the first one being above the second one
+	void addBand(unsigned int upperRing, unsigned int lowerRing)
+	{
+		for (unsigned int slice = 0; slice < NumSlices; ++slice)
+		{
+			addTriangle(upperRing + slice, lowerRing + slice, upperRing + slice + 1);
+			addTriangle(upperRing + slice + 1, lowerRing + slice, lowerRing + slice + 1);
+		}
+	}
+
+	osg::ref_ptr<osg::Vec3Array> vertices;
+	osg::ref_ptr<osg::Vec3Array> normals;
+	osg::ref_ptr<osg::FloatArray> sides;
+	osg::ref_ptr<osg::DrawElementsUInt> triangles;
+};
+
+osg::Vec3f getRingDirection(unsigned int slice)
+{
+	float angle = 2.0f * static_cast<float>(osg::PI) * static_cast<float>(slice) / static_cast<float>(NumSlices);
+	return osg::Vec3f(std::sin(angle), 0.0f, std::cos(angle));
+}
+
+/// Sphere of radius 1, for the capsule the equator is split so that the upper and lower halves can be moved apart
+void buildSphere(bool isCapsule, UnitShape* shape)
+{
+	unsigned int previousRing = 0;
+	for (unsigned int stack = 0; stack <= NumStacks; ++stack)
+	{
+		float angle = static_cast<float>(osg::PI) * static_cast<float>(stack) / static_cast<float>(NumStacks);
+		float side = 0.0f;
+		if (isCapsule)
+		{
+			side = (2 * stack < NumStacks) ? 1.0f : -1.0f;
+		}
+		int numCopies = (isCapsule && 2 * stack == NumStacks) ? 2 : 1;
+		for (int copy = 0; copy < numCopies; ++copy)
+		{
+			if (numCopies == 2)
+			{
+				side = (copy == 0) ? 1.0f : -1.0f;
+			}
+			unsigned int ring = static_cast<unsigned int>(shape->vertices->size());
+			for (unsigned int slice = 0; slice <= NumSlices; ++slice)
+			{
+				osg::Vec3f normal = getRingDirection(slice) * std::sin(angle);
+				normal.y() = std::cos(angle);
+				shape->addVertex(normal, normal, side);
+			}
+			if (ring > 0)
+			{
+				shape->addBand(previousRing, ring);
+			}
+			previousRing = ring;
+		}
+	}
+}
+
+/// Box of size 1
+void buildBox(UnitShape* shape)
+{
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const int uAxis = (axis + 1) % 3;
+		const int vAxis = (axis + 2) % 3;
+		for (int direction = -1; direction <= 1; direction += 2)
+		{
+			osg::Vec3f normal;
+			normal[axis] = static_cast<float>(direction);
+			unsigned int first = static_cast<unsigned int>(shape->vertices->size());
+			const float u[4] = {-0.5f, 0.5f, 0.5f, -0.5f};
+			const float v[4] = {-0.5f, -0.5f, 0.5f, 0.5f};
+			for (int corner = 0; corner < 4; ++corner)
+			{
+				osg::Vec3f vertex = normal * 0.5f;
+				vertex[uAxis] = u[corner];
+				vertex[vAxis] = v[corner];
+				shape->addVertex(vertex, normal, 0.0f);
+			}
+			const unsigned int second = (direction > 0) ? first + 1 : first + 3;
+			const unsigned int fourth = (direction > 0) ? first + 3 : first + 1;
+			shape->addTriangle(first, second, first + 2);
+			shape->addTriangle(first, first + 2, fourth);
+		}
+	}
+}
+
+/// Cylinder of radius 1 and height 1 along y
+void buildCylinder(UnitShape* shape)
+{
+	const osg::Vec3f up(0.0f, 1.0f, 0.0f);
+	unsigned int upperRing = static_cast<unsigned int>(shape->vertices->size());
+	for (unsigned int slice = 0; slice <= NumSlices; ++slice)
+	{
+		shape->addVertex(getRingDirection(slice) + up * 0.5f, getRingDirection(slice), 0.0f);
+	}
+	unsigned int lowerRing = static_cast<unsigned int>(shape->vertices->size());
+	for (unsigned int slice = 0; slice <= NumSlices; ++slice)
+	{
+		shape->addVertex(getRingDirection(slice) - up * 0.5f, getRingDirection(slice), 0.0f);
+	}
+	shape->addBand(upperRing, lowerRing);
+
+	for (int direction = -1; direction <= 1; direction += 2)
+	{
+		osg::Vec3f normal = up * static_cast<float>(direction);
+		unsigned int center = static_cast<unsigned int>(shape->vertices->size());
+		shape->addVertex(normal * 0.5f, normal, 0.0f);
+		for (unsigned int slice = 0; slice <= NumSlices; ++slice)
+		{
+			shape->addVertex(getRingDirection(slice) + normal * 0.5f, normal, 0.0f);
+		}
+		for (unsigned int slice = 0; slice < NumSlices; ++slice)
+		{
+			if (direction > 0)
+			{
+				shape->addTriangle(center, center + 1 + slice, center + 2 + slice);
+			}
+			else
+			{
+				shape->addTriangle(center, center + 2 + slice, center + 1 + slice);
+			}
+		}
+	}
+}
+
+/// Load a shader from the application data into the program
+/// \param type The type of the shader
+/// \param name The name of the shader file
+/// \param [in,out] program The program to add the shader to
+void addShader(osg::Shader::Type type, const std::string& name, osg::Program* program)
+{
+	std::string fileName = SurgSim::Framework::Runtime::getApplicationData()->findFile(name);
+	osg::ref_ptr<osg::Shader> shader = (fileName.empty()) ? nullptr : osg::Shader::readShaderFile(type, fileName);
+	if (shader == nullptr)
+	{
+		SURGSIM_LOG_WARNING(SurgSim::Framework::Logger::getLogger("Graphics/OsgInstanceBatch"))
+				<< "Shader " << name << ", could not " << ((fileName.empty()) ? "find shader file" : "load " + fileName)
+				<< ", instances will not be drawn correctly.";
+		return;
+	}
+	program->addShader(shader);
+}
+
+/// \return The program placing the instances, shared by all the batches
+osg::ref_ptr<osg::Program> getInstanceProgram()
+{
+	static osg::ref_ptr<osg::Program> program;
+	if (program == nullptr)
+	{
+		program = new osg::Program();
+		addShader(osg::Shader::VERTEX, VertexShaderName, program);
+		addShader(osg::Shader::FRAGMENT, FragmentShaderName, program);
+		program->addBindAttribLocation("side", SurgSim::Graphics::INSTANCE_SIDE_VERTEX_ATTRIBUTE_ID);
+		program->addBindAttribLocation("instanceRow0", SurgSim::Graphics::INSTANCE_ROW0_VERTEX_ATTRIBUTE_ID);
+		program->addBindAttribLocation("instanceRow1", SurgSim::Graphics::INSTANCE_ROW1_VERTEX_ATTRIBUTE_ID);
+		program->addBindAttribLocation("instanceRow2", SurgSim::Graphics::INSTANCE_ROW2_VERTEX_ATTRIBUTE_ID);
+		program->addBindAttribLocation("instanceScale", SurgSim::Graphics::INSTANCE_SCALE_VERTEX_ATTRIBUTE_ID);
+	}
+	return program;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+OsgInstanceBatch::OsgInstanceBatch(InstanceShape shape) :
+	m_shape(shape),
+	m_numInstances(0),
+	m_geode(new osg::Geode()),
+	m_geometry(new osg::Geometry()),
+	m_row0(new osg::Vec4Array()),
+	m_row1(new osg::Vec4Array()),
+	m_row2(new osg::Vec4Array()),
+	m_scale(new osg::Vec4Array())
+{
+	UnitShape unitShape;
+	switch (shape)
+	{
+		case INSTANCE_SHAPE_BOX:
+			buildBox(&unitShape);
+			break;
+		case INSTANCE_SHAPE_CAPSULE:
+			buildSphere(true, &unitShape);
+			break;
+		case INSTANCE_SHAPE_CYLINDER:
+			buildCylinder(&unitShape);
+			break;
+		case INSTANCE_SHAPE_SPHERE:
+			buildSphere(false, &unitShape);
+			break;
+		default:
+			SURGSIM_FAILURE() << "OsgInstanceBatch can not draw the instance shape " << shape;
+	}
+	m_triangles = unitShape.triangles;
+
+	m_geometry->setUseDisplayList(false);
+	m_geometry->setUseVertexBufferObjects(true);
+	m_geometry->setVertexArray(unitShape.vertices);
+	m_geometry->setNormalArray(unitShape.normals, osg::Array::BIND_PER_VERTEX);
+	m_geometry->setVertexAttribArray(INSTANCE_SIDE_VERTEX_ATTRIBUTE_ID, unitShape.sides, osg::Array::BIND_PER_VERTEX);
+	m_geometry->setVertexAttribArray(INSTANCE_ROW0_VERTEX_ATTRIBUTE_ID, m_row0, osg::Array::BIND_PER_VERTEX);
+	m_geometry->setVertexAttribArray(INSTANCE_ROW1_VERTEX_ATTRIBUTE_ID, m_row1, osg::Array::BIND_PER_VERTEX);
+	m_geometry->setVertexAttribArray(INSTANCE_ROW2_VERTEX_ATTRIBUTE_ID, m_row2, osg::Array::BIND_PER_VERTEX);
+	m_geometry->setVertexAttribArray(INSTANCE_SCALE_VERTEX_ATTRIBUTE_ID, m_scale, osg::Array::BIND_PER_VERTEX);
+	m_geometry->addPrimitiveSet(m_triangles);
+	m_geode->addDrawable(m_geometry);
+	m_geode->setName("Instance Batch");
+
+	// The instance attributes advance once per instance instead of once per vertex
+	osg::StateSet* state = m_geode->getOrCreateStateSet();
+	state->setAttributeAndModes(getInstanceProgram(), osg::StateAttribute::ON);
+	state->setAttribute(new osg::VertexAttribDivisor(INSTANCE_ROW0_VERTEX_ATTRIBUTE_ID, 1));
+	state->setAttribute(new osg::VertexAttribDivisor(INSTANCE_ROW1_VERTEX_ATTRIBUTE_ID, 1));
+	state->setAttribute(new osg::VertexAttribDivisor(INSTANCE_ROW2_VERTEX_ATTRIBUTE_ID, 1));
+	state->setAttribute(new osg::VertexAttribDivisor(INSTANCE_SCALE_VERTEX_ATTRIBUTE_ID, 1));
+
+	// Nothing is drawn until there are instances, a primitive set with no instances is drawn once
+	m_geode->setNodeMask(0);
+}
+
+InstanceShape OsgInstanceBatch::getShape() const
+{
+	return m_shape;
+}
+
+bool OsgInstanceBatch::add(std::shared_ptr<OsgRepresentation> representation)
+{
+	SURGSIM_ASSERT(representation->getInstanceShape() == m_shape) <<
+		"Representation " << representation->getName() << " can not be drawn by an instance batch of shape " <<
+		m_shape;
+	if (std::find(m_representations.begin(), m_representations.end(), representation) != m_representations.end())
+	{
+		return false;
+	}
+	m_representations.push_back(representation);
+	return true;
+}
+
+bool OsgInstanceBatch::remove(std::shared_ptr<OsgRepresentation> representation)
+{
+	auto found = std::find(m_representations.begin(), m_representations.end(), representation);
+	if (found == m_representations.end())
+	{
+		return false;
+	}
+	m_representations.erase(found);
+	return true;
+}
+
+const std::vector<std::shared_ptr<OsgRepresentation>>& OsgInstanceBatch::getRepresentations() const
+{
+	return m_representations;
+}
+
+size_t OsgInstanceBatch::getNumRepresentations() const
+{
+	return m_representations.size();
+}
+
+size_t OsgInstanceBatch::getNumInstances() const
+{
+	return m_numInstances;
+}
+
+void OsgInstanceBatch::update(std::vector<std::shared_ptr<OsgRepresentation>>* removed)
+{
+	auto notInstanceable = std::stable_partition(m_representations.begin(), m_representations.end(),
+						   [](const std::shared_ptr<OsgRepresentation>& representation)
+	{
+		return representation->isInstanceable();
+	});
+	removed->assign(notInstanceable, m_representations.end());
+	m_representations.erase(notInstanceable, m_representations.end());
+
+	m_row0->clear();
+	m_row1->clear();
+	m_row2->clear();
+	m_scale->clear();
+	osg::BoundingBox bounds;
+	for (auto it = m_representations.cbegin(); it != m_representations.cend(); ++it)
+	{
+		const OsgRepresentation& representation = **it;
+		if (!representation.isActive())
+		{
+			continue;
+		}
+		const SurgSim::Math::Matrix44f matrix = representation.getPose().matrix().cast<float>();
+		m_row0->push_back(osg::Vec4f(matrix(0, 0), matrix(0, 1), matrix(0, 2), matrix(0, 3)));
+		m_row1->push_back(osg::Vec4f(matrix(1, 0), matrix(1, 1), matrix(1, 2), matrix(1, 3)));
+		m_row2->push_back(osg::Vec4f(matrix(2, 0), matrix(2, 1), matrix(2, 2), matrix(2, 3)));
+		osg::Vec4f scale = representation.getInstanceScale();
+		m_scale->push_back(scale);
+
+		// The unit shapes fit in a sphere of radius |scale|, the capsule halves move by w
+		osg::Vec3f center(matrix(0, 3), matrix(1, 3), matrix(2, 3));
+		bounds.expandBy(osg::BoundingSphere(center, osg::Vec3f(scale.x(), scale.y(), scale.z()).length() +
+											std::abs(scale.w())));
+	}
+
+	m_numInstances = m_scale->size();
+	m_row0->dirty();
+	m_row1->dirty();
+	m_row2->dirty();
+	m_scale->dirty();
+	m_triangles->setNumInstances(static_cast<int>(m_numInstances));
+	m_triangles->dirty();
+	m_geometry->setInitialBound(bounds);
+	m_geometry->dirtyBound();
+	m_geode->setNodeMask((m_numInstances > 0) ? 0xffffffff : 0);
+}
+
+osg::ref_ptr<osg::Node> OsgInstanceBatch::getOsgNode() const
+{
+	return m_geode;
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,117 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_OSGINSTANCEBATCH_H
+#define SURGSIM_GRAPHICS_OSGINSTANCEBATCH_H
+
+#include <memory>
+#include <vector>
+
+#include <osg/Array>
+#include <osg/Geode>
+#include <osg/Geometry>
+#include <osg/ref_ptr>
+
+#include "SurgSim/Graphics/OsgRepresentation.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Vertex attribute ids used by the instanced drawing, the tangent space uses 6 and 7
+static const int INSTANCE_SIDE_VERTEX_ATTRIBUTE_ID = 9;
+static const int INSTANCE_ROW0_VERTEX_ATTRIBUTE_ID = 10;
+static const int INSTANCE_ROW1_VERTEX_ATTRIBUTE_ID = 11;
+static const int INSTANCE_ROW2_VERTEX_ATTRIBUTE_ID = 12;
+static const int INSTANCE_SCALE_VERTEX_ATTRIBUTE_ID = 13;
+
+/// Draws all the representations of one InstanceShape with a single instanced draw call.
+/// Instead of a transform and a drawable per representation, the pose and scale of every representation are
+/// written into per instance vertex attributes once per frame by update(), and the shader Shaders/instanced_lit.vert,
+/// found through the application data of the runtime, places the shared unit shape. Representations that stop being
+/// instanceable, e.g. when a material is set on them, are handed back to the caller so that they can be drawn
+/// through their own node again.
+/// The unit shapes are a sphere of radius 1, a box of size 1, and a cylinder of radius 1 and height 1 along y, the
+/// capsule is a sphere whose halves are moved apart along y.
+class OsgInstanceBatch
+{
+public:
+	/// Constructor
+	/// \param shape The shape of the instances
+	explicit OsgInstanceBatch(InstanceShape shape);
+
+	/// \return The shape of the instances
+	InstanceShape getShape() const;
+
+	/// Add a representation, it has to be instanceable with the shape of this batch
+	/// \param representation The representation to draw
+	/// \return false if the representation was already in the batch
+	bool add(std::shared_ptr<OsgRepresentation> representation);
+
+	/// \param representation The representation to remove
+	/// \return true if the representation was in the batch
+	bool remove(std::shared_ptr<OsgRepresentation> representation);
+
+	/// \return The representations in the batch
+	const std::vector<std::shared_ptr<OsgRepresentation>>& getRepresentations() const;
+
+	/// \return The number of representations in the batch
+	size_t getNumRepresentations() const;
+
+	/// \return The number of instances drawn after the last update, i.e. the active representations
+	size_t getNumInstances() const;
+
+	/// Write the poses and scales of the active representations into the instance attributes
+	/// \param [out] removed The representations that are not instanceable anymore, these were removed from the batch
+	void update(std::vector<std::shared_ptr<OsgRepresentation>>* removed);
+
+	/// \return The node drawing all the instances
+	osg::ref_ptr<osg::Node> getOsgNode() const;
+
+private:
+	/// The shape of the instances
+	InstanceShape m_shape;
+
+	/// The representations drawn by the batch
+	std::vector<std::shared_ptr<OsgRepresentation>> m_representations;
+
+	/// Number of instances drawn
+	size_t m_numInstances;
+
+	/// The node holding the geometry
+	osg::ref_ptr<osg::Geode> m_geode;
+
+	/// The unit shape, with the instance attributes
+	osg::ref_ptr<osg::Geometry> m_geometry;
+
+	/// The triangles of the unit shape, drawn once per instance
+	osg::ref_ptr<osg::DrawElementsUInt> m_triangles;
+
+	///@{
+	/// Rows of the rigid transform of each instance
+	osg::ref_ptr<osg::Vec4Array> m_row0;
+	osg::ref_ptr<osg::Vec4Array> m_row1;
+	osg::ref_ptr<osg::Vec4Array> m_row2;
+	///@}
+
+	/// Scale of each instance, see OsgRepresentation::getInstanceScale()
+	osg::ref_ptr<osg::Vec4Array> m_scale;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_OSGINSTANCEBATCH_H
@@ -0,0 +1,100 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/OsgLevelOfDetail.h"
+
+#include <algorithm>
+
+#include <osg/Group>
+#include <osgUtil/CullVisitor>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+OsgLevelOfDetail::OsgLevelOfDetail(double pixelSize) :
+	m_pixelSize(pixelSize),
+	m_hysteresis(0.1),
+	m_level(0)
+{
+}
+
+void OsgLevelOfDetail::setPixelSize(double pixelSize)
+{
+	m_pixelSize = pixelSize;
+}
+
+double OsgLevelOfDetail::getPixelSize() const
+{
+	return m_pixelSize;
+}
+
+void OsgLevelOfDetail::setHysteresis(double hysteresis)
+{
+	SURGSIM_ASSERT(hysteresis >= 0.0 && hysteresis < 1.0) << "The hysteresis has to be in [0, 1).";
+	m_hysteresis = hysteresis;
+}
+
+double OsgLevelOfDetail::getHysteresis() const
+{
+	return m_hysteresis;
+}
+
+size_t OsgLevelOfDetail::getLevel() const
+{
+	return m_level;
+}
+
+size_t OsgLevelOfDetail::selectLevel(size_t level, size_t numLevels, double size, double pixelSize,
+									 double hysteresis)
+{
+	// The levels required when the size is clearly below, or possibly below, their threshold
+	size_t coarsest = 0;
+	size_t finest = 0;
+	double threshold = pixelSize;
+	for (size_t i = 1; i < numLevels; ++i, threshold *= 0.5)
+	{
+		if (size < threshold * (1.0 - hysteresis))
+		{
+			coarsest = i;
+		}
+		if (size < threshold * (1.0 + hysteresis))
+		{
+			finest = i;
+		}
+	}
+	return std::max(coarsest, std::min(finest, level));
+}
+
+void OsgLevelOfDetail::operator()(osg::Node* node, osg::NodeVisitor* nodeVisitor)
+{
+	osgUtil::CullVisitor* cullVisitor = dynamic_cast<osgUtil::CullVisitor*>(nodeVisitor);
+	osg::Group* group = node->asGroup();
+	if (cullVisitor == nullptr || group == nullptr || group->getNumChildren() == 0)
+	{
+		traverse(node, nodeVisitor);
+		return;
+	}
+
+	double size = cullVisitor->clampedPixelSize(node->getBound());
+	m_level = selectLevel(m_level, group->getNumChildren(), size, m_pixelSize, m_hysteresis);
+	group->getChild(static_cast<unsigned int>(m_level))->accept(*nodeVisitor);
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,82 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_OSGLEVELOFDETAIL_H
+#define SURGSIM_GRAPHICS_OSGLEVELOFDETAIL_H
+
+#include <cstddef>
+
+#include <osg/NodeCallback>
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Cull callback for a group whose children draw the same object with less and less detail, only one of the
+/// children is culled and drawn. The first child is used while the object covers at least the given size on the
+/// screen, every following child is used once the size halves again, so that an object whose levels keep a quarter
+/// of the triangles of the previous level keeps about the same number of triangles per pixel.
+/// Switching between levels is delayed by a hysteresis band around each threshold so that an object does not pop
+/// back and forth between two levels when its size stays close to a threshold. The chosen level is kept in the
+/// callback, a group seen by several cameras switches levels for the camera that culls it.
+class OsgLevelOfDetail : public osg::NodeCallback
+{
+public:
+	/// Constructor
+	/// \param pixelSize The size on the screen, in pixels, below which the second child is drawn
+	explicit OsgLevelOfDetail(double pixelSize = 200.0);
+
+	/// \param pixelSize The size on the screen, in pixels, below which the second child is drawn
+	void setPixelSize(double pixelSize);
+
+	/// \return The size on the screen, in pixels, below which the second child is drawn
+	double getPixelSize() const;
+
+	/// \param hysteresis The width of the hysteresis band, relative to the threshold sizes
+	void setHysteresis(double hysteresis);
+
+	/// \return The width of the hysteresis band, relative to the threshold sizes
+	double getHysteresis() const;
+
+	/// \return The level chosen during the last cull traversal
+	size_t getLevel() const;
+
+	/// Choose the level of detail for a size on the screen
+	/// \param level The current level
+	/// \param numLevels The number of levels
+	/// \param size The size of the object on the screen, in pixels
+	/// \param pixelSize The size below which the level 1 is used
+	/// \param hysteresis The width of the hysteresis band, relative to the threshold sizes
+	/// \return The new level
+	static size_t selectLevel(size_t level, size_t numLevels, double size, double pixelSize, double hysteresis);
+
+	void operator()(osg::Node* node, osg::NodeVisitor* nodeVisitor) override;
+
+private:
+	/// The size below which the level 1 is used
+	double m_pixelSize;
+
+	/// The width of the hysteresis band
+	double m_hysteresis;
+
+	/// The current level
+	size_t m_level;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_OSGLEVELOFDETAIL_H
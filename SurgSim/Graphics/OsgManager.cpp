@@ -20,17 +20,18 @@
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/Scene.h"
 #include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/Tracer.h"
 
 #include "SurgSim/Graphics/OsgRepresentation.h"
 #include "SurgSim/Graphics/OsgCamera.h"
 #include "SurgSim/Graphics/OsgGroup.h"
+#include "SurgSim/Graphics/OsgModelMatrixUpdater.h"
 #include "SurgSim/Graphics/OsgView.h"
 #include "SurgSim/Graphics/OsgScreenSpacePass.h"
 
 #include <osgViewer/Scene>
 #include <osgDB/WriteFile>
 #include <osg/NodeVisitor>
-#include <osg/NodeCallback>
 #include <osg/Matrixf>
 #include <osg/Uniform>
 
@@ -42,34 +43,8 @@ using SurgSim::Graphics::OsgManager;
 namespace
 {
 
-/// Class to update the "modelMatrix" uniform for all transforms in the scenegraph
-/// #performance This could be change to use a stack of matrices rather than query
-/// the nodepath for every transform
-class TransformUpdater : public osg::NodeCallback
-{
-public:
-	explicit TransformUpdater(osg::Uniform* uniform) : m_uniform(uniform)
-	{
-
-	}
-
-	void operator()(osg::Node* node, osg::NodeVisitor* nodeVisitor) override
-	{
-		osgUtil::CullVisitor* cv = dynamic_cast<osgUtil::CullVisitor*>(nodeVisitor);
-		if (cv != nullptr)
-		{
-			auto mat = osg::computeLocalToWorld(nodeVisitor->getNodePath(), true);
-			m_uniform->set(mat);
-		}
-		traverse(node, nodeVisitor);
-	}
-
-private:
-	osg::ref_ptr<osg::Uniform> m_uniform;
-};
-
 /// Class to find all transform nodes in the added scenegraph, and add the "modelMatrix" uniform
-/// to the stateset, also ads the appropriate callback to the node
+/// to the stateset, the uniforms are set by the OsgModelMatrixUpdater
 class TransformModifier : public osg::NodeVisitor
 {
 public:
@@ -84,14 +59,12 @@ class TransformModifier : public osg::NodeVisitor
 		auto uniform = new osg::Uniform;
 		uniform->setName("modelMatrix");
 		uniform->setType(osg::Uniform::FLOAT_MAT4);
+		uniform->setDataVariance(osg::Object::DYNAMIC);
 
 		osg::Matrix matrix;
 		uniform->set(matrix);
 
 		state->addUniform(uniform);
-
-		auto callback = new TransformUpdater(uniform);
-		node.addCullCallback(callback);
 	}
 };
 
@@ -102,7 +75,8 @@ namespace SurgSim
 namespace Graphics
 {
 OsgManager::OsgManager() : SurgSim::Graphics::Manager(),
-	m_viewer(new osgViewer::CompositeViewer())
+	m_viewer(new osgViewer::CompositeViewer()),
+	m_modelMatrixUpdater(new OsgModelMatrixUpdater())
 {
 	setMultiThreading(true);
 }
@@ -230,9 +204,42 @@ bool OsgManager::doUpdate(double dt)
 	}
 
 
-	if (Manager::doUpdate(dt))
+	bool success;
 	{
-		m_viewer->frame();
+		SURGSIM_TRACE_SCOPE("Graphics", "Update representations");
+		success = Manager::doUpdate(dt);
+	}
+
+	{
+		SURGSIM_TRACE_SCOPE("Graphics", "Update instances");
+		for (auto& group : getGroups())
+		{
+			auto osgGroup = std::dynamic_pointer_cast<OsgGroup>(group.second);
+			if (osgGroup != nullptr)
+			{
+				osgGroup->updateInstances();
+			}
+		}
+	}
+
+	{
+		SURGSIM_TRACE_SCOPE("Graphics", "Update model matrices");
+		for (auto& group : getGroups())
+		{
+			auto osgGroup = std::dynamic_pointer_cast<OsgGroup>(group.second);
+			if (osgGroup != nullptr)
+			{
+				m_modelMatrixUpdater->update(osgGroup->getOsgGroup());
+			}
+		}
+	}
+
+	if (success)
+	{
+		{
+			SURGSIM_TRACE_SCOPE("Graphics", "Render frame");
+			m_viewer->frame();
+		}
 
 		// \note HS-2013-dec-12 This will work as long as we deal with one view, when we move to stereoscopic
 		//	     we might have to revise things. Or just assume that most views have the same size
@@ -33,6 +33,7 @@ class Group;
 class View;
 class OsgCamera;
 class OsgGroup;
+class OsgModelMatrixUpdater;
 class OsgScreenSpacePass;
 
 /// OSG-based implementation of graphics manager class.
@@ -102,6 +103,9 @@ class OsgManager : public Manager
 	/// OSG CompositeViewer to manage and render the individual views
 	osg::ref_ptr<osgViewer::CompositeViewer> m_viewer;
 
+	/// Sets the "modelMatrix" uniforms of the transforms of all the groups before each frame
+	osg::ref_ptr<OsgModelMatrixUpdater> m_modelMatrixUpdater;
+
 	/// Builtin RenderPass that can be used for HUD functionality, uses Group "ossHud"
 	std::shared_ptr<OsgScreenSpacePass> m_hudElement;
 };
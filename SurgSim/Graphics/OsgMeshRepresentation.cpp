@@ -18,6 +18,7 @@
 #include <osg/Array>
 #include <osg/Geode>
 #include <osg/Geometry>
+#include <osg/Group>
 #include <osg/Switch>
 #include <osg/PositionAttitudeTransform>
 #include <osg/Vec3f>
@@ -30,7 +31,7 @@
 #include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Graphics/Mesh.h"
 #include "SurgSim/Graphics/OsgConversions.h"
-#include "SurgSim/Graphics/TriangleNormalGenerator.h"
+#include "SurgSim/Graphics/TangentSpaceGenerator.h"
 #include "SurgSim/Math/MeshShape.h"
 #include "SurgSim/Math/Shape.h"
 
@@ -45,7 +46,12 @@ OsgMeshRepresentation::OsgMeshRepresentation(const std::string& name) :
 	OsgRepresentation(name),
 	MeshRepresentation(name),
 	m_updateOptions(UPDATE_OPTION_VERTICES),
-	m_updateCount(0)
+	m_numLevelsOfDetail(1),
+	m_levelOfDetail(new OsgLevelOfDetail()),
+	m_updateCount(0),
+	m_isIncrementalUpdate(false),
+	m_isFullUpdateNeeded(true),
+	m_isFullTangentUpdateNeeded(true)
 {
 	m_meshSwitch = new osg::Switch();
 	m_transform->addChild(m_meshSwitch);
@@ -60,6 +66,7 @@ OsgMeshRepresentation::~OsgMeshRepresentation()
 void OsgMeshRepresentation::loadMesh(const std::string& fileName)
 {
 	auto mesh = std::make_shared<Mesh>();
+	mesh->setNumLevelsOfDetailOnLoad(m_numLevelsOfDetail);
 	mesh->load(fileName);
 	setMesh(mesh);
 }
@@ -71,6 +78,7 @@ void OsgMeshRepresentation::setMesh(std::shared_ptr<SurgSim::Framework::Asset> m
 	m_mesh = graphicsMesh;
 	m_updateCount = m_mesh->getUpdateCount();
 	m_mesh->dirty();
+	m_isFullUpdateNeeded = true;
 	buildGeometry();
 }
 
@@ -106,6 +114,11 @@ void OsgMeshRepresentation::doUpdate(double dt)
 			privateUpdateMesh(tempMesh);
 		}
 	}
+
+	if (m_vertexPositions.tryTakeFront())
+	{
+		updateVertexPositions(m_vertexPositions.getFront());
+	}
 }
 
 void OsgMeshRepresentation::privateUpdateMesh(const Mesh& mesh)
@@ -125,18 +138,48 @@ void OsgMeshRepresentation::privateUpdateMesh(const Mesh& mesh)
 	int updateOptions = updateOsgArrays(mesh, m_geometry);
 	updateOptions |= m_updateOptions;
 
+	bool isTopologyChanged = false;
 	if ((updateOptions & UPDATE_OPTION_TRIANGLES) != 0)
 	{
-		updateTriangles(mesh, m_geometry);
+		isTopologyChanged = updateTriangles(mesh, m_geometry);
+	}
+
+	if (isTopologyChanged || m_adjacency.getNumVertices() != mesh.getNumVertices())
+	{
+		osg::Geometry::DrawElementsList drawElements;
+		m_geometry->getDrawElementsList(drawElements);
+		m_adjacency.build(*static_cast<osg::DrawElementsUInt*>(drawElements[0]), mesh.getNumVertices());
+		m_isFullUpdateNeeded = true;
+		updateOptions |= UPDATE_OPTION_VERTICES;
+	}
+
+	if (isTopologyChanged || m_levelGeometries.size() + 1 != m_numLevelsOfDetail)
+	{
+		updateLevelsOfDetail(mesh);
 	}
 
 	if ((updateOptions & (UPDATE_OPTION_VERTICES | UPDATE_OPTION_TEXTURES | UPDATE_OPTION_COLORS)) != 0)
 	{
 		updateVertices(mesh, m_geometry, updateOptions);
-		updateTangents();
+
+		// When a large part of the mesh changed, recalculating everything is cheaper than collecting the neighborhood
+		bool isIncremental = m_isIncrementalUpdate && !m_isFullUpdateNeeded &&
+							 m_changedVertices.size() * 4 < mesh.getNumVertices();
+		if (isIncremental)
+		{
+			m_adjacency.collectAffected(m_changedVertices, &m_affectedTriangles, &m_affectedVertices);
+		}
+		if ((updateOptions & UPDATE_OPTION_VERTICES) != 0)
+		{
+			updateNormals(m_geometry, isIncremental);
+			m_isFullUpdateNeeded = false;
+		}
+		updateMeshTangents(m_geometry, isIncremental);
+
 		m_geometry->dirtyDisplayList();
 		m_geometry->dirtyBound();
 		m_geometry->getBound();
+		shareLevelArrays();
 	}
 }
 
@@ -158,12 +201,18 @@ void OsgMeshRepresentation::updateVertices(const Mesh& mesh, osg::Geometry* geom
 	auto colors = static_cast<osg::Vec4Array*>(geometry->getColorArray());
 	auto textureCoords = static_cast<osg::Vec2Array*>(geometry->getTexCoordArray(0));
 
+	bool trackChanges = m_isIncrementalUpdate && !m_isFullUpdateNeeded;
+	m_changedVertices.clear();
+
 	size_t index = 0;
 	for (const auto& vertex : mesh.getVertices())
 	{
+		bool isChanged = false;
 		if (updateVertices)
 		{
-			(*vertices)[index].set(toOsg(vertex.position));
+			osg::Vec3 position = toOsg(vertex.position);
+			isChanged = trackChanges && position != (*vertices)[index];
+			(*vertices)[index].set(position);
 		}
 		if (updateColors)
 		{
@@ -171,47 +220,125 @@ void OsgMeshRepresentation::updateVertices(const Mesh& mesh, osg::Geometry* geom
 		}
 		if (updateTextures)
 		{
-			(*textureCoords)[index] =
+			osg::Vec2 textureCoord =
 				(vertex.data.texture.hasValue()) ? toOsg(vertex.data.texture.getValue()) : defaultTextureCoord;
+			isChanged = isChanged || (trackChanges && textureCoord != (*textureCoords)[index]);
+			(*textureCoords)[index] = textureCoord;
+		}
+		if (isChanged)
+		{
+			m_changedVertices.push_back(static_cast<unsigned int>(index));
 		}
 		++index;
 	}
 
-	if (updateVertices)
-	{
-		updateNormals(geometry);
-	}
 	vertices->dirty();
 }
 
-void OsgMeshRepresentation::updateNormals(osg::Geometry* geometry)
+void OsgMeshRepresentation::updateNormals(osg::Geometry* geometry, bool isIncremental)
 {
-	// Generate normals from geometry
 	auto vertices = static_cast<osg::Vec3Array*>(geometry->getVertexArray());
 	auto normals = static_cast<osg::Vec3Array*>(geometry->getNormalArray());
-	auto normalGenerator = createNormalGenerator(vertices, normals);
-	geometry->accept(normalGenerator);
-	normalGenerator.normalize();
+	if (isIncremental)
+	{
+		m_adjacency.computeNormals(*vertices, m_affectedTriangles, m_affectedVertices, normals);
+	}
+	else
+	{
+		m_adjacency.computeNormals(*vertices, normals);
+	}
 	normals->dirty();
 }
 
-void OsgMeshRepresentation::updateTriangles(const Mesh& mesh, osg::Geometry* geometry)
+void OsgMeshRepresentation::updateMeshTangents(osg::Geometry* geometry, bool isIncremental)
+{
+	if (m_tangentGenerator == nullptr)
+	{
+		return;
+	}
+
+	auto vertices = static_cast<osg::Vec3Array*>(geometry->getVertexArray());
+	auto normals = static_cast<osg::Vec3Array*>(geometry->getNormalArray());
+	auto textureCoords = dynamic_cast<osg::Vec2Array*>(geometry->getTexCoordArray(DIFFUSE_TEXTURE_UNIT));
+	auto tangents = dynamic_cast<osg::Vec4Array*>(geometry->getVertexAttribArray(TANGENT_VERTEX_ATTRIBUTE_ID));
+	auto bitangents = dynamic_cast<osg::Vec4Array*>(geometry->getVertexAttribArray(BITANGENT_VERTEX_ATTRIBUTE_ID));
+	if (textureCoords == nullptr || tangents == nullptr || bitangents == nullptr ||
+		textureCoords->size() != vertices->size() || tangents->size() != vertices->size() ||
+		bitangents->size() != vertices->size())
+	{
+		// The generator sets up the tangent arrays, or reports what data is missing, it does not fill the per
+		// triangle tangents of m_adjacency that an incremental update builds upon
+		updateTangents();
+		m_isFullTangentUpdateNeeded = true;
+		return;
+	}
+
+	bool orthonormal = m_tangentGenerator->getBasisOrthonormality();
+	if (isIncremental && !m_isFullTangentUpdateNeeded)
+	{
+		m_adjacency.computeTangents(*vertices, *normals, *textureCoords, orthonormal,
+									m_affectedTriangles, m_affectedVertices, tangents, bitangents);
+	}
+	else
+	{
+		m_adjacency.computeTangents(*vertices, *normals, *textureCoords, orthonormal, tangents, bitangents);
+		m_isFullTangentUpdateNeeded = false;
+	}
+	tangents->dirty();
+	bitangents->dirty();
+}
+
+void OsgMeshRepresentation::updateVertexPositions(osg::Vec3Array* positions)
+{
+	auto vertices = static_cast<osg::Vec3Array*>(m_geometry->getVertexArray());
+	if (positions->size() != vertices->size())
+	{
+		SURGSIM_LOG_ONCE(SurgSim::Framework::Logger::getLogger("Graphics/OsgMeshRepresentation"), WARNING)
+				<< "Ignoring vertex positions for " << positions->size() << " vertices in " << getFullName()
+				<< ", the geometry has " << vertices->size() << " vertices.";
+		return;
+	}
+
+	// The previous array will be handed back to the producer, drawing needs to be done with it before the next
+	// update traversal
+	m_geometry->setDataVariance(osg::Object::DYNAMIC);
+	positions->setDataVariance(osg::Object::DYNAMIC);
+	if (positions != vertices)
+	{
+		m_geometry->setVertexArray(positions);
+	}
+	positions->dirty();
+
+	updateNormals(m_geometry, false);
+	updateMeshTangents(m_geometry, false);
+	m_geometry->dirtyDisplayList();
+	m_geometry->dirtyBound();
+	m_geometry->getBound();
+	shareLevelArrays();
+}
+
+bool OsgMeshRepresentation::updateTriangles(const Mesh& mesh, osg::Geometry* geometry)
 {
 	osg::Geometry::DrawElementsList drawElements;
 	geometry->getDrawElementsList(drawElements);
 	auto triangles = static_cast<osg::DrawElementsUInt*>(drawElements[0]);
 
+	bool isChanged = false;
 	size_t i = 0;
 	for (auto const& triangle : mesh.getTriangles())
 	{
 		if (triangle.isValid)
 		{
-			(*triangles)[i++] = triangle.verticesId[0];
-			(*triangles)[i++] = triangle.verticesId[1];
-			(*triangles)[i++] = triangle.verticesId[2];
+			for (size_t j = 0; j < 3; ++j, ++i)
+			{
+				unsigned int vertexId = static_cast<unsigned int>(triangle.verticesId[j]);
+				isChanged = isChanged || (*triangles)[i] != vertexId;
+				(*triangles)[i] = vertexId;
+			}
 		}
 	}
 	triangles->dirty();
+	return isChanged;
 }
 
 int OsgMeshRepresentation::updateOsgArrays(const Mesh& mesh, osg::Geometry* geometry)
@@ -290,6 +417,64 @@ int OsgMeshRepresentation::getUpdateOptions() const
 	return m_updateOptions;
 }
 
+void OsgMeshRepresentation::setIncrementalUpdate(bool val)
+{
+	m_isIncrementalUpdate = val;
+	m_isFullUpdateNeeded = true;
+}
+
+bool OsgMeshRepresentation::isIncrementalUpdate() const
+{
+	return m_isIncrementalUpdate;
+}
+
+void OsgMeshRepresentation::setGenerateTangents(bool value)
+{
+	OsgRepresentation::setGenerateTangents(value);
+	m_isFullTangentUpdateNeeded = true;
+}
+
+void OsgMeshRepresentation::setLevelsOfDetail(size_t numLevels)
+{
+	SURGSIM_ASSERT(numLevels > 0) << "There has to be at least one level of detail.";
+	m_numLevelsOfDetail = numLevels;
+
+	// Build the levels now instead of on the graphics thread, a mesh from a file is loaded again so that the levels
+	// come from the asset cache or the binary cache file
+	if (!isAwake() && numLevels > 1 && m_mesh->getNumLevelsOfDetail() != numLevels)
+	{
+		if (!m_mesh->getFileName().empty())
+		{
+			loadMesh(m_mesh->getFileName());
+		}
+		else if (m_mesh->getNumTriangles() > 0)
+		{
+			m_mesh->buildLevelsOfDetail(numLevels);
+		}
+	}
+	m_mesh->dirty();
+}
+
+size_t OsgMeshRepresentation::getLevelsOfDetail() const
+{
+	return m_numLevelsOfDetail;
+}
+
+void OsgMeshRepresentation::setLevelOfDetailPixelSize(double pixelSize)
+{
+	m_levelOfDetail->setPixelSize(pixelSize);
+}
+
+double OsgMeshRepresentation::getLevelOfDetailPixelSize() const
+{
+	return m_levelOfDetail->getPixelSize();
+}
+
+osg::ref_ptr<osg::Group> OsgMeshRepresentation::getOsgLevelsOfDetail() const
+{
+	return m_levels;
+}
+
 osg::ref_ptr<osg::Geometry> OsgMeshRepresentation::getOsgGeometry() const
 {
 	return m_geometry;
@@ -300,6 +485,32 @@ void OsgMeshRepresentation::updateMesh(const SurgSim::Graphics::Mesh& mesh)
 	m_writeBuffer.set(mesh);
 }
 
+float* OsgMeshRepresentation::getVertexPositionBuffer(size_t numVertices)
+{
+	static_assert(sizeof(osg::Vec3) == 3 * sizeof(float), "osg::Vec3 needs to be made of 3 packed floats.");
+
+	osg::ref_ptr<osg::Vec3Array>& positions = m_vertexPositions.getBack();
+	if (positions == nullptr || positions->size() != numVertices)
+	{
+		SURGSIM_ASSERT(m_mesh->getNumVertices() == numVertices)
+				<< "Vertex positions for " << numVertices << " vertices were requested for " << getFullName()
+				<< ", but the mesh has " << m_mesh->getNumVertices() << " vertices.";
+
+		// Vertices that are never written keep the position they have in the mesh
+		positions = new osg::Vec3Array(numVertices);
+		for (size_t i = 0; i < numVertices; ++i)
+		{
+			(*positions)[i] = toOsg(m_mesh->getVertexPosition(i));
+		}
+	}
+	return (numVertices == 0) ? nullptr : &(*positions)[0][0];
+}
+
+void OsgMeshRepresentation::publishVertexPositions()
+{
+	m_vertexPositions.publish();
+}
+
 osg::Object::DataVariance OsgMeshRepresentation::getDataVariance(int updateOption)
 {
 	return ((m_updateOptions & updateOption) != 0) ? osg::Object::DYNAMIC : osg::Object::STATIC;
@@ -309,6 +520,8 @@ void OsgMeshRepresentation::buildGeometry()
 {
 	// Remove old Geometry nodes
 	m_meshSwitch->removeChildren(0, m_meshSwitch->getNumChildren());
+	m_levels = nullptr;
+	m_levelGeometries.clear();
 
 	m_geometry = new osg::Geometry;
 
@@ -334,10 +547,90 @@ void OsgMeshRepresentation::buildGeometry()
 	auto triangles = new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES);
 	m_geometry->addPrimitiveSet(triangles);
 
-	auto geode = new osg::Geode;
-	geode->addDrawable(m_geometry);
+	m_geode = new osg::Geode;
+	m_geode->addDrawable(m_geometry);
 	m_meshSwitch->setAllChildrenOff();
-	m_meshSwitch->addChild(geode);
+	m_meshSwitch->addChild(m_geode);
+}
+
+void OsgMeshRepresentation::updateLevelsOfDetail(const Mesh& mesh)
+{
+	if (m_numLevelsOfDetail < 2)
+	{
+		if (m_levels != nullptr)
+		{
+			m_meshSwitch->replaceChild(m_levels, m_geode);
+			m_levels = nullptr;
+			m_levelGeometries.clear();
+		}
+		return;
+	}
+
+	// Levels built on the mesh of the representation are kept in the mesh, other representations sharing the mesh
+	// use them as well
+	const Mesh* levelsMesh = &mesh;
+	Mesh copy;
+	if (mesh.getNumLevelsOfDetail() != m_numLevelsOfDetail)
+	{
+		if (&mesh == m_mesh.get())
+		{
+			m_mesh->buildLevelsOfDetail(m_numLevelsOfDetail);
+		}
+		else
+		{
+			copy = mesh;
+			copy.buildLevelsOfDetail(m_numLevelsOfDetail);
+			levelsMesh = &copy;
+		}
+	}
+
+	if (m_levels == nullptr)
+	{
+		m_levels = new osg::Group;
+		m_levels->setCullCallback(m_levelOfDetail);
+		m_levels->addChild(m_geode);
+		m_meshSwitch->replaceChild(m_geode, m_levels);
+	}
+
+	if (m_levelGeometries.size() + 1 > m_numLevelsOfDetail)
+	{
+		m_levels->removeChildren(static_cast<unsigned int>(m_numLevelsOfDetail),
+								 static_cast<unsigned int>(m_levelGeometries.size() + 1 - m_numLevelsOfDetail));
+		m_levelGeometries.resize(m_numLevelsOfDetail - 1);
+	}
+	while (m_levelGeometries.size() + 1 < m_numLevelsOfDetail)
+	{
+		osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
+		geometry->setUseDisplayList(false);
+		geometry->addPrimitiveSet(new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES));
+		auto geode = new osg::Geode;
+		geode->addDrawable(geometry);
+		m_levels->addChild(geode);
+		m_levelGeometries.push_back(geometry);
+	}
+
+	for (size_t level = 1; level < m_numLevelsOfDetail; ++level)
+	{
+		const std::vector<unsigned int>& triangles = levelsMesh->getLevelOfDetail(level);
+		auto drawElements = static_cast<osg::DrawElementsUInt*>(m_levelGeometries[level - 1]->getPrimitiveSet(0));
+		drawElements->assign(triangles.begin(), triangles.end());
+		drawElements->dirty();
+	}
+	shareLevelArrays();
+}
+
+void OsgMeshRepresentation::shareLevelArrays()
+{
+	for (auto& geometry : m_levelGeometries)
+	{
+		geometry->setVertexArray(m_geometry->getVertexArray());
+		geometry->setNormalArray(m_geometry->getNormalArray());
+		geometry->setColorArray(m_geometry->getColorArray());
+		geometry->setTexCoordArrayList(m_geometry->getTexCoordArrayList());
+		geometry->setVertexAttribArrayList(m_geometry->getVertexAttribArrayList());
+		geometry->setDataVariance(m_geometry->getDataVariance());
+		geometry->dirtyBound();
+	}
 }
 
 }; // Graphics
@@ -23,9 +23,12 @@
 
 #include "SurgSim/Framework/Macros.h"
 #include "SurgSim/Framework/ObjectFactory.h"
+#include "SurgSim/Graphics/OsgLevelOfDetail.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
 #include "SurgSim/Graphics/MeshRepresentation.h"
+#include "SurgSim/Graphics/VertexTriangleAdjacency.h"
 #include "SurgSim/Framework/LockedContainer.h"
+#include "SurgSim/Framework/SwapBuffer.h"
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -71,10 +74,42 @@ class OsgMeshRepresentation : public OsgRepresentation, public MeshRepresentatio
 	void setUpdateOptions(int val) override;
 	int getUpdateOptions() const override;
 
+	void setLevelsOfDetail(size_t numLevels) override;
+
+	size_t getLevelsOfDetail() const override;
+
+	void setLevelOfDetailPixelSize(double pixelSize) override;
+
+	double getLevelOfDetailPixelSize() const override;
+
+	/// \return The group drawing one level of detail of the mesh, nullptr if the mesh has a single level
+	osg::ref_ptr<osg::Group> getOsgLevelsOfDetail() const;
+
+	/// Sets whether normals and tangents are only recalculated around the vertices that changed since the last
+	/// update, instead of for the whole mesh. This pays off when only a small part of a large mesh deforms, finding
+	/// the changed vertices adds a comparison per vertex on every update. Any change in the triangles or the number
+	/// of vertices still causes a full recalculation. Default is false.
+	/// \param val Whether to only update the neighborhood of changed vertices
+	void setIncrementalUpdate(bool val);
+
+	/// \return true if normals and tangents are only recalculated around the vertices that changed
+	bool isIncrementalUpdate() const;
+
+	/// \copydoc OsgRepresentation::setGenerateTangents()
+	/// \note Enabling the tangents causes the next update to recalculate them for the whole mesh
+	void setGenerateTangents(bool value) override;
+
 	osg::ref_ptr<osg::Geometry> getOsgGeometry() const;
 
 	void updateMesh(const SurgSim::Graphics::Mesh& mesh) override;
 
+	/// \copydoc MeshRepresentation::getVertexPositionBuffer()
+	/// \note The published buffer becomes the vertex array of the geometry without being copied, normals and tangents
+	/// 	are recalculated for the whole mesh, setIncrementalUpdate() does not apply to this path.
+	float* getVertexPositionBuffer(size_t numVertices) override;
+
+	void publishVertexPositions() override;
+
 protected:
 	void doUpdate(double dt) override;
 
@@ -96,9 +131,22 @@ class OsgMeshRepresentation : public OsgRepresentation, public MeshRepresentatio
 	///@{
 	/// Osg structures
 	osg::ref_ptr<osg::Switch> m_meshSwitch;
+	osg::ref_ptr<osg::Geode> m_geode;
 	osg::ref_ptr<osg::Geometry> m_geometry;
 	///@}
 
+	/// The number of levels of detail, including the full mesh
+	size_t m_numLevelsOfDetail;
+
+	/// Chooses the level of detail that is drawn
+	osg::ref_ptr<OsgLevelOfDetail> m_levelOfDetail;
+
+	/// Group holding one geode per level of detail, the first one is m_geode
+	osg::ref_ptr<osg::Group> m_levels;
+
+	/// The geometries of the simplified levels, they share all the arrays of m_geometry
+	std::vector<osg::ref_ptr<osg::Geometry>> m_levelGeometries;
+
 	/// Updates the internal arrays in accordance to the sizes given in the mesh
 	/// \param mesh The mesh used to update
 	/// \param geometry [out] The geometry that carries the data
@@ -107,7 +155,8 @@ class OsgMeshRepresentation : public OsgRepresentation, public MeshRepresentatio
 	int updateOsgArrays(const Mesh& mesh, osg::Geometry* geometry);
 
 	/// Copies the attributes for each mesh vertex in the appropriate osg structure, this will only be done
-	/// for the data as is indicated by updateOptions
+	/// for the data as is indicated by updateOptions. When doing an incremental update the ids of the vertices whose
+	/// position or texture coordinates changed are stored in m_changedVertices.
 	/// \param mesh The mesh used to update
 	/// \param geometry [out] The geometry that carries the data
 	/// \param updateOptions Set of flags indicating whether a specific vertex attribute should be updated
@@ -115,12 +164,23 @@ class OsgMeshRepresentation : public OsgRepresentation, public MeshRepresentatio
 
 	/// Updates the normals.
 	/// \param geometry [out] The geometry that carries the data
-	void updateNormals(osg::Geometry* geometry);
+	/// \param isIncremental Whether to only update the normals of m_affectedVertices
+	void updateNormals(osg::Geometry* geometry, bool isIncremental);
+
+	/// Updates the tangents and bitangents, if tangents are generated
+	/// \param geometry [out] The geometry that carries the data
+	/// \param isIncremental Whether to only update the tangents of m_affectedVertices
+	void updateMeshTangents(osg::Geometry* geometry, bool isIncremental);
+
+	/// Makes the vertex positions published through publishVertexPositions() the vertex array of the geometry
+	/// \param positions The published positions
+	void updateVertexPositions(osg::Vec3Array* positions);
 
 	/// Updates the triangles.
 	/// \param mesh The mesh used to update
 	/// \param geometry [out] The geometry that carries the data
-	void updateTriangles(const Mesh& mesh, osg::Geometry* geometry);
+	/// \return true if any of the triangles changed
+	bool updateTriangles(const Mesh& mesh, osg::Geometry* geometry);
 
 	/// Gets data variance for a given update option.
 	/// \param	updateOption	The update option.
@@ -130,11 +190,41 @@ class OsgMeshRepresentation : public OsgRepresentation, public MeshRepresentatio
 	/// Create the appropriate geometry nodes
 	void buildGeometry();
 
+	/// Set the triangles of the simplified levels of detail, building them if the mesh does not have them yet
+	/// \param mesh The mesh used to update
+	void updateLevelsOfDetail(const Mesh& mesh);
+
+	/// Let the geometries of the simplified levels use the current arrays of m_geometry
+	void shareLevelArrays();
+
 	/// Cache for the update count pull from the mesh
 	size_t m_updateCount;
 
 	Framework::LockedContainer<Mesh> m_writeBuffer;
 
+	/// Vertex positions written directly by a producer, see getVertexPositionBuffer()
+	Framework::SwapBuffer<osg::ref_ptr<osg::Vec3Array>> m_vertexPositions;
+
+	/// The triangles around each vertex, used to calculate normals and tangents
+	VertexTriangleAdjacency m_adjacency;
+
+	/// Whether normals and tangents are only recalculated around changed vertices
+	bool m_isIncrementalUpdate;
+
+	/// Whether the next update needs to recalculate all normals and tangents
+	bool m_isFullUpdateNeeded;
+
+	/// Whether the next update needs to recalculate all tangents, this is tracked separately from the normals as the
+	/// per triangle tangents kept in m_adjacency are not filled when the tangents are generated by the
+	/// TangentSpaceGenerator, or while tangents are not generated at all
+	bool m_isFullTangentUpdateNeeded;
+
+	///@{
+	/// Vertices that changed in the current update, and the triangles and vertices that depend on them
+	std::vector<unsigned int> m_changedVertices;
+	std::vector<unsigned int> m_affectedTriangles;
+	std::vector<unsigned int> m_affectedVertices;
+	///@}
 };
 
 #if defined(_MSC_VER)
@@ -15,9 +15,143 @@
 
 #include "SurgSim/Graphics/OsgModel.h"
 #include "SurgSim/Framework/Log.h"
+#include "SurgSim/Graphics/MeshSimplifier.h"
 
+#include <unordered_map>
+
+#include <osg/Geode>
+#include <osg/Geometry>
+#include <osg/NodeVisitor>
+#include <osg/TriangleIndexFunctor>
 #include <osgDB/ReadFile>
 
+namespace
+{
+
+/// Collects the vertex ids of the triangles of a geometry, whatever primitives they are drawn with
+struct TriangleCollector
+{
+	void operator()(unsigned int v0, unsigned int v1, unsigned int v2)
+	{
+		// Strips contain degenerate triangles to join their parts
+		if (v0 != v1 && v1 != v2 && v2 != v0)
+		{
+			triangles.push_back(v0);
+			triangles.push_back(v1);
+			triangles.push_back(v2);
+		}
+	}
+
+	std::vector<unsigned int> triangles;
+};
+
+/// \return true if the geometry only draws triangles with per vertex attributes, so that its triangles can be
+/// 	replaced
+bool isSimplifiable(const osg::Geometry& geometry)
+{
+	if (geometry.getNumPrimitiveSets() == 0 || geometry.containsDeprecatedData() ||
+		dynamic_cast<const osg::Vec3Array*>(geometry.getVertexArray()) == nullptr)
+	{
+		return false;
+	}
+	for (unsigned int i = 0; i < geometry.getNumPrimitiveSets(); ++i)
+	{
+		GLenum mode = geometry.getPrimitiveSet(i)->getMode();
+		if (mode == osg::PrimitiveSet::POINTS || mode == osg::PrimitiveSet::LINES ||
+			mode == osg::PrimitiveSet::LINE_STRIP || mode == osg::PrimitiveSet::LINE_LOOP)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Replaces the geometries of a copy of the model by their simplified version for one level of detail, the
+/// simplified versions of all levels are computed together the first time a geometry is found
+class LevelOfDetailBuilder : public osg::NodeVisitor
+{
+public:
+	/// Constructor
+	/// \param numLevels The number of levels including the full model
+	/// \param ratio The number of triangles of each level relative to the previous level
+	LevelOfDetailBuilder(size_t numLevels, double ratio) :
+		osg::NodeVisitor(osg::NodeVisitor::TRAVERSE_ALL_CHILDREN),
+		m_numLevels(numLevels),
+		m_ratio(ratio),
+		m_level(1)
+	{
+	}
+
+	/// \param level The level built by the next traversal
+	void setLevel(size_t level)
+	{
+		m_level = level;
+	}
+
+	void apply(osg::Geode& geode) override // NOLINT
+	{
+		for (unsigned int i = 0; i < geode.getNumDrawables(); ++i)
+		{
+			osg::Geometry* geometry = geode.getDrawable(i)->asGeometry();
+			if (geometry != nullptr && isSimplifiable(*geometry))
+			{
+				geode.setDrawable(i, getLevels(geometry)[m_level - 1]);
+			}
+		}
+		traverse(geode);
+	}
+
+private:
+	/// \return The simplified versions of a geometry for all the levels after the full model
+	const std::vector<osg::ref_ptr<osg::Geometry>>& getLevels(osg::Geometry* geometry)
+	{
+		auto found = m_levels.find(geometry);
+		if (found != m_levels.end())
+		{
+			return found->second;
+		}
+
+		osg::TriangleIndexFunctor<TriangleCollector> collector;
+		geometry->accept(collector);
+		const osg::Vec3Array& vertices = *static_cast<const osg::Vec3Array*>(geometry->getVertexArray());
+		std::vector<SurgSim::Math::Vector3d> positions;
+		positions.reserve(vertices.size());
+		for (const auto& vertex : vertices)
+		{
+			positions.emplace_back(vertex.x(), vertex.y(), vertex.z());
+		}
+
+		std::vector<osg::ref_ptr<osg::Geometry>>& levels = m_levels[geometry];
+		SurgSim::Graphics::MeshSimplifier simplifier(positions, collector.triangles);
+		double numTriangles = static_cast<double>(collector.triangles.size() / 3);
+		std::vector<unsigned int> triangles;
+		for (size_t level = 1; level < m_numLevels; ++level)
+		{
+			numTriangles *= m_ratio;
+			simplifier.simplify(static_cast<size_t>(numTriangles), &triangles);
+			osg::ref_ptr<osg::Geometry> simplified = new osg::Geometry(*geometry, osg::CopyOp::SHALLOW_COPY);
+			simplified->removePrimitiveSet(0, simplified->getNumPrimitiveSets());
+			simplified->addPrimitiveSet(new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES, triangles.begin(),
+										triangles.end()));
+			levels.push_back(simplified);
+		}
+		return levels;
+	}
+
+	/// The number of levels including the full model
+	size_t m_numLevels;
+
+	/// The number of triangles of each level relative to the previous level
+	double m_ratio;
+
+	/// The level built by the traversal
+	size_t m_level;
+
+	/// The simplified versions of the geometries found so far
+	std::unordered_map<osg::Geometry*, std::vector<osg::ref_ptr<osg::Geometry>>> m_levels;
+};
+
+}
 
 namespace SurgSim
 {
@@ -40,9 +174,40 @@ osg::ref_ptr<osg::Node> OsgModel::getOsgNode()
 	return m_root;
 }
 
+void OsgModel::buildLevelsOfDetail(size_t numLevels, double ratio)
+{
+	SURGSIM_ASSERT(m_root.valid()) << "The model has to be loaded before building its levels of detail.";
+	SURGSIM_ASSERT(numLevels > 0) << "There has to be at least one level of detail.";
+	SURGSIM_ASSERT(ratio > 0.0 && ratio < 1.0) << "The ratio between levels of detail has to be in (0, 1).";
+
+	m_levelsOfDetail.clear();
+	LevelOfDetailBuilder builder(numLevels, ratio);
+	for (size_t level = 1; level < numLevels; ++level)
+	{
+		// The nodes are copied, the drawables are shared until the builder replaces them
+		osg::ref_ptr<osg::Node> root = static_cast<osg::Node*>(m_root->clone(osg::CopyOp::DEEP_COPY_NODES));
+		builder.setLevel(level);
+		root->accept(builder);
+		m_levelsOfDetail.push_back(root);
+	}
+}
+
+size_t OsgModel::getNumLevelsOfDetail() const
+{
+	return m_levelsOfDetail.size() + 1;
+}
+
+osg::ref_ptr<osg::Node> OsgModel::getOsgLevelOfDetail(size_t level)
+{
+	SURGSIM_ASSERT(level < getNumLevelsOfDetail())
+			<< "Level of detail " << level << " does not exist, the model has " << getNumLevelsOfDetail() << " levels.";
+	return (level == 0) ? m_root : m_levelsOfDetail[level - 1];
+}
+
 bool OsgModel::doLoad(const std::string& filePath)
 {
 	m_root = osgDB::readNodeFile(filePath);
+	m_levelsOfDetail.clear();
 	SURGSIM_ASSERT(m_root.valid()) << "Could not load file " << filePath << std::endl;
 	return true;
 }
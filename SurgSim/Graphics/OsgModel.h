@@ -20,6 +20,7 @@
 #include "SurgSim/Framework/Macros.h"
 #include "SurgSim/Graphics/Model.h"
 #include <osg/ref_ptr>
+#include <vector>
 
 namespace osg
 {
@@ -47,11 +48,30 @@ class OsgModel : public Model
 	/// \return the Node that is the root of the loaded model, nullptr if no model is loaded
 	osg::ref_ptr<osg::Node> getOsgNode();
 
+	/// Build simplified versions of the model for drawing it with less detail. Each level is a copy of the scene
+	/// graph of the model in which the triangle geometries are replaced by their simplification, see MeshSimplifier,
+	/// the simplified geometries share the vertex arrays and the state of the original ones. Geometries that are not
+	/// made of triangles are kept in all levels. The levels are kept in the model, so that the representations
+	/// sharing the model share them.
+	/// \param numLevels The number of levels including the full model as level 0
+	/// \param ratio The number of triangles of each level relative to the previous level
+	void buildLevelsOfDetail(size_t numLevels, double ratio = 0.25);
+
+	/// \return The number of levels of detail including the full model, 1 if the levels were not built
+	size_t getNumLevelsOfDetail() const;
+
+	/// \param level The level of detail, less than getNumLevelsOfDetail()
+	/// \return The root of the model at that level of detail, the node of the full model for level 0
+	osg::ref_ptr<osg::Node> getOsgLevelOfDetail(size_t level);
+
 private:
 
 	bool doLoad(const std::string& filePath) override;
 
 	osg::ref_ptr<osg::Node> m_root;
+
+	/// The roots of the levels of detail after the full model
+	std::vector<osg::ref_ptr<osg::Node>> m_levelsOfDetail;
 };
 
 }
@@ -0,0 +1,80 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/OsgModelMatrixUpdater.h"
+
+#include <osg/Camera>
+#include <osg/Matrixf>
+#include <osg/StateSet>
+#include <osg/Transform>
+#include <osg/Uniform>
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+OsgModelMatrixUpdater::OsgModelMatrixUpdater() :
+	osg::NodeVisitor(osg::NodeVisitor::TRAVERSE_ACTIVE_CHILDREN),
+	m_numChanged(0)
+{
+}
+
+void OsgModelMatrixUpdater::update(osg::Node* root, const osg::Matrixd& matrix)
+{
+	m_numChanged = 0;
+	m_matrices.assign(1, matrix);
+	root->traverse(*this);
+}
+
+size_t OsgModelMatrixUpdater::getNumChanged() const
+{
+	return m_numChanged;
+}
+
+void OsgModelMatrixUpdater::apply(osg::Transform& transform)
+{
+	osg::Matrixd matrix = m_matrices.back();
+	transform.computeLocalToWorldMatrix(matrix, this);
+
+	osg::StateSet* stateSet = transform.getStateSet();
+	osg::Uniform* uniform = (stateSet != nullptr) ? stateSet->getUniform("modelMatrix") : nullptr;
+	if (uniform != nullptr)
+	{
+		osg::Matrixf current;
+		uniform->get(current);
+		osg::Matrixf value(matrix);
+		if (value != current)
+		{
+			uniform->set(value);
+			++m_numChanged;
+		}
+		return;
+	}
+
+	m_matrices.push_back(matrix);
+	traverse(transform);
+	m_matrices.pop_back();
+}
+
+void OsgModelMatrixUpdater::apply(osg::Camera& camera)
+{
+	m_matrices.push_back(osg::Matrixd::identity());
+	traverse(camera);
+	m_matrices.pop_back();
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,64 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_OSGMODELMATRIXUPDATER_H
+#define SURGSIM_GRAPHICS_OSGMODELMATRIXUPDATER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <osg/Matrixd>
+#include <osg/NodeVisitor>
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Node visitor that sets the "modelMatrix" uniforms of the transforms of a scene graph in one pass from the top
+/// down, accumulating the matrices of the transforms on the way instead of computing the node path of every
+/// transform. Cameras restart the accumulation, as their matrices are not part of the model matrix.
+/// The first transform with a "modelMatrix" uniform ends its branch, the nodes below it use its uniform. A uniform
+/// is only set when its value changes, so the transforms that did not move do not have their uniform uploaded again.
+class OsgModelMatrixUpdater : public osg::NodeVisitor
+{
+public:
+	/// Constructor
+	OsgModelMatrixUpdater();
+
+	/// Update the uniforms of the transforms below a node
+	/// \param root The node to start from, its own matrix is not used if it is a transform
+	/// \param matrix The model matrix of the root
+	void update(osg::Node* root, const osg::Matrixd& matrix = osg::Matrixd::identity());
+
+	/// \return The number of uniforms whose value changed during the last update
+	size_t getNumChanged() const;
+
+	void apply(osg::Transform& transform) override; // NOLINT
+
+	void apply(osg::Camera& camera) override; // NOLINT
+
+private:
+	/// The accumulated model matrices of the current branch
+	std::vector<osg::Matrixd> m_matrices;
+
+	/// The number of uniforms whose value changed
+	size_t m_numChanged;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_OSGMODELMATRIXUPDATER_H
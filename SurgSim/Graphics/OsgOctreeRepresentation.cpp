@@ -13,6 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
+#include <osg/Geometry>
 #include <osg/PositionAttitudeTransform>
 
 #include "SurgSim/Graphics/OsgOctreeRepresentation.h"
@@ -20,11 +23,38 @@
 #include "SurgSim/DataStructures/OctreeNode.h"
 #include "SurgSim/Framework/Assert.h"
 #include "SurgSim/Framework/Log.h"
-#include "SurgSim/Framework/SharedInstance.h"
 #include "SurgSim/Graphics/OsgConversions.h"
-#include "SurgSim/Graphics/OsgUnitBox.h"
 #include "SurgSim/Math/Vector.h"
 
+namespace
+{
+
+/// Largest depth of the octree that is rasterized at leaf resolution, deeper nodes are drawn with the cell of their
+/// ancestor at this depth. This bounds the number of cells, and keeps the cell ids within the VoxelSurface range.
+const int MaxDepth = 10;
+
+/// \return The depth of the deepest leaf under the node
+int getDepth(const SurgSim::Math::OctreeShape::NodeType& node)
+{
+	int result = 0;
+	if (node.hasChildren())
+	{
+		for (auto child = node.getChildren().cbegin(); child != node.getChildren().cend(); ++child)
+		{
+			result = std::max(result, getDepth(**child) + 1);
+		}
+	}
+	return result;
+}
+
+/// \return The offset of a child in units of the child size, the bits of the child index select x, y and z
+Eigen::Vector3i getChildOffset(size_t index)
+{
+	return Eigen::Vector3i(((index & 1) == 0) ? 0 : 1, ((index & 2) == 0) ? 0 : 1, ((index & 4) == 0) ? 0 : 1);
+}
+
+}
+
 namespace SurgSim
 {
 namespace Graphics
@@ -37,8 +67,12 @@ OsgOctreeRepresentation::OsgOctreeRepresentation(const std::string& name) :
 	Representation(name),
 	OctreeRepresentation(name),
 	OsgRepresentation(name),
-	m_sharedUnitBox(getSharedUnitBox())
+	m_origin(Vector3d::Zero()),
+	m_cellSize(Vector3d::Ones()),
+	m_numCells(1),
+	m_chunkGroup(new osg::Group())
 {
+	m_transform->addChild(m_chunkGroup);
 }
 
 OsgOctreeRepresentation::~OsgOctreeRepresentation()
@@ -47,43 +81,7 @@ OsgOctreeRepresentation::~OsgOctreeRepresentation()
 
 void OsgOctreeRepresentation::doUpdate(double dt)
 {
-}
-
-// An Octree(Node) is traversed in following order (the 2nd OctreeNode, i.e. OctreeNode with "1" is now shown):
-/*
-				________
-			   /3  /  7/|
-			  /-------/ |
-			 /2__/_6_/| |
-			|   |   | |/|
-			|___|___|/|5|
-			|   |   | |/
-			|0__|__4|/
-*/
-void OsgOctreeRepresentation::buildOctree(osg::ref_ptr<osg::PositionAttitudeTransform> transformNode,
-		std::shared_ptr<SurgSim::Math::OctreeShape::NodeType> octree)
-{
-	SURGSIM_ASSERT(!isAwake()) << "OsgOctreeRepresentation::buildOctree() should be called before wake up.";
-	osg::ref_ptr<osg::PositionAttitudeTransform> osgTransform = new osg::PositionAttitudeTransform();
-	transformNode->addChild(osgTransform);
-
-	if (octree->hasChildren())
-	{
-		auto octreeChildren = octree->getChildren();
-		for (int i = 0; i < 8; ++i)
-		{
-			buildOctree(osgTransform, octreeChildren[i]);
-		}
-	}
-	else
-	{
-		osgTransform->addChild(m_sharedUnitBox->getNode());
-		osgTransform->setPosition(toOsg(static_cast<Vector3d>(octree->getBoundingBox().center())));
-		osgTransform->setScale(toOsg(static_cast<Vector3d>(octree->getBoundingBox().sizes())));
-
-		int nodeMask = octree->isActive() ? 0xffffffff : 0;
-		osgTransform->setNodeMask(nodeMask);
-	}
+	updateChunks();
 }
 
 void OsgOctreeRepresentation::setOctreeShape(const std::shared_ptr<SurgSim::Math::Shape>& shape)
@@ -92,9 +90,23 @@ void OsgOctreeRepresentation::setOctreeShape(const std::shared_ptr<SurgSim::Math
 
 	auto octreeShape = std::dynamic_pointer_cast<SurgSim::Math::OctreeShape>(shape);
 	SURGSIM_ASSERT(octreeShape != nullptr) << "OsgOctreeRepresentation can only accept an OctreeShape.";
-	m_octreeShape = octreeShape;
 
-	buildOctree(m_transform, m_octreeShape->getOctree());
+	auto octree = octreeShape->getOctree();
+	int depth = std::min(getDepth(*octree), MaxDepth);
+
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		m_octreeShape = octreeShape;
+		m_nodeVisibility.clear();
+		m_numCells = 1 << depth;
+		m_origin = octree->getBoundingBox().min();
+		m_cellSize = octree->getBoundingBox().sizes() / static_cast<double>(m_numCells);
+
+		m_cells.clear();
+		SurgSim::DataStructures::OctreePath path;
+		rasterize(octree, &path, Eigen::Vector3i::Zero(), m_numCells, true);
+	}
+	updateChunks();
 }
 
 std::shared_ptr<SurgSim::Math::OctreeShape> OsgOctreeRepresentation::getOctreeShape() const
@@ -104,23 +116,151 @@ std::shared_ptr<SurgSim::Math::OctreeShape> OsgOctreeRepresentation::getOctreeSh
 
 void OsgOctreeRepresentation::setNodeVisible(const SurgSim::DataStructures::OctreePath& path, bool visibility)
 {
-	SURGSIM_ASSERT(0 != m_transform->getNumChildren()) << "No Octree held by OsgOctreeRepresentation";
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	SURGSIM_ASSERT(m_octreeShape != nullptr) << "No Octree held by OsgOctreeRepresentation";
 
-	osg::ref_ptr<osg::Group> result = m_transform->getChild(0)->asGroup();
+	std::shared_ptr<SurgSim::Math::OctreeShape::NodeType> node = m_octreeShape->getOctree();
+	std::shared_ptr<SurgSim::Math::OctreeShape::NodeType> drawnNode = node;
+	SurgSim::DataStructures::OctreePath nodePath;
+	Eigen::Vector3i cell = Eigen::Vector3i::Zero();
+	int size = m_numCells;
+	bool isParentVisible = true;
 	for (auto index = std::begin(path); index != std::end(path); ++index)
 	{
-		SURGSIM_ASSERT(result->getNumChildren() > 1) <<
+		SURGSIM_ASSERT(node->hasChildren() && *index < 8) <<
 				"OsgOctreeRepresentation::setNodeVisible(): Invalid OctreePath";
 
-		result = result->getChild(*index)->asGroup();
+		// A node deeper than MaxDepth is drawn as part of the cell of its ancestor at MaxDepth
+		if (size > 1)
+		{
+			isParentVisible = isParentVisible && isNodeVisible(*node, nodePath);
+			size /= 2;
+			cell += getChildOffset(*index) * size;
+			drawnNode = node->getChild(*index);
+			nodePath.push_back(*index);
+		}
+		node = node->getChild(*index);
 	}
-	result->setNodeMask(visibility ? 0xffffffff : 0);
+
+	m_nodeVisibility[path] = visibility;
+	rasterize(drawnNode, &nodePath, cell, size, isParentVisible);
 }
 
-std::shared_ptr<SurgSim::Graphics::OsgUnitBox> OsgOctreeRepresentation::getSharedUnitBox()
+size_t OsgOctreeRepresentation::getNumChunks() const
 {
-	static SurgSim::Framework::SharedInstance<OsgUnitBox> shared;
-	return shared.get();
+	return m_chunks.size();
+}
+
+void OsgOctreeRepresentation::rasterize(const std::shared_ptr<SurgSim::Math::OctreeShape::NodeType>& node,
+										SurgSim::DataStructures::OctreePath* path, const Eigen::Vector3i& cell,
+										int size, bool isParentVisible)
+{
+	bool isVisible = isParentVisible && isNodeVisible(*node, *path);
+	if (isVisible && node->hasChildren() && size == 1)
+	{
+		// The node is at MaxDepth, its cell is filled when any of the leaves under it is visible
+		isVisible = hasVisibleLeaf(*node, path);
+	}
+	if (isVisible && node->hasChildren() && size > 1)
+	{
+		int childSize = size / 2;
+		for (size_t i = 0; i < 8; ++i)
+		{
+			path->push_back(i);
+			rasterize(node->getChild(i), path, cell + getChildOffset(i) * childSize, childSize, true);
+			path->pop_back();
+		}
+	}
+	else
+	{
+		// A hidden node hides its whole box
+		m_cells.setCells(cell, cell + Eigen::Vector3i::Constant(size), isVisible);
+	}
+}
+
+bool OsgOctreeRepresentation::hasVisibleLeaf(const SurgSim::Math::OctreeShape::NodeType& node,
+		SurgSim::DataStructures::OctreePath* path) const
+{
+	if (!isNodeVisible(node, *path))
+	{
+		return false;
+	}
+	if (!node.hasChildren())
+	{
+		return true;
+	}
+
+	bool result = false;
+	for (size_t i = 0; i < 8 && !result; ++i)
+	{
+		path->push_back(i);
+		result = hasVisibleLeaf(*node.getChild(i), path);
+		path->pop_back();
+	}
+	return result;
+}
+
+bool OsgOctreeRepresentation::isNodeVisible(const SurgSim::Math::OctreeShape::NodeType& node,
+		const SurgSim::DataStructures::OctreePath& path) const
+{
+	auto found = m_nodeVisibility.find(path);
+	if (found != m_nodeVisibility.end())
+	{
+		return found->second;
+	}
+	return node.hasChildren() || node.isActive();
+}
+
+void OsgOctreeRepresentation::updateChunks()
+{
+	std::vector<Eigen::Vector3i> dirtyChunks;
+	std::vector<SurgSim::Math::Vector3f> vertices;
+	std::vector<SurgSim::Math::Vector3f> normals;
+	std::vector<unsigned int> triangles;
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	const osg::Vec3 origin = toOsg(m_origin);
+	const osg::Vec3 cellSize = toOsg(m_cellSize);
+	dirtyChunks = m_cells.takeDirtyChunks();
+	for (auto chunk = dirtyChunks.cbegin(); chunk != dirtyChunks.cend(); ++chunk)
+	{
+		m_cells.buildSurface(*chunk, &vertices, &normals, &triangles);
+		auto found = m_chunks.find(*chunk);
+		if (triangles.empty())
+		{
+			if (found != m_chunks.end())
+			{
+				m_chunkGroup->removeChild(found->second);
+				m_chunks.erase(found);
+			}
+			continue;
+		}
+
+		osg::ref_ptr<osg::Vec3Array> osgVertices = new osg::Vec3Array(vertices.size());
+		osg::ref_ptr<osg::Vec3Array> osgNormals = new osg::Vec3Array(normals.size());
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			(*osgVertices)[i] = origin + osg::componentMultiply(toOsg(vertices[i]), cellSize);
+			(*osgNormals)[i] = toOsg(normals[i]);
+		}
+
+		osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry();
+		geometry->setUseDisplayList(false);
+		geometry->setUseVertexBufferObjects(true);
+		geometry->setVertexArray(osgVertices);
+		geometry->setNormalArray(osgNormals, osg::Array::BIND_PER_VERTEX);
+		geometry->addPrimitiveSet(new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES,
+								  triangles.begin(), triangles.end()));
+
+		if (found == m_chunks.end())
+		{
+			osg::ref_ptr<osg::Geode> geode = new osg::Geode();
+			m_chunkGroup->addChild(geode);
+			found = m_chunks.emplace(*chunk, geode).first;
+		}
+		found->second->removeDrawables(0, found->second->getNumDrawables());
+		found->second->addDrawable(geometry);
+	}
 }
 
 }; // Graphics
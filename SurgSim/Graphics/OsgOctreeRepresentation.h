@@ -16,14 +16,19 @@
 #ifndef SURGSIM_GRAPHICS_OSGOCTREEREPRESENTATION_H
 #define SURGSIM_GRAPHICS_OSGOCTREEREPRESENTATION_H
 
+#include <boost/thread/mutex.hpp>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
+#include <osg/Geode>
+#include <osg/Group>
 #include <osg/ref_ptr>
 
 #include "SurgSim/Framework/ObjectFactory.h"
 #include "SurgSim/Graphics/OctreeRepresentation.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
+#include "SurgSim/Graphics/VoxelSurface.h"
 #include "SurgSim/Math/OctreeShape.h"
 
 #if defined(_MSC_VER)
@@ -36,15 +41,17 @@ namespace SurgSim
 namespace Graphics
 {
 
-class OsgUnitBox;
-
 SURGSIM_STATIC_REGISTRATION(OsgOctreeRepresentation);
 
 /// OSG octree representation, implements an OctreeRepresenation using OSG.
 /// Given a OctreeShape, this representation will copy the Octree instead of sharing the Octree (with the OctreeShape).
 /// Wake up call on this representation will fail if no octree is held.
 /// That is to say, setOctree() method MUST be called before WakeUp() to make this representation work properly.
-/// The OSG tree corresponds to the Octree will be built only once at wake up and can not be changed once awake.
+/// The visible leaves are rasterized into cells of the size of the smallest leaf, octrees deeper than 10 levels use
+/// the size of the nodes at depth 10 and fill a cell when any of the leaves inside it is visible. The exposed faces
+/// of these cells are merged into large rectangles and drawn as one geometry per cubic chunk of cells. Every chunk
+/// has its own bounding box for culling, and setNodeVisible() only causes the chunks whose cells changed to be
+/// rebuilt.
 class OsgOctreeRepresentation : public OctreeRepresentation, public OsgRepresentation
 {
 public:
@@ -65,26 +72,67 @@ class OsgOctreeRepresentation : public OctreeRepresentation, public OsgRepresent
 	std::shared_ptr<SurgSim::Math::OctreeShape> getOctreeShape() const override;
 
 	/// Mark the OctreeNode visible/invisible in the given a OctreePath (typedef-ed in OctreeNode.h).
+	/// A leaf is drawn when it and all its ancestors are visible, initially the active leaves are visible.
 	/// \param path An OctreePath, giving the path leads to the OctreeNode whose visibility to be changed.
 	/// \param visibility Whether or not the OctreeNode specified by 'path' is visible or not.
 	void setNodeVisible(const SurgSim::DataStructures::OctreePath& path, bool visibility) override;
 
-private:
-	/// Draw the Octree associated with this OSG representation.
-	/// \param parentTransformNode The osg::PositionAttitudeTransform node under which either the octreeNode or its
-	///                            children will be drawn.
-	/// \param octree The octree to be drawn.
-	void buildOctree(osg::ref_ptr<osg::PositionAttitudeTransform> parentTransformNode,
-					 std::shared_ptr<SurgSim::Math::OctreeShape::NodeType> octree);
+	/// \return The number of chunks that currently have a geometry
+	size_t getNumChunks() const;
 
-	/// Shared unit box, so that the geometry can be instanced rather than having multiple copies.
-	std::shared_ptr<OsgUnitBox> m_sharedUnitBox;
+private:
+	/// Fill the cells of the visible leaves of a node, and empty the cells of the others
+	/// \param node The octree node
+	/// \param [in,out] path The path to the node, restored when the function returns
+	/// \param cell The first cell covered by the node
+	/// \param size The number of cells along each side of the node
+	/// \param isParentVisible Whether all the ancestors of the node are visible
+	void rasterize(const std::shared_ptr<SurgSim::Math::OctreeShape::NodeType>& node,
+				   SurgSim::DataStructures::OctreePath* path, const Eigen::Vector3i& cell, int size,
+				   bool isParentVisible);
+
+	/// \param node The octree node
+	/// \param [in,out] path The path to the node, restored when the function returns
+	/// \return Whether any leaf under the node is drawn, assuming all the ancestors of the node are visible
+	bool hasVisibleLeaf(const SurgSim::Math::OctreeShape::NodeType& node,
+						SurgSim::DataStructures::OctreePath* path) const;
+
+	/// \param node The octree node
+	/// \param path The path to the node
+	/// \return Whether the node itself is visible
+	bool isNodeVisible(const SurgSim::Math::OctreeShape::NodeType& node,
+					   const SurgSim::DataStructures::OctreePath& path) const;
+
+	/// Rebuild the geometry of the chunks whose cells changed
+	void updateChunks();
 
 	/// The OctreeShape whose Octree will be visualized.
 	std::shared_ptr<SurgSim::Math::OctreeShape> m_octreeShape;
 
-	/// Returns the shared unit box
-	static std::shared_ptr<OsgUnitBox> getSharedUnitBox();
+	/// Protects the cells and the node visibility, setNodeVisible() can be called from any thread
+	mutable boost::mutex m_mutex;
+
+	/// The visibility of the nodes that was set by setNodeVisible()
+	std::unordered_map<SurgSim::DataStructures::OctreePath, bool, SurgSim::DataStructures::OctreePathHash>
+		m_nodeVisibility;
+
+	/// The cells of the visible leaves
+	VoxelSurface m_cells;
+
+	/// The position of the first cell
+	SurgSim::Math::Vector3d m_origin;
+
+	/// The size of a cell, the size of the smallest leaf
+	SurgSim::Math::Vector3d m_cellSize;
+
+	/// The number of cells along each side of the octree
+	int m_numCells;
+
+	/// The parent of the chunk geodes
+	osg::ref_ptr<osg::Group> m_chunkGroup;
+
+	/// The geode of each chunk that has a surface
+	std::unordered_map<Eigen::Vector3i, osg::ref_ptr<osg::Geode>, VoxelSurface::ChunkHash> m_chunks;
 };
 
 }; // Graphics
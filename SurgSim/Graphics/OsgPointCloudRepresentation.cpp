@@ -13,14 +13,62 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include <osg/Geode>
 #include <osg/PositionAttitudeTransform>
 #include <osg/StateAttribute>
 
 #include "SurgSim/DataStructures/EmptyData.h"
 #include "SurgSim/DataStructures/Vertices.h"
+#include "SurgSim/Graphics/Material.h"
 #include "SurgSim/Graphics/OsgConversions.h"
 #include "SurgSim/Graphics/OsgPointCloudRepresentation.h"
+#include "SurgSim/Graphics/Program.h"
+
+namespace
+{
+
+/// Computes the bounding box of the points that are drawn only, the arrays keep their size when the number of
+/// points goes down
+class PointCloudBoundingBoxCallback : public osg::Drawable::ComputeBoundingBoxCallback
+{
+public:
+	PointCloudBoundingBoxCallback()
+	{
+	}
+
+	PointCloudBoundingBoxCallback(const PointCloudBoundingBoxCallback& other, const osg::CopyOp& copyOp) :
+		osg::Drawable::ComputeBoundingBoxCallback(other, copyOp)
+	{
+	}
+
+	META_Object(SurgSim, PointCloudBoundingBoxCallback);
+
+	osg::BoundingBox computeBound(const osg::Drawable& drawable) const override
+	{
+		osg::BoundingBox box;
+		const osg::Geometry* geometry = drawable.asGeometry();
+		if (geometry == nullptr || geometry->getNumPrimitiveSets() == 0)
+		{
+			return box;
+		}
+		auto vertices = dynamic_cast<const osg::Vec3Array*>(geometry->getVertexArray());
+		auto drawArrays = dynamic_cast<const osg::DrawArrays*>(geometry->getPrimitiveSet(0));
+		if (vertices != nullptr && drawArrays != nullptr)
+		{
+			size_t end = std::min(static_cast<size_t>(vertices->size()),
+								  static_cast<size_t>(drawArrays->getFirst() + drawArrays->getCount()));
+			for (size_t i = static_cast<size_t>(drawArrays->getFirst()); i < end; ++i)
+			{
+				box.expandBy((*vertices)[i]);
+			}
+		}
+		return box;
+	}
+};
+
+}
 
 namespace SurgSim
 {
@@ -34,15 +82,20 @@ OsgPointCloudRepresentation::OsgPointCloudRepresentation(const std::string& name
 	Representation(name),
 	PointCloudRepresentation(name),
 	OsgRepresentation(name),
-	m_color(1.0, 1.0, 1.0, 1.0)
+	m_color(1.0, 1.0, 1.0, 1.0),
+	m_isPointSizeProgramEnabled(false)
 {
 	m_vertices = std::make_shared<PointCloud>();
 
 	osg::Geode* geode = new osg::Geode();
 	m_geometry = new osg::Geometry();
 	m_vertexData = new osg::Vec3Array;
+	m_sizeData = new osg::FloatArray;
+	m_colorData = new osg::Vec4Array;
+	m_overallColor = new osg::Vec4Array(1);
 
 	m_geometry->setVertexArray(m_vertexData);
+	m_geometry->setComputeBoundingBoxCallback(new PointCloudBoundingBoxCallback);
 
 	setColor(m_color);
 
@@ -67,6 +120,11 @@ OsgPointCloudRepresentation::~OsgPointCloudRepresentation()
 
 void OsgPointCloudRepresentation::doUpdate(double dt)
 {
+	if (updateFromBuffers())
+	{
+		return;
+	}
+
 	DataStructures::VerticesPlain vertices;
 
 	// #performance
@@ -89,17 +147,12 @@ void OsgPointCloudRepresentation::updateGeometry(const DataStructures::VerticesP
 	auto& vertices = vertexData.getVertices();
 	size_t count = vertices.size();
 
-	// Check for size change in number of vertices
-	if (count != static_cast<size_t>(m_drawArrays->getCount()))
+	// The array keeps its size when the number of vertices goes down
+	if (count > m_vertexData->size())
 	{
-		if (count != m_vertexData->size())
-		{
-			m_vertexData->resize(count);
-		}
-
-		m_drawArrays->set(osg::PrimitiveSet::POINTS, 0, count);
-		m_drawArrays->dirty();
+		m_vertexData->resize(count);
 	}
+	setNumPoints(count);
 
 	// #performance
 	// Calculate the bounding box while iterating over the vertices, this will save osg time in the update traversal
@@ -115,6 +168,81 @@ void OsgPointCloudRepresentation::updateGeometry(const DataStructures::VerticesP
 	m_geometry->dirtyDisplayList();
 }
 
+bool OsgPointCloudRepresentation::updateFromBuffers()
+{
+	size_t numPoints;
+	if (m_buffers.take(PointCloudBuffers::ATTRIBUTE_SIZE, m_sizeData.get(), &numPoints, m_point->getSize()))
+	{
+		if (m_geometry->getVertexAttribArray(POINT_SIZE_VERTEX_ATTRIBUTE_ID) != m_sizeData.get())
+		{
+			m_geometry->setVertexAttribArray(POINT_SIZE_VERTEX_ATTRIBUTE_ID, m_sizeData, osg::Array::BIND_PER_VERTEX);
+		}
+		m_sizeData->dirty();
+	}
+	updatePointSizeMode();
+
+	if (m_buffers.take(PointCloudBuffers::ATTRIBUTE_COLOR, m_colorData.get(), &numPoints, toOsg(m_color)))
+	{
+		if (m_geometry->getColorArray() != m_colorData.get())
+		{
+			m_geometry->setColorArray(m_colorData, osg::Array::BIND_PER_VERTEX);
+		}
+		m_colorData->dirty();
+	}
+
+	bool isWritten = m_buffers.isWritten(PointCloudBuffers::ATTRIBUTE_POSITION);
+	if (m_buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, m_vertexData.get(), &numPoints))
+	{
+		setNumPoints(numPoints);
+		m_vertexData->dirty();
+		m_geometry->dirtyBound();
+	}
+	return isWritten;
+}
+
+void OsgPointCloudRepresentation::updatePointSizeMode()
+{
+	// The program sets the size of the points only if it reads the per point sizes, the point size of the whole
+	// cloud is used otherwise
+	bool isEnabled = false;
+	if (m_geometry->getVertexAttribArray(POINT_SIZE_VERTEX_ATTRIBUTE_ID) == m_sizeData.get())
+	{
+		auto material = getMaterial();
+		auto program = (material != nullptr) ? material->getProgram() : nullptr;
+		int location;
+		isEnabled = program != nullptr && program->getAttributeLocation("pointSize", &location) &&
+					location == POINT_SIZE_VERTEX_ATTRIBUTE_ID;
+	}
+
+	if (isEnabled != m_isPointSizeProgramEnabled)
+	{
+		m_geometry->getOrCreateStateSet()->setMode(GL_VERTEX_PROGRAM_POINT_SIZE,
+				isEnabled ? osg::StateAttribute::ON : osg::StateAttribute::OFF);
+		m_isPointSizeProgramEnabled = isEnabled;
+	}
+}
+
+void OsgPointCloudRepresentation::setNumPoints(size_t count)
+{
+	// The per point attributes need an entry for every point that is drawn, the ones that were not streamed keep
+	// the color and size of the whole cloud
+	if (m_geometry->getColorArray() == m_colorData.get() && m_colorData->size() < count)
+	{
+		m_colorData->resize(count, toOsg(m_color));
+	}
+	if (m_geometry->getVertexAttribArray(POINT_SIZE_VERTEX_ATTRIBUTE_ID) == m_sizeData.get() &&
+		m_sizeData->size() < count)
+	{
+		m_sizeData->resize(count, m_point->getSize());
+	}
+
+	if (count != static_cast<size_t>(m_drawArrays->getCount()))
+	{
+		m_drawArrays->setCount(static_cast<GLsizei>(count));
+		m_drawArrays->dirty();
+	}
+}
+
 std::shared_ptr<PointCloud> OsgPointCloudRepresentation::getVertices() const
 {
 	return m_vertices;
@@ -132,15 +260,13 @@ double OsgPointCloudRepresentation::getPointSize() const
 
 void OsgPointCloudRepresentation::setColor(const SurgSim::Math::Vector4d& color)
 {
-	// Set the color of the particles to one single color by default
-	osg::Vec4Array* colors = dynamic_cast<osg::Vec4Array*>(m_geometry->getColorArray());
-	if (colors == nullptr)
+	// Set the color of the particles to one single color, this replaces the per point colors
+	(*m_overallColor)[0] = SurgSim::Graphics::toOsg(color);
+	m_overallColor->dirty();
+	if (m_geometry->getColorArray() != m_overallColor.get())
 	{
-		colors = new osg::Vec4Array(1);
-		m_geometry->setColorArray(colors);
-		m_geometry->setColorBinding(osg::Geometry::BIND_OVERALL);
+		m_geometry->setColorArray(m_overallColor, osg::Array::BIND_OVERALL);
 	}
-	(*colors)[0] = SurgSim::Graphics::toOsg(color);
 	m_color = color;
 }
 
@@ -89,6 +89,15 @@ class OsgPointCloudRepresentation : public PointCloudRepresentation, public OsgR
 	/// OSG vertex data for updating
 	osg::ref_ptr<osg::Vec3Array> m_vertexData;
 
+	/// OSG per point sizes, streamed through updatePointSizes()
+	osg::ref_ptr<osg::FloatArray> m_sizeData;
+
+	/// OSG per point colors, streamed through updatePointColors()
+	osg::ref_ptr<osg::Vec4Array> m_colorData;
+
+	/// OSG color of all the points
+	osg::ref_ptr<osg::Vec4Array> m_overallColor;
+
 	/// OSG Geometry node holding the data
 	osg::ref_ptr<osg::Geometry> m_geometry;
 
@@ -101,9 +110,24 @@ class OsgPointCloudRepresentation : public PointCloudRepresentation, public OsgR
 	/// Color backing variable
 	SurgSim::Math::Vector4d m_color;
 
+	/// Whether the program of the material sets the size of the points from the per point sizes
+	bool m_isPointSizeProgramEnabled;
+
 	/// Update the geometry
 	/// \param vertices new vertices
 	void updateGeometry(const DataStructures::VerticesPlain& vertices);
+
+	/// Copy the point data that changed in the single precision buffers into the geometry
+	/// \return true if positions have been written into the buffers, the vertices are not used then
+	bool updateFromBuffers();
+
+	/// Let the program set the size of the points if per point sizes are streamed and the program of the material
+	/// binds "pointSize" to POINT_SIZE_VERTEX_ATTRIBUTE_ID
+	void updatePointSizeMode();
+
+	/// Set the number of points that are drawn
+	/// \param count The number of points
+	void setNumPoints(size_t count);
 };
 
 #if defined(_MSC_VER)
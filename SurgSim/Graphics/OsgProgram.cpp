@@ -146,6 +146,23 @@ bool OsgProgram::isGlobalScope() const
 	return m_globalScope;
 }
 
+void OsgProgram::setAttributeLocation(const std::string& name, int location)
+{
+	m_program->addBindAttribLocation(name, static_cast<GLuint>(location));
+}
+
+bool OsgProgram::getAttributeLocation(const std::string& name, int* location) const
+{
+	const osg::Program::AttribBindingList& bindings = m_program->getAttribBindingList();
+	auto binding = bindings.find(name);
+	if (binding == bindings.end())
+	{
+		return false;
+	}
+	*location = static_cast<int>(binding->second);
+	return true;
+}
+
 bool OsgProgram::hasShader(int shaderType) const
 {
 	bool result = true;
@@ -81,6 +81,10 @@ class OsgProgram : public Program
 
 	bool isGlobalScope() const override;
 
+	void setAttributeLocation(const std::string& name, int location) override;
+
+	bool getAttributeLocation(const std::string& name, int* location) const override;
+
 	/// \return the OSG program attribute
 	osg::ref_ptr<osg::Program> getOsgProgram() const;
 
@@ -183,5 +183,21 @@ void OsgRepresentation::addUniform(std::shared_ptr<UniformBase> uniform)
 	m_transform->getOrCreateStateSet()->addUniform(osgUniform->getOsgUniform());
 }
 
+InstanceShape OsgRepresentation::getInstanceShape() const
+{
+	return INSTANCE_SHAPE_NONE;
+}
+
+osg::Vec4f OsgRepresentation::getInstanceScale() const
+{
+	return osg::Vec4f(1.0f, 1.0f, 1.0f, 0.0f);
+}
+
+bool OsgRepresentation::isInstanceable() const
+{
+	return getInstanceShape() != INSTANCE_SHAPE_NONE && m_material == nullptr && !m_drawAsWireFrame &&
+		   m_tangentGenerator == nullptr && m_transform->getStateSet() == nullptr;
+}
+
 }; // Graphics
 }; // SurgSim
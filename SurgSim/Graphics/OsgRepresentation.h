@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include <osg/Vec4f>
 #include <osg/ref_ptr>
 
 #include "SurgSim/Graphics/Representation.h"
@@ -44,9 +45,21 @@ class UniformBase;
 ///@{
 static const int TANGENT_VERTEX_ATTRIBUTE_ID = 6;
 static const int BITANGENT_VERTEX_ATTRIBUTE_ID = 7;
+static const int POINT_SIZE_VERTEX_ATTRIBUTE_ID = 8;
 static const int DIFFUSE_TEXTURE_UNIT = 0;
 static const int NORMAL_TEXTURE_UNIT = 1;
 static const int SHADOW_TEXTURE_UNIT = 8;
+
+/// The shared unit shapes that representations can be drawn with by an OsgInstanceBatch
+enum InstanceShape
+{
+	INSTANCE_SHAPE_NONE = -1,
+	INSTANCE_SHAPE_BOX = 0,
+	INSTANCE_SHAPE_CAPSULE,
+	INSTANCE_SHAPE_CYLINDER,
+	INSTANCE_SHAPE_SPHERE,
+	INSTANCE_SHAPE_COUNT
+};
 ///@}
 
 /// Base OSG implementation of a graphics representation.
@@ -98,6 +111,18 @@ class OsgRepresentation : public virtual Representation
 
 	void addUniform(std::shared_ptr<SurgSim::Graphics::UniformBase> uniform);
 
+	/// \return The unit shape that the representation can be drawn with by an OsgInstanceBatch,
+	/// INSTANCE_SHAPE_NONE if it needs its own geometry
+	virtual InstanceShape getInstanceShape() const;
+
+	/// \return The scale of the unit shape when drawn by an OsgInstanceBatch, w moves the two halves of the shape
+	/// apart along y
+	virtual osg::Vec4f getInstanceScale() const;
+
+	/// \return true if the representation can currently be drawn by an OsgInstanceBatch, i.e. it has an instance
+	/// shape and none of the state that only its own node can carry: material, uniforms, wire frame or tangents
+	bool isInstanceable() const;
+
 protected:
 	virtual void doUpdate(double dt);
 
@@ -34,6 +34,8 @@ OsgSceneryRepresentation::OsgSceneryRepresentation(const std::string& name) :
 	OsgRepresentation(name),
 	SceneryRepresentation(name),
 	m_osgNode(nullptr),
+	m_numLevelsOfDetail(1),
+	m_levelOfDetail(new OsgLevelOfDetail()),
 	m_fileName()
 {
 }
@@ -55,20 +57,11 @@ void OsgSceneryRepresentation::setModel(std::shared_ptr<SurgSim::Framework::Asse
 	auto osgModel = std::dynamic_pointer_cast<OsgModel>(model);
 
 	SURGSIM_ASSERT(model == nullptr || osgModel != nullptr) << "OsgSceneryRepresentation expects an OsgModel.";
-
-	if (m_osgNode.valid())
-	{
-		m_transform->removeChild(m_osgNode);
-	}
-	if (osgModel != nullptr)
-	{
-		SURGSIM_ASSERT(osgModel->getOsgNode().valid())
-				<< "OsgSceneryRepresentation was passed a model that did not have any geometry assigned to it.";
-		m_osgNode = osgModel->getOsgNode();
-		m_transform->addChild(m_osgNode);
-	}
+	SURGSIM_ASSERT(osgModel == nullptr || osgModel->getOsgNode().valid())
+			<< "OsgSceneryRepresentation was passed a model that did not have any geometry assigned to it.";
 
 	m_model = osgModel;
+	updateModelNode();
 	updateTangents();
 }
 
@@ -77,10 +70,70 @@ std::shared_ptr<Model> OsgSceneryRepresentation::getModel() const
 	return m_model;
 }
 
+void OsgSceneryRepresentation::setLevelsOfDetail(size_t numLevels)
+{
+	SURGSIM_ASSERT(numLevels > 0) << "There has to be at least one level of detail.";
+	if (numLevels != m_numLevelsOfDetail)
+	{
+		m_numLevelsOfDetail = numLevels;
+		updateModelNode();
+		updateTangents();
+	}
+}
+
+size_t OsgSceneryRepresentation::getLevelsOfDetail() const
+{
+	return m_numLevelsOfDetail;
+}
+
+void OsgSceneryRepresentation::setLevelOfDetailPixelSize(double pixelSize)
+{
+	m_levelOfDetail->setPixelSize(pixelSize);
+}
+
+double OsgSceneryRepresentation::getLevelOfDetailPixelSize() const
+{
+	return m_levelOfDetail->getPixelSize();
+}
+
 osg::ref_ptr<osg::Node> OsgSceneryRepresentation::getModelNode() const
 {
 	return m_osgNode;
 }
 
+void OsgSceneryRepresentation::updateModelNode()
+{
+	if (m_osgNode.valid())
+	{
+		m_transform->removeChild(m_osgNode);
+		m_osgNode = nullptr;
+	}
+	if (m_model == nullptr)
+	{
+		return;
+	}
+
+	if (m_numLevelsOfDetail < 2)
+	{
+		m_osgNode = m_model->getOsgNode();
+	}
+	else
+	{
+		// The levels are kept in the model, representations sharing it only build them once
+		if (m_model->getNumLevelsOfDetail() != m_numLevelsOfDetail)
+		{
+			m_model->buildLevelsOfDetail(m_numLevelsOfDetail);
+		}
+		osg::ref_ptr<osg::Group> levels = new osg::Group;
+		levels->setCullCallback(m_levelOfDetail);
+		for (size_t level = 0; level < m_numLevelsOfDetail; ++level)
+		{
+			levels->addChild(m_model->getOsgLevelOfDetail(level));
+		}
+		m_osgNode = levels;
+	}
+	m_transform->addChild(m_osgNode);
+}
+
 };	// namespace Graphics
 };	// namespace SurgSim
\ No newline at end of file
@@ -16,9 +16,11 @@
 #ifndef SURGSIM_GRAPHICS_OSGSCENERYREPRESENTATION_H
 #define SURGSIM_GRAPHICS_OSGSCENERYREPRESENTATION_H
 
+#include "SurgSim/Graphics/OsgLevelOfDetail.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
 #include "SurgSim/Graphics/SceneryRepresentation.h"
 
+#include <osg/Group>
 #include <osg/Node>
 
 #if defined(_MSC_VER)
@@ -35,6 +37,7 @@ class Asset;
 namespace Graphics
 {
 class Model;
+class OsgModel;
 
 SURGSIM_STATIC_REGISTRATION(OsgSceneryRepresentation);
 
@@ -56,15 +59,34 @@ class OsgSceneryRepresentation:	public OsgRepresentation, public SceneryRepresen
 
 	std::shared_ptr<Model> getModel() const override;
 
-	/// \return the osg node that carries the information of the loaded model
+	void setLevelsOfDetail(size_t numLevels) override;
+
+	size_t getLevelsOfDetail() const override;
+
+	void setLevelOfDetailPixelSize(double pixelSize) override;
+
+	double getLevelOfDetailPixelSize() const override;
+
+	/// \return the osg node that carries the information of the loaded model, the group of its levels of detail if
+	/// 	there are several
 	osg::ref_ptr<osg::Node> getModelNode() const;
 
 private:
 	bool doInitialize() override;
+
+	/// Attach the node of the model, or the group of its levels of detail, to the transform
+	void updateModelNode();
+
 	/// A osg::Node to hold the objet loaded from file
 	osg::ref_ptr<osg::Node> m_osgNode;
 
-	std::shared_ptr<Model> m_model;
+	std::shared_ptr<OsgModel> m_model;
+
+	/// The number of levels of detail used to draw the model
+	size_t m_numLevelsOfDetail;
+
+	/// The cull callback choosing among the levels of detail
+	osg::ref_ptr<OsgLevelOfDetail> m_levelOfDetail;
 
 	/// Name of the object file to be loaded
 	std::string m_fileName;
@@ -31,6 +31,7 @@
 #include <osgAnimation/StackedQuaternionElement>
 #include <osgAnimation/StackedTranslateElement>
 #include <osgAnimation/UpdateBone>
+#include <osgAnimation/VertexInfluence>
 #include <osgDB/ReadFile>
 
 #include "SurgSim/Framework/ApplicationData.h"
@@ -38,6 +39,8 @@
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/ObjectFactory.h"
 #include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Graphics/CpuSkinning.h"
+#include "SurgSim/Graphics/OsgMatrixConversions.h"
 #include "SurgSim/Graphics/OsgModel.h"
 #include "SurgSim/Graphics/OsgRigidTransformConversions.h"
 #include "SurgSim/Graphics/OsgProgram.h"
@@ -49,15 +52,19 @@ struct SurgSim::Graphics::BoneData
 	osg::ref_ptr<osgAnimation::Bone> osgBone;
 	osg::ref_ptr<osgAnimation::StackedQuaternionElement> osgRotation;
 	osg::ref_ptr<osgAnimation::StackedTranslateElement> osgTranslation;
+	osg::ref_ptr<osgAnimation::UpdateMatrixTransform> osgUpdate;
 	SurgSim::Math::RigidTransform3d neutralPose;
 	SurgSim::Math::RigidTransform3d pose;
+	size_t index;
 
 	BoneData() :
 		osgBone(nullptr),
 		osgRotation(nullptr),
 		osgTranslation(nullptr),
+		osgUpdate(nullptr),
 		neutralPose(SurgSim::Math::RigidTransform3d::Identity()),
-		pose(SurgSim::Math::RigidTransform3d::Identity())
+		pose(SurgSim::Math::RigidTransform3d::Identity()),
+		index(0)
 	{
 	}
 };
@@ -129,6 +136,23 @@ class BoneBuilder : public osg::NodeVisitor
 			// Push these transformations onto the stack so we can manipulate them
 			callback->getStackedTransforms().push_back(newBone->second.osgRotation);
 			callback->getStackedTransforms().push_back(newBone->second.osgTranslation);
+			newBone->second.osgUpdate = callback;
+
+			// The traversal is depth first, the parent of a bone is found before the bone
+			int parent = -1;
+			const osg::NodePath& path = getNodePath();
+			for (auto node = path.rbegin() + 1; node != path.rend(); ++node)
+			{
+				osgAnimation::Bone* parentBone = dynamic_cast<osgAnimation::Bone*>(*node);
+				if (parentBone != nullptr)
+				{
+					parent = static_cast<int>(m_bones->at(parentBone->getName()).index);
+					break;
+				}
+			}
+			newBone->second.index = m_boneNames.size();
+			m_boneNames.push_back(bone->getName());
+			m_parents.push_back(parent);
 		}
 
 		// Setup for hardware skinning.
@@ -160,6 +184,18 @@ class BoneBuilder : public osg::NodeVisitor
 		return m_rootTransform;
 	}
 
+	/// \return The names of the bones found, parents before children.
+	const std::vector<std::string>& getBoneNames() const
+	{
+		return m_boneNames;
+	}
+
+	/// \return The index of the parent of each bone found, -1 for the roots.
+	const std::vector<int>& getParents() const
+	{
+		return m_parents;
+	}
+
 private:
 	/// The root bone of the skeleton where the global transform is set.
 	osg::ref_ptr<osg::MatrixTransform> m_rootTransform;
@@ -169,6 +205,42 @@ class BoneBuilder : public osg::NodeVisitor
 
 	/// The bone data from the skeleton.
 	std::shared_ptr<std::map<std::string, SurgSim::Graphics::BoneData>>  m_bones;
+
+	/// The names of the bones found, parents before children.
+	std::vector<std::string> m_boneNames;
+
+	/// The index of the parent of each bone found.
+	std::vector<int> m_parents;
+};
+
+/// Visitor finding the first skinned geometry of a tree
+class RigGeometryFinder : public osg::NodeVisitor
+{
+public:
+	/// Constructor
+	RigGeometryFinder() :
+		NodeVisitor(NodeVisitor::TRAVERSE_ALL_CHILDREN)
+	{
+	}
+
+	virtual void apply(osg::Geode& geode) override // NOLINT
+	{
+		for (unsigned int i = 0; i < geode.getNumDrawables() && m_rigGeometry == nullptr; ++i)
+		{
+			m_rigGeometry = dynamic_cast<osgAnimation::RigGeometry*>(geode.getDrawable(i));
+		}
+		traverse(geode);
+	}
+
+	/// \return The skinned geometry found, nullptr if there is none.
+	osg::ref_ptr<osgAnimation::RigGeometry> getRigGeometry()
+	{
+		return m_rigGeometry;
+	}
+
+private:
+	/// The skinned geometry found.
+	osg::ref_ptr<osgAnimation::RigGeometry> m_rigGeometry;
 };
 
 };
@@ -322,19 +394,94 @@ std::map<std::string, SurgSim::Math::RigidTransform3d> OsgSkeletonRepresentation
 	return std::move(neutralBonePoses);
 }
 
-void OsgSkeletonRepresentation::doUpdate(double dt)
+std::vector<std::string> OsgSkeletonRepresentation::getBoneNames() const
 {
+	boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+	return m_boneNames;
+}
+
+BonePalette::Palette OsgSkeletonRepresentation::getBonePalette() const
+{
+	boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+	return m_palette.getPalette();
+}
+
+bool OsgSkeletonRepresentation::buildCpuSkinning(CpuSkinning* skinning) const
+{
+	SURGSIM_ASSERT(isInitialized()) << "The bones are only known once " << getName() << " is initialized.";
+
+	RigGeometryFinder finder;
+	m_skeleton->accept(finder);
+	osg::ref_ptr<osgAnimation::RigGeometry> rigGeometry = finder.getRigGeometry();
+	if (rigGeometry == nullptr || rigGeometry->getSourceGeometry() == nullptr ||
+		rigGeometry->getInfluenceMap() == nullptr)
+	{
+		return false;
+	}
+	osg::Geometry* geometry = rigGeometry->getSourceGeometry();
+	auto vertices = dynamic_cast<osg::Vec3Array*>(geometry->getVertexArray());
+	auto normals = dynamic_cast<osg::Vec3Array*>(geometry->getNormalArray());
+	if (vertices == nullptr)
+	{
+		return false;
+	}
+
+	std::vector<Math::Vector3f> positions;
+	positions.reserve(vertices->size());
+	for (const auto& vertex : *vertices)
+	{
+		positions.emplace_back(vertex.x(), vertex.y(), vertex.z());
+	}
+	std::vector<Math::Vector3f> bindNormals;
+	if (normals != nullptr && normals->size() == vertices->size())
+	{
+		bindNormals.reserve(normals->size());
+		for (const auto& normal : *normals)
+		{
+			bindNormals.emplace_back(normal.x(), normal.y(), normal.z());
+		}
+	}
+
+	// Gather the bones of each vertex, padded with null weights up to the largest number of bones on a vertex
+	std::vector<std::vector<std::pair<unsigned int, float>>> influences(vertices->size());
+	size_t bonesPerVertex = 0;
 	{
 		boost::shared_lock<boost::shared_mutex> lock(m_mutex);
-		for (auto& bone : *m_bones)
+		for (const auto& influence : *rigGeometry->getInfluenceMap())
+		{
+			auto bone = m_bones->find(influence.first);
+			if (bone == m_bones->end())
+			{
+				continue;
+			}
+			for (const auto& indexWeight : influence.second)
+			{
+				auto& vertexInfluences = influences[indexWeight.first];
+				vertexInfluences.emplace_back(static_cast<unsigned int>(bone->second.index), indexWeight.second);
+				bonesPerVertex = std::max(bonesPerVertex, vertexInfluences.size());
+			}
+		}
+	}
+	std::vector<unsigned int> boneIds(bonesPerVertex * vertices->size(), 0);
+	std::vector<float> weights(bonesPerVertex * vertices->size(), 0.0f);
+	for (size_t vertex = 0; vertex < influences.size(); ++vertex)
+	{
+		for (size_t i = 0; i < influences[vertex].size(); ++i)
 		{
-			std::pair<osg::Quat, osg::Vec3d> pose = toOsg(bone.second.pose * bone.second.neutralPose);
-			bone.second.osgRotation->setQuaternion(pose.first);
-			bone.second.osgTranslation->setTranslate(pose.second);
+			boneIds[bonesPerVertex * vertex + i] = influences[vertex][i].first;
+			weights[bonesPerVertex * vertex + i] = influences[vertex][i].second;
 		}
 	}
 
-	// Update the position of the rest of the bones.
+	skinning->setBindPose(positions, bindNormals, bonesPerVertex, boneIds, weights);
+	return true;
+}
+
+void OsgSkeletonRepresentation::doUpdate(double dt)
+{
+	updateBones();
+
+	// Update the skinned geometries with the new bone matrices.
 	m_base->accept(*m_updateVisitor);
 	++m_frameCount;
 	m_updateVisitor->setTraversalNumber(m_frameCount);
@@ -383,6 +530,8 @@ bool OsgSkeletonRepresentation::doInitialize()
 		return false;
 	}
 
+	updateBones();
+
 	// Setup the transform updater for the skeleton.
 	m_updateVisitor = new osgUtil::UpdateVisitor();
 	m_frameCount = 0;
@@ -395,6 +544,31 @@ bool OsgSkeletonRepresentation::doInitialize()
 	return true;
 }
 
+void OsgSkeletonRepresentation::updateBones()
+{
+	boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+	for (size_t i = 0; i < m_orderedBones.size(); ++i)
+	{
+		BoneData& bone = *m_orderedBones[i];
+		std::pair<osg::Quat, osg::Vec3d> pose = toOsg(bone.pose * bone.neutralPose);
+		bone.osgRotation->setQuaternion(pose.first);
+		bone.osgTranslation->setTranslate(pose.second);
+		osgAnimation::StackedTransform& transforms = bone.osgUpdate->getStackedTransforms();
+		transforms.update();
+		m_localTransforms[i] = fromOsg(transforms.getMatrix());
+	}
+
+	// All the bones at once, instead of one update callback per bone
+	m_palette.update(m_localTransforms);
+	const BonePalette::Transforms& skeletonTransforms = m_palette.getSkeletonTransforms();
+	for (size_t i = 0; i < m_orderedBones.size(); ++i)
+	{
+		osgAnimation::Bone* bone = m_orderedBones[i]->osgBone.get();
+		bone->setMatrix(toOsg(m_localTransforms[i]));
+		bone->setMatrixInSkeletonSpace(toOsg(skeletonTransforms[i]));
+	}
+}
+
 bool OsgSkeletonRepresentation::setupBones()
 {
 	boost::unique_lock<boost::shared_mutex> lock(m_mutex);
@@ -403,6 +577,21 @@ bool OsgSkeletonRepresentation::setupBones()
 	builder.traverse(*m_skeleton.get());
 	m_base = builder.getRootTransform();
 
+	m_boneNames = builder.getBoneNames();
+	m_orderedBones.clear();
+	BonePalette::Transforms inverseBindMatrices;
+	for (const auto& name : m_boneNames)
+	{
+		BoneData& bone = m_bones->at(name);
+		m_orderedBones.push_back(&bone);
+		inverseBindMatrices.push_back(fromOsg(bone.osgBone->getInvBindMatrixInSkeletonSpace()));
+
+		// The matrices of the bones are computed in updateBones(), not by their update callbacks
+		bone.osgBone->setUpdateCallback(nullptr);
+	}
+	m_palette.setBones(builder.getParents(), inverseBindMatrices);
+	m_localTransforms.assign(m_boneNames.size(), SurgSim::Math::Matrix44d::Identity());
+
 	for (auto bone = m_bones->begin(); bone != m_bones->end();)
 	{
 		if (bone->second.osgBone == nullptr)
@@ -22,7 +22,9 @@
 #include <osg/ref_ptr>
 #include <osgUtil/UpdateVisitor>
 #include <string>
+#include <vector>
 
+#include "SurgSim/Graphics/BonePalette.h"
 #include "SurgSim/Graphics/OsgRepresentation.h"
 #include "SurgSim/Graphics/SkeletonRepresentation.h"
 
@@ -43,10 +45,13 @@ namespace Graphics
 {
 
 struct BoneData;
+class CpuSkinning;
 class OsgModel;
 
 /// Skeleton representation is used to move a mesh based on the movements of
 /// pre-selected control points (bones).
+/// All the bone matrices are computed in one pass over the bones, ordered parents first, into a BonePalette, and
+/// written to the osgAnimation bones from there. The palette can also skin meshes on the CPU, see buildCpuSkinning().
 class OsgSkeletonRepresentation : public OsgRepresentation, public SkeletonRepresentation
 {
 public:
@@ -77,6 +82,19 @@ class OsgSkeletonRepresentation : public OsgRepresentation, public SkeletonRepre
 
 	SurgSim::Math::RigidTransform3d getNeutralBonePose(const std::string& name) const override;
 
+	/// \return The names of the bones, in the order of the bone palette, empty until initialized
+	std::vector<std::string> getBoneNames() const;
+
+	/// \return The skinning matrices of the bones, in the order of getBoneNames(), as of the last update
+	BonePalette::Palette getBonePalette() const;
+
+	/// Set up CPU skinning with the bind pose and bone weights of the skinned mesh of the model, so that it can be
+	/// skinned with getBonePalette(), e.g. for a collision mesh following the skeleton. The mesh is expected in the
+	/// coordinates of the skeleton.
+	/// \param [out] skinning The skinning to set up
+	/// \return false if the model does not contain a skinned mesh
+	bool buildCpuSkinning(CpuSkinning* skinning) const;
+
 protected:
 	void setNeutralBonePoses(const std::map<std::string, SurgSim::Math::RigidTransform3d>& poses) override;
 
@@ -90,6 +108,9 @@ class OsgSkeletonRepresentation : public OsgRepresentation, public SkeletonRepre
 	/// Setup the bones with the model and skinning shader
 	bool setupBones();
 
+	/// Compute the matrices of all the bones from their poses
+	void updateBones();
+
 	/// The logger for this class.
 	std::shared_ptr<SurgSim::Framework::Logger> m_logger;
 
@@ -99,6 +120,18 @@ class OsgSkeletonRepresentation : public OsgRepresentation, public SkeletonRepre
 	/// The named map of the bones in this skeleton.
 	std::shared_ptr<std::map<std::string, BoneData>> m_bones;
 
+	/// The bones in the order of the palette, parents before children.
+	std::vector<BoneData*> m_orderedBones;
+
+	/// The names of the bones in the order of the palette.
+	std::vector<std::string> m_boneNames;
+
+	/// The transform of each bone relative to its parent, in the order of the palette.
+	BonePalette::Transforms m_localTransforms;
+
+	/// The bone matrices.
+	BonePalette m_palette;
+
 	/// Mutex to access m_bones safely.
 	mutable boost::shared_mutex m_mutex;
 
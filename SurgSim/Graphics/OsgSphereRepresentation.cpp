@@ -57,5 +57,16 @@ std::shared_ptr<OsgUnitSphere> OsgSphereRepresentation::getSharedUnitSphere()
 	return shared.get();
 }
 
+InstanceShape OsgSphereRepresentation::getInstanceShape() const
+{
+	return INSTANCE_SHAPE_SPHERE;
+}
+
+osg::Vec4f OsgSphereRepresentation::getInstanceScale() const
+{
+	float radius = static_cast<float>(getRadius());
+	return osg::Vec4f(radius, radius, radius, 0.0f);
+}
+
 }; // Graphics
 }; // SurgSim
\ No newline at end of file
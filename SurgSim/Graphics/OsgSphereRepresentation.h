@@ -56,6 +56,10 @@ class OsgSphereRepresentation : public OsgRepresentation, public SphereRepresent
 	/// \return	Radius of the sphere
 	virtual double getRadius() const;
 
+	InstanceShape getInstanceShape() const override;
+
+	osg::Vec4f getInstanceScale() const override;
+
 private:
 	/// Shared unit sphere, so that the geometry can be instanced rather than having multiple copies.
 	std::shared_ptr<OsgUnitSphere> m_sharedUnitSphere;
@@ -0,0 +1,65 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_INL_H
+#define SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_INL_H
+
+#include <algorithm>
+#include <cstring>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+template <class Array>
+bool PointCloudBuffers::take(Attribute attribute, Array* array, size_t* numPoints,
+							 const typename Array::value_type& fill)
+{
+	const size_t numComponents = getNumComponents(attribute);
+	SURGSIM_ASSERT(sizeof((*array)[0]) == numComponents * sizeof(float))
+			<< "The elements of the array need to be made of " << numComponents << " floats.";
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	Buffer& buffer = m_buffers[attribute];
+	if (buffer.dirtyBegin >= buffer.dirtyEnd && !buffer.isResized)
+	{
+		return false;
+	}
+
+	if (static_cast<size_t>(array->size()) < m_capacity)
+	{
+		array->resize(m_capacity, fill);
+	}
+	if (buffer.dirtyBegin < buffer.dirtyEnd)
+	{
+		std::memcpy(reinterpret_cast<float*>(&(*array)[0]) + numComponents * buffer.dirtyBegin,
+					buffer.values.data() + numComponents * buffer.dirtyBegin,
+					numComponents * (buffer.dirtyEnd - buffer.dirtyBegin) * sizeof(float));
+	}
+	*numPoints = buffer.numPoints;
+
+	buffer.dirtyBegin = 0;
+	buffer.dirtyEnd = 0;
+	buffer.isResized = false;
+	return true;
+}
+
+};  // namespace Graphics
+};  // namespace SurgSim
+
+#endif  // SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_INL_H
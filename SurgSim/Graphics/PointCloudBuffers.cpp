@@ -0,0 +1,112 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/PointCloudBuffers.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+const size_t PointCloudBuffers::ALL_POINTS = std::numeric_limits<size_t>::max();
+
+PointCloudBuffers::PointCloudBuffers() :
+	m_capacity(0)
+{
+	for (auto& buffer : m_buffers)
+	{
+		buffer.numPoints = 0;
+		buffer.dirtyBegin = 0;
+		buffer.dirtyEnd = 0;
+		buffer.isResized = false;
+		buffer.isWritten = false;
+	}
+}
+
+size_t PointCloudBuffers::getNumComponents(Attribute attribute)
+{
+	static const size_t numComponents[ATTRIBUTE_COUNT] = {3, 1, 4};
+	SURGSIM_ASSERT(attribute >= 0 && attribute < ATTRIBUTE_COUNT) << "Invalid point attribute " << attribute << ".";
+	return numComponents[attribute];
+}
+
+void PointCloudBuffers::reserve(size_t numPoints)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	reserveLocked(numPoints);
+}
+
+size_t PointCloudBuffers::getCapacity() const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_capacity;
+}
+
+void PointCloudBuffers::write(Attribute attribute, const float* values, size_t numPoints, size_t dirtyBegin,
+							  size_t dirtyEnd)
+{
+	const size_t numComponents = getNumComponents(attribute);
+	dirtyEnd = std::min(dirtyEnd, numPoints);
+	SURGSIM_ASSERT(dirtyBegin <= dirtyEnd) << "The dirty range [" << dirtyBegin << ", " << dirtyEnd
+										   << ") is not within the " << numPoints << " points.";
+	SURGSIM_ASSERT(values != nullptr || dirtyBegin == dirtyEnd) << "No values to read the dirty range from.";
+
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	Buffer& buffer = m_buffers[attribute];
+	reserveLocked(numPoints);
+	if (dirtyBegin < dirtyEnd)
+	{
+		std::copy(values + numComponents * dirtyBegin, values + numComponents * dirtyEnd,
+				  buffer.values.begin() + numComponents * dirtyBegin);
+		if (buffer.dirtyBegin < buffer.dirtyEnd)
+		{
+			buffer.dirtyBegin = std::min(buffer.dirtyBegin, dirtyBegin);
+			buffer.dirtyEnd = std::max(buffer.dirtyEnd, dirtyEnd);
+		}
+		else
+		{
+			buffer.dirtyBegin = dirtyBegin;
+			buffer.dirtyEnd = dirtyEnd;
+		}
+	}
+	if (numPoints != buffer.numPoints)
+	{
+		buffer.numPoints = numPoints;
+		buffer.isResized = true;
+	}
+	buffer.isWritten = true;
+}
+
+bool PointCloudBuffers::isWritten(Attribute attribute) const
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_buffers[attribute].isWritten;
+}
+
+void PointCloudBuffers::reserveLocked(size_t numPoints)
+{
+	if (numPoints > m_capacity)
+	{
+		// Grow geometrically, so that a slowly growing number of points does not reallocate every time
+		m_capacity = std::max(numPoints, m_capacity + m_capacity / 2);
+		for (size_t attribute = 0; attribute < ATTRIBUTE_COUNT; ++attribute)
+		{
+			m_buffers[attribute].values.resize(getNumComponents(static_cast<Attribute>(attribute)) * m_capacity);
+		}
+	}
+}
+
+};  // namespace Graphics
+};  // namespace SurgSim
@@ -0,0 +1,133 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_H
+#define SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_H
+
+#include <array>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Single precision point data handed over from a producer thread to the renderer, one buffer per attribute.
+/// Producers write only the range of points that changed, the renderer copies only the ranges that changed since it
+/// last took the data, straight into its own arrays. The buffers keep their capacity when the number of points goes
+/// down, and reserve() can make them large enough up front, so that neither the buffers nor the arrays of the
+/// renderer are reallocated while the number of points fluctuates, e.g. for particles that are emitted and die.
+class PointCloudBuffers
+{
+public:
+	/// The attributes of the points
+	enum Attribute
+	{
+		ATTRIBUTE_POSITION = 0,
+		ATTRIBUTE_SIZE,
+		ATTRIBUTE_COLOR,
+		ATTRIBUTE_COUNT
+	};
+
+	/// Marks the end of the dirty range as the end of the points
+	static const size_t ALL_POINTS;
+
+	/// Constructor
+	PointCloudBuffers();
+
+	/// \param attribute The attribute
+	/// \return The number of floats per point for the attribute, 3 for positions, 1 for sizes and 4 for colors
+	static size_t getNumComponents(Attribute attribute);
+
+	/// Make room for a number of points in all the buffers
+	/// \param numPoints The number of points
+	void reserve(size_t numPoints);
+
+	/// \return The number of points the buffers can hold without being reallocated
+	size_t getCapacity() const;
+
+	/// Producer side, write the values of an attribute
+	/// \param attribute The attribute
+	/// \param values The values of all the points, getNumComponents() floats per point, only the points in the
+	///        dirty range are read
+	/// \param numPoints The number of points
+	/// \param dirtyBegin The first point that changed
+	/// \param dirtyEnd One past the last point that changed, clamped to numPoints
+	void write(Attribute attribute, const float* values, size_t numPoints, size_t dirtyBegin = 0,
+			   size_t dirtyEnd = ALL_POINTS);
+
+	/// \param attribute The attribute
+	/// \return true if the attribute has ever been written
+	bool isWritten(Attribute attribute) const;
+
+	/// Consumer side, copy the values of an attribute that changed since the last call. The array is grown to the
+	/// capacity of the buffers if it is smaller, so it is not reallocated when the number of points changes.
+	/// \tparam Array Contiguous array type with value_type, size(), resize() and operator[], whose elements are
+	///         made of getNumComponents() packed floats, e.g. an osg::Vec3Array for the positions
+	/// \param attribute The attribute
+	/// \param [in,out] array The values of all the points
+	/// \param [out] numPoints The number of points
+	/// \param fill The value of the elements the array is grown by, until the points are written
+	/// \return true if any value or the number of points changed since the last call, array and numPoints are not
+	///         changed otherwise
+	template <class Array>
+	bool take(Attribute attribute, Array* array, size_t* numPoints,
+			  const typename Array::value_type& fill = typename Array::value_type());
+
+private:
+	/// The data of one attribute
+	struct Buffer
+	{
+		/// The values, getNumComponents() floats per point
+		std::vector<float> values;
+
+		/// The number of points
+		size_t numPoints;
+
+		/// The range of points that changed since the last take()
+		size_t dirtyBegin;
+		size_t dirtyEnd;
+
+		/// Whether the number of points changed since the last take()
+		bool isResized;
+
+		/// Whether the attribute has ever been written
+		bool isWritten;
+	};
+
+	/// Make room for a number of points, the lock has to be held
+	/// \param numPoints The number of points
+	void reserveLocked(size_t numPoints);
+
+	/// The buffers of all the attributes
+	std::array<Buffer, ATTRIBUTE_COUNT> m_buffers;
+
+	/// The number of points the buffers can hold
+	size_t m_capacity;
+
+	/// The mutex between the producer and the consumer
+	mutable boost::mutex m_mutex;
+};
+
+};  // namespace Graphics
+};  // namespace SurgSim
+
+#include "SurgSim/Graphics/PointCloudBuffers-inl.h"
+
+#endif  // SURGSIM_GRAPHICS_POINTCLOUDBUFFERS_H
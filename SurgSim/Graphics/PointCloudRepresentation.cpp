@@ -49,5 +49,28 @@ void PointCloudRepresentation::updateVertices(DataStructures::VerticesPlain&& ve
 	m_locker.set(std::move(vertices));
 }
 
+void PointCloudRepresentation::reservePoints(size_t numPoints)
+{
+	m_buffers.reserve(numPoints);
+}
+
+void PointCloudRepresentation::updateVertices(const float* positions, size_t numPoints, size_t dirtyBegin,
+											  size_t dirtyEnd)
+{
+	m_buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions, numPoints, dirtyBegin, dirtyEnd);
+}
+
+void PointCloudRepresentation::updatePointSizes(const float* sizes, size_t numPoints, size_t dirtyBegin,
+												size_t dirtyEnd)
+{
+	m_buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, sizes, numPoints, dirtyBegin, dirtyEnd);
+}
+
+void PointCloudRepresentation::updatePointColors(const float* colors, size_t numPoints, size_t dirtyBegin,
+												 size_t dirtyEnd)
+{
+	m_buffers.write(PointCloudBuffers::ATTRIBUTE_COLOR, colors, numPoints, dirtyBegin, dirtyEnd);
+}
+
 }; // Graphics
 }; // SurgSim
@@ -21,6 +21,7 @@
 #include "SurgSim/DataStructures/EmptyData.h"
 #include "SurgSim/DataStructures/Vertices.h"
 #include "SurgSim/Framework/LockedContainer.h"
+#include "SurgSim/Graphics/PointCloudBuffers.h"
 #include "SurgSim/Graphics/Representation.h"
 #include "SurgSim/Math/MathConvert.h"
 #include "SurgSim/Math/Vector.h"
@@ -66,9 +67,47 @@ class PointCloudRepresentation : public virtual Representation
 
 	void updateVertices(DataStructures::VerticesPlain&& vertices);
 
+	/// Make room for a number of points in the single precision buffers, so that neither they nor the arrays of the
+	/// renderer are reallocated as long as the number of points stays below it
+	/// \param numPoints The number of points
+	void reservePoints(size_t numPoints);
+
+	/// Set the positions of the points in single precision, they are copied straight into the vertex array of the
+	/// renderer without going through the vertices. Once positions have been set this way they replace the
+	/// vertices.
+	/// \param positions The x, y and z of each point, only the points in [dirtyBegin, dirtyEnd) are read
+	/// \param numPoints The number of points
+	/// \param dirtyBegin The first point that changed since the last call
+	/// \param dirtyEnd One past the last point that changed since the last call, all the points by default
+	/// \note Points that are added have to be part of the dirty range
+	void updateVertices(const float* positions, size_t numPoints, size_t dirtyBegin = 0,
+						size_t dirtyEnd = PointCloudBuffers::ALL_POINTS);
+
+	/// Set the size of each point, in pixels, replacing the point size of the whole cloud. The sizes are passed to
+	/// the program of the material in the vertex attribute POINT_SIZE_VERTEX_ATTRIBUTE_ID, e.g. to
+	/// Shaders/point_cloud.vert. They are only used if the program binds "pointSize" to that location with
+	/// Program::setAttributeLocation(), the point size of the whole cloud is used otherwise.
+	/// \param sizes The size of each point, only the points in [dirtyBegin, dirtyEnd) are read
+	/// \param numPoints The number of points
+	/// \param dirtyBegin The first point that changed since the last call
+	/// \param dirtyEnd One past the last point that changed since the last call, all the points by default
+	void updatePointSizes(const float* sizes, size_t numPoints, size_t dirtyBegin = 0,
+						  size_t dirtyEnd = PointCloudBuffers::ALL_POINTS);
+
+	/// Set the color of each point, replacing the color of the whole cloud until setColor() is called
+	/// \param colors The red, green, blue and alpha of each point, only the points in [dirtyBegin, dirtyEnd) are read
+	/// \param numPoints The number of points
+	/// \param dirtyBegin The first point that changed since the last call
+	/// \param dirtyEnd One past the last point that changed since the last call, all the points by default
+	void updatePointColors(const float* colors, size_t numPoints, size_t dirtyBegin = 0,
+						   size_t dirtyEnd = PointCloudBuffers::ALL_POINTS);
+
 protected:
 
 	Framework::LockedContainer<DataStructures::VerticesPlain> m_locker;
+
+	/// The single precision point data, written by any thread and taken by the renderer
+	PointCloudBuffers m_buffers;
 };
 
 }; // Graphics
@@ -120,6 +120,18 @@ class Program
 	/// \return	true if global scope, false if not.
 	virtual bool isGlobalScope() const = 0;
 
+	/// Binds a generic vertex attribute of the shaders to a location, the geometry has to provide the data of the
+	/// attribute at that location, e.g. TANGENT_VERTEX_ATTRIBUTE_ID.
+	/// \param	name	Name of the attribute in the shader source code
+	/// \param	location	Index of the vertex attribute
+	virtual void setAttributeLocation(const std::string& name, int location) = 0;
+
+	/// Gets the location an attribute is bound to
+	/// \param	name	Name of the attribute in the shader source code
+	/// \param [out]	location	Index of the vertex attribute, unchanged if the attribute is not bound
+	/// \return	true if the attribute is bound to a location, otherwise false.
+	virtual bool getAttributeLocation(const std::string& name, int* location) const = 0;
+
 };
 
 inline Program::~Program()
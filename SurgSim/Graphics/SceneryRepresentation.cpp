@@ -30,6 +30,10 @@ SceneryRepresentation::SceneryRepresentation(const std::string& name) : Represen
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SceneryRepresentation, std::shared_ptr<SurgSim::Framework::Asset>,
 									  Model , getModel, setModel);
 	SURGSIM_ADD_SETTER(SceneryRepresentation, std::string, ModelFileName, loadModel);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SceneryRepresentation, size_t, LevelsOfDetail, getLevelsOfDetail,
+									  setLevelsOfDetail);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(SceneryRepresentation, double, LevelOfDetailPixelSize,
+									  getLevelOfDetailPixelSize, setLevelOfDetailPixelSize);
 }
 
 
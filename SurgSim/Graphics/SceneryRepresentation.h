@@ -52,6 +52,23 @@ class SceneryRepresentation : public virtual Representation
 
 	/// \return the current model.
 	virtual std::shared_ptr<Model> getModel() const = 0;
+
+	/// Sets the number of levels of detail used to draw the model, the simplified levels are built once per model
+	/// and kept with it, each keeps a quarter of the triangles of the previous level. Default is 1, i.e. the full
+	/// model is always drawn.
+	/// \param numLevels The number of levels including the full model
+	virtual void setLevelsOfDetail(size_t numLevels) = 0;
+
+	/// \return The number of levels of detail including the full model
+	virtual size_t getLevelsOfDetail() const = 0;
+
+	/// Sets the size of the model on the screen below which the first simplified level is drawn, every following
+	/// level is drawn once the size halves again
+	/// \param pixelSize The size of the bounding sphere on the screen, in pixels
+	virtual void setLevelOfDetailPixelSize(double pixelSize) = 0;
+
+	/// \return The size of the model on the screen below which the first simplified level is drawn
+	virtual double getLevelOfDetailPixelSize() const = 0;
 };
 
 };  // namespace Graphics
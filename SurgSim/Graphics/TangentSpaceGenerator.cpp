@@ -20,11 +20,13 @@
 #include <osg/Vec3>
 #include <osg/Array>
 
-namespace
+namespace SurgSim
+{
+namespace Graphics
 {
 
-void orthogonalize(const osg::Vec3& normal, osg::Vec4* tangent, osg::Vec4* bitangent,
-				   bool createOrthonormalBasis = false)
+void orthogonalizeTangentSpace(const osg::Vec3& normal, osg::Vec4* tangent, osg::Vec4* bitangent,
+							   bool createOrthonormalBasis)
 {
 	SURGSIM_ASSERT(tangent != nullptr) << "Tanget parameter can't be nullptr.";
 	SURGSIM_ASSERT(bitangent != nullptr) << "BiTangent parameter can't be nullptr.";
@@ -57,13 +59,6 @@ void orthogonalize(const osg::Vec3& normal, osg::Vec4* tangent, osg::Vec4* bitan
 	}
 }
 
-}
-
-namespace SurgSim
-{
-namespace Graphics
-{
-
 GenerateTangentSpaceTriangleIndexFunctor::GenerateTangentSpaceTriangleIndexFunctor() :
 	m_vertexArray(nullptr),
 	m_normalArray(nullptr),
@@ -119,10 +114,10 @@ void GenerateTangentSpaceTriangleIndexFunctor::orthogonalize()
 
 	for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
 	{
-		::orthogonalize((*m_normalArray)[vertexIndex],
-						 &(*m_tangentArray)[vertexIndex],
-						 &(*m_bitangentArray)[vertexIndex],
-						 m_createOrthonormalBasis);
+		orthogonalizeTangentSpace((*m_normalArray)[vertexIndex],
+								  &(*m_tangentArray)[vertexIndex],
+								  &(*m_bitangentArray)[vertexIndex],
+								  m_createOrthonormalBasis);
 	}
 }
 
@@ -25,6 +25,15 @@ namespace SurgSim
 namespace Graphics
 {
 
+/// Orthogonalize and normalize the accumulated tangent space basis vectors of one vertex against its normal
+/// \param normal The normal of the vertex
+/// \param [in,out] tangent The tangent of the vertex
+/// \param [in,out] bitangent The bitangent of the vertex
+/// \param createOrthonormalBasis Whether or not to create a fully orthonormal basis; otherwise, each tangent is
+///        separately orthonormal to the normal, but not to each other
+void orthogonalizeTangentSpace(const osg::Vec3& normal, osg::Vec4* tangent, osg::Vec4* bitangent,
+							   bool createOrthonormalBasis);
+
 /// Triangle index functor which calculates the tangent space basis vectors for the vertices
 /// of a geometry from texture coordinates
 class GenerateTangentSpaceTriangleIndexFunctor
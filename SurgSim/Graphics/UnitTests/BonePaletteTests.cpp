@@ -0,0 +1,103 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include "SurgSim/Graphics/BonePalette.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::makeRigidTransform;
+using SurgSim::Math::makeRotationQuaternion;
+using SurgSim::Math::Matrix44d;
+using SurgSim::Math::Vector3d;
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(BonePaletteTests, SetBones)
+{
+	BonePalette palette;
+	EXPECT_EQ(0u, palette.getNumBones());
+
+	BonePalette::Transforms inverseBindMatrices(3, Matrix44d::Identity());
+	EXPECT_ANY_THROW(palette.setBones(std::vector<int>(2, -1), inverseBindMatrices));
+	EXPECT_ANY_THROW(palette.setBones({-1, 2, 0}, inverseBindMatrices));
+	EXPECT_ANY_THROW(palette.setBones({-1, 1, 0}, inverseBindMatrices));
+
+	ASSERT_NO_THROW(palette.setBones({-1, 0, 0}, inverseBindMatrices));
+	EXPECT_EQ(3u, palette.getNumBones());
+	EXPECT_EQ(-1, palette.getParent(0));
+	EXPECT_EQ(0, palette.getParent(2));
+	ASSERT_EQ(3u, palette.getPalette().size());
+	EXPECT_TRUE(palette.getPalette()[1].isIdentity());
+
+	EXPECT_ANY_THROW(palette.update(BonePalette::Transforms(2, Matrix44d::Identity())));
+}
+
+TEST(BonePaletteTests, Update)
+{
+	// A chain of three bones, and a second root
+	std::vector<int> parents = {-1, 0, 1, -1};
+	BonePalette::Transforms bindLocal;
+	bindLocal.push_back(makeRigidTransform(makeRotationQuaternion(0.3, Vector3d::UnitZ().eval()),
+										   Vector3d(1.0, 0.0, 0.0)).matrix());
+	bindLocal.push_back(makeRigidTransform(makeRotationQuaternion(-0.7, Vector3d::UnitY().eval()),
+										   Vector3d(0.0, 2.0, 0.0)).matrix());
+	bindLocal.push_back(makeRigidTransform(makeRotationQuaternion(1.1, Vector3d::UnitX().eval()),
+										   Vector3d(0.0, 0.0, 3.0)).matrix());
+	bindLocal.push_back(makeRigidTransform(makeRotationQuaternion(0.2, Vector3d::UnitX().eval()),
+										   Vector3d(4.0, 0.0, 0.0)).matrix());
+
+	BonePalette::Transforms bindSkeleton(4);
+	bindSkeleton[0] = bindLocal[0];
+	bindSkeleton[1] = bindSkeleton[0] * bindLocal[1];
+	bindSkeleton[2] = bindSkeleton[1] * bindLocal[2];
+	bindSkeleton[3] = bindLocal[3];
+	BonePalette::Transforms inverseBindMatrices;
+	for (const auto& transform : bindSkeleton)
+	{
+		inverseBindMatrices.push_back(transform.inverse());
+	}
+
+	BonePalette palette;
+	palette.setBones(parents, inverseBindMatrices);
+
+	// In the bind pose the vertices do not move
+	palette.update(bindLocal);
+	for (size_t bone = 0; bone < 4; ++bone)
+	{
+		EXPECT_TRUE(bindSkeleton[bone].isApprox(palette.getSkeletonTransforms()[bone]));
+		EXPECT_TRUE(palette.getPalette()[bone].isIdentity(1e-5f));
+	}
+
+	// Moving the middle bone moves its child, not its parent nor the other root
+	BonePalette::Transforms local = bindLocal;
+	Matrix44d move = makeRigidTransform(makeRotationQuaternion(0.5, Vector3d::UnitZ().eval()),
+										Vector3d(0.1, 0.2, 0.3)).matrix();
+	local[1] = bindLocal[1] * move;
+	palette.update(local);
+	EXPECT_TRUE(palette.getPalette()[0].isIdentity(1e-5f));
+	EXPECT_TRUE(palette.getPalette()[3].isIdentity(1e-5f));
+	Matrix44d expected = bindSkeleton[1] * move * bindSkeleton[1].inverse();
+	EXPECT_TRUE(palette.getPalette()[1].isApprox(expected.cast<float>(), 1e-5f));
+	EXPECT_TRUE(palette.getPalette()[2].isApprox(expected.cast<float>(), 1e-5f));
+	EXPECT_TRUE((bindSkeleton[1] * move * bindLocal[2]).isApprox(palette.getSkeletonTransforms()[2]));
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
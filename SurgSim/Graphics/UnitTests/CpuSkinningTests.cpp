@@ -0,0 +1,150 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "SurgSim/DataStructures/Vertices.h"
+#include "SurgSim/Graphics/CpuSkinning.h"
+#include "SurgSim/Math/Quaternion.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::makeRigidTransform;
+using SurgSim::Math::makeRotationQuaternion;
+using SurgSim::Math::Matrix44f;
+using SurgSim::Math::Vector3d;
+using SurgSim::Math::Vector3f;
+
+namespace
+{
+
+/// \return A rigid transform as a skinning matrix
+Matrix44f makeMatrix(double angle, const Vector3d& axis, const Vector3d& translation)
+{
+	return makeRigidTransform(makeRotationQuaternion(angle, axis), translation).matrix().cast<float>();
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(CpuSkinningTests, SetBindPose)
+{
+	CpuSkinning skinning;
+	EXPECT_EQ(0u, skinning.getNumVertices());
+
+	std::vector<Vector3f> positions(2, Vector3f::Zero());
+	EXPECT_ANY_THROW(skinning.setBindPose(positions, std::vector<Vector3f>(1), 1, {0, 0}, {1.0f, 1.0f}));
+	EXPECT_ANY_THROW(skinning.setBindPose(positions, {}, 2, {0, 0}, {1.0f, 1.0f}));
+	EXPECT_ANY_THROW(skinning.setBindPose(positions, {}, 1, {0, 0}, {1.0f}));
+
+	ASSERT_NO_THROW(skinning.setBindPose(positions, {}, 1, {0, 3}, {1.0f, 1.0f}));
+	EXPECT_EQ(2u, skinning.getNumVertices());
+	EXPECT_EQ(1u, skinning.getBonesPerVertex());
+
+	// The second vertex refers to the fourth bone
+	EXPECT_ANY_THROW(skinning.update(BonePalette::Palette(3, Matrix44f::Identity())));
+	EXPECT_NO_THROW(skinning.update(BonePalette::Palette(4, Matrix44f::Identity())));
+	EXPECT_TRUE(skinning.getNormals().empty());
+}
+
+TEST(CpuSkinningTests, Blending)
+{
+	std::vector<Vector3f> positions;
+	positions.push_back(Vector3f(1.0f, 0.0f, 0.0f));
+	positions.push_back(Vector3f(0.0f, 1.0f, 0.0f));
+	positions.push_back(Vector3f(0.0f, 0.0f, 1.0f));
+	std::vector<Vector3f> normals = positions;
+
+	// The first vertex follows the first bone, the second the second bone, the third is between them
+	std::vector<unsigned int> boneIds = {0, 1, 1, 0, 0, 1};
+	std::vector<float> weights = {1.0f, 0.0f, 1.0f, 0.0f, 0.5f, 0.5f};
+	CpuSkinning skinning;
+	skinning.setBindPose(positions, normals, 2, boneIds, weights);
+
+	BonePalette::Palette palette;
+	palette.push_back(makeMatrix(M_PI_2, Vector3d::UnitZ(), Vector3d(1.0, 2.0, 3.0)));
+	palette.push_back(makeMatrix(-0.4, Vector3d::UnitX(), Vector3d(-1.0, 0.0, 0.5)));
+	skinning.update(palette);
+
+	const std::vector<Vector3f>& skinned = skinning.getPositions();
+	const std::vector<Vector3f>& skinnedNormals = skinning.getNormals();
+	ASSERT_EQ(3u, skinned.size());
+	ASSERT_EQ(3u, skinnedNormals.size());
+	EXPECT_TRUE(skinned[0].isApprox(Vector3f(1.0f, 3.0f, 3.0f)));
+	EXPECT_TRUE(skinnedNormals[0].isApprox(Vector3f(0.0f, 1.0f, 0.0f)));
+	EXPECT_TRUE(skinned[1].isApprox((palette[1] * Math::Vector4f(0.0f, 1.0f, 0.0f, 1.0f)).head<3>()));
+	EXPECT_TRUE(skinnedNormals[1].isApprox(palette[1].block<3, 3>(0, 0) * normals[1]));
+
+	// Blending the transformed positions, as the skinning shader does
+	Math::Vector4f position(0.0f, 0.0f, 1.0f, 1.0f);
+	Math::Vector4f expected = 0.5f * (palette[0] * position) + 0.5f * (palette[1] * position);
+	EXPECT_TRUE(skinned[2].isApprox(expected.head<3>()));
+	Vector3f expectedNormal = 0.5f * (palette[0].block<3, 3>(0, 0) * normals[2]) +
+							  0.5f * (palette[1].block<3, 3>(0, 0) * normals[2]);
+	EXPECT_TRUE(skinnedNormals[2].isApprox(expectedNormal));
+
+	DataStructures::VerticesPlain vertices;
+	EXPECT_ANY_THROW(skinning.copyPositions(&vertices));
+	for (int i = 0; i < 3; ++i)
+	{
+		vertices.addVertex(DataStructures::VerticesPlain::VertexType(Vector3d::Zero()));
+	}
+	skinning.copyPositions(&vertices);
+	EXPECT_TRUE(vertices.getVertexPosition(0).isApprox(Vector3d(1.0, 3.0, 3.0), 1e-6));
+}
+
+TEST(CpuSkinningTests, LargeMesh)
+{
+	// Enough vertices to be spread over the thread pool
+	const size_t numVertices = 50000;
+	std::vector<Vector3f> positions;
+	std::vector<unsigned int> boneIds;
+	std::vector<float> weights;
+	for (size_t i = 0; i < numVertices; ++i)
+	{
+		float height = static_cast<float>(i) / static_cast<float>(numVertices);
+		positions.push_back(Vector3f(std::cos(0.01f * i), std::sin(0.01f * i), height));
+		boneIds.push_back(0);
+		boneIds.push_back(1);
+		weights.push_back(1.0f - height);
+		weights.push_back(height);
+	}
+	CpuSkinning skinning;
+	skinning.setBindPose(positions, positions, 2, boneIds, weights);
+
+	BonePalette::Palette palette;
+	palette.push_back(Matrix44f::Identity());
+	palette.push_back(makeMatrix(0.8, Vector3d::UnitZ(), Vector3d(0.0, 0.0, 1.0)));
+	skinning.update(palette);
+
+	ASSERT_EQ(numVertices, skinning.getPositions().size());
+	for (size_t i = 0; i < numVertices; i += 997)
+	{
+		Math::Vector4f position;
+		position << positions[i], 1.0f;
+		Math::Vector4f expected = weights[2 * i] * position + weights[2 * i + 1] * (palette[1] * position);
+		EXPECT_TRUE(skinning.getPositions()[i].isApprox(expected.head<3>()));
+	}
+	EXPECT_TRUE(skinning.getPositions().back().isApprox((palette[1] * Math::Vector4f(
+					positions.back().x(), positions.back().y(), positions.back().z(), 1.0f)).head<3>(), 1e-4f));
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,208 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SurgSim/DataStructures/Vertices.h"
+#include "SurgSim/Graphics/CurveTessellator.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::DataStructures::VerticesPlain;
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+
+VerticesPlain makeHelix(size_t numPoints)
+{
+	VerticesPlain result;
+	for (size_t i = 0; i < numPoints; ++i)
+	{
+		double angle = 0.5 * static_cast<double>(i);
+		result.addVertex(VerticesPlain::VertexType(Vector3d(std::cos(angle), std::sin(angle), 0.1 * angle)));
+	}
+	return result;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(CurveTessellatorTests, Parameters)
+{
+	CurveTessellator tessellator;
+	EXPECT_EQ(100u, tessellator.getMaxSubdivisions());
+	EXPECT_DOUBLE_EQ(0.4, tessellator.getTension());
+	EXPECT_DOUBLE_EQ(0.0, tessellator.getTolerance());
+
+	EXPECT_ANY_THROW(tessellator.setMaxSubdivisions(0));
+	EXPECT_ANY_THROW(tessellator.setTolerance(-1.0));
+
+	VerticesPlain points;
+	points.addVertex(VerticesPlain::VertexType(Vector3d::Zero()));
+	EXPECT_ANY_THROW(tessellator.update(points));
+}
+
+TEST(CurveTessellatorTests, FixedSubdivisions)
+{
+	CurveTessellator tessellator;
+	tessellator.setMaxSubdivisions(10);
+	VerticesPlain points = makeHelix(5);
+	ASSERT_TRUE(tessellator.update(points));
+
+	ASSERT_EQ(4u, tessellator.getNumSegments());
+	const auto& vertices = tessellator.getVertices();
+	const auto& directions = tessellator.getDirections();
+	ASSERT_EQ(41u, vertices.size());
+	ASSERT_EQ(41u, directions.size());
+	EXPECT_EQ(0u, tessellator.getChangedBegin());
+	EXPECT_EQ(41u, tessellator.getChangedEnd());
+
+	// The strip goes through the control points
+	for (size_t i = 0; i < points.getNumVertices(); ++i)
+	{
+		EXPECT_TRUE(vertices[10 * i].isApprox(points.getVertexPosition(i).cast<float>()));
+	}
+	for (size_t i = 0; i + 1 < vertices.size(); ++i)
+	{
+		EXPECT_TRUE(directions[i].isApprox(vertices[i + 1] - vertices[i], 1e-4f));
+	}
+
+	// Nothing moved
+	EXPECT_FALSE(tessellator.update(points));
+	EXPECT_EQ(tessellator.getChangedBegin(), tessellator.getChangedEnd());
+
+	// Changing a parameter recomputes everything
+	tessellator.setTension(0.5);
+	EXPECT_TRUE(tessellator.update(points));
+	EXPECT_EQ(0u, tessellator.getChangedBegin());
+	EXPECT_EQ(41u, tessellator.getChangedEnd());
+}
+
+TEST(CurveTessellatorTests, AdaptiveSubdivisions)
+{
+	CurveTessellator tessellator;
+	tessellator.setTolerance(1e-4);
+
+	// Straight segments are not subdivided
+	VerticesPlain line;
+	for (int i = 0; i < 4; ++i)
+	{
+		line.addVertex(VerticesPlain::VertexType(Vector3d(static_cast<double>(i), 0.0, 0.0)));
+	}
+	ASSERT_TRUE(tessellator.update(line));
+	EXPECT_EQ(4u, tessellator.getVertices().size());
+
+	// The strip stays within the tolerance of the spline computed with the maximum subdivisions
+	VerticesPlain helix = makeHelix(20);
+	CurveTessellator reference;
+	reference.setMaxSubdivisions(200);
+	reference.update(helix);
+	ASSERT_TRUE(tessellator.update(helix));
+	EXPECT_GT(reference.getVertices().size(), tessellator.getVertices().size());
+
+	const auto& vertices = tessellator.getVertices();
+	const auto& expected = reference.getVertices();
+	size_t offset = 0;
+	for (size_t segment = 0; segment < tessellator.getNumSegments(); ++segment)
+	{
+		size_t subdivisions = tessellator.getNumSubdivisions(segment);
+		EXPECT_LE(1u, subdivisions);
+		EXPECT_GE(100u, subdivisions);
+		for (size_t i = 0; i < 200; ++i)
+		{
+			// Distance from the spline to the closest chord of the segment
+			const Math::Vector3f& point = expected[200 * segment + i];
+			float distance = std::numeric_limits<float>::max();
+			for (size_t chord = offset; chord < offset + subdivisions; ++chord)
+			{
+				Math::Vector3f direction = vertices[chord + 1] - vertices[chord];
+				float alpha = std::max(0.0f, std::min(1.0f, direction.dot(point - vertices[chord]) /
+													  direction.squaredNorm()));
+				distance = std::min(distance, (vertices[chord] + alpha * direction - point).norm());
+			}
+			EXPECT_GT(2e-4f, distance);
+		}
+		offset += subdivisions;
+	}
+}
+
+TEST(CurveTessellatorTests, PartialUpdate)
+{
+	CurveTessellator tessellator;
+	tessellator.setTolerance(1e-4);
+	VerticesPlain points = makeHelix(50);
+	ASSERT_TRUE(tessellator.update(points));
+	std::vector<Math::Vector3f> previous = tessellator.getVertices();
+
+	// Moving one control point only changes the segments it influences, here 23 to 26
+	points.setVertexPosition(25, points.getVertexPosition(25) + Vector3d(0.0, 0.0, 0.5));
+	ASSERT_TRUE(tessellator.update(points));
+	size_t begin = 0;
+	for (size_t segment = 0; segment < 23; ++segment)
+	{
+		begin += tessellator.getNumSubdivisions(segment);
+	}
+	EXPECT_EQ(begin, tessellator.getChangedBegin());
+
+	CurveTessellator full;
+	full.setTolerance(1e-4);
+	full.update(points);
+	ASSERT_EQ(full.getVertices().size(), tessellator.getVertices().size());
+	for (size_t i = 0; i < full.getVertices().size(); ++i)
+	{
+		EXPECT_TRUE(full.getVertices()[i].isApprox(tessellator.getVertices()[i]));
+		EXPECT_TRUE(full.getDirections()[i].isApprox(tessellator.getDirections()[i]));
+	}
+	for (size_t i = 0; i < begin; ++i)
+	{
+		EXPECT_TRUE(previous[i] == tessellator.getVertices()[i]);
+	}
+
+	// Changing the number of control points recomputes everything
+	points.addVertex(VerticesPlain::VertexType(Vector3d(0.0, 0.0, 10.0)));
+	ASSERT_TRUE(tessellator.update(points));
+	EXPECT_EQ(0u, tessellator.getChangedBegin());
+	EXPECT_EQ(tessellator.getVertices().size(), tessellator.getChangedEnd());
+}
+
+TEST(CurveTessellatorTests, LargeCurve)
+{
+	// Enough vertices to be spread over the thread pool
+	CurveTessellator tessellator;
+	VerticesPlain points = makeHelix(1000);
+	ASSERT_TRUE(tessellator.update(points));
+	ASSERT_EQ(99901u, tessellator.getVertices().size());
+	for (size_t i = 0; i < points.getNumVertices(); ++i)
+	{
+		EXPECT_TRUE(tessellator.getVertices()[100 * i].isApprox(points.getVertexPosition(i).cast<float>()));
+	}
+
+	points.setVertexPosition(500, Vector3d::Zero());
+	ASSERT_TRUE(tessellator.update(points));
+	EXPECT_EQ(49800u, tessellator.getChangedBegin());
+	EXPECT_EQ(50200u, tessellator.getChangedEnd());
+	EXPECT_TRUE(tessellator.getVertices()[50000].isZero());
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,184 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "SurgSim/Graphics/MeshSimplifier.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+
+/// Build a grid of squares, each split in two triangles, displaced along z
+void buildGrid(size_t size, double height, std::vector<Vector3d>* positions, std::vector<unsigned int>* triangles)
+{
+	for (size_t j = 0; j <= size; ++j)
+	{
+		for (size_t i = 0; i <= size; ++i)
+		{
+			double x = static_cast<double>(i) / static_cast<double>(size);
+			double y = static_cast<double>(j) / static_cast<double>(size);
+			positions->push_back(Vector3d(x, y, height * std::sin(M_PI * x) * std::sin(M_PI * y)));
+		}
+	}
+	for (unsigned int j = 0; j < size; ++j)
+	{
+		for (unsigned int i = 0; i < size; ++i)
+		{
+			unsigned int first = i + j * static_cast<unsigned int>(size + 1);
+			unsigned int above = first + static_cast<unsigned int>(size + 1);
+			triangles->insert(triangles->end(), {first, first + 1, above + 1, first, above + 1, above});
+		}
+	}
+}
+
+/// \return The area of the triangles projected on the xy plane, signed by their orientation
+double getProjectedArea(const std::vector<Vector3d>& positions, const std::vector<unsigned int>& triangles)
+{
+	double area = 0.0;
+	for (size_t i = 0; i < triangles.size(); i += 3)
+	{
+		Vector3d normal = (positions[triangles[i + 1]] - positions[triangles[i]]).cross(
+							  positions[triangles[i + 2]] - positions[triangles[i]]);
+		area += 0.5 * normal.z();
+	}
+	return area;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(MeshSimplifierTests, Flat)
+{
+	std::vector<Vector3d> positions;
+	std::vector<unsigned int> triangles;
+	buildGrid(10, 0.0, &positions, &triangles);
+	ASSERT_EQ(200u, triangles.size() / 3);
+
+	// A flat square collapses down to two triangles without any error
+	MeshSimplifier simplifier(positions, triangles);
+	std::vector<unsigned int> result;
+	simplifier.simplify(2, &result);
+	EXPECT_EQ(result.size() / 3, simplifier.getNumTriangles());
+	EXPECT_EQ(2u, simplifier.getNumTriangles());
+	EXPECT_NEAR(1.0, getProjectedArea(positions, result), 1e-9);
+	for (unsigned int id : result)
+	{
+		EXPECT_GT(positions.size(), id);
+	}
+}
+
+TEST(MeshSimplifierTests, Progressive)
+{
+	std::vector<Vector3d> positions;
+	std::vector<unsigned int> triangles;
+	buildGrid(32, 0.3, &positions, &triangles);
+	const size_t numTriangles = triangles.size() / 3;
+
+	MeshSimplifier simplifier(positions, triangles);
+	std::vector<unsigned int> result;
+	simplifier.simplify(numTriangles, &result);
+	EXPECT_EQ(triangles, result);
+
+	size_t previous = numTriangles;
+	for (size_t target = numTriangles / 4; target > 16; target /= 4)
+	{
+		simplifier.simplify(target, &result);
+		EXPECT_GE(target, result.size() / 3);
+		EXPECT_LT(result.size() / 3, previous);
+		previous = result.size() / 3;
+
+		// No triangle is flipped over and the border stays in place
+		EXPECT_NEAR(1.0, getProjectedArea(positions, result), 1e-9);
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			Vector3d normal = (positions[result[i + 1]] - positions[result[i]]).cross(
+								  positions[result[i + 2]] - positions[result[i]]);
+			EXPECT_LE(0.0, normal.z());
+		}
+	}
+}
+
+TEST(MeshSimplifierTests, Closed)
+{
+	// An octahedron subdivided and pushed onto the unit sphere
+	std::vector<Vector3d> positions;
+	std::vector<unsigned int> triangles;
+	const size_t size = 16;
+	const Vector3d axes[3] = {Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ()};
+	for (int face = 0; face < 8; ++face)
+	{
+		Vector3d corners[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			corners[i] = ((face >> i) & 1) ? -axes[i] : axes[i];
+		}
+		if (corners[0].cross(corners[1]).dot(corners[2]) < 0.0)
+		{
+			std::swap(corners[1], corners[2]);
+		}
+		unsigned int first = static_cast<unsigned int>(positions.size());
+		for (size_t j = 0; j <= size; ++j)
+		{
+			for (size_t i = 0; i + j <= size; ++i)
+			{
+				Vector3d point = corners[0] + (corners[1] - corners[0]) * static_cast<double>(i) / size +
+								 (corners[2] - corners[0]) * static_cast<double>(j) / size;
+				positions.push_back(point.normalized());
+			}
+		}
+		auto index = [first, size](size_t i, size_t j)
+		{
+			return first + static_cast<unsigned int>(j * (size + 1) - j * (j - 1) / 2 + i);
+		};
+		for (size_t j = 0; j < size; ++j)
+		{
+			for (size_t i = 0; i + j < size; ++i)
+			{
+				triangles.insert(triangles.end(), {index(i, j), index(i + 1, j), index(i, j + 1)});
+				if (i + j + 1 < size)
+				{
+					triangles.insert(triangles.end(), {index(i + 1, j), index(i + 1, j + 1), index(i, j + 1)});
+				}
+			}
+		}
+	}
+
+	// The faces do not share vertices, their edges are kept like texture seams
+	MeshSimplifier simplifier(positions, triangles);
+	std::vector<unsigned int> result;
+	simplifier.simplify(triangles.size() / 3 / 8, &result);
+	EXPECT_GE(triangles.size() / 3 / 8, result.size() / 3);
+	for (size_t i = 0; i < result.size(); i += 3)
+	{
+		Vector3d center = (positions[result[i]] + positions[result[i + 1]] + positions[result[i + 2]]) / 3.0;
+		Vector3d normal = (positions[result[i + 1]] - positions[result[i]]).cross(
+							  positions[result[i + 2]] - positions[result[i]]);
+		EXPECT_LT(0.0, normal.dot(center));
+		EXPECT_LT(0.8, center.norm());
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
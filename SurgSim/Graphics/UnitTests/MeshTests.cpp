@@ -13,8 +13,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
 #include <vector>
+#include <boost/filesystem.hpp>
 #include <gtest/gtest.h>
+#include "SurgSim/Framework/AssetCache.h"
+#include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Graphics/Mesh.h"
 #include "SurgSim/Testing/TestCube.h"
 
@@ -132,5 +136,118 @@ TEST_F(MeshTests, MakeMeshTextures)
 }
 
 
+TEST_F(MeshTests, LevelsOfDetail)
+{
+	// A bumpy grid of 2 * 32 * 32 triangles
+	const size_t size = 32;
+	std::vector<Vector3d> vertices;
+	std::vector<size_t> triangles;
+	for (size_t j = 0; j <= size; ++j)
+	{
+		for (size_t i = 0; i <= size; ++i)
+		{
+			double x = static_cast<double>(i) / size;
+			double y = static_cast<double>(j) / size;
+			vertices.push_back(Vector3d(x, y, 0.2 * std::sin(6.0 * x) * std::cos(5.0 * y)));
+		}
+	}
+	for (size_t j = 0; j < size; ++j)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			size_t first = i + j * (size + 1);
+			triangles.insert(triangles.end(), {first, first + 1, first + size + 2, first, first + size + 2,
+											   first + size + 1});
+		}
+	}
+
+	auto mesh = std::make_shared<Mesh>();
+	mesh->initialize(vertices, std::vector<Vector4d>(), std::vector<Vector2d>(), triangles);
+	EXPECT_EQ(1u, mesh->getNumLevelsOfDetail());
+	EXPECT_ANY_THROW(mesh->getLevelOfDetail(1));
+	EXPECT_ANY_THROW(mesh->buildLevelsOfDetail(3, 1.0));
+
+	mesh->buildLevelsOfDetail(3);
+	ASSERT_EQ(3u, mesh->getNumLevelsOfDetail());
+	EXPECT_ANY_THROW(mesh->getLevelOfDetail(0));
+	EXPECT_GE(2048u / 4, mesh->getLevelOfDetail(1).size() / 3);
+	EXPECT_GE(2048u / 16, mesh->getLevelOfDetail(2).size() / 3);
+	EXPECT_LT(0u, mesh->getLevelOfDetail(2).size());
+	for (unsigned int id : mesh->getLevelOfDetail(2))
+	{
+		EXPECT_GT(vertices.size(), id);
+	}
+
+	// The levels are copied with the mesh
+	Mesh copy(*mesh);
+	ASSERT_EQ(3u, copy.getNumLevelsOfDetail());
+	EXPECT_EQ(mesh->getLevelOfDetail(2), copy.getLevelOfDetail(2));
+
+	// Changing the triangles invalidates the levels
+	mesh->removeTriangle(0);
+	EXPECT_EQ(1u, mesh->getNumLevelsOfDetail());
+
+	// Out of date levels are not copied
+	Mesh staleCopy(*mesh);
+	EXPECT_EQ(1u, staleCopy.getNumLevelsOfDetail());
+
+	// Also when the number of triangles stays the same
+	copy.getTriangle(0).verticesId[2] = copy.getTriangle(0).verticesId[1] + 1;
+	EXPECT_EQ(2048u, copy.getNumTriangles());
+	EXPECT_EQ(1u, copy.getNumLevelsOfDetail());
+	EXPECT_ANY_THROW(copy.getLevelOfDetail(1));
+}
+
+TEST_F(MeshTests, LevelsOfDetailOnLoad)
+{
+	auto runtime = std::make_shared<SurgSim::Framework::Runtime>("config.txt");
+	auto cache = SurgSim::Framework::Runtime::getAssetCache();
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	boost::filesystem::create_directories(directory);
+	cache->clear();
+	cache->setBinaryCacheEnabled(true);
+	cache->setBinaryCacheDirectory(directory.string());
+
+	const std::string fileName = "Geometry/wound_deformable_with_texture.ply";
+	auto loaded = std::make_shared<Mesh>();
+	EXPECT_EQ(1u, loaded->getNumLevelsOfDetailOnLoad());
+	EXPECT_ANY_THROW(loaded->setNumLevelsOfDetailOnLoad(0));
+	loaded->setNumLevelsOfDetailOnLoad(3);
+	ASSERT_NO_THROW(loaded->load(fileName));
+	ASSERT_EQ(3u, loaded->getNumLevelsOfDetail());
+
+	// The levels are shared through the asset cache
+	auto shared = std::make_shared<Mesh>();
+	shared->setNumLevelsOfDetailOnLoad(3);
+	ASSERT_NO_THROW(shared->load(fileName));
+	ASSERT_EQ(3u, shared->getNumLevelsOfDetail());
+	EXPECT_EQ(loaded->getLevelOfDetail(2), shared->getLevelOfDetail(2));
+
+	// Without the cached data in memory, the mesh and its levels are read from the binary cache file
+	cache->clear();
+	auto restored = std::make_shared<Mesh>();
+	restored->setNumLevelsOfDetailOnLoad(3);
+	ASSERT_NO_THROW(restored->load(fileName));
+	EXPECT_TRUE(*loaded == *restored);
+	ASSERT_EQ(3u, restored->getNumLevelsOfDetail());
+	EXPECT_EQ(loaded->getLevelOfDetail(1), restored->getLevelOfDetail(1));
+	EXPECT_EQ(loaded->getLevelOfDetail(2), restored->getLevelOfDetail(2));
+	ASSERT_TRUE(restored->getVertex(0).data.texture.hasValue());
+	EXPECT_TRUE(loaded->getVertex(0).data.texture.getValue().isApprox(restored->getVertex(0).data.texture.getValue()));
+
+	// A different number of levels builds them again
+	cache->clear();
+	auto moreLevels = std::make_shared<Mesh>();
+	moreLevels->setNumLevelsOfDetailOnLoad(4);
+	ASSERT_NO_THROW(moreLevels->load(fileName));
+	EXPECT_EQ(4u, moreLevels->getNumLevelsOfDetail());
+
+	cache->setBinaryCacheEnabled(false);
+	cache->setBinaryCacheDirectory("");
+	cache->clear();
+	boost::filesystem::remove_all(directory);
+}
+
+
 }; // namespace Graphics
 }; // namespace SurgSim
@@ -50,6 +50,12 @@ TEST(OsgCurveRepresentationTests, SetterGettersProperties)
 	EXPECT_NEAR(tension, curve->getValue<double>("Tension"), epsilon);
 	EXPECT_NEAR(tension, curve->getTension(), epsilon);
 
+	EXPECT_DOUBLE_EQ(0.0, curve->getTolerance());
+	double tolerance = 0.01;
+	curve->setValue("Tolerance", tolerance);
+	EXPECT_NEAR(tolerance, curve->getValue<double>("Tolerance"), epsilon);
+	EXPECT_NEAR(tolerance, curve->getTolerance(), epsilon);
+
 	bool val = curve->isAntiAliasing();
 	curve->setValue("AntiAliasing", !val);
 	EXPECT_EQ(!val, curve->isAntiAliasing());
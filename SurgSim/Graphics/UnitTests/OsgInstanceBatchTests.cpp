@@ -0,0 +1,205 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <osg/Geode>
+#include <osg/Geometry>
+
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Graphics/OsgBoxRepresentation.h"
+#include "SurgSim/Graphics/OsgCapsuleRepresentation.h"
+#include "SurgSim/Graphics/OsgGroup.h"
+#include "SurgSim/Graphics/OsgInstanceBatch.h"
+#include "SurgSim/Graphics/OsgMaterial.h"
+#include "SurgSim/Graphics/OsgSphereRepresentation.h"
+#include "SurgSim/Graphics/UnitTests/MockOsgObjects.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::makeRigidTranslation;
+using SurgSim::Math::Vector3d;
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+namespace
+{
+
+osg::Geometry* getGeometry(const OsgInstanceBatch& batch)
+{
+	return batch.getOsgNode()->asGeode()->getDrawable(0)->asGeometry();
+}
+
+}
+
+TEST(OsgInstanceBatchTests, Shapes)
+{
+	auto runtime = std::make_shared<Framework::Runtime>("config.txt");
+	for (int shape = 0; shape < INSTANCE_SHAPE_COUNT; ++shape)
+	{
+		OsgInstanceBatch batch(static_cast<InstanceShape>(shape));
+		EXPECT_EQ(shape, batch.getShape());
+		EXPECT_EQ(0u, batch.getNumRepresentations());
+		EXPECT_EQ(0u, batch.getNumInstances());
+		EXPECT_LT(0u, getGeometry(batch)->getVertexArray()->getNumElements());
+		// Nothing is drawn without instances
+		EXPECT_EQ(0u, batch.getOsgNode()->getNodeMask());
+	}
+	EXPECT_ANY_THROW(OsgInstanceBatch batch(INSTANCE_SHAPE_NONE));
+}
+
+TEST(OsgInstanceBatchTests, Update)
+{
+	auto runtime = std::make_shared<Framework::Runtime>("config.txt");
+	OsgInstanceBatch batch(INSTANCE_SHAPE_CAPSULE);
+	auto box = std::make_shared<OsgBoxRepresentation>("box");
+	EXPECT_ANY_THROW(batch.add(box));
+
+	std::vector<std::shared_ptr<OsgCapsuleRepresentation>> capsules;
+	for (int i = 0; i < 3; ++i)
+	{
+		auto capsule = std::make_shared<OsgCapsuleRepresentation>("capsule" + std::to_string(i));
+		capsule->setSize(0.1 * (i + 1), 2.0);
+		capsule->setLocalPose(makeRigidTranslation(Vector3d(static_cast<double>(i), 0.0, 0.0)));
+		EXPECT_TRUE(batch.add(capsule));
+		capsules.push_back(capsule);
+	}
+	EXPECT_FALSE(batch.add(capsules[0]));
+	EXPECT_EQ(3u, batch.getNumRepresentations());
+
+	std::vector<std::shared_ptr<OsgRepresentation>> removed;
+	capsules[1]->setLocalActive(false);
+	batch.update(&removed);
+	EXPECT_TRUE(removed.empty());
+	EXPECT_EQ(2u, batch.getNumInstances());
+	EXPECT_NE(0u, batch.getOsgNode()->getNodeMask());
+
+	auto scale = static_cast<osg::Vec4Array*>(getGeometry(batch)->getVertexAttribArray(
+					  INSTANCE_SCALE_VERTEX_ATTRIBUTE_ID));
+	ASSERT_EQ(2u, scale->size());
+	EXPECT_NEAR(0.3f, (*scale)[1].x(), 1e-6f);
+	EXPECT_NEAR(1.0f, (*scale)[1].w(), 1e-6f);
+	auto row0 = static_cast<osg::Vec4Array*>(getGeometry(batch)->getVertexAttribArray(
+					 INSTANCE_ROW0_VERTEX_ATTRIBUTE_ID));
+	EXPECT_NEAR(2.0f, (*row0)[1].w(), 1e-6f);
+	EXPECT_TRUE(getGeometry(batch)->getInitialBound().contains(osg::Vec3f(2.0f, 1.2f, 0.0f)));
+
+	// A representation with a material needs its own node
+	capsules[2]->setMaterial(std::make_shared<OsgMaterial>("material"));
+	batch.update(&removed);
+	ASSERT_EQ(1u, removed.size());
+	EXPECT_EQ(capsules[2], removed[0]);
+	EXPECT_EQ(2u, batch.getNumRepresentations());
+	EXPECT_EQ(1u, batch.getNumInstances());
+
+	EXPECT_TRUE(batch.remove(capsules[0]));
+	EXPECT_FALSE(batch.remove(capsules[0]));
+	EXPECT_EQ(1u, batch.getNumRepresentations());
+}
+
+TEST(OsgInstanceBatchTests, Group)
+{
+	auto runtime = std::make_shared<Framework::Runtime>("config.txt");
+	auto group = std::make_shared<OsgGroup>("group");
+	osg::ref_ptr<osg::Group> osgGroup = group->getOsgGroup();
+	EXPECT_FALSE(group->isInstancingEnabled());
+	group->setInstancingEnabled(true);
+	EXPECT_TRUE(group->isInstancingEnabled());
+	EXPECT_EQ(nullptr, group->getInstanceBatch(INSTANCE_SHAPE_SPHERE));
+
+	std::vector<std::shared_ptr<OsgSphereRepresentation>> spheres;
+	for (int i = 0; i < 100; ++i)
+	{
+		spheres.push_back(std::make_shared<OsgSphereRepresentation>("sphere" + std::to_string(i)));
+		EXPECT_TRUE(group->add(spheres.back()));
+	}
+
+	// All the spheres share a single node
+	auto batch = group->getInstanceBatch(INSTANCE_SHAPE_SPHERE);
+	ASSERT_NE(nullptr, batch);
+	EXPECT_EQ(1u, osgGroup->getNumChildren());
+	EXPECT_EQ(100u, batch->getNumRepresentations());
+	group->updateInstances();
+	EXPECT_EQ(100u, batch->getNumInstances());
+
+	// Representations with a material or without an instance shape keep their own node
+	auto sphere = std::make_shared<OsgSphereRepresentation>("sphere with material");
+	sphere->setMaterial(std::make_shared<OsgMaterial>("material"));
+	EXPECT_TRUE(group->add(sphere));
+	EXPECT_TRUE(group->add(std::make_shared<MockOsgRepresentation>("mock")));
+	EXPECT_EQ(3u, osgGroup->getNumChildren());
+	EXPECT_TRUE(osgGroup->containsNode(sphere->getOsgNode()));
+
+	spheres[0]->setDrawAsWireFrame(true);
+	group->updateInstances();
+	EXPECT_EQ(99u, batch->getNumInstances());
+	EXPECT_EQ(4u, osgGroup->getNumChildren());
+	EXPECT_TRUE(osgGroup->containsNode(spheres[0]->getOsgNode()));
+
+	EXPECT_TRUE(group->remove(spheres[0]));
+	EXPECT_TRUE(group->remove(spheres[1]));
+	EXPECT_EQ(3u, osgGroup->getNumChildren());
+	EXPECT_EQ(98u, batch->getNumRepresentations());
+
+	group->clear();
+	EXPECT_EQ(0u, batch->getNumRepresentations());
+	EXPECT_EQ(1u, osgGroup->getNumChildren());
+}
+
+TEST(OsgInstanceBatchTests, EnableInstancing)
+{
+	auto runtime = std::make_shared<Framework::Runtime>("config.txt");
+	auto group = std::make_shared<OsgGroup>("group");
+	osg::ref_ptr<osg::Group> osgGroup = group->getOsgGroup();
+
+	// Without instancing every representation has its own node
+	std::vector<std::shared_ptr<OsgSphereRepresentation>> spheres;
+	for (int i = 0; i < 10; ++i)
+	{
+		spheres.push_back(std::make_shared<OsgSphereRepresentation>("sphere" + std::to_string(i)));
+		EXPECT_TRUE(group->add(spheres.back()));
+	}
+	EXPECT_TRUE(group->add(std::make_shared<MockOsgRepresentation>("mock")));
+	EXPECT_EQ(nullptr, group->getInstanceBatch(INSTANCE_SHAPE_SPHERE));
+	EXPECT_EQ(11u, osgGroup->getNumChildren());
+
+	// Enabling moves the members into a batch
+	group->setInstancingEnabled(true);
+	auto batch = group->getInstanceBatch(INSTANCE_SHAPE_SPHERE);
+	ASSERT_NE(nullptr, batch);
+	EXPECT_EQ(10u, batch->getNumRepresentations());
+	EXPECT_EQ(2u, osgGroup->getNumChildren());
+	EXPECT_FALSE(osgGroup->containsNode(spheres[0]->getOsgNode()));
+
+	// Disabling gives them their own node again
+	group->setInstancingEnabled(false);
+	EXPECT_EQ(nullptr, group->getInstanceBatch(INSTANCE_SHAPE_SPHERE));
+	EXPECT_EQ(11u, osgGroup->getNumChildren());
+	EXPECT_TRUE(osgGroup->containsNode(spheres[0]->getOsgNode()));
+	EXPECT_FALSE(osgGroup->containsNode(batch->getOsgNode()));
+
+	EXPECT_TRUE(group->remove(spheres[0]));
+	EXPECT_EQ(10u, osgGroup->getNumChildren());
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
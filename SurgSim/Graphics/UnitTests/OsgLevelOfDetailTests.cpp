@@ -0,0 +1,69 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <osg/ref_ptr>
+
+#include "SurgSim/Graphics/OsgLevelOfDetail.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(OsgLevelOfDetailTests, Parameters)
+{
+	osg::ref_ptr<OsgLevelOfDetail> levelOfDetail = new OsgLevelOfDetail(100.0);
+	EXPECT_DOUBLE_EQ(100.0, levelOfDetail->getPixelSize());
+	EXPECT_DOUBLE_EQ(0.1, levelOfDetail->getHysteresis());
+	EXPECT_EQ(0u, levelOfDetail->getLevel());
+
+	levelOfDetail->setPixelSize(50.0);
+	EXPECT_DOUBLE_EQ(50.0, levelOfDetail->getPixelSize());
+	levelOfDetail->setHysteresis(0.2);
+	EXPECT_DOUBLE_EQ(0.2, levelOfDetail->getHysteresis());
+	EXPECT_ANY_THROW(levelOfDetail->setHysteresis(-0.1));
+	EXPECT_ANY_THROW(levelOfDetail->setHysteresis(1.0));
+}
+
+TEST(OsgLevelOfDetailTests, SelectLevel)
+{
+	// Thresholds at 100, 50 and 25 pixels
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(0, 4, 200.0, 100.0, 0.0));
+	EXPECT_EQ(1u, OsgLevelOfDetail::selectLevel(0, 4, 80.0, 100.0, 0.0));
+	EXPECT_EQ(2u, OsgLevelOfDetail::selectLevel(0, 4, 40.0, 100.0, 0.0));
+	EXPECT_EQ(3u, OsgLevelOfDetail::selectLevel(0, 4, 20.0, 100.0, 0.0));
+	EXPECT_EQ(3u, OsgLevelOfDetail::selectLevel(0, 4, 1.0, 100.0, 0.0));
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(3, 4, 200.0, 100.0, 0.0));
+
+	// A single level is always used
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(0, 1, 1.0, 100.0, 0.1));
+
+	// Within the hysteresis band the current level is kept
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(0, 4, 95.0, 100.0, 0.1));
+	EXPECT_EQ(1u, OsgLevelOfDetail::selectLevel(1, 4, 95.0, 100.0, 0.1));
+	EXPECT_EQ(1u, OsgLevelOfDetail::selectLevel(1, 4, 105.0, 100.0, 0.1));
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(1, 4, 115.0, 100.0, 0.1));
+	EXPECT_EQ(1u, OsgLevelOfDetail::selectLevel(0, 4, 85.0, 100.0, 0.1));
+
+	// Moving by several levels at once
+	EXPECT_EQ(3u, OsgLevelOfDetail::selectLevel(0, 4, 10.0, 100.0, 0.1));
+	EXPECT_EQ(2u, OsgLevelOfDetail::selectLevel(3, 4, 30.0, 100.0, 0.1));
+	EXPECT_EQ(0u, OsgLevelOfDetail::selectLevel(3, 4, 120.0, 100.0, 0.1));
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
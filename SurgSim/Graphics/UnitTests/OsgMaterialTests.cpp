@@ -66,6 +66,9 @@ class MockProgram : public Program
 
 	MOCK_CONST_METHOD0(isGlobalScope, bool());
 	MOCK_METHOD1(setGlobalScope, void(bool)); //NOLINT
+
+	MOCK_METHOD2(setAttributeLocation, void(const std::string&, int));
+	MOCK_CONST_METHOD2(getAttributeLocation, bool(const std::string&, int*));
 };
 
 
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 #include <osg/ref_ptr>
 #include <osg/Geometry>
+#include <osg/Geode>
+#include <osg/Group>
 #include <osg/Array>
 
 #include "SurgSim/DataStructures/PlyReader.h"
@@ -42,6 +44,35 @@ std::vector<Vector3d> cubeVertices;
 std::vector<size_t> cubeTriangles;
 std::vector<Vector4d> cubeColors;
 std::vector<Vector2d> cubeTextures;
+
+/// Checks the normals, tangents and bitangents of an incrementally updated representation against the ones of a
+/// representation of the same mesh that was updated as a whole
+void expectSameTangentSpace(osg::Geometry* expected, osg::Geometry* actual)
+{
+	const float epsilon = 1e-5f;
+	auto expectedNormals = static_cast<osg::Vec3Array*>(expected->getNormalArray());
+	auto actualNormals = static_cast<osg::Vec3Array*>(actual->getNormalArray());
+	ASSERT_EQ(expectedNormals->size(), actualNormals->size());
+	for (size_t i = 0; i < expectedNormals->size(); ++i)
+	{
+		EXPECT_NEAR(0.0f, ((*expectedNormals)[i] - (*actualNormals)[i]).length(), epsilon);
+	}
+
+	for (int attribute : {SurgSim::Graphics::TANGENT_VERTEX_ATTRIBUTE_ID,
+						  SurgSim::Graphics::BITANGENT_VERTEX_ATTRIBUTE_ID})
+	{
+		SCOPED_TRACE(attribute);
+		auto expectedArray = dynamic_cast<osg::Vec4Array*>(expected->getVertexAttribArray(attribute));
+		auto actualArray = dynamic_cast<osg::Vec4Array*>(actual->getVertexAttribArray(attribute));
+		ASSERT_NE(nullptr, expectedArray);
+		ASSERT_NE(nullptr, actualArray);
+		ASSERT_EQ(expectedArray->size(), actualArray->size());
+		for (size_t i = 0; i < expectedArray->size(); ++i)
+		{
+			EXPECT_NEAR(0.0f, ((*expectedArray)[i] - (*actualArray)[i]).length(), epsilon);
+		}
+	}
+}
 }
 
 namespace SurgSim
@@ -155,5 +186,118 @@ TEST(OsgMeshRepresentationTests, MeshDelegateTest)
 	EXPECT_EQ(triangle11, mesh->getTriangle(11).verticesId);
 }
 
+TEST(OsgMeshRepresentationTests, LevelsOfDetailTest)
+{
+	std::shared_ptr<Runtime> runtime = std::make_shared<Runtime>("config.txt");
+	auto meshRepresentation = std::make_shared<OsgMeshRepresentation>("TestMesh");
+	EXPECT_EQ(1u, meshRepresentation->getLevelsOfDetail());
+	EXPECT_ANY_THROW(meshRepresentation->setLevelsOfDetail(0));
+
+	meshRepresentation->setValue("LevelsOfDetail", static_cast<size_t>(3));
+	meshRepresentation->setValue("LevelOfDetailPixelSize", 100.0);
+	EXPECT_EQ(3u, meshRepresentation->getLevelsOfDetail());
+	EXPECT_DOUBLE_EQ(100.0, meshRepresentation->getLevelOfDetailPixelSize());
+
+	std::shared_ptr<Mesh> mesh = meshRepresentation->getMesh();
+	mesh->initialize(cubeVertices, cubeColors, cubeTextures, cubeTriangles);
+	ASSERT_TRUE(meshRepresentation->initialize(runtime));
+	ASSERT_TRUE(meshRepresentation->wakeUp());
+	ASSERT_NO_THROW(meshRepresentation->update(0.1));
+
+	// The levels are built in the mesh, and drawn with the vertex arrays of the full mesh
+	EXPECT_EQ(3u, mesh->getNumLevelsOfDetail());
+	osg::ref_ptr<osg::Group> levels = meshRepresentation->getOsgLevelsOfDetail();
+	ASSERT_NE(nullptr, levels);
+	ASSERT_EQ(3u, levels->getNumChildren());
+	osg::ref_ptr<osg::Geometry> geometry = meshRepresentation->getOsgGeometry();
+	ASSERT_NE(nullptr, levels->getChild(0)->asGeode());
+	EXPECT_EQ(geometry, levels->getChild(0)->asGeode()->getDrawable(0));
+	for (unsigned int level = 1; level < 3; ++level)
+	{
+		SCOPED_TRACE(level);
+		ASSERT_NE(nullptr, levels->getChild(level)->asGeode());
+		auto levelGeometry = levels->getChild(level)->asGeode()->getDrawable(0)->asGeometry();
+		ASSERT_NE(nullptr, levelGeometry);
+		EXPECT_EQ(geometry->getVertexArray(), levelGeometry->getVertexArray());
+		EXPECT_EQ(geometry->getColorArray(), levelGeometry->getColorArray());
+		EXPECT_EQ(mesh->getLevelOfDetail(level).size(), levelGeometry->getPrimitiveSet(0)->getNumIndices());
+		EXPECT_GE(cubeTriangles.size(), levelGeometry->getPrimitiveSet(0)->getNumIndices());
+	}
+
+	meshRepresentation->setLevelsOfDetail(1);
+	ASSERT_NO_THROW(meshRepresentation->update(0.1));
+	EXPECT_EQ(nullptr, meshRepresentation->getOsgLevelsOfDetail());
+
+	// A mesh from a file gets its levels while loading, before the representation is updated
+	auto loaded = std::make_shared<OsgMeshRepresentation>("LoadedMesh");
+	loaded->setLevelsOfDetail(3);
+	loaded->loadMesh("Geometry/wound_deformable_with_texture.ply");
+	EXPECT_EQ(3u, loaded->getMesh()->getNumLevelsOfDetail());
+
+	// Changing the levels before wake up loads the file again
+	loaded->setLevelsOfDetail(2);
+	EXPECT_EQ(2u, loaded->getMesh()->getNumLevelsOfDetail());
+}
+
+TEST(OsgMeshRepresentationTests, IncrementalUpdateTest)
+{
+	std::shared_ptr<Runtime> runtime = std::make_shared<Runtime>();
+	SurgSim::Testing::Cube::makeCube(&cubeVertices, &cubeColors, &cubeTextures, &cubeTriangles);
+
+	auto makeRepresentation = [&runtime](bool isIncremental, bool generateTangents)
+	{
+		auto representation = std::make_shared<OsgMeshRepresentation>("TestMesh");
+		representation->getMesh()->initialize(cubeVertices, cubeColors, cubeTextures, cubeTriangles);
+		representation->setIncrementalUpdate(isIncremental);
+		representation->setGenerateTangents(generateTangents);
+		EXPECT_TRUE(representation->initialize(runtime));
+		EXPECT_TRUE(representation->wakeUp());
+		representation->update(0.1);
+		return representation;
+	};
+
+	auto moveVertex = [](std::shared_ptr<OsgMeshRepresentation> representation, size_t id)
+	{
+		auto mesh = representation->getMesh();
+		mesh->setVertexPosition(id, mesh->getVertexPosition(id) + Vector3d(0.2, -0.3, 0.1));
+		mesh->dirty();
+		representation->update(0.1);
+	};
+
+	auto check = [&makeRepresentation](std::shared_ptr<OsgMeshRepresentation> representation)
+	{
+		auto expected = makeRepresentation(false, true);
+		std::vector<Vector3d> positions;
+		for (const auto& vertex : representation->getMesh()->getVertices())
+		{
+			positions.push_back(vertex.position);
+		}
+		expected->getMesh()->setVertexPositions(positions);
+		expected->getMesh()->dirty();
+		expected->update(0.1);
+		expectSameTangentSpace(expected->getOsgGeometry(), representation->getOsgGeometry());
+	};
+
+	{
+		SCOPED_TRACE("Tangents generated from the start");
+		auto representation = makeRepresentation(true, true);
+		moveVertex(representation, 0);
+		check(representation);
+		moveVertex(representation, 5);
+		check(representation);
+	}
+
+	{
+		SCOPED_TRACE("Tangents enabled after the first updates");
+		auto representation = makeRepresentation(true, false);
+		moveVertex(representation, 0);
+		representation->setGenerateTangents(true);
+		moveVertex(representation, 5);
+		check(representation);
+		moveVertex(representation, 10);
+		check(representation);
+	}
+}
+
 }; // namespace Graphics
 }; // namespace SurgSim
@@ -0,0 +1,115 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <osg/Camera>
+#include <osg/Group>
+#include <osg/MatrixTransform>
+#include <osg/PositionAttitudeTransform>
+#include <osg/Switch>
+#include <osg/Uniform>
+
+#include "SurgSim/Graphics/OsgModelMatrixUpdater.h"
+
+namespace
+{
+
+/// \return A transform carrying a "modelMatrix" uniform, as set up by the OsgManager
+osg::ref_ptr<osg::PositionAttitudeTransform> makeTransform(const osg::Vec3d& position)
+{
+	osg::ref_ptr<osg::PositionAttitudeTransform> transform = new osg::PositionAttitudeTransform;
+	transform->setPosition(position);
+	auto uniform = new osg::Uniform(osg::Uniform::FLOAT_MAT4, "modelMatrix");
+	uniform->set(osg::Matrixf());
+	transform->getOrCreateStateSet()->addUniform(uniform);
+	return transform;
+}
+
+/// \return The value of the "modelMatrix" uniform of a transform
+osg::Matrixf getModelMatrix(osg::Node* transform)
+{
+	osg::Matrixf matrix;
+	transform->getStateSet()->getUniform("modelMatrix")->get(matrix);
+	return matrix;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(OsgModelMatrixUpdaterTests, Update)
+{
+	osg::ref_ptr<osg::Switch> root = new osg::Switch;
+
+	// Directly below the root
+	auto first = makeTransform(osg::Vec3d(1.0, 0.0, 0.0));
+	root->addChild(first);
+
+	// Below a transform without uniform, and with a transform below that uses its uniform
+	osg::ref_ptr<osg::MatrixTransform> parent = new osg::MatrixTransform(osg::Matrixd::translate(0.0, 2.0, 0.0));
+	auto second = makeTransform(osg::Vec3d(1.0, 0.0, 0.0));
+	auto nested = makeTransform(osg::Vec3d(0.0, 0.0, 5.0));
+	second->addChild(nested);
+	parent->addChild(second);
+	root->addChild(parent);
+
+	// Below a camera, whose matrix is not part of the model matrix
+	osg::ref_ptr<osg::Camera> camera = new osg::Camera;
+	camera->setViewMatrix(osg::Matrixd::translate(0.0, 0.0, -10.0));
+	auto third = makeTransform(osg::Vec3d(0.0, 3.0, 0.0));
+	camera->addChild(third);
+	root->addChild(camera);
+
+	// Hidden
+	auto hidden = makeTransform(osg::Vec3d(4.0, 0.0, 0.0));
+	root->addChild(hidden, false);
+
+	osg::ref_ptr<OsgModelMatrixUpdater> updater = new OsgModelMatrixUpdater();
+	updater->update(root);
+	EXPECT_EQ(3u, updater->getNumChanged());
+	EXPECT_EQ(osg::Matrixf::translate(1.0f, 0.0f, 0.0f), getModelMatrix(first));
+	EXPECT_EQ(osg::Matrixf::translate(1.0f, 2.0f, 0.0f), getModelMatrix(second));
+	EXPECT_EQ(osg::Matrixf(), getModelMatrix(nested));
+	EXPECT_EQ(osg::Matrixf::translate(0.0f, 3.0f, 0.0f), getModelMatrix(third));
+	EXPECT_EQ(osg::Matrixf(), getModelMatrix(hidden));
+
+	// Nothing moved
+	updater->update(root);
+	EXPECT_EQ(0u, updater->getNumChanged());
+
+	// Moving a parent changes the matrix of its children
+	parent->setMatrix(osg::Matrixd::translate(0.0, 4.0, 0.0));
+	updater->update(root);
+	EXPECT_EQ(1u, updater->getNumChanged());
+	EXPECT_EQ(osg::Matrixf::translate(1.0f, 4.0f, 0.0f), getModelMatrix(second));
+
+	root->setChildValue(hidden, true);
+	updater->update(root);
+	EXPECT_EQ(1u, updater->getNumChanged());
+	EXPECT_EQ(osg::Matrixf::translate(4.0f, 0.0f, 0.0f), getModelMatrix(hidden));
+
+	// The matrix of the root
+	updater->update(root, osg::Matrixd::translate(0.0, 0.0, 1.0));
+	EXPECT_EQ(4u, updater->getNumChanged());
+	EXPECT_EQ(osg::Matrixf::translate(1.0f, 0.0f, 1.0f), getModelMatrix(first));
+	EXPECT_EQ(osg::Matrixf::translate(0.0f, 3.0f, 0.0f), getModelMatrix(third));
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
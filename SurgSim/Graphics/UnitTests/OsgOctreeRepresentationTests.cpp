@@ -90,6 +90,59 @@ TEST(OsgOctreeRepresentationTests, SetNodeVisibilityTest)
 	EXPECT_ANY_THROW(octreeRepresentation->setNodeVisible(invalidPath, true));
 }
 
+TEST(OsgOctreeRepresentationTests, MergedGeometryTest)
+{
+	auto runtime = std::make_shared<Runtime>("config.txt");
+	auto octreeShape = std::make_shared<SurgSim::Math::OctreeShape>();
+	octreeShape->loadOctree("Geometry/staple.ply");
+
+	auto octreeRepresentation = std::make_shared<OsgOctreeRepresentation>("TestOctree");
+	EXPECT_EQ(0u, octreeRepresentation->getNumChunks());
+	octreeRepresentation->setOctreeShape(octreeShape);
+	size_t numChunks = octreeRepresentation->getNumChunks();
+	EXPECT_LT(0u, numChunks);
+
+	EXPECT_TRUE(octreeRepresentation->initialize(runtime));
+	EXPECT_TRUE(octreeRepresentation->wakeUp());
+
+	// Hiding the root removes all the chunks, the geometry is only rebuilt on update
+	SurgSim::DataStructures::OctreePath root;
+	octreeRepresentation->setNodeVisible(root, false);
+	EXPECT_EQ(numChunks, octreeRepresentation->getNumChunks());
+	octreeRepresentation->update(0.1);
+	EXPECT_EQ(0u, octreeRepresentation->getNumChunks());
+
+	octreeRepresentation->setNodeVisible(root, true);
+	octreeRepresentation->update(0.1);
+	EXPECT_EQ(numChunks, octreeRepresentation->getNumChunks());
+}
+
+TEST(OsgOctreeRepresentationTests, DeepOctreeTest)
+{
+	OctreeShape::NodeType::AxisAlignedBoundingBox boundingBox(Vector3d::Zero(), Vector3d::Ones() * 4.0);
+	auto octreeNode = std::make_shared<OctreeShape::NodeType>(boundingBox);
+	octreeNode->addData(Vector3d(0.0, 0.0, 0.0), 16, SurgSim::DataStructures::EmptyData());
+	auto octreeShape = std::make_shared<SurgSim::Math::OctreeShape>(*octreeNode);
+
+	// The leaf is drawn with a cell of its ancestor at the largest rasterized depth
+	auto runtime = std::make_shared<Runtime>();
+	auto octreeRepresentation = std::make_shared<OsgOctreeRepresentation>("TestOctree");
+	ASSERT_NO_THROW(octreeRepresentation->setOctreeShape(octreeShape));
+	EXPECT_EQ(1u, octreeRepresentation->getNumChunks());
+	EXPECT_TRUE(octreeRepresentation->initialize(runtime));
+	EXPECT_TRUE(octreeRepresentation->wakeUp());
+
+	// Hiding the only leaf empties the cell
+	SurgSim::DataStructures::OctreePath path(15, 0);
+	octreeRepresentation->setNodeVisible(path, false);
+	octreeRepresentation->update(0.1);
+	EXPECT_EQ(0u, octreeRepresentation->getNumChunks());
+
+	octreeRepresentation->setNodeVisible(path, true);
+	octreeRepresentation->update(0.1);
+	EXPECT_EQ(1u, octreeRepresentation->getNumChunks());
+}
+
 TEST(OsgOctreeRepresentationTests, SerializationTest)
 {
 	Runtime runtime("config.txt");
@@ -17,9 +17,15 @@
 
 #include <gtest/gtest.h>
 
+#include <osg/Geode>
+#include <osg/Geometry>
+
 #include "SurgSim/DataStructures/EmptyData.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
+#include "SurgSim/Graphics/OsgMaterial.h"
 #include "SurgSim/Graphics/OsgPointCloudRepresentation.h"
+#include "SurgSim/Graphics/OsgProgram.h"
+#include "SurgSim/Graphics/OsgRepresentation.h"
 #include "SurgSim/Math/Vector.h"
 
 using SurgSim::DataStructures::EmptyData;
@@ -87,6 +93,94 @@ TEST(OsgPointCloudRepresentationTests, VertexTest)
 	}
 }
 
+TEST(OsgPointCloudRepresentationTests, FloatBuffersTest)
+{
+	auto pointCloud = std::make_shared<OsgPointCloudRepresentation>("TestPointCloud");
+	pointCloud->reservePoints(16);
+
+	std::vector<float> positions = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+	std::vector<float> sizes = {1.0f, 2.0f, 3.0f};
+	std::vector<float> colors(12, 0.5f);
+	pointCloud->updateVertices(positions.data(), 3);
+	pointCloud->updatePointSizes(sizes.data(), 3);
+	pointCloud->updatePointColors(colors.data(), 3);
+	pointCloud->update(0.1);
+
+	// Switch, material proxy, transform, geode
+	osg::Node* node = pointCloud->getOsgNode();
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_NE(nullptr, node->asGroup());
+		node = node->asGroup()->getChild(0);
+	}
+	auto geode = node->asGeode();
+	ASSERT_NE(nullptr, geode);
+	auto geometry = geode->getDrawable(0)->asGeometry();
+	ASSERT_NE(nullptr, geometry);
+
+	auto vertices = dynamic_cast<osg::Vec3Array*>(geometry->getVertexArray());
+	ASSERT_NE(nullptr, vertices);
+	EXPECT_EQ(16u, vertices->size());
+	EXPECT_EQ(osg::Vec3(6.0f, 7.0f, 8.0f), (*vertices)[2]);
+	auto drawArrays = dynamic_cast<osg::DrawArrays*>(geometry->getPrimitiveSet(0));
+	ASSERT_NE(nullptr, drawArrays);
+	EXPECT_EQ(3, drawArrays->getCount());
+
+	auto pointSizes = dynamic_cast<osg::FloatArray*>(geometry->getVertexAttribArray(POINT_SIZE_VERTEX_ATTRIBUTE_ID));
+	ASSERT_NE(nullptr, pointSizes);
+	EXPECT_EQ(3.0f, (*pointSizes)[2]);
+	auto pointColors = dynamic_cast<osg::Vec4Array*>(geometry->getColorArray());
+	ASSERT_NE(nullptr, pointColors);
+	EXPECT_EQ(16u, pointColors->size());
+	EXPECT_EQ(osg::Array::BIND_PER_VERTEX, pointColors->getBinding());
+
+	// The points that were not streamed yet have the color and the size of the whole cloud
+	EXPECT_EQ(osg::Vec4(1.0f, 1.0f, 1.0f, 1.0f), (*pointColors)[15]);
+	EXPECT_EQ(1.0f, (*pointSizes)[15]);
+
+	// The program only sets the size of the points if it binds the per point sizes
+	osg::StateSet* stateSet = geometry->getOrCreateStateSet();
+	EXPECT_EQ(osg::StateAttribute::INHERIT, stateSet->getMode(GL_VERTEX_PROGRAM_POINT_SIZE));
+	auto material = std::make_shared<OsgMaterial>("material");
+	auto program = std::make_shared<OsgProgram>();
+	material->setProgram(program);
+	pointCloud->setMaterial(material);
+	pointCloud->update(0.1);
+	EXPECT_EQ(osg::StateAttribute::INHERIT, stateSet->getMode(GL_VERTEX_PROGRAM_POINT_SIZE));
+	program->setAttributeLocation("pointSize", POINT_SIZE_VERTEX_ATTRIBUTE_ID);
+	pointCloud->update(0.1);
+	EXPECT_EQ(osg::StateAttribute::ON, stateSet->getMode(GL_VERTEX_PROGRAM_POINT_SIZE));
+	pointCloud->clearMaterial();
+	pointCloud->update(0.1);
+	EXPECT_EQ(osg::StateAttribute::OFF, stateSet->getMode(GL_VERTEX_PROGRAM_POINT_SIZE));
+
+	// Fewer points, only the one that moved is written, the array is not reallocated
+	positions[3] = 10.0f;
+	pointCloud->updateVertices(positions.data(), 2, 1, 2);
+	pointCloud->update(0.1);
+	EXPECT_EQ(vertices, geometry->getVertexArray());
+	EXPECT_EQ(2, drawArrays->getCount());
+	EXPECT_EQ(osg::Vec3(10.0f, 4.0f, 5.0f), (*vertices)[1]);
+
+	// The bound only covers the points that are drawn
+	ASSERT_NE(nullptr, geometry->getComputeBoundingBoxCallback());
+	osg::BoundingBox box = geometry->getComputeBoundingBoxCallback()->computeBound(*geometry);
+	EXPECT_NEAR(10.0f, box.xMax(), epsilon);
+	EXPECT_NEAR(1.0f, box.yMin(), epsilon);
+
+	// The vertices are not used once positions were streamed
+	pointCloud->getVertices()->addVertex(PointCloud::VertexType(Vector3d(1.0, 1.0, 1.0)));
+	pointCloud->update(0.1);
+	EXPECT_EQ(2, drawArrays->getCount());
+
+	// A color for the whole cloud replaces the per point colors
+	pointCloud->setColor(Vector4d(1.0, 0.0, 0.0, 1.0));
+	auto overallColor = dynamic_cast<osg::Vec4Array*>(geometry->getColorArray());
+	ASSERT_NE(nullptr, overallColor);
+	EXPECT_EQ(1u, overallColor->size());
+	EXPECT_EQ(osg::Array::BIND_OVERALL, overallColor->getBinding());
+}
+
 TEST(OsgPointCloudRepresentationTests, SerializationTest)
 {
 	auto pointCloud = std::make_shared<OsgPointCloudRepresentation>("TestPointCloud");
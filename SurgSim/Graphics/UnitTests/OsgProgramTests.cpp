@@ -290,5 +290,28 @@ TEST(OsgProgramTests, ClearShaderTest)
 	}
 }
 
+TEST(OsgProgramTests, AttributeLocationTest)
+{
+	std::shared_ptr<OsgProgram> osgProgram = std::make_shared<OsgProgram>();
+	std::shared_ptr<Program> program = osgProgram;
+
+	int location = -1;
+	EXPECT_FALSE(program->getAttributeLocation("pointSize", &location));
+	EXPECT_EQ(-1, location);
+
+	program->setAttributeLocation("pointSize", 8);
+	ASSERT_TRUE(program->getAttributeLocation("pointSize", &location));
+	EXPECT_EQ(8, location);
+	EXPECT_FALSE(program->getAttributeLocation("tangent", &location));
+
+	auto bindings = osgProgram->getOsgProgram()->getAttribBindingList();
+	ASSERT_EQ(1u, bindings.size());
+	EXPECT_EQ(8u, bindings["pointSize"]);
+
+	program->setAttributeLocation("pointSize", 6);
+	ASSERT_TRUE(program->getAttributeLocation("pointSize", &location));
+	EXPECT_EQ(6, location);
+}
+
 }  // namespace Graphics
 }  // namespace SurgSim
@@ -157,3 +157,38 @@ TEST_F(OsgSceneryRepresentationTest, GenerateTangents)
 	}
 
 }
+
+TEST_F(OsgSceneryRepresentationTest, LevelsOfDetail)
+{
+	EXPECT_EQ(1u, sceneryObject->getLevelsOfDetail());
+	EXPECT_ANY_THROW(sceneryObject->setLevelsOfDetail(0));
+
+	sceneryObject->setValue("LevelsOfDetail", static_cast<size_t>(3));
+	sceneryObject->setValue("LevelOfDetailPixelSize", 100.0);
+	EXPECT_EQ(3u, sceneryObject->getLevelsOfDetail());
+	EXPECT_DOUBLE_EQ(100.0, sceneryObject->getLevelOfDetailPixelSize());
+
+	// The levels are built in the model and shared by the representations using it
+	sceneryObject->loadModel("Geometry/Torus.obj");
+	auto model = std::dynamic_pointer_cast<SurgSim::Graphics::OsgModel>(sceneryObject->getModel());
+	ASSERT_NE(nullptr, model);
+	EXPECT_EQ(3u, model->getNumLevelsOfDetail());
+	EXPECT_ANY_THROW(model->getOsgLevelOfDetail(3));
+
+	auto levels = sceneryObject->getModelNode()->asGroup();
+	ASSERT_NE(nullptr, levels);
+	ASSERT_EQ(3u, levels->getNumChildren());
+	for (unsigned int level = 0; level < 3; ++level)
+	{
+		EXPECT_EQ(model->getOsgLevelOfDetail(level), levels->getChild(level));
+	}
+	EXPECT_EQ(model->getOsgNode(), levels->getChild(0));
+
+	sceneryObject2->setLevelsOfDetail(3);
+	sceneryObject2->setModel(model);
+	EXPECT_EQ(model->getOsgLevelOfDetail(1), sceneryObject2->getModelNode()->asGroup()->getChild(1));
+
+	// Without levels the model is used directly
+	sceneryObject->setLevelsOfDetail(1);
+	EXPECT_EQ(model->getOsgNode(), sceneryObject->getModelNode());
+}
@@ -16,11 +16,13 @@
 /// \file
 /// Unit Tests for the OsgSkeletonRepresentation class.
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <memory>
 
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Graphics/CpuSkinning.h"
 #include "SurgSim/Graphics/OsgManager.h"
 #include "SurgSim/Graphics/OsgSkeletonRepresentation.h"
 #include "SurgSim/Graphics/OsgViewElement.h"
@@ -188,6 +190,41 @@ TEST_F(OsgSkeletonRepresentationTest, NeutralPosesTest)
 	}
 }
 
+TEST_F(OsgSkeletonRepresentationTest, BonePaletteTest)
+{
+	auto skeleton = std::make_shared<OsgSkeletonRepresentation>("test");
+	skeleton->loadModel("OsgSkeletonRepresentationTests/rigged_cylinder.osgt");
+	skeleton->setSkinningShaderFileName("Shaders/skinning.vert");
+	EXPECT_TRUE(skeleton->getBoneNames().empty());
+
+	CpuSkinning skinning;
+	EXPECT_ANY_THROW(skeleton->buildCpuSkinning(&skinning));
+
+	ASSERT_TRUE(skeleton->initialize(runtime));
+	std::vector<std::string> names = skeleton->getBoneNames();
+	ASSERT_FALSE(names.empty());
+	EXPECT_NE(names.end(), std::find(names.begin(), names.end(), "Bone"));
+	EXPECT_EQ(names.size(), skeleton->getBonePalette().size());
+
+	ASSERT_TRUE(skeleton->buildCpuSkinning(&skinning));
+	ASSERT_LT(0u, skinning.getNumVertices());
+	EXPECT_LT(0u, skinning.getBonesPerVertex());
+
+	// Moving a bone changes the palette, and the skinned vertices follow
+	skinning.update(skeleton->getBonePalette());
+	std::vector<SurgSim::Math::Vector3f> before = skinning.getPositions();
+	skeleton->setBonePose("Bone", makeRigidTransform(makeRotationQuaternion(0.5, Vector3d::UnitX().eval()),
+						  Vector3d(0.0, 0.0, 1.0)));
+	skeleton->update(0.1);
+	skinning.update(skeleton->getBonePalette());
+	bool isMoved = false;
+	for (size_t i = 0; i < before.size(); ++i)
+	{
+		isMoved = isMoved || !before[i].isApprox(skinning.getPositions()[i]);
+	}
+	EXPECT_TRUE(isMoved);
+}
+
 TEST_F(OsgSkeletonRepresentationTest, AccessibleTest)
 {
 	std::shared_ptr<SurgSim::Framework::Component> component;
@@ -0,0 +1,149 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Graphics/PointCloudBuffers.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(PointCloudBuffersTests, Init)
+{
+	PointCloudBuffers buffers;
+	EXPECT_EQ(0u, buffers.getCapacity());
+	EXPECT_FALSE(buffers.isWritten(PointCloudBuffers::ATTRIBUTE_POSITION));
+	EXPECT_EQ(3u, PointCloudBuffers::getNumComponents(PointCloudBuffers::ATTRIBUTE_POSITION));
+	EXPECT_EQ(1u, PointCloudBuffers::getNumComponents(PointCloudBuffers::ATTRIBUTE_SIZE));
+	EXPECT_EQ(4u, PointCloudBuffers::getNumComponents(PointCloudBuffers::ATTRIBUTE_COLOR));
+
+	std::vector<float> sizes;
+	size_t numPoints = 7;
+	EXPECT_FALSE(buffers.take(PointCloudBuffers::ATTRIBUTE_SIZE, &sizes, &numPoints));
+	EXPECT_EQ(7u, numPoints);
+
+	buffers.reserve(10);
+	EXPECT_EQ(10u, buffers.getCapacity());
+	buffers.reserve(5);
+	EXPECT_EQ(10u, buffers.getCapacity());
+}
+
+TEST(PointCloudBuffersTests, WriteAndTake)
+{
+	PointCloudBuffers buffers;
+	std::vector<float> positions;
+	for (int i = 0; i < 12; ++i)
+	{
+		positions.push_back(static_cast<float>(i));
+	}
+
+	buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions.data(), 4);
+	EXPECT_TRUE(buffers.isWritten(PointCloudBuffers::ATTRIBUTE_POSITION));
+	EXPECT_FALSE(buffers.isWritten(PointCloudBuffers::ATTRIBUTE_COLOR));
+	EXPECT_EQ(4u, buffers.getCapacity());
+
+	std::vector<std::array<float, 3>> array;
+	size_t numPoints = 0;
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, &array, &numPoints));
+	EXPECT_EQ(4u, numPoints);
+	ASSERT_EQ(4u, array.size());
+	for (size_t i = 0; i < 4; ++i)
+	{
+		for (size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_EQ(positions[3 * i + j], array[i][j]);
+		}
+	}
+	EXPECT_FALSE(buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, &array, &numPoints));
+
+	// Only the dirty ranges are copied, ranges written before a take are merged with the points in between
+	for (auto& position : positions)
+	{
+		position += 100.0f;
+	}
+	buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions.data(), 4, 1, 2);
+	buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions.data(), 4, 3, 4);
+	array[0][0] = -1.0f;
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, &array, &numPoints));
+	EXPECT_EQ(-1.0f, array[0][0]);
+	EXPECT_EQ(103.0f, array[1][0]);
+	EXPECT_EQ(6.0f, array[2][0]);
+	EXPECT_EQ(109.0f, array[3][0]);
+
+	// Fewer points keep the array as it is
+	buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions.data(), 2, 0, 0);
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, &array, &numPoints));
+	EXPECT_EQ(2u, numPoints);
+	EXPECT_EQ(4u, array.size());
+	EXPECT_EQ(-1.0f, array[0][0]);
+
+	// More points than the capacity grow the buffers and the array
+	positions.resize(3 * 5, 200.0f);
+	buffers.write(PointCloudBuffers::ATTRIBUTE_POSITION, positions.data(), 5, 4);
+	EXPECT_LE(5u, buffers.getCapacity());
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_POSITION, &array, &numPoints));
+	EXPECT_EQ(5u, numPoints);
+	EXPECT_EQ(buffers.getCapacity(), array.size());
+	EXPECT_EQ(200.0f, array[4][2]);
+	EXPECT_EQ(109.0f, array[3][0]);
+}
+
+TEST(PointCloudBuffersTests, Attributes)
+{
+	PointCloudBuffers buffers;
+	buffers.reserve(8);
+
+	std::vector<float> sizes(3, 2.0f);
+	buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, sizes.data(), 3);
+	std::vector<float> colors(12, 0.5f);
+	buffers.write(PointCloudBuffers::ATTRIBUTE_COLOR, colors.data(), 3);
+
+	std::vector<float> sizeArray;
+	size_t numPoints = 0;
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_SIZE, &sizeArray, &numPoints));
+	EXPECT_EQ(3u, numPoints);
+	EXPECT_EQ(8u, sizeArray.size());
+	EXPECT_EQ(2.0f, sizeArray[2]);
+
+	std::vector<std::array<float, 4>> colorArray;
+	std::array<float, 4> white = {{1.0f, 1.0f, 1.0f, 1.0f}};
+	ASSERT_TRUE(buffers.take(PointCloudBuffers::ATTRIBUTE_COLOR, &colorArray, &numPoints, white));
+	EXPECT_EQ(8u, colorArray.size());
+	EXPECT_EQ(0.5f, colorArray[2][3]);
+
+	// The points that were not written yet get the fill value
+	EXPECT_EQ(white, colorArray[3]);
+	EXPECT_EQ(white, colorArray[7]);
+	EXPECT_EQ(0.0f, sizeArray[3]);
+
+	// The elements of the array have to match the attribute
+	buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, sizes.data(), 3);
+	EXPECT_THROW(buffers.take(PointCloudBuffers::ATTRIBUTE_SIZE, &colorArray, &numPoints),
+				 Framework::AssertionFailure);
+
+	EXPECT_THROW(buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, sizes.data(), 3, 2, 1),
+				 Framework::AssertionFailure);
+	EXPECT_THROW(buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, nullptr, 3), Framework::AssertionFailure);
+	EXPECT_NO_THROW(buffers.write(PointCloudBuffers::ATTRIBUTE_SIZE, nullptr, 3, 0, 0));
+}
+
+};  // namespace Graphics
+};  // namespace SurgSim
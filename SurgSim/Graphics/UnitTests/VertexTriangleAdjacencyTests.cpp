@@ -0,0 +1,223 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <osg/Array>
+#include <osg/Geometry>
+#include <osg/ref_ptr>
+#include <vector>
+
+#include "SurgSim/Graphics/TangentSpaceGenerator.h"
+#include "SurgSim/Graphics/TriangleNormalGenerator.h"
+#include "SurgSim/Graphics/VertexTriangleAdjacency.h"
+
+namespace
+{
+
+const float epsilon = 1e-5f;
+
+/// Create a bumpy grid of size x size vertices, with texture coordinates, large enough to be processed in parallel
+osg::ref_ptr<osg::Geometry> makeGrid(unsigned int size)
+{
+	osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
+	osg::ref_ptr<osg::Vec3Array> vertices = new osg::Vec3Array(size * size);
+	osg::ref_ptr<osg::Vec2Array> textureCoords = new osg::Vec2Array(size * size);
+	for (unsigned int i = 0; i < size; ++i)
+	{
+		for (unsigned int j = 0; j < size; ++j)
+		{
+			(*vertices)[i * size + j].set(static_cast<float>(i), static_cast<float>(j),
+										  0.1f * static_cast<float>((i * 7 + j * 13) % 5));
+			(*textureCoords)[i * size + j].set(static_cast<float>(i) / size, static_cast<float>(j) / size);
+		}
+	}
+	geometry->setVertexArray(vertices);
+	geometry->setNormalArray(new osg::Vec3Array(size * size), osg::Array::BIND_PER_VERTEX);
+	geometry->setTexCoordArray(0, textureCoords, osg::Array::BIND_PER_VERTEX);
+
+	osg::ref_ptr<osg::DrawElementsUInt> triangles = new osg::DrawElementsUInt(osg::PrimitiveSet::TRIANGLES);
+	for (unsigned int i = 0; i + 1 < size; ++i)
+	{
+		for (unsigned int j = 0; j + 1 < size; ++j)
+		{
+			unsigned int vertex = i * size + j;
+			triangles->push_back(vertex);
+			triangles->push_back(vertex + 1);
+			triangles->push_back(vertex + size);
+			triangles->push_back(vertex + 1);
+			triangles->push_back(vertex + size + 1);
+			triangles->push_back(vertex + size);
+		}
+	}
+	// Degenerate triangles are ignored
+	triangles->push_back(0);
+	triangles->push_back(0);
+	triangles->push_back(0);
+	geometry->addPrimitiveSet(triangles);
+	return geometry;
+}
+
+osg::DrawElementsUInt* getTriangles(osg::Geometry* geometry)
+{
+	return static_cast<osg::DrawElementsUInt*>(geometry->getPrimitiveSet(0));
+}
+
+osg::Vec3Array* getVertices(osg::Geometry* geometry)
+{
+	return static_cast<osg::Vec3Array*>(geometry->getVertexArray());
+}
+
+osg::Vec3Array* getNormals(osg::Geometry* geometry)
+{
+	return static_cast<osg::Vec3Array*>(geometry->getNormalArray());
+}
+
+osg::Vec2Array* getTextureCoords(osg::Geometry* geometry)
+{
+	return static_cast<osg::Vec2Array*>(geometry->getTexCoordArray(0));
+}
+
+/// Calculate the reference normals with the TriangleNormalGenerator
+void generateNormals(osg::Geometry* geometry)
+{
+	auto normalGenerator = SurgSim::Graphics::createNormalGenerator(getVertices(geometry), getNormals(geometry));
+	normalGenerator.reset();
+	geometry->accept(normalGenerator);
+	normalGenerator.normalize();
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(VertexTriangleAdjacencyTests, Build)
+{
+	auto geometry = makeGrid(3);
+	VertexTriangleAdjacency adjacency;
+	EXPECT_EQ(0u, adjacency.getNumVertices());
+	EXPECT_EQ(0u, adjacency.getNumTriangles());
+
+	adjacency.build(*getTriangles(geometry), 9);
+	EXPECT_EQ(9u, adjacency.getNumVertices());
+	EXPECT_EQ(8u, adjacency.getNumTriangles());
+
+	EXPECT_EQ(std::vector<unsigned int>(1, 0), adjacency.getTriangles(0));
+	EXPECT_EQ(std::vector<unsigned int>({1, 2, 3, 4, 5, 6}), adjacency.getTriangles(4));
+	EXPECT_EQ(std::vector<unsigned int>(1, 7), adjacency.getTriangles(8));
+
+	EXPECT_ANY_THROW(adjacency.build(*getTriangles(geometry), 8));
+}
+
+TEST(VertexTriangleAdjacencyTests, CollectAffected)
+{
+	auto geometry = makeGrid(3);
+	VertexTriangleAdjacency adjacency;
+	adjacency.build(*getTriangles(geometry), 9);
+
+	std::vector<unsigned int> triangles;
+	std::vector<unsigned int> vertices;
+	adjacency.collectAffected(std::vector<unsigned int>(1, 0), &triangles, &vertices);
+	EXPECT_EQ(std::vector<unsigned int>(1, 0), triangles);
+	std::sort(vertices.begin(), vertices.end());
+	EXPECT_EQ(std::vector<unsigned int>({0, 1, 3}), vertices);
+
+	// Repeated calls start from scratch
+	adjacency.collectAffected(std::vector<unsigned int>({0, 8}), &triangles, &vertices);
+	std::sort(triangles.begin(), triangles.end());
+	std::sort(vertices.begin(), vertices.end());
+	EXPECT_EQ(std::vector<unsigned int>({0, 7}), triangles);
+	EXPECT_EQ(std::vector<unsigned int>({0, 1, 3, 5, 7, 8}), vertices);
+}
+
+TEST(VertexTriangleAdjacencyTests, Normals)
+{
+	auto geometry = makeGrid(200);
+	auto vertices = getVertices(geometry);
+	generateNormals(geometry);
+
+	VertexTriangleAdjacency adjacency;
+	adjacency.build(*getTriangles(geometry), vertices->size());
+	osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array(vertices->size());
+	adjacency.computeNormals(*vertices, normals);
+
+	auto expected = getNormals(geometry);
+	for (size_t i = 0; i < vertices->size(); ++i)
+	{
+		EXPECT_NEAR(0.0f, ((*normals)[i] - (*expected)[i]).length(), epsilon);
+	}
+}
+
+TEST(VertexTriangleAdjacencyTests, IncrementalNormals)
+{
+	auto geometry = makeGrid(200);
+	auto vertices = getVertices(geometry);
+
+	VertexTriangleAdjacency adjacency;
+	adjacency.build(*getTriangles(geometry), vertices->size());
+	osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array(vertices->size());
+	adjacency.computeNormals(*vertices, normals);
+
+	std::vector<unsigned int> changed;
+	changed.push_back(0);
+	changed.push_back(1234);
+	changed.push_back(static_cast<unsigned int>(vertices->size() - 1));
+	for (auto vertexId : changed)
+	{
+		(*vertices)[vertexId] += osg::Vec3(0.2f, -0.3f, 0.5f);
+	}
+
+	std::vector<unsigned int> affectedTriangles;
+	std::vector<unsigned int> affectedVertices;
+	adjacency.collectAffected(changed, &affectedTriangles, &affectedVertices);
+	adjacency.computeNormals(*vertices, affectedTriangles, affectedVertices, normals);
+
+	generateNormals(geometry);
+	auto expected = getNormals(geometry);
+	for (size_t i = 0; i < vertices->size(); ++i)
+	{
+		EXPECT_NEAR(0.0f, ((*normals)[i] - (*expected)[i]).length(), epsilon);
+	}
+}
+
+TEST(VertexTriangleAdjacencyTests, Tangents)
+{
+	auto geometry = makeGrid(100);
+	auto vertices = getVertices(geometry);
+	generateNormals(geometry);
+	TangentSpaceGenerator::generateTangentSpace(geometry, 0, 6, 7, true);
+	auto expectedTangents = static_cast<osg::Vec4Array*>(geometry->getVertexAttribArray(6));
+	auto expectedBitangents = static_cast<osg::Vec4Array*>(geometry->getVertexAttribArray(7));
+
+	VertexTriangleAdjacency adjacency;
+	adjacency.build(*getTriangles(geometry), vertices->size());
+	osg::ref_ptr<osg::Vec4Array> tangents = new osg::Vec4Array(vertices->size());
+	osg::ref_ptr<osg::Vec4Array> bitangents = new osg::Vec4Array(vertices->size());
+	adjacency.computeTangents(*vertices, *getNormals(geometry), *getTextureCoords(geometry), true,
+							  tangents, bitangents);
+
+	for (size_t i = 0; i < vertices->size(); ++i)
+	{
+		EXPECT_NEAR(0.0f, ((*tangents)[i] - (*expectedTangents)[i]).length(), epsilon);
+		EXPECT_NEAR(0.0f, ((*bitangents)[i] - (*expectedBitangents)[i]).length(), epsilon);
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,236 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "SurgSim/Graphics/VoxelSurface.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::Math::Vector3f;
+
+namespace
+{
+
+/// The surface of all the chunks of a voxel surface
+struct Surface
+{
+	std::vector<Vector3f> vertices;
+	std::vector<Vector3f> normals;
+	std::vector<unsigned int> triangles;
+	size_t numChunks;
+};
+
+Surface buildAll(SurgSim::Graphics::VoxelSurface* voxels)
+{
+	Surface result;
+	result.numChunks = 0;
+	std::vector<Vector3f> vertices;
+	std::vector<Vector3f> normals;
+	std::vector<unsigned int> triangles;
+	auto chunks = voxels->takeDirtyChunks();
+	for (auto chunk = chunks.cbegin(); chunk != chunks.cend(); ++chunk)
+	{
+		voxels->buildSurface(*chunk, &vertices, &normals, &triangles);
+		if (!triangles.empty())
+		{
+			++result.numChunks;
+		}
+		for (auto triangle = triangles.cbegin(); triangle != triangles.cend(); ++triangle)
+		{
+			result.triangles.push_back(*triangle + static_cast<unsigned int>(result.vertices.size()));
+		}
+		result.vertices.insert(result.vertices.end(), vertices.begin(), vertices.end());
+		result.normals.insert(result.normals.end(), normals.begin(), normals.end());
+	}
+	return result;
+}
+
+/// \return The area of the surface, and check that the triangles face along their normals
+float getArea(const Surface& surface)
+{
+	float area = 0.0f;
+	for (size_t i = 0; i < surface.triangles.size(); i += 3)
+	{
+		const Vector3f& a = surface.vertices[surface.triangles[i]];
+		const Vector3f& b = surface.vertices[surface.triangles[i + 1]];
+		const Vector3f& c = surface.vertices[surface.triangles[i + 2]];
+		Vector3f normal = (b - a).cross(c - a);
+		EXPECT_NEAR(normal.norm(), normal.dot(surface.normals[surface.triangles[i]]), 1e-5f);
+		area += 0.5f * normal.norm();
+	}
+	return area;
+}
+
+/// \return The number of faces of filled cells that are not shared with another filled cell
+size_t countExposedFaces(const SurgSim::Graphics::VoxelSurface& voxels, const Eigen::Vector3i& min,
+						 const Eigen::Vector3i& max)
+{
+	size_t result = 0;
+	Eigen::Vector3i cell;
+	for (cell.z() = min.z(); cell.z() < max.z(); ++cell.z())
+	{
+		for (cell.y() = min.y(); cell.y() < max.y(); ++cell.y())
+		{
+			for (cell.x() = min.x(); cell.x() < max.x(); ++cell.x())
+			{
+				if (voxels.isFilled(cell))
+				{
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						result += voxels.isFilled(cell + Eigen::Vector3i::Unit(axis)) ? 0 : 1;
+						result += voxels.isFilled(cell - Eigen::Vector3i::Unit(axis)) ? 0 : 1;
+					}
+				}
+			}
+		}
+	}
+	return result;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+TEST(VoxelSurfaceTests, Cells)
+{
+	VoxelSurface voxels(4);
+	EXPECT_EQ(4, voxels.getChunkSize());
+	EXPECT_EQ(0u, voxels.getNumFilled());
+	EXPECT_TRUE(voxels.getChunk(Eigen::Vector3i(3, 4, -1)).isApprox(Eigen::Vector3i(0, 1, -1)));
+
+	voxels.setCells(Eigen::Vector3i(-2, 0, 0), Eigen::Vector3i(3, 2, 1), true);
+	EXPECT_EQ(10u, voxels.getNumFilled());
+	EXPECT_TRUE(voxels.isFilled(Eigen::Vector3i(-2, 0, 0)));
+	EXPECT_TRUE(voxels.isFilled(Eigen::Vector3i(2, 1, 0)));
+	EXPECT_FALSE(voxels.isFilled(Eigen::Vector3i(3, 1, 0)));
+	EXPECT_FALSE(voxels.isFilled(Eigen::Vector3i(0, 0, 1)));
+
+	// Filling again does not change the count
+	voxels.setCell(Eigen::Vector3i(0, 0, 0), true);
+	EXPECT_EQ(10u, voxels.getNumFilled());
+
+	voxels.setCell(Eigen::Vector3i(0, 0, 0), false);
+	EXPECT_EQ(9u, voxels.getNumFilled());
+	EXPECT_FALSE(voxels.isFilled(Eigen::Vector3i(0, 0, 0)));
+
+	voxels.clear();
+	EXPECT_EQ(0u, voxels.getNumFilled());
+	EXPECT_FALSE(voxels.isFilled(Eigen::Vector3i(2, 1, 0)));
+}
+
+TEST(VoxelSurfaceTests, DirtyChunks)
+{
+	VoxelSurface voxels(4);
+	EXPECT_TRUE(voxels.takeDirtyChunks().empty());
+
+	// A cell in the middle of a chunk only changes the surface of its own chunk
+	voxels.setCell(Eigen::Vector3i(1, 1, 1), true);
+	auto dirty = voxels.takeDirtyChunks();
+	ASSERT_EQ(1u, dirty.size());
+	EXPECT_TRUE(dirty[0].isApprox(Eigen::Vector3i::Zero()));
+	EXPECT_TRUE(voxels.takeDirtyChunks().empty());
+
+	// Setting a cell to its current state changes nothing
+	voxels.setCell(Eigen::Vector3i(1, 1, 1), true);
+	EXPECT_TRUE(voxels.takeDirtyChunks().empty());
+
+	// A cell at the border of a chunk changes the faces of the neighboring chunk
+	voxels.setCell(Eigen::Vector3i(3, 1, 1), true);
+	dirty = voxels.takeDirtyChunks();
+	ASSERT_EQ(2u, dirty.size());
+	EXPECT_TRUE(std::any_of(dirty.begin(), dirty.end(), [](const Eigen::Vector3i& chunk)
+	{
+		return chunk.isApprox(Eigen::Vector3i(1, 0, 0));
+	}));
+
+	// Emptying a box without filled cells changes nothing
+	voxels.setCells(Eigen::Vector3i(-7, -7, -7), Eigen::Vector3i(13, 1, 1), false);
+	EXPECT_TRUE(voxels.takeDirtyChunks().empty());
+
+	// Only the chunk whose cells changed is dirty, with the neighbors next to the sides the box goes through
+	voxels.setCells(Eigen::Vector3i(-7, -7, -7), Eigen::Vector3i(3, 2, 2), false);
+	EXPECT_EQ(1u, voxels.getNumFilled());
+	EXPECT_EQ(4u, voxels.takeDirtyChunks().size());
+
+	// Emptying a huge box only visits the existing chunks, a chunk that is emptied as a whole changes the faces of
+	// all its neighbors
+	voxels.setCells(Eigen::Vector3i::Constant(-(1 << 21)), Eigen::Vector3i::Constant(1 << 21), false);
+	EXPECT_EQ(0u, voxels.getNumFilled());
+	EXPECT_EQ(7u, voxels.takeDirtyChunks().size());
+
+	voxels.setCell(Eigen::Vector3i(1, 1, 1), true);
+	voxels.takeDirtyChunks();
+	voxels.clear();
+	EXPECT_EQ(1u, voxels.takeDirtyChunks().size());
+}
+
+TEST(VoxelSurfaceTests, MergedFaces)
+{
+	VoxelSurface voxels(8);
+
+	// A single cell is a box
+	voxels.setCell(Eigen::Vector3i(1, 2, 3), true);
+	Surface surface = buildAll(&voxels);
+	EXPECT_EQ(1u, surface.numChunks);
+	EXPECT_EQ(24u, surface.vertices.size());
+	EXPECT_EQ(36u, surface.triangles.size());
+	EXPECT_NEAR(6.0f, getArea(surface), 1e-5f);
+	for (auto vertex = surface.vertices.cbegin(); vertex != surface.vertices.cend(); ++vertex)
+	{
+		EXPECT_TRUE((vertex->array() >= Vector3f(1.0f, 2.0f, 3.0f).array()).all());
+		EXPECT_TRUE((vertex->array() <= Vector3f(2.0f, 3.0f, 4.0f).array()).all());
+	}
+
+	// A full box of cells is still six rectangles
+	voxels.clear();
+	voxels.setCells(Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(5, 3, 2), true);
+	surface = buildAll(&voxels);
+	EXPECT_EQ(24u, surface.vertices.size());
+	EXPECT_NEAR(2.0f * (15.0f + 10.0f + 6.0f), getArea(surface), 1e-5f);
+
+	// The faces between chunks are not part of the surface
+	voxels.clear();
+	voxels.setCells(Eigen::Vector3i(-3, 0, 0), Eigen::Vector3i(13, 1, 1), true);
+	surface = buildAll(&voxels);
+	EXPECT_EQ(3u, surface.numChunks);
+	EXPECT_NEAR(16.0f * 4.0f + 2.0f, getArea(surface), 1e-5f);
+}
+
+TEST(VoxelSurfaceTests, RandomCells)
+{
+	VoxelSurface voxels(8);
+	unsigned int seed = 12345;
+	for (int i = 0; i < 2000; ++i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		Eigen::Vector3i cell(static_cast<int>((seed >> 8) % 20), static_cast<int>((seed >> 13) % 20),
+							 static_cast<int>((seed >> 18) % 20));
+		voxels.setCell(cell - Eigen::Vector3i::Constant(4), (seed >> 28) != 0);
+	}
+	Surface surface = buildAll(&voxels);
+	size_t numFaces = countExposedFaces(voxels, Eigen::Vector3i::Constant(-4), Eigen::Vector3i::Constant(16));
+	EXPECT_NEAR(static_cast<float>(numFaces), getArea(surface), 1e-3f);
+	// Merging reduces the number of rectangles below the number of faces
+	EXPECT_GT(getArea(surface), static_cast<float>(surface.vertices.size() / 4));
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
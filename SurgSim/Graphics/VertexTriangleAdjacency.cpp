@@ -0,0 +1,354 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/VertexTriangleAdjacency.h"
+
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <future>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/Runtime.h"
+#include "SurgSim/Framework/ThreadPool.h"
+#include "SurgSim/Graphics/TangentSpaceGenerator.h"
+
+namespace
+{
+
+/// Minimum number of items handled by one task, smaller workloads are processed on the calling thread
+const size_t MIN_ITEMS_PER_TASK = 4096;
+
+/// Split the range [0, count) into contiguous blocks and process them on the Runtime thread pool
+/// \param count The number of items
+/// \param function Processes the items [begin, end)
+void parallelFor(size_t count, const std::function<void(size_t, size_t)>& function)
+{
+	size_t numTasks = std::min(count / MIN_ITEMS_PER_TASK,
+							   static_cast<size_t>(std::max(boost::thread::hardware_concurrency(), 1u)));
+	if (numTasks < 2)
+	{
+		function(0, count);
+		return;
+	}
+
+	auto threadPool = SurgSim::Framework::Runtime::getThreadPool();
+	std::vector<std::future<void>> tasks;
+	size_t blockSize = (count + numTasks - 1) / numTasks;
+	for (size_t begin = blockSize; begin < count; begin += blockSize)
+	{
+		size_t end = std::min(begin + blockSize, count);
+		tasks.push_back(threadPool->enqueue<void>([&function, begin, end]() { function(begin, end); }));
+	}
+
+	// The calling thread handles the first block instead of waiting idle
+	function(0, blockSize);
+
+	for (auto& task : tasks)
+	{
+		task.get();
+	}
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+VertexTriangleAdjacency::VertexTriangleAdjacency() :
+	m_offsets(1, 0)
+{
+}
+
+void VertexTriangleAdjacency::build(const osg::DrawElementsUInt& triangles, size_t numVertices)
+{
+	m_triangleVertices.clear();
+	m_triangleVertices.reserve(triangles.size());
+	for (size_t i = 0; i + 2 < triangles.size(); i += 3)
+	{
+		unsigned int vertex1 = triangles[i];
+		unsigned int vertex2 = triangles[i + 1];
+		unsigned int vertex3 = triangles[i + 2];
+		if (vertex1 == vertex2 || vertex2 == vertex3 || vertex1 == vertex3)
+		{
+			continue;
+		}
+		SURGSIM_ASSERT(vertex1 < numVertices && vertex2 < numVertices && vertex3 < numVertices)
+				<< "Triangle " << i / 3 << " uses a vertex that does not exist, there are " << numVertices
+				<< " vertices.";
+		m_triangleVertices.push_back(vertex1);
+		m_triangleVertices.push_back(vertex2);
+		m_triangleVertices.push_back(vertex3);
+	}
+	size_t numTriangles = m_triangleVertices.size() / 3;
+
+	// Count the triangles of each vertex, then turn the counts into offsets
+	m_offsets.assign(numVertices + 1, 0);
+	for (auto vertexId : m_triangleVertices)
+	{
+		++m_offsets[vertexId + 1];
+	}
+	for (size_t i = 1; i < m_offsets.size(); ++i)
+	{
+		m_offsets[i] += m_offsets[i - 1];
+	}
+
+	std::vector<unsigned int> next(m_offsets.begin(), m_offsets.end() - 1);
+	m_vertexTriangles.resize(m_triangleVertices.size());
+	for (size_t i = 0; i < m_triangleVertices.size(); ++i)
+	{
+		m_vertexTriangles[next[m_triangleVertices[i]]++] = static_cast<unsigned int>(i / 3);
+	}
+
+	m_triangleNormals.resize(numTriangles);
+	m_triangleTangents.resize(numTriangles);
+	m_triangleBitangents.resize(numTriangles);
+	m_isTriangleMarked.assign(numTriangles, false);
+	m_isVertexMarked.assign(numVertices, false);
+}
+
+size_t VertexTriangleAdjacency::getNumVertices() const
+{
+	return m_offsets.size() - 1;
+}
+
+size_t VertexTriangleAdjacency::getNumTriangles() const
+{
+	return m_triangleVertices.size() / 3;
+}
+
+std::vector<unsigned int> VertexTriangleAdjacency::getTriangles(size_t vertexId) const
+{
+	SURGSIM_ASSERT(vertexId < getNumVertices()) << "Invalid vertex id " << vertexId;
+	return std::vector<unsigned int>(m_vertexTriangles.begin() + m_offsets[vertexId],
+									 m_vertexTriangles.begin() + m_offsets[vertexId + 1]);
+}
+
+void VertexTriangleAdjacency::collectAffected(const std::vector<unsigned int>& changedVertices,
+		std::vector<unsigned int>* triangles, std::vector<unsigned int>* vertices)
+{
+	triangles->clear();
+	vertices->clear();
+
+	for (auto vertexId : changedVertices)
+	{
+		SURGSIM_ASSERT(vertexId < getNumVertices()) << "Invalid vertex id " << vertexId;
+		for (unsigned int i = m_offsets[vertexId]; i < m_offsets[vertexId + 1]; ++i)
+		{
+			unsigned int triangleId = m_vertexTriangles[i];
+			if (!m_isTriangleMarked[triangleId])
+			{
+				m_isTriangleMarked[triangleId] = true;
+				triangles->push_back(triangleId);
+			}
+		}
+	}
+
+	for (auto triangleId : *triangles)
+	{
+		m_isTriangleMarked[triangleId] = false;
+		for (size_t i = 0; i < 3; ++i)
+		{
+			unsigned int vertexId = m_triangleVertices[3 * triangleId + i];
+			if (!m_isVertexMarked[vertexId])
+			{
+				m_isVertexMarked[vertexId] = true;
+				vertices->push_back(vertexId);
+			}
+		}
+	}
+
+	for (auto vertexId : *vertices)
+	{
+		m_isVertexMarked[vertexId] = false;
+	}
+}
+
+void VertexTriangleAdjacency::computeNormals(const osg::Vec3Array& vertices, osg::Vec3Array* normals)
+{
+	SURGSIM_ASSERT(vertices.size() == getNumVertices() && normals->size() == getNumVertices())
+			<< "The adjacency was built for " << getNumVertices() << " vertices, but there are " << vertices.size()
+			<< " vertices and " << normals->size() << " normals.";
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	computeTriangleNormals(vertices, nullptr);
+	gatherNormals(nullptr, normals);
+}
+
+void VertexTriangleAdjacency::computeNormals(const osg::Vec3Array& vertices,
+		const std::vector<unsigned int>& triangleIds, const std::vector<unsigned int>& vertexIds,
+		osg::Vec3Array* normals)
+{
+	SURGSIM_ASSERT(vertices.size() == getNumVertices() && normals->size() == getNumVertices())
+			<< "The adjacency was built for " << getNumVertices() << " vertices, but there are " << vertices.size()
+			<< " vertices and " << normals->size() << " normals.";
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	computeTriangleNormals(vertices, &triangleIds);
+	gatherNormals(&vertexIds, normals);
+}
+
+void VertexTriangleAdjacency::computeTangents(const osg::Vec3Array& vertices, const osg::Vec3Array& normals,
+		const osg::Vec2Array& textureCoords, bool orthonormal,
+		osg::Vec4Array* tangents, osg::Vec4Array* bitangents)
+{
+	SURGSIM_ASSERT(vertices.size() == getNumVertices() && normals.size() == getNumVertices() &&
+				   textureCoords.size() == getNumVertices() && tangents->size() == getNumVertices() &&
+				   bitangents->size() == getNumVertices())
+			<< "The adjacency was built for " << getNumVertices() << " vertices, the sizes of the arrays differ.";
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	computeTriangleTangents(vertices, textureCoords, nullptr);
+	gatherTangents(normals, orthonormal, nullptr, tangents, bitangents);
+}
+
+void VertexTriangleAdjacency::computeTangents(const osg::Vec3Array& vertices, const osg::Vec3Array& normals,
+		const osg::Vec2Array& textureCoords, bool orthonormal,
+		const std::vector<unsigned int>& triangleIds, const std::vector<unsigned int>& vertexIds,
+		osg::Vec4Array* tangents, osg::Vec4Array* bitangents)
+{
+	SURGSIM_ASSERT(vertices.size() == getNumVertices() && normals.size() == getNumVertices() &&
+				   textureCoords.size() == getNumVertices() && tangents->size() == getNumVertices() &&
+				   bitangents->size() == getNumVertices())
+			<< "The adjacency was built for " << getNumVertices() << " vertices, the sizes of the arrays differ.";
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	computeTriangleTangents(vertices, textureCoords, &triangleIds);
+	gatherTangents(normals, orthonormal, &vertexIds, tangents, bitangents);
+}
+
+void VertexTriangleAdjacency::computeTriangleNormals(const osg::Vec3Array& vertices,
+		const std::vector<unsigned int>* triangleIds)
+{
+	const osg::Vec3* positions = &vertices.front();
+	const unsigned int* triangleVertices = m_triangleVertices.data();
+	osg::Vec3* triangleNormals = m_triangleNormals.data();
+	size_t count = (triangleIds == nullptr) ? getNumTriangles() : triangleIds->size();
+
+	parallelFor(count, [positions, triangleVertices, triangleNormals, triangleIds](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			size_t triangleId = (triangleIds == nullptr) ? i : (*triangleIds)[i];
+			const unsigned int* ids = triangleVertices + 3 * triangleId;
+			const osg::Vec3& v1 = positions[ids[0]];
+			osg::Vec3 normal = (positions[ids[1]] - v1) ^ (positions[ids[2]] - v1);
+			normal.normalize();
+			triangleNormals[triangleId] = normal;
+		}
+	});
+}
+
+void VertexTriangleAdjacency::gatherNormals(const std::vector<unsigned int>* vertexIds,
+		osg::Vec3Array* normals) const
+{
+	const unsigned int* offsets = m_offsets.data();
+	const unsigned int* vertexTriangles = m_vertexTriangles.data();
+	const osg::Vec3* triangleNormals = m_triangleNormals.data();
+	osg::Vec3* result = &normals->front();
+	size_t count = (vertexIds == nullptr) ? getNumVertices() : vertexIds->size();
+
+	parallelFor(count, [offsets, vertexTriangles, triangleNormals, result, vertexIds](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			size_t vertexId = (vertexIds == nullptr) ? i : (*vertexIds)[i];
+			osg::Vec3 normal(0.0f, 0.0f, 0.0f);
+			for (unsigned int j = offsets[vertexId]; j < offsets[vertexId + 1]; ++j)
+			{
+				normal += triangleNormals[vertexTriangles[j]];
+			}
+			normal.normalize();
+			result[vertexId] = normal;
+		}
+	});
+}
+
+void VertexTriangleAdjacency::computeTriangleTangents(const osg::Vec3Array& vertices,
+		const osg::Vec2Array& textureCoords, const std::vector<unsigned int>* triangleIds)
+{
+	const osg::Vec3* positions = &vertices.front();
+	const osg::Vec2* coordinates = &textureCoords.front();
+	const unsigned int* triangleVertices = m_triangleVertices.data();
+	osg::Vec4* triangleTangents = m_triangleTangents.data();
+	osg::Vec4* triangleBitangents = m_triangleBitangents.data();
+	size_t count = (triangleIds == nullptr) ? getNumTriangles() : triangleIds->size();
+
+	parallelFor(count, [positions, coordinates, triangleVertices, triangleTangents, triangleBitangents,
+						triangleIds](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			size_t triangleId = (triangleIds == nullptr) ? i : (*triangleIds)[i];
+			const unsigned int* ids = triangleVertices + 3 * triangleId;
+			const osg::Vec3 edge1 = positions[ids[1]] - positions[ids[0]];
+			const osg::Vec3 edge2 = positions[ids[2]] - positions[ids[0]];
+			const osg::Vec2 delta1 = coordinates[ids[1]] - coordinates[ids[0]];
+			const osg::Vec2 delta2 = coordinates[ids[2]] - coordinates[ids[0]];
+
+			float r = 1.0f / (delta1.x() * delta2.y() - delta2.x() * delta1.y());
+			triangleTangents[triangleId] = osg::Vec4((edge1 * delta2.y() - edge2 * delta1.y()) * r, 0.0f);
+			triangleBitangents[triangleId] = osg::Vec4((edge2 * delta1.x() - edge1 * delta2.x()) * r, 0.0f);
+		}
+	});
+}
+
+void VertexTriangleAdjacency::gatherTangents(const osg::Vec3Array& normals, bool orthonormal,
+		const std::vector<unsigned int>* vertexIds, osg::Vec4Array* tangents, osg::Vec4Array* bitangents) const
+{
+	const unsigned int* offsets = m_offsets.data();
+	const unsigned int* vertexTriangles = m_vertexTriangles.data();
+	const osg::Vec4* triangleTangents = m_triangleTangents.data();
+	const osg::Vec4* triangleBitangents = m_triangleBitangents.data();
+	const osg::Vec3* vertexNormals = &normals.front();
+	osg::Vec4* resultTangents = &tangents->front();
+	osg::Vec4* resultBitangents = &bitangents->front();
+	size_t count = (vertexIds == nullptr) ? getNumVertices() : vertexIds->size();
+
+	parallelFor(count, [offsets, vertexTriangles, triangleTangents, triangleBitangents, vertexNormals,
+						resultTangents, resultBitangents, orthonormal, vertexIds](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			size_t vertexId = (vertexIds == nullptr) ? i : (*vertexIds)[i];
+			osg::Vec4 tangent(0.0f, 0.0f, 0.0f, 0.0f);
+			osg::Vec4 bitangent(0.0f, 0.0f, 0.0f, 0.0f);
+			for (unsigned int j = offsets[vertexId]; j < offsets[vertexId + 1]; ++j)
+			{
+				tangent += triangleTangents[vertexTriangles[j]];
+				bitangent += triangleBitangents[vertexTriangles[j]];
+			}
+			orthogonalizeTangentSpace(vertexNormals[vertexId], &tangent, &bitangent, orthonormal);
+			resultTangents[vertexId] = tangent;
+			resultBitangents[vertexId] = bitangent;
+		}
+	});
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
@@ -0,0 +1,156 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_VERTEXTRIANGLEADJACENCY_H
+#define SURGSIM_GRAPHICS_VERTEXTRIANGLEADJACENCY_H
+
+#include <vector>
+
+#include <osg/Array>
+#include <osg/PrimitiveSet>
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Lists the triangles around every vertex of a triangle geometry in compressed rows (one contiguous range of
+/// triangle ids per vertex), to compute smooth vertex normals and tangents without going through the osg
+/// TriangleIndexFunctor.
+/// Every triangle value is computed once and then gathered per vertex, so each vertex is only written by one
+/// thread, large meshes are split over the Runtime thread pool. The computation can be restricted to the
+/// neighborhood of a set of changed vertices, see collectAffected().
+/// The results match TriangleNormalGenerator and TangentSpaceGenerator.
+class VertexTriangleAdjacency
+{
+public:
+	/// Constructor
+	VertexTriangleAdjacency();
+
+	/// Rebuild the adjacency, this only needs to be called when the triangles change
+	/// \param triangles The vertex ids of the triangles, three per triangle, degenerate triangles are ignored
+	/// \param numVertices The number of vertices of the geometry
+	void build(const osg::DrawElementsUInt& triangles, size_t numVertices);
+
+	/// \return The number of vertices that the adjacency was built for
+	size_t getNumVertices() const;
+
+	/// \return The number of non degenerate triangles
+	size_t getNumTriangles() const;
+
+	/// \param vertexId The id of the vertex
+	/// \return The ids of the triangles that use the vertex
+	std::vector<unsigned int> getTriangles(size_t vertexId) const;
+
+	/// Find the triangles and vertices whose normals and tangents depend on a set of changed vertices, i.e. the
+	/// triangles that use any of the changed vertices and all the vertices of these triangles
+	/// \param changedVertices The ids of the vertices that changed
+	/// \param [out] triangles The ids of the affected triangles
+	/// \param [out] vertices The ids of the affected vertices
+	void collectAffected(const std::vector<unsigned int>& changedVertices,
+						 std::vector<unsigned int>* triangles, std::vector<unsigned int>* vertices);
+
+	/// Calculate the normals of all the vertices
+	/// \param vertices The vertex positions
+	/// \param [out] normals The normalized vertex normals, needs to have the same size as vertices
+	void computeNormals(const osg::Vec3Array& vertices, osg::Vec3Array* normals);
+
+	/// Calculate the normals of the given vertices, the triangles have to contain all the triangles around these
+	/// vertices, as returned by collectAffected()
+	/// \param vertices The vertex positions
+	/// \param triangleIds The triangles whose normals need to be recalculated
+	/// \param vertexIds The vertices whose normals need to be recalculated
+	/// \param [out] normals The normalized vertex normals, needs to have the same size as vertices
+	void computeNormals(const osg::Vec3Array& vertices, const std::vector<unsigned int>& triangleIds,
+						const std::vector<unsigned int>& vertexIds, osg::Vec3Array* normals);
+
+	/// Calculate the tangent space of all the vertices from their texture coordinates
+	/// \param vertices The vertex positions
+	/// \param normals The vertex normals
+	/// \param textureCoords The texture coordinates
+	/// \param orthonormal Whether to create a fully orthonormal basis, see TangentSpaceGenerator
+	/// \param [out] tangents The vertex tangents
+	/// \param [out] bitangents The vertex bitangents
+	void computeTangents(const osg::Vec3Array& vertices, const osg::Vec3Array& normals,
+						 const osg::Vec2Array& textureCoords, bool orthonormal,
+						 osg::Vec4Array* tangents, osg::Vec4Array* bitangents);
+
+	/// Calculate the tangent space of the given vertices, the triangles have to contain all the triangles around
+	/// these vertices, as returned by collectAffected()
+	/// \param vertices The vertex positions
+	/// \param normals The vertex normals
+	/// \param textureCoords The texture coordinates
+	/// \param orthonormal Whether to create a fully orthonormal basis, see TangentSpaceGenerator
+	/// \param triangleIds The triangles whose tangents need to be recalculated
+	/// \param vertexIds The vertices whose tangents need to be recalculated
+	/// \param [out] tangents The vertex tangents
+	/// \param [out] bitangents The vertex bitangents
+	void computeTangents(const osg::Vec3Array& vertices, const osg::Vec3Array& normals,
+						 const osg::Vec2Array& textureCoords, bool orthonormal,
+						 const std::vector<unsigned int>& triangleIds, const std::vector<unsigned int>& vertexIds,
+						 osg::Vec4Array* tangents, osg::Vec4Array* bitangents);
+
+private:
+	/// Calculate the normal of each triangle in m_triangleNormals
+	/// \param vertices The vertex positions
+	/// \param triangleIds The triangles to update, nullptr for all
+	void computeTriangleNormals(const osg::Vec3Array& vertices, const std::vector<unsigned int>* triangleIds);
+
+	/// Sum and normalize the triangle normals around each vertex
+	/// \param vertexIds The vertices to update, nullptr for all
+	/// \param [out] normals The vertex normals
+	void gatherNormals(const std::vector<unsigned int>* vertexIds, osg::Vec3Array* normals) const;
+
+	/// Calculate the tangent and bitangent of each triangle in m_triangleTangents and m_triangleBitangents
+	/// \param vertices The vertex positions
+	/// \param textureCoords The texture coordinates
+	/// \param triangleIds The triangles to update, nullptr for all
+	void computeTriangleTangents(const osg::Vec3Array& vertices, const osg::Vec2Array& textureCoords,
+								 const std::vector<unsigned int>* triangleIds);
+
+	/// Sum and orthogonalize the triangle tangents around each vertex
+	/// \param normals The vertex normals
+	/// \param orthonormal Whether to create a fully orthonormal basis
+	/// \param vertexIds The vertices to update, nullptr for all
+	/// \param [out] tangents The vertex tangents
+	/// \param [out] bitangents The vertex bitangents
+	void gatherTangents(const osg::Vec3Array& normals, bool orthonormal, const std::vector<unsigned int>* vertexIds,
+						osg::Vec4Array* tangents, osg::Vec4Array* bitangents) const;
+
+	/// The vertex ids of the non degenerate triangles, three per triangle
+	std::vector<unsigned int> m_triangleVertices;
+
+	/// For each vertex the start of its range in m_vertexTriangles, with one additional entry for the end
+	std::vector<unsigned int> m_offsets;
+
+	/// The triangle ids around each vertex, in the order of the vertices
+	std::vector<unsigned int> m_vertexTriangles;
+
+	///@{
+	/// Per triangle values, reused between calls
+	std::vector<osg::Vec3> m_triangleNormals;
+	std::vector<osg::Vec4> m_triangleTangents;
+	std::vector<osg::Vec4> m_triangleBitangents;
+	///@}
+
+	/// Marks used by collectAffected(), reused between calls
+	std::vector<bool> m_isTriangleMarked;
+	std::vector<bool> m_isVertexMarked;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_VERTEXTRIANGLEADJACENCY_H
@@ -0,0 +1,360 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Graphics/VoxelSurface.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace
+{
+
+const int KeyBits = 21;
+const int64_t KeyOffset = int64_t(1) << (KeyBits - 1);
+const uint64_t KeyMask = (uint64_t(1) << KeyBits) - 1;
+
+/// Division rounding towards negative infinity
+int floorDivide(int value, int divisor)
+{
+	return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+}
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+size_t VoxelSurface::ChunkHash::operator()(const Eigen::Vector3i& chunk) const
+{
+	return std::hash<uint64_t>()(getKey(chunk));
+}
+
+VoxelSurface::VoxelSurface(int chunkSize) :
+	m_chunkSize(chunkSize),
+	m_numFilled(0)
+{
+	SURGSIM_ASSERT(chunkSize > 0) << "The chunk size has to be positive.";
+}
+
+int VoxelSurface::getChunkSize() const
+{
+	return m_chunkSize;
+}
+
+void VoxelSurface::clear()
+{
+	for (auto it = m_chunks.cbegin(); it != m_chunks.cend(); ++it)
+	{
+		m_dirtyChunks.insert(it->first);
+	}
+	m_chunks.clear();
+	m_numFilled = 0;
+}
+
+void VoxelSurface::setCell(const Eigen::Vector3i& cell, bool isFilled)
+{
+	setCells(cell, cell + Eigen::Vector3i::Ones(), isFilled);
+}
+
+void VoxelSurface::setCells(const Eigen::Vector3i& min, const Eigen::Vector3i& max, bool isFilled)
+{
+	if ((max.array() <= min.array()).any())
+	{
+		return;
+	}
+
+	const Eigen::Vector3i firstChunk = getChunk(min);
+	const Eigen::Vector3i lastChunk = getChunk(max - Eigen::Vector3i::Ones());
+	const double numChunks = ((lastChunk - firstChunk).cast<double>().array() + 1.0).prod();
+	if (!isFilled && static_cast<double>(m_chunks.size()) < numChunks)
+	{
+		// Emptying only changes the existing chunks, visit these instead of all the chunk ids of a large box
+		std::vector<Eigen::Vector3i> chunks;
+		for (auto it = m_chunks.cbegin(); it != m_chunks.cend(); ++it)
+		{
+			Eigen::Vector3i chunk = getChunkFromKey(it->first);
+			if ((chunk.array() >= firstChunk.array()).all() && (chunk.array() <= lastChunk.array()).all())
+			{
+				chunks.push_back(chunk);
+			}
+		}
+		for (auto chunk = chunks.cbegin(); chunk != chunks.cend(); ++chunk)
+		{
+			setChunkCells(*chunk, min, max, isFilled);
+		}
+		return;
+	}
+
+	Eigen::Vector3i chunk;
+	for (chunk.z() = firstChunk.z(); chunk.z() <= lastChunk.z(); ++chunk.z())
+	{
+		for (chunk.y() = firstChunk.y(); chunk.y() <= lastChunk.y(); ++chunk.y())
+		{
+			for (chunk.x() = firstChunk.x(); chunk.x() <= lastChunk.x(); ++chunk.x())
+			{
+				setChunkCells(chunk, min, max, isFilled);
+			}
+		}
+	}
+}
+
+bool VoxelSurface::isFilled(const Eigen::Vector3i& cell) const
+{
+	Eigen::Vector3i chunk = getChunk(cell);
+	auto found = m_chunks.find(getKey(chunk));
+	return (found != m_chunks.end()) && found->second.cells[getIndex(cell - chunk * m_chunkSize)];
+}
+
+size_t VoxelSurface::getNumFilled() const
+{
+	return m_numFilled;
+}
+
+Eigen::Vector3i VoxelSurface::getChunk(const Eigen::Vector3i& cell) const
+{
+	return Eigen::Vector3i(floorDivide(cell.x(), m_chunkSize), floorDivide(cell.y(), m_chunkSize),
+						   floorDivide(cell.z(), m_chunkSize));
+}
+
+std::vector<Eigen::Vector3i> VoxelSurface::takeDirtyChunks()
+{
+	std::vector<Eigen::Vector3i> result;
+	result.reserve(m_dirtyChunks.size());
+	for (auto key = m_dirtyChunks.cbegin(); key != m_dirtyChunks.cend(); ++key)
+	{
+		result.push_back(getChunkFromKey(*key));
+	}
+	m_dirtyChunks.clear();
+	return result;
+}
+
+void VoxelSurface::buildSurface(const Eigen::Vector3i& chunk, std::vector<SurgSim::Math::Vector3f>* vertices,
+								std::vector<SurgSim::Math::Vector3f>* normals,
+								std::vector<unsigned int>* triangles) const
+{
+	vertices->clear();
+	normals->clear();
+	triangles->clear();
+
+	auto found = m_chunks.find(getKey(chunk));
+	if (found == m_chunks.end())
+	{
+		return;
+	}
+	const std::vector<bool>& cells = found->second.cells;
+	const Eigen::Vector3i origin = chunk * m_chunkSize;
+	const int size = m_chunkSize;
+
+	std::vector<bool> mask(size * size);
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		// The rectangles are built in the plane of the two other axes, (u, v, normal) is right handed
+		const int uAxis = (axis + 1) % 3;
+		const int vAxis = (axis + 2) % 3;
+		for (int direction = -1; direction <= 1; direction += 2)
+		{
+			SurgSim::Math::Vector3f normal = SurgSim::Math::Vector3f::Zero();
+			normal[axis] = static_cast<float>(direction);
+
+			for (int depth = 0; depth < size; ++depth)
+			{
+				// Mark the faces of the slice that are not covered by a filled neighbor
+				Eigen::Vector3i local;
+				local[axis] = depth;
+				const int neighborDepth = depth + direction;
+				const bool isNeighborInChunk = (neighborDepth >= 0 && neighborDepth < size);
+				for (int v = 0; v < size; ++v)
+				{
+					local[vAxis] = v;
+					for (int u = 0; u < size; ++u)
+					{
+						local[uAxis] = u;
+						bool isExposed = cells[getIndex(local)];
+						if (isExposed)
+						{
+							Eigen::Vector3i neighbor = local;
+							neighbor[axis] = neighborDepth;
+							isExposed = isNeighborInChunk ? !cells[getIndex(neighbor)] : !isFilled(origin + neighbor);
+						}
+						mask[u + v * size] = isExposed;
+					}
+				}
+
+				// Grow rectangles along u first and then along v, clearing the faces they cover
+				for (int v = 0; v < size; ++v)
+				{
+					for (int u = 0; u < size;)
+					{
+						if (!mask[u + v * size])
+						{
+							++u;
+							continue;
+						}
+
+						int width = 1;
+						while (u + width < size && mask[u + width + v * size])
+						{
+							++width;
+						}
+
+						int height = 1;
+						bool isRowFull = true;
+						while (v + height < size && isRowFull)
+						{
+							for (int i = 0; i < width && isRowFull; ++i)
+							{
+								isRowFull = mask[u + i + (v + height) * size];
+							}
+							if (isRowFull)
+							{
+								++height;
+							}
+						}
+
+						for (int j = 0; j < height; ++j)
+						{
+							std::fill_n(mask.begin() + (u + (v + j) * size), width, false);
+						}
+
+						SurgSim::Math::Vector3f corner;
+						corner[axis] = static_cast<float>(origin[axis] + depth + ((direction > 0) ? 1 : 0));
+						const float u0 = static_cast<float>(origin[uAxis] + u);
+						const float u1 = u0 + static_cast<float>(width);
+						const float v0 = static_cast<float>(origin[vAxis] + v);
+						const float v1 = v0 + static_cast<float>(height);
+
+						const unsigned int first = static_cast<unsigned int>(vertices->size());
+						corner[uAxis] = u0;
+						corner[vAxis] = v0;
+						vertices->push_back(corner);
+						corner[uAxis] = u1;
+						vertices->push_back(corner);
+						corner[vAxis] = v1;
+						vertices->push_back(corner);
+						corner[uAxis] = u0;
+						vertices->push_back(corner);
+						normals->insert(normals->end(), 4, normal);
+
+						const unsigned int second = (direction > 0) ? first + 1 : first + 3;
+						const unsigned int fourth = (direction > 0) ? first + 3 : first + 1;
+						triangles->insert(triangles->end(), {first, second, first + 2, first, first + 2, fourth});
+
+						u += width;
+					}
+				}
+			}
+		}
+	}
+}
+
+uint64_t VoxelSurface::getKey(const Eigen::Vector3i& chunk)
+{
+	return (static_cast<uint64_t>(chunk.x() + KeyOffset) & KeyMask) |
+		   ((static_cast<uint64_t>(chunk.y() + KeyOffset) & KeyMask) << KeyBits) |
+		   ((static_cast<uint64_t>(chunk.z() + KeyOffset) & KeyMask) << (2 * KeyBits));
+}
+
+Eigen::Vector3i VoxelSurface::getChunkFromKey(uint64_t key)
+{
+	return Eigen::Vector3i(static_cast<int>(static_cast<int64_t>(key & KeyMask) - KeyOffset),
+						   static_cast<int>(static_cast<int64_t>((key >> KeyBits) & KeyMask) - KeyOffset),
+						   static_cast<int>(static_cast<int64_t>((key >> (2 * KeyBits)) & KeyMask) - KeyOffset));
+}
+
+size_t VoxelSurface::getIndex(const Eigen::Vector3i& local) const
+{
+	return static_cast<size_t>(local.x() + m_chunkSize * (local.y() + m_chunkSize * local.z()));
+}
+
+void VoxelSurface::setChunkCells(const Eigen::Vector3i& chunk, const Eigen::Vector3i& min,
+								 const Eigen::Vector3i& max, bool isFilled)
+{
+	const uint64_t key = getKey(chunk);
+	auto found = m_chunks.find(key);
+	if (found == m_chunks.end())
+	{
+		if (!isFilled)
+		{
+			return;
+		}
+		Chunk& newChunk = m_chunks[key];
+		newChunk.cells.resize(m_chunkSize * m_chunkSize * m_chunkSize, false);
+		newChunk.numFilled = 0;
+		found = m_chunks.find(key);
+	}
+
+	const Eigen::Vector3i origin = chunk * m_chunkSize;
+	const Eigen::Vector3i localMin = (min - origin).cwiseMax(0);
+	const Eigen::Vector3i localMax = (max - origin).cwiseMin(m_chunkSize);
+
+	Chunk& data = found->second;
+	size_t numChanged = 0;
+	Eigen::Vector3i local;
+	for (local.z() = localMin.z(); local.z() < localMax.z(); ++local.z())
+	{
+		for (local.y() = localMin.y(); local.y() < localMax.y(); ++local.y())
+		{
+			for (local.x() = localMin.x(); local.x() < localMax.x(); ++local.x())
+			{
+				auto cell = data.cells[getIndex(local)];
+				if (cell != isFilled)
+				{
+					cell = isFilled;
+					++numChanged;
+				}
+			}
+		}
+	}
+
+	if (isFilled)
+	{
+		data.numFilled += numChanged;
+		m_numFilled += numChanged;
+	}
+	else
+	{
+		data.numFilled -= numChanged;
+		m_numFilled -= numChanged;
+		if (data.numFilled == 0)
+		{
+			m_chunks.erase(found);
+		}
+	}
+
+	if (numChanged > 0)
+	{
+		// The faces of the cells next to the box can change as well, these are in the neighboring chunks when the
+		// box touches the side of the chunk
+		m_dirtyChunks.insert(key);
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (localMin[axis] == 0)
+			{
+				m_dirtyChunks.insert(getKey(chunk - Eigen::Vector3i::Unit(axis)));
+			}
+			if (localMax[axis] == m_chunkSize)
+			{
+				m_dirtyChunks.insert(getKey(chunk + Eigen::Vector3i::Unit(axis)));
+			}
+		}
+	}
+}
+
+}; // namespace Graphics
+}; // namespace SurgSim
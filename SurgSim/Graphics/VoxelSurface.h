@@ -0,0 +1,135 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_GRAPHICS_VOXELSURFACE_H
+#define SURGSIM_GRAPHICS_VOXELSURFACE_H
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "SurgSim/Math/Vector.h"
+
+namespace SurgSim
+{
+namespace Graphics
+{
+
+/// Sparse grid of filled cells that is split into cubic chunks, the exposed faces of the filled cells of a chunk
+/// can be turned into a surface where coplanar neighboring faces are merged into larger rectangles (greedy meshing).
+/// Changing cells marks the chunks whose surface changes as dirty, so that only these need to be rebuilt.
+/// Chunk ids have to be within [-2^20, 2^20) on every axis.
+class VoxelSurface
+{
+public:
+	/// Hash of chunk ids, to use them as keys in unordered containers
+	struct ChunkHash
+	{
+		size_t operator()(const Eigen::Vector3i& chunk) const;
+	};
+
+	/// Constructor
+	/// \param chunkSize The number of cells along each side of a chunk
+	explicit VoxelSurface(int chunkSize = 32);
+
+	/// \return The number of cells along each side of a chunk
+	int getChunkSize() const;
+
+	/// Remove all the cells, the chunks that were not empty are marked dirty
+	void clear();
+
+	/// Fill or empty a cell
+	/// \param cell The coordinates of the cell
+	/// \param isFilled Whether the cell is filled
+	void setCell(const Eigen::Vector3i& cell, bool isFilled);
+
+	/// Fill or empty a box of cells. Emptying only visits the existing chunks, so the box can be large, filling
+	/// allocates every chunk the box overlaps.
+	/// \param min The coordinates of the first cell of the box
+	/// \param max The coordinates one past the last cell of the box
+	/// \param isFilled Whether the cells are filled
+	void setCells(const Eigen::Vector3i& min, const Eigen::Vector3i& max, bool isFilled);
+
+	/// \param cell The coordinates of the cell
+	/// \return true if the cell is filled
+	bool isFilled(const Eigen::Vector3i& cell) const;
+
+	/// \return The number of filled cells
+	size_t getNumFilled() const;
+
+	/// \param cell The coordinates of a cell
+	/// \return The id of the chunk containing the cell
+	Eigen::Vector3i getChunk(const Eigen::Vector3i& cell) const;
+
+	/// \return The chunks whose surface changed since the last call, the dirty state is reset
+	std::vector<Eigen::Vector3i> takeDirtyChunks();
+
+	/// Build the surface of the filled cells of a chunk, faces between two filled cells are not part of the surface.
+	/// Vertices are expressed in cell units, i.e. the cell (i, j, k) spans from (i, j, k) to (i + 1, j + 1, k + 1).
+	/// \param chunk The id of the chunk
+	/// \param [out] vertices The vertex positions, four per rectangle
+	/// \param [out] normals The outward normals of the vertices
+	/// \param [out] triangles The vertex ids of the triangles, counterclockwise when seen from outside
+	void buildSurface(const Eigen::Vector3i& chunk, std::vector<SurgSim::Math::Vector3f>* vertices,
+					  std::vector<SurgSim::Math::Vector3f>* normals, std::vector<unsigned int>* triangles) const;
+
+private:
+	/// The filled state of the cells of one chunk
+	struct Chunk
+	{
+		std::vector<bool> cells;
+		size_t numFilled;
+	};
+
+	/// \param chunk The id of a chunk
+	/// \return The key of the chunk in m_chunks
+	static uint64_t getKey(const Eigen::Vector3i& chunk);
+
+	/// \param key The key of a chunk in m_chunks
+	/// \return The id of the chunk
+	static Eigen::Vector3i getChunkFromKey(uint64_t key);
+
+	/// \param local The coordinates of a cell relative to the first cell of its chunk
+	/// \return The index of the cell in Chunk::cells
+	size_t getIndex(const Eigen::Vector3i& local) const;
+
+	/// Fill or empty the part of a box of cells that is inside one chunk, if any cell changed the chunk is marked
+	/// dirty, together with the neighboring chunks whose side is touched by the box
+	/// \param chunk The id of the chunk
+	/// \param min The coordinates of the first cell of the box
+	/// \param max The coordinates one past the last cell of the box
+	/// \param isFilled Whether the cells are filled
+	void setChunkCells(const Eigen::Vector3i& chunk, const Eigen::Vector3i& min, const Eigen::Vector3i& max,
+					   bool isFilled);
+
+	/// Number of cells along each side of a chunk
+	int m_chunkSize;
+
+	/// The chunks that contain filled cells
+	std::unordered_map<uint64_t, Chunk> m_chunks;
+
+	/// The keys of the chunks whose surface needs to be rebuilt
+	std::unordered_set<uint64_t> m_dirtyChunks;
+
+	/// Number of filled cells
+	size_t m_numFilled;
+};
+
+}; // namespace Graphics
+}; // namespace SurgSim
+
+#endif // SURGSIM_GRAPHICS_VOXELSURFACE_H
@@ -16,9 +16,12 @@
 #include "SurgSim/Input/CommonDevice.h"
 
 #include <boost/thread/mutex.hpp>
+#include <limits>
 #include <boost/thread/locks.hpp>
 
+#include "SurgSim/Framework/Clock.h"
 #include "SurgSim/Framework/Log.h"
+#include "SurgSim/Framework/Tracer.h"
 #include "SurgSim/Input/InputConsumerInterface.h"
 #include "SurgSim/Input/OutputProducerInterface.h"
 
@@ -32,21 +35,27 @@ namespace Input
 CommonDevice::CommonDevice(const std::string& name) :
 	m_name(name),
 	m_nameForCallback(name),
-	m_inputData(DataStructures::DataGroup())
+	m_inputData(DataStructures::DataGroup()),
+	m_nextSequenceNumber(0),
+	m_lastOutputSequenceNumber(-1)
 {
 }
 
 CommonDevice::CommonDevice(const std::string& name, const DataStructures::DataGroup& inputData) :
 	m_name(name),
 	m_nameForCallback(name),
-	m_inputData(inputData)
+	m_inputData(inputData),
+	m_nextSequenceNumber(0),
+	m_lastOutputSequenceNumber(-1)
 {
 }
 
 CommonDevice::CommonDevice(const std::string& name, DataStructures::DataGroup&& inputData) :
 	m_name(name),
 	m_nameForCallback(name),
-	m_inputData(std::move(inputData))
+	m_inputData(std::move(inputData)),
+	m_nextSequenceNumber(0),
+	m_lastOutputSequenceNumber(-1)
 {
 }
 
@@ -54,6 +63,11 @@ CommonDevice::~CommonDevice()
 {
 	clearInputConsumers();
 	clearOutputProducer();
+	if (m_latencyStatistics.getNumberOfSamples() > 0)
+	{
+		SURGSIM_LOG_INFO(Framework::Logger::getLogger("Input/CommonDevice")) << "Latency of " << m_name << ": " <<
+			m_latencyStatistics.getSummary();
+	}
 }
 
 std::string CommonDevice::getName() const
@@ -98,7 +112,10 @@ bool CommonDevice::addInputConsumer(std::shared_ptr<InputConsumerInterface> inpu
 
 	// NB: callbacks are called with the local m_nameForCallback.
 	// This allows e.g. filters to call their callbacks with a name different from their "real" name.
-	inputConsumer->initializeInput(m_nameForCallback, m_inputData);
+	if (!m_inputData.isEmpty())
+	{
+		inputConsumer->initializeInput(m_nameForCallback, m_inputData);
+	}
 	m_inputConsumerList.emplace_back(std::move(inputConsumer));
 	return true;
 }
@@ -175,6 +192,7 @@ bool CommonDevice::hasOutputProducer()
 
 void CommonDevice::pushInput()
 {
+	SURGSIM_TRACE_SCOPE_DYNAMIC("Device", getName() + " input");
 	boost::lock_guard<boost::mutex> lock(m_consumerProducerMutex);
 	for (auto it = m_inputConsumerList.begin();  it != m_inputConsumerList.end();  ++it)
 	{
@@ -188,8 +206,25 @@ void CommonDevice::pushInput()
 	}
 }
 
+bool CommonDevice::initializeInputConsumers()
+{
+	boost::lock_guard<boost::mutex> lock(m_consumerProducerMutex);
+	bool hasConsumers = false;
+	for (const auto& input : m_inputConsumerList)
+	{
+		auto inputConsumer = input.lock();
+		if (inputConsumer != nullptr)
+		{
+			inputConsumer->initializeInput(m_nameForCallback, m_inputData);
+			hasConsumers = true;
+		}
+	}
+	return hasConsumers;
+}
+
 bool CommonDevice::pullOutput()
 {
+	SURGSIM_TRACE_SCOPE_DYNAMIC("Device", getName() + " output");
 	boost::lock_guard<boost::mutex> lock(m_consumerProducerMutex);
 	auto outputProducer = m_outputProducer.lock();
 	if (outputProducer != nullptr)
@@ -199,6 +234,16 @@ bool CommonDevice::pullOutput()
 		bool gotOutput = outputProducer->requestOutput(m_nameForCallback, &m_outputData);
 		if (gotOutput)
 		{
+			double inputTime, outputTime;
+			int sequenceNumber;
+			if (m_outputData.scalars().get(DataStructures::Names::INPUT_TIMESTAMP, &inputTime) &&
+				m_outputData.scalars().get(DataStructures::Names::OUTPUT_TIMESTAMP, &outputTime) &&
+				m_outputData.integers().get(DataStructures::Names::INPUT_SEQUENCE_NUMBER, &sequenceNumber) &&
+				sequenceNumber != m_lastOutputSequenceNumber)
+			{
+				m_latencyStatistics.addSample(inputTime, outputTime, Framework::getMonotonicTime());
+				m_lastOutputSequenceNumber = sequenceNumber;
+			}
 			return true;
 		}
 
@@ -211,6 +256,25 @@ bool CommonDevice::pullOutput()
 	return false;
 }
 
+void CommonDevice::stampInput()
+{
+	if (m_inputData.scalars().hasEntry(DataStructures::Names::TIMESTAMP))
+	{
+		m_inputData.scalars().set(DataStructures::Names::TIMESTAMP, Framework::getMonotonicTime());
+	}
+	if (m_inputData.integers().hasEntry(DataStructures::Names::SEQUENCE_NUMBER))
+	{
+		m_inputData.integers().set(DataStructures::Names::SEQUENCE_NUMBER, m_nextSequenceNumber);
+		// Wrap around explicitly, signed overflow is undefined
+		m_nextSequenceNumber = (m_nextSequenceNumber < std::numeric_limits<int>::max()) ? m_nextSequenceNumber + 1 : 0;
+	}
+}
+
+const LatencyStatistics& CommonDevice::getLatencyStatistics() const
+{
+	return m_latencyStatistics;
+}
+
 DataStructures::DataGroup& CommonDevice::getInputData()
 {
 	return m_inputData;
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "SurgSim/Input/DeviceInterface.h"
+#include "SurgSim/Input/LatencyStatistics.h"
 #include "SurgSim/DataStructures/DataGroup.h"
 
 namespace SurgSim
@@ -72,6 +73,11 @@ class CommonDevice : public DeviceInterface
 	/// \return	The name being used.
 	std::string getNameForCallback() const;
 
+	/// Adds an input consumer, and initializes its input with the input data of the device.  If the layout of the
+	/// input is not known yet, i.e. the input data is empty, the consumer is initialized by
+	/// initializeInputConsumers() once it is.
+	/// \param inputConsumer The input consumer.
+	/// \return true if the consumer was added.
 	bool addInputConsumer(std::shared_ptr<InputConsumerInterface> inputConsumer) override;
 
 	bool removeInputConsumer(std::shared_ptr<InputConsumerInterface> inputConsumer) override;
@@ -86,11 +92,27 @@ class CommonDevice : public DeviceInterface
 
 	void clearOutputProducer() override;
 
+	/// The latency between the input of the device and the output computed from it.  Samples are only collected if
+	/// the input is stamped, see stampInput(), and the output producer sends the stamps of the input it used back
+	/// together with the time it handed the output over, see DataStructures::Names::INPUT_TIMESTAMP,
+	/// INPUT_SEQUENCE_NUMBER and OUTPUT_TIMESTAMP.  A summary is logged when the device is destroyed.
+	/// \return The latency statistics of the device.
+	const LatencyStatistics& getLatencyStatistics() const;
+
 protected:
+	/// Stamp the input data with the current monotonic time and the next sequence number, if the input data has
+	/// the DataStructures::Names::TIMESTAMP and SEQUENCE_NUMBER entries.  Devices call this right after they got
+	/// the input from the hardware and before pushInput(), so that the latency to the output can be measured.
+	void stampInput();
 
 	/// Push application input to consumers.
 	virtual void pushInput();
 
+	/// Initialize the input of all the input consumers with the input data.  Called by devices that only know the
+	/// layout of their input once they are initialized, for the consumers added before.
+	/// \return true if the device has input consumers.
+	bool initializeInputConsumers();
+
 	/// Pull application output from a producer.
 	virtual bool pullOutput();
 
@@ -130,6 +152,16 @@ class CommonDevice : public DeviceInterface
 	/// The mutex that protects the consumers and the producer.
 	boost::mutex m_consumerProducerMutex;
 
+	/// The sequence number of the next input.
+	int m_nextSequenceNumber;
+
+	/// The sequence number of the input the last latency sample was computed from, so that output that has not
+	/// been updated since is not counted again.
+	int m_lastOutputSequenceNumber;
+
+	/// The latency between the input and the output.
+	LatencyStatistics m_latencyStatistics;
+
 };
 
 
@@ -15,9 +15,12 @@
 
 #include "SurgSim/Input/InputComponent.h"
 
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+
 #include "SurgSim/DataStructures/DataGroup.h"
-#include "SurgSim/Framework/LockedContainer.h"
 #include "SurgSim/Framework/Log.h"
+#include "SurgSim/Framework/SwapBuffer.h"
 #include "SurgSim/Input/DeviceInterface.h"
 #include "SurgSim/Input/InputConsumerInterface.h"
 
@@ -27,7 +30,9 @@ namespace Input
 {
 SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Input::InputComponent, InputComponent);
 
-/// An input consumer monitors device and signal state update
+/// An input consumer monitors device and signal state update.
+/// The device thread hands each sample over through a triple buffer, it never waits on the consumers and, as the
+/// buffers all share the layout of the device data, it does not allocate for any of the fixed size entries.
 class InputConsumer: public InputConsumerInterface
 {
 public:
@@ -45,27 +50,41 @@ class InputConsumer: public InputConsumerInterface
 	/// \param inputData The input data coming from the device.
 	void handleInput(const std::string& device, const SurgSim::DataStructures::DataGroup& inputData) override
 	{
-		m_lastInput.set(inputData);
+		m_buffers.getBack() = inputData;
+		m_buffers.publish();
 	}
 
 	/// Initialize the input data information stored in this input consumer.
+	/// All three buffers take the layout of the device data here, so that handleInput() only copies values.
 	/// \param device The name of the device that is producing the input.
 	/// \param initialData Initial input data of the device.
 	void initializeInput(const std::string& device, const SurgSim::DataStructures::DataGroup& initialData) override
 	{
-		m_lastInput.set(initialData);
+		boost::lock_guard<boost::mutex> lock(m_consumerMutex);
+		m_buffers.getBack() = initialData;
+		m_buffers.publish();
+		m_buffers.tryTakeFront();
+		m_buffers.getBack() = initialData;
+		m_buffers.publish();
+		m_buffers.getBack() = initialData;
+		m_buffers.publish();
 	}
 
 	/// Retrieve input data information stored in this input consumer
 	/// \param [out] dataGroup Used to accept the retrieved input data information
 	void getData(SurgSim::DataStructures::DataGroup* dataGroup)
 	{
-		m_lastInput.get(dataGroup);
+		boost::lock_guard<boost::mutex> lock(m_consumerMutex);
+		m_buffers.tryTakeFront();
+		*dataGroup = m_buffers.getFront();
 	}
 
 private:
 	/// Used to store input data information passed in from device
-	SurgSim::Framework::LockedContainer<SurgSim::DataStructures::DataGroup> m_lastInput;
+	SurgSim::Framework::SwapBuffer<SurgSim::DataStructures::DataGroup> m_buffers;
+
+	/// Serializes the consumers of the data, the device thread never takes it
+	boost::mutex m_consumerMutex;
 };
 
 
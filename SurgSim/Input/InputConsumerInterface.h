@@ -57,12 +57,16 @@ class InputConsumerInterface
 	///   | string     | "serial"    | Serial number string.                                          |
 	///   | (any)      | "debug:*"   | Various debugging information                                  |
 	///
+	/// This is called on the device thread, possibly at haptic rates. Implementations should not block or allocate,
+	/// the layout of inputData is the one passed to initializeInput(), so its values can be copied into storage
+	/// prepared there.
+	///
 	/// \param device The name of the device that is producing the input.  This should only be used to identify
 	/// 	the device (e.g. if the consumer is listening to several devices at once).
 	/// \param inputData The application input state coming from the device.
 	virtual void handleInput(const std::string& device, const SurgSim::DataStructures::DataGroup& inputData) = 0;
 
-	/// Set the initial input data group.
+	/// Set the initial input data group, and with it the layout of all the input data that will follow.
 	/// \param device The name of the device that is producing the input.  This should only be used to identify
 	/// 	the device (e.g. if the consumer is listening to several devices at once).
 	/// \param inputData The application input state coming from the device.
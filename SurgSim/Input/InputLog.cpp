@@ -0,0 +1,435 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Input/InputLog.h"
+
+#include <cstdint>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/DataStructures/IndexDirectory.h"
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/BinaryReader.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::DataStructures::NamedData;
+using SurgSim::Framework::BinaryReader;
+using SurgSim::Framework::BinaryWriter;
+
+namespace
+{
+
+/// Identifies an input log, "SSIL"
+const uint32_t MAGIC = 0x4c495353;
+
+/// The version of the format
+const uint32_t VERSION = 1;
+
+/// The kinds of records
+const uint8_t RECORD_LAYOUT = 0;
+const uint8_t RECORD_SAMPLE = 1;
+
+void writeValue(const DataGroup::PoseType& value, BinaryWriter* writer)
+{
+	writer->write(value.matrix());
+}
+
+void writeValue(const DataGroup::DynamicMatrixType& value, BinaryWriter* writer)
+{
+	writer->write(static_cast<uint64_t>(value.rows()));
+	writer->write(static_cast<uint64_t>(value.cols()));
+	writer->writeArray(value.data(), static_cast<size_t>(value.size()));
+}
+
+void writeValue(const DataGroup::StringType& value, BinaryWriter* writer)
+{
+	writer->writeString(value);
+}
+
+void writeValue(const DataGroup::ImageType& value, BinaryWriter* writer)
+{
+	writer->write(static_cast<uint64_t>(value.getWidth()));
+	writer->write(static_cast<uint64_t>(value.getHeight()));
+	writer->write(static_cast<uint64_t>(value.getNumChannels()));
+	writer->writeArray(value.getData(), value.getWidth() * value.getHeight() * value.getNumChannels());
+}
+
+template <class T>
+void writeValue(const T& value, BinaryWriter* writer)
+{
+	writer->write(value);
+}
+
+bool readValue(BinaryReader* reader, DataGroup::PoseType* value)
+{
+	DataGroup::PoseType::MatrixType matrix;
+	if (!reader->read(&matrix))
+	{
+		return false;
+	}
+	value->matrix() = matrix;
+	return true;
+}
+
+bool readValue(BinaryReader* reader, DataGroup::DynamicMatrixType* value)
+{
+	uint64_t rows;
+	uint64_t cols;
+	if (!reader->read(&rows) || !reader->read(&cols))
+	{
+		return false;
+	}
+	value->resize(static_cast<DataGroup::DynamicMatrixType::Index>(rows),
+				  static_cast<DataGroup::DynamicMatrixType::Index>(cols));
+	return reader->readArray(value->data(), static_cast<size_t>(rows * cols));
+}
+
+bool readValue(BinaryReader* reader, DataGroup::StringType* value)
+{
+	return reader->readString(value);
+}
+
+bool readValue(BinaryReader* reader, DataGroup::ImageType* value)
+{
+	uint64_t width;
+	uint64_t height;
+	uint64_t channels;
+	if (!reader->read(&width) || !reader->read(&height) || !reader->read(&channels))
+	{
+		return false;
+	}
+	if (value->getWidth() != width || value->getHeight() != height || value->getNumChannels() != channels)
+	{
+		*value = DataGroup::ImageType(width, height, channels);
+	}
+	return reader->readArray(value->getData(), width * height * channels);
+}
+
+template <class T>
+bool readValue(BinaryReader* reader, T* value)
+{
+	return reader->read(value);
+}
+
+template <class T>
+void writeNames(const NamedData<T>& data, BinaryWriter* writer)
+{
+	const auto& names = data.getDirectory()->getAllNames();
+	writer->write(static_cast<uint64_t>(names.size()));
+	for (const auto& name : names)
+	{
+		writer->writeString(name);
+	}
+}
+
+template <class T>
+bool readNames(BinaryReader* reader, SurgSim::DataStructures::NamedDataBuilder<T>* builder)
+{
+	uint64_t count;
+	if (!reader->read(&count))
+	{
+		return false;
+	}
+	std::string name;
+	for (uint64_t i = 0; i < count; ++i)
+	{
+		if (!reader->readString(&name))
+		{
+			return false;
+		}
+		builder->addEntry(name);
+	}
+	return true;
+}
+
+/// Write the values of a NamedData, each preceded by whether it is set
+template <class T>
+void writeValues(const NamedData<T>& data, T* value, BinaryWriter* writer)
+{
+	for (int i = 0; i < data.getNumEntries(); ++i)
+	{
+		const bool hasData = data.get(i, value);
+		writer->write(static_cast<uint8_t>(hasData));
+		if (hasData)
+		{
+			writeValue(*value, writer);
+		}
+	}
+}
+
+template <class T>
+bool readValues(BinaryReader* reader, T* value, NamedData<T>* data)
+{
+	uint8_t hasData;
+	for (int i = 0; i < data->getNumEntries(); ++i)
+	{
+		if (!reader->read(&hasData))
+		{
+			return false;
+		}
+		if (hasData != 0)
+		{
+			if (!readValue(reader, value))
+			{
+				return false;
+			}
+			data->set(i, *value);
+		}
+		else
+		{
+			data->reset(i);
+		}
+	}
+	return true;
+}
+
+}
+
+namespace SurgSim
+{
+namespace Input
+{
+
+struct InputLogWriter::Values
+{
+	DataGroup::PoseType pose;
+	DataGroup::VectorType vector;
+	DataGroup::DynamicMatrixType matrix;
+	DataGroup::ScalarType scalar;
+	DataGroup::IntegerType integer;
+	DataGroup::BooleanType boolean;
+	DataGroup::StringType string;
+	DataGroup::ImageType image;
+};
+
+InputLogWriter::InputLogWriter() :
+	m_values(new Values)
+{
+}
+
+InputLogWriter::~InputLogWriter()
+{
+	close();
+}
+
+bool InputLogWriter::open(const std::string& fileName)
+{
+	close();
+	m_file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	m_record.clear();
+	m_record.write(MAGIC);
+	m_record.write(VERSION);
+	m_file.write(m_record.getBuffer().data(), m_record.getBuffer().size());
+	resetLayout();
+	return m_file.good();
+}
+
+bool InputLogWriter::isOpen() const
+{
+	return m_file.is_open();
+}
+
+bool InputLogWriter::write(double time, const DataGroup& data)
+{
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	encodeRecord(time, data);
+	m_file.write(m_record.getBuffer().data(), m_record.getBuffer().size());
+	return m_file.good();
+}
+
+void InputLogWriter::encode(double time, const DataGroup& data, std::vector<char>* record)
+{
+	encodeRecord(time, data);
+	record->assign(m_record.getBuffer().begin(), m_record.getBuffer().end());
+}
+
+void InputLogWriter::resetLayout()
+{
+	for (auto& directory : m_layout)
+	{
+		directory.reset();
+	}
+}
+
+bool InputLogWriter::writeRecord(const std::vector<char>& record)
+{
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	m_file.write(record.data(), record.size());
+	return m_file.good();
+}
+
+void InputLogWriter::encodeRecord(double time, const DataGroup& data)
+{
+	const std::array<std::shared_ptr<const DataStructures::IndexDirectory>, 8> layout = {{
+		data.poses().getDirectory(), data.vectors().getDirectory(), data.matrices().getDirectory(),
+		data.scalars().getDirectory(), data.integers().getDirectory(), data.booleans().getDirectory(),
+		data.strings().getDirectory(), data.images().getDirectory()
+	}};
+
+	m_record.clear();
+	if (layout != m_layout)
+	{
+		m_layout = layout;
+		m_record.write(RECORD_LAYOUT);
+		writeNames(data.poses(), &m_record);
+		writeNames(data.vectors(), &m_record);
+		writeNames(data.matrices(), &m_record);
+		writeNames(data.scalars(), &m_record);
+		writeNames(data.integers(), &m_record);
+		writeNames(data.booleans(), &m_record);
+		writeNames(data.strings(), &m_record);
+		writeNames(data.images(), &m_record);
+	}
+
+	m_record.write(RECORD_SAMPLE);
+	m_record.write(time);
+	writeValues(data.poses(), &m_values->pose, &m_record);
+	writeValues(data.vectors(), &m_values->vector, &m_record);
+	writeValues(data.matrices(), &m_values->matrix, &m_record);
+	writeValues(data.scalars(), &m_values->scalar, &m_record);
+	writeValues(data.integers(), &m_values->integer, &m_record);
+	writeValues(data.booleans(), &m_values->boolean, &m_record);
+	writeValues(data.strings(), &m_values->string, &m_record);
+	writeValues(data.images(), &m_values->image, &m_record);
+}
+
+void InputLogWriter::flush()
+{
+	if (m_file.is_open())
+	{
+		m_file.flush();
+	}
+}
+
+void InputLogWriter::close()
+{
+	if (m_file.is_open())
+	{
+		m_file.close();
+	}
+}
+
+struct InputLogReader::Values
+{
+	DataGroup::PoseType pose;
+	DataGroup::VectorType vector;
+	DataGroup::DynamicMatrixType matrix;
+	DataGroup::ScalarType scalar;
+	DataGroup::IntegerType integer;
+	DataGroup::BooleanType boolean;
+	DataGroup::StringType string;
+	DataGroup::ImageType image;
+};
+
+InputLogReader::InputLogReader(const std::string& fileName) :
+	m_values(new Values),
+	m_reader(new BinaryReader(fileName)),
+	m_time(0.0),
+	m_isValid(false),
+	m_hasNewLayout(false)
+{
+	uint32_t magic;
+	uint32_t version;
+	m_isValid = m_reader->read(&magic) && m_reader->read(&version) && magic == MAGIC && version == VERSION;
+}
+
+InputLogReader::~InputLogReader()
+{
+}
+
+bool InputLogReader::isValid() const
+{
+	return m_isValid;
+}
+
+bool InputLogReader::readNext()
+{
+	uint8_t record;
+	m_hasNewLayout = false;
+	while (m_isValid && !m_reader->isAtEnd())
+	{
+		m_isValid = m_reader->read(&record);
+		if (m_isValid && record == RECORD_LAYOUT)
+		{
+			m_isValid = readLayout();
+		}
+		else if (m_isValid && record == RECORD_SAMPLE)
+		{
+			m_isValid = m_data != nullptr && m_reader->read(&m_time) &&
+				readValues(m_reader.get(), &m_values->pose, &m_data->poses()) &&
+				readValues(m_reader.get(), &m_values->vector, &m_data->vectors()) &&
+				readValues(m_reader.get(), &m_values->matrix, &m_data->matrices()) &&
+				readValues(m_reader.get(), &m_values->scalar, &m_data->scalars()) &&
+				readValues(m_reader.get(), &m_values->integer, &m_data->integers()) &&
+				readValues(m_reader.get(), &m_values->boolean, &m_data->booleans()) &&
+				readValues(m_reader.get(), &m_values->string, &m_data->strings()) &&
+				readValues(m_reader.get(), &m_values->image, &m_data->images());
+			return m_isValid;
+		}
+		else
+		{
+			m_isValid = false;
+		}
+	}
+	return false;
+}
+
+double InputLogReader::getTime() const
+{
+	return m_time;
+}
+
+bool InputLogReader::hasNewLayout() const
+{
+	return m_hasNewLayout;
+}
+
+const DataGroup& InputLogReader::getData() const
+{
+	SURGSIM_ASSERT(m_data != nullptr) << "No sample has been read from the input log.";
+	return *m_data;
+}
+
+bool InputLogReader::readLayout()
+{
+	DataGroupBuilder builder;
+	if (!readNames(m_reader.get(), &builder.poses()) || !readNames(m_reader.get(), &builder.vectors()) ||
+		!readNames(m_reader.get(), &builder.matrices()) || !readNames(m_reader.get(), &builder.scalars()) ||
+		!readNames(m_reader.get(), &builder.integers()) || !readNames(m_reader.get(), &builder.booleans()) ||
+		!readNames(m_reader.get(), &builder.strings()) || !readNames(m_reader.get(), &builder.images()))
+	{
+		return false;
+	}
+	m_data.reset(new DataGroup(builder.createData()));
+	m_hasNewLayout = true;
+	return true;
+}
+
+};  // namespace Input
+};  // namespace SurgSim
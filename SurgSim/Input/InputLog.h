@@ -0,0 +1,189 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_INPUT_INPUTLOG_H
+#define SURGSIM_INPUT_INPUTLOG_H
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SurgSim/Framework/BinaryWriter.h"
+
+namespace SurgSim
+{
+
+namespace DataStructures
+{
+class DataGroup;
+class IndexDirectory;
+}
+
+namespace Framework
+{
+class BinaryReader;
+}
+
+namespace Input
+{
+
+/// Writes timestamped samples of device input to a compact binary log, to be played back by an InputLogReader.
+/// The names of the entries are written once, when the layout of the data changes, and each sample only holds the
+/// values, in the order of the layout, so a sample costs little more than its values.  All the data of a DataGroup
+/// is recorded except for its custom data.  The log uses the byte order and layout of the platform it is written
+/// on, like the other binary files written with Framework::BinaryWriter.
+/// A sample can also be encoded into a record by encode() and written later by writeRecord(), which only use the
+/// layout and the file respectively, so that the file can be written by another thread than the one sampling.
+/// \sa InputLogReader
+class InputLogWriter
+{
+public:
+	/// Constructor
+	InputLogWriter();
+
+	/// Destructor, closes the log
+	~InputLogWriter();
+
+	/// Open a log for writing, replacing any existing file.
+	/// \param fileName The name of the file.
+	/// \return true if the file was opened.
+	bool open(const std::string& fileName);
+
+	/// \return true if the log is open
+	bool isOpen() const;
+
+	/// Append a sample to the log.
+	/// \param time The time of the sample, in seconds, non decreasing from one sample to the next.
+	/// \param data The data.
+	/// \return true if the sample was written.
+	bool write(double time, const DataStructures::DataGroup& data);
+
+	/// Encode a sample into a record, without writing it to the file.  The records have to be written by
+	/// writeRecord() in the order they were encoded, since a record only holds the layout if it changed.
+	/// \param time The time of the sample, in seconds, non decreasing from one sample to the next.
+	/// \param data The data.
+	/// \param [out] record The record, its memory is reused if it is large enough.
+	void encode(double time, const DataStructures::DataGroup& data, std::vector<char>* record);
+
+	/// Forget the layout of the last sample, so that the next record holds the layout again.  Needed when an
+	/// encoded record is not written.
+	void resetLayout();
+
+	/// Append a record made by encode() to the log.
+	/// \param record The record.
+	/// \return true if the record was written.
+	bool writeRecord(const std::vector<char>& record);
+
+	/// Flush the samples written so far to the file.
+	void flush();
+
+	/// Close the log.
+	void close();
+
+private:
+	/// @{
+	/// Prevent default copy construction and default assignment
+	InputLogWriter(const InputLogWriter& other);
+	InputLogWriter& operator=(const InputLogWriter& other);
+	/// @}
+
+	/// Encode a sample into m_record.
+	/// \param time The time of the sample.
+	/// \param data The data.
+	void encodeRecord(double time, const DataStructures::DataGroup& data);
+
+	/// Storage for the values while they are written, kept so that it is reused from one sample to the next
+	struct Values;
+	std::unique_ptr<Values> m_values;
+
+	/// The file
+	std::ofstream m_file;
+
+	/// The record being written
+	Framework::BinaryWriter m_record;
+
+	/// The layout of the last sample, the IndexDirectory of each recorded NamedData
+	std::array<std::shared_ptr<const DataStructures::IndexDirectory>, 8> m_layout;
+};
+
+/// Reads the samples of a log written by an InputLogWriter, one at a time.  The file is mapped into memory, and the
+/// samples are read into the same DataGroup as long as the layout does not change.
+/// \sa InputLogWriter
+class InputLogReader
+{
+public:
+	/// Constructor
+	/// \param fileName The name of the log, if it cannot be read, the reader will not be valid.
+	explicit InputLogReader(const std::string& fileName);
+
+	/// Destructor
+	~InputLogReader();
+
+	/// \return true if the log could be read so far
+	bool isValid() const;
+
+	/// Read the next sample.
+	/// \return true if a sample was read, false at the end of the log or if the log is not valid.
+	bool readNext();
+
+	/// \return The time of the last sample read, in seconds.
+	double getTime() const;
+
+	/// \return true if the layout of the last sample read differs from the one of the sample before it, in which
+	///		case getData() returns a different DataGroup.
+	bool hasNewLayout() const;
+
+	/// \return The data of the last sample read.  It is kept in the same DataGroup from one sample to the next,
+	///		unless the layout of the log changes.
+	/// \exception Asserts if no sample was read.
+	const DataStructures::DataGroup& getData() const;
+
+private:
+	/// @{
+	/// Prevent default copy construction and default assignment
+	InputLogReader(const InputLogReader& other);
+	InputLogReader& operator=(const InputLogReader& other);
+	/// @}
+
+	/// Read the layout of the samples that follow it.
+	/// \return true if the layout was read.
+	bool readLayout();
+
+	/// Storage for the values while they are read, kept so that it is reused from one sample to the next
+	struct Values;
+	std::unique_ptr<Values> m_values;
+
+	/// The reader of the file
+	std::unique_ptr<Framework::BinaryReader> m_reader;
+
+	/// The data of the last sample
+	std::unique_ptr<DataStructures::DataGroup> m_data;
+
+	/// The time of the last sample
+	double m_time;
+
+	/// Whether the log could be read so far
+	bool m_isValid;
+
+	/// Whether the last sample read has a new layout
+	bool m_hasNewLayout;
+};
+
+};  // namespace Input
+};  // namespace SurgSim
+
+#endif  // SURGSIM_INPUT_INPUTLOG_H
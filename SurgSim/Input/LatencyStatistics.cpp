@@ -0,0 +1,122 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SurgSim/Input/LatencyStatistics.h"
+
+#include <sstream>
+
+#include "SurgSim/Framework/Assert.h"
+
+namespace SurgSim
+{
+namespace Input
+{
+
+LatencyStatistics::LatencyStatistics(double binWidth, size_t binCount) :
+	m_simulation(binWidth, binCount),
+	m_output(binWidth, binCount),
+	m_total(binWidth, binCount)
+{
+}
+
+void LatencyStatistics::addSample(double inputTime, double outputTime, double deviceTime)
+{
+	// The total is added last, so that a reader that sees a sample in the count sees it in all the stages
+	m_simulation.addSample(outputTime - inputTime);
+	m_output.addSample(deviceTime - outputTime);
+	m_total.addSample(deviceTime - inputTime);
+}
+
+void LatencyStatistics::reset()
+{
+	m_simulation.reset();
+	m_output.reset();
+	m_total.reset();
+}
+
+double LatencyStatistics::getBinWidth() const
+{
+	return m_total.getBinWidth();
+}
+
+size_t LatencyStatistics::getBinCount() const
+{
+	return m_total.getBinCount();
+}
+
+size_t LatencyStatistics::getNumberOfSamples() const
+{
+	return m_total.getNumberOfSamples();
+}
+
+std::vector<size_t> LatencyStatistics::getHistogram(Stage stage) const
+{
+	return getStageHistogram(stage).getBins();
+}
+
+double LatencyStatistics::getMaxLatency(Stage stage) const
+{
+	return getStageHistogram(stage).getMax();
+}
+
+double LatencyStatistics::getAverageLatency(Stage stage) const
+{
+	return getStageHistogram(stage).getAverage();
+}
+
+double LatencyStatistics::getPercentile(Stage stage, double fraction) const
+{
+	return getStageHistogram(stage).getPercentile(fraction);
+}
+
+std::string LatencyStatistics::getSummary() const
+{
+	static const char* const names[STAGE_COUNT] = {"simulation", "output", "total"};
+
+	std::ostringstream summary;
+	const size_t sampleCount = getNumberOfSamples();
+	summary << sampleCount << " samples";
+	if (sampleCount > 0)
+	{
+		for (size_t i = 0; i < STAGE_COUNT; ++i)
+		{
+			const Framework::Histogram& histogram = getStageHistogram(static_cast<Stage>(i));
+			summary << ", " << names[i] << " latency (ms) mean " << 1000.0 * histogram.getAverage() <<
+				" median " << 1000.0 * histogram.getPercentile(0.5) <<
+				" 99% " << 1000.0 * histogram.getPercentile(0.99) <<
+				" max " << 1000.0 * histogram.getMax();
+		}
+	}
+	return summary.str();
+}
+
+const Framework::Histogram& LatencyStatistics::getStageHistogram(Stage stage) const
+{
+	switch (stage)
+	{
+	case STAGE_SIMULATION:
+		return m_simulation;
+	case STAGE_OUTPUT:
+		return m_output;
+	case STAGE_TOTAL:
+		return m_total;
+	default:
+		SURGSIM_FAILURE() << "Invalid latency stage " << stage << ".";
+		return m_total;
+	}
+}
+
+};  // namespace Input
+};  // namespace SurgSim
@@ -0,0 +1,117 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SURGSIM_INPUT_LATENCYSTATISTICS_H
+#define SURGSIM_INPUT_LATENCYSTATISTICS_H
+
+#include <string>
+#include <vector>
+
+#include "SurgSim/Framework/Histogram.h"
+
+namespace SurgSim
+{
+namespace Input
+{
+
+/// Histograms of the latency between the input of a device and the output computed from it, i.e. the delay from a
+/// motion of the user to the force it causes.  Each sample is split in stages: from the time the device produced
+/// the input to the time the simulation handed the output over (see DataStructures::Names::INPUT_TIMESTAMP and
+/// OUTPUT_TIMESTAMP), and from then to the time the device pulled the output.  The hand-offs in between, through the
+/// InputComponent and the behaviors reading it, are not stamped, they are part of the simulation stage.
+/// All the histograms use the same bins of fixed width starting at 0, the last bin collects all the values that are
+/// larger than the range.
+/// Samples are added by the device thread without locking, all the accessors are thread safe and can be used while
+/// the device runs, see Framework::Histogram.
+/// \sa SurgSim::Input::CommonDevice::getLatencyStatistics
+class LatencyStatistics
+{
+public:
+	/// The stages of the latency
+	enum Stage
+	{
+		/// From the input of the device to the output of the simulation
+		STAGE_SIMULATION = 0,
+		/// From the output of the simulation to the device
+		STAGE_OUTPUT,
+		/// From the input of the device to the device getting the output
+		STAGE_TOTAL,
+		STAGE_COUNT
+	};
+
+	/// Constructor
+	/// \param binWidth the width of each bin in seconds
+	/// \param binCount the number of bins, needs to be at least 1
+	explicit LatencyStatistics(double binWidth = 0.5e-3, size_t binCount = 100);
+
+	/// Add the latency of one output, only called by the device thread.
+	/// \param inputTime the time the device produced the input the output was computed from
+	/// \param outputTime the time the simulation handed over the output
+	/// \param deviceTime the time the device got the output
+	void addSample(double inputTime, double outputTime, double deviceTime);
+
+	/// Clear all the collected samples.
+	void reset();
+
+	/// \return the width of each bin in seconds
+	double getBinWidth() const;
+
+	/// \return the number of bins in each histogram
+	size_t getBinCount() const;
+
+	/// \return the number of samples collected since construction or the last reset
+	size_t getNumberOfSamples() const;
+
+	/// \param stage the stage
+	/// \return the histogram of the stage, entry i counts the samples with latency in [i * width, (i + 1) * width)
+	std::vector<size_t> getHistogram(Stage stage) const;
+
+	/// \param stage the stage
+	/// \return the largest latency of the stage in seconds since construction or the last reset
+	double getMaxLatency(Stage stage) const;
+
+	/// \param stage the stage
+	/// \return the mean latency of the stage in seconds, 0 if there are no samples
+	double getAverageLatency(Stage stage) const;
+
+	/// \param stage the stage
+	/// \param fraction the fraction of the samples, in [0, 1]
+	/// \return the latency in seconds below which the fraction of the samples fall, rounded up to the end of a bin,
+	///		or the largest latency if it falls in the last bin, 0 if there are no samples
+	double getPercentile(Stage stage, double fraction) const;
+
+	/// \return a one line summary of the mean, median, 99th percentile and largest latency of each stage
+	std::string getSummary() const;
+
+private:
+	/// \param stage the stage
+	/// \return the histogram of the stage
+	/// \exception Asserts if the stage is not valid
+	const Framework::Histogram& getStageHistogram(Stage stage) const;
+
+	/// The latency from the input of the device to the output of the simulation
+	Framework::Histogram m_simulation;
+
+	/// The latency from the output of the simulation to the device
+	Framework::Histogram m_output;
+
+	/// The latency from the input of the device to the device getting the output
+	Framework::Histogram m_total;
+};
+
+};  // namespace Input
+};  // namespace SurgSim
+
+#endif  // SURGSIM_INPUT_LATENCYSTATISTICS_H
@@ -15,22 +15,29 @@
 
 #include "SurgSim/Input/OutputComponent.h"
 
+#include <atomic>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+
 #include "SurgSim/DataStructures/DataGroup.h"
 #include "SurgSim/Input/DeviceInterface.h"
 #include "SurgSim/Input/OutputProducerInterface.h"
 #include "SurgSim/Framework/LockedContainer.h"
+#include "SurgSim/Framework/SwapBuffer.h"
 
 namespace SurgSim
 {
 namespace Input
 {
 SURGSIM_REGISTER(SurgSim::Framework::Component, SurgSim::Input::OutputComponent, OutputComponent);
-/// An output producer sends data to a device
+/// An output producer sends data to a device.
+/// The data is handed over to the device thread through a triple buffer, so the device never waits on the threads
+/// that set the data, and it only copies values into its own output data.
 class OutputProducer: public OutputProducerInterface
 {
 public:
 	/// Constructor
-	OutputProducer() : m_haveData(false)
+	OutputProducer() : m_haveData(false), m_haveFront(false)
 	{
 	}
 	/// Destructor
@@ -44,10 +51,15 @@ class OutputProducer: public OutputProducerInterface
 	/// \return true if outputData was provided.
 	bool requestOutput(const std::string& device, SurgSim::DataStructures::DataGroup* outputData) override
 	{
+		if (m_buffers.tryTakeFront())
+		{
+			m_haveFront = true;
+		}
+
 		bool result = false;
-		if (m_haveData && (outputData != nullptr))
+		if (m_haveFront && (outputData != nullptr))
 		{
-			m_lastOutput.get(outputData); // cannot get() until after the first call to setData
+			*outputData = m_buffers.getFront();
 			result = true;
 		}
 		return result;
@@ -57,17 +69,45 @@ class OutputProducer: public OutputProducerInterface
 	/// \param dataGroup Data to be sent to the device
 	void setData(const SurgSim::DataStructures::DataGroup& dataGroup)
 	{
+		{
+			boost::lock_guard<boost::mutex> lock(m_producerMutex);
+			m_buffers.getBack() = dataGroup;
+			m_buffers.publish();
+		}
 		m_lastOutput.set(dataGroup);
 		m_haveData = true;
 	}
 
+	/// Get the output data information stored in this output producer, without taking it from the device
+	/// \param [out] dataGroup The last data that was set
+	/// \return true if setData has been called
+	bool getData(SurgSim::DataStructures::DataGroup* dataGroup) const
+	{
+		bool result = false;
+		if (m_haveData && (dataGroup != nullptr))
+		{
+			m_lastOutput.get(dataGroup); // cannot get() until after the first call to setData
+			result = true;
+		}
+		return result;
+	}
+
 private:
-	/// Used to store output data information to be passed out to device.  The DataGroup in the LockedContainer is
-	/// default-constructed, so m_lastOutput.get will assert until after the first call to m_lastOutput.set in setData.
+	/// Used to hand the output data over to the device, the device thread is the only consumer
+	SurgSim::Framework::SwapBuffer<SurgSim::DataStructures::DataGroup> m_buffers;
+
+	/// Serializes the threads setting the data
+	boost::mutex m_producerMutex;
+
+	/// Copy of the last output data for getData().  The DataGroup in the LockedContainer is default-constructed, so
+	/// m_lastOutput.get will assert until after the first call to m_lastOutput.set in setData.
 	SurgSim::Framework::LockedContainer<SurgSim::DataStructures::DataGroup> m_lastOutput;
 
 	/// Has setData been called since construction?
-	bool m_haveData;
+	std::atomic<bool> m_haveData;
+
+	/// Has the device taken a front buffer, only used on the device thread
+	bool m_haveFront;
 };
 
 OutputComponent::OutputComponent(const std::string& name) :
@@ -102,7 +142,7 @@ void OutputComponent::setData(const SurgSim::DataStructures::DataGroup& dataGrou
 DataStructures::DataGroup OutputComponent::getData() const
 {
 	DataStructures::DataGroup data;
-	m_output->requestOutput("", &data);
+	m_output->getData(&data);
 	return data;
 }
 
@@ -25,6 +25,7 @@
 #include "SurgSim/DataStructures/DataGroup.h"
 #include "SurgSim/DataStructures/DataGroupBuilder.h"
 #include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Framework/Clock.h"
 #include "SurgSim/Math/Matrix.h"
 
 #include "SurgSim/Input/UnitTests/TestDevice.h"
@@ -257,3 +258,119 @@ TEST(CommonDeviceTests, RemoveOutputProducer)
 	device.clearOutputProducer();
 	EXPECT_FALSE(device.hasOutputProducer());
 }
+
+namespace
+{
+
+/// A device whose input is stamped for the latency measurements
+class StampedTestDevice : public CommonDevice
+{
+public:
+	explicit StampedTestDevice(const std::string& name) :
+		CommonDevice(name, buildInputData())
+	{
+	}
+
+	bool initialize() override
+	{
+		return true;
+	}
+
+	bool isInitialized() const override
+	{
+		return true;
+	}
+
+	void stampAndPushInput()
+	{
+		stampInput();
+		pushInput();
+	}
+
+	bool pullOutput() override
+	{
+		return CommonDevice::pullOutput();
+	}
+
+private:
+	bool finalize() override
+	{
+		return true;
+	}
+
+	static DataGroup buildInputData()
+	{
+		DataGroupBuilder builder;
+		builder.addScalar(SurgSim::DataStructures::Names::TIMESTAMP);
+		builder.addInteger(SurgSim::DataStructures::Names::SEQUENCE_NUMBER);
+		return builder.createData();
+	}
+};
+
+/// Sends back the stamps of the last input it received, like SurgSim::Physics::VirtualToolCoupler does
+struct EchoStampsProducer : public InputConsumerInterface, public OutputProducerInterface
+{
+	EchoStampsProducer()
+	{
+		DataGroupBuilder builder;
+		builder.addScalar(SurgSim::DataStructures::Names::INPUT_TIMESTAMP);
+		builder.addInteger(SurgSim::DataStructures::Names::INPUT_SEQUENCE_NUMBER);
+		builder.addScalar(SurgSim::DataStructures::Names::OUTPUT_TIMESTAMP);
+		m_output = builder.createData();
+	}
+
+	void initializeInput(const std::string& device, const DataGroup& initialInput) override
+	{
+	}
+
+	void handleInput(const std::string& device, const DataGroup& inputData) override
+	{
+		double timestamp;
+		int sequenceNumber;
+		ASSERT_TRUE(inputData.scalars().get(SurgSim::DataStructures::Names::TIMESTAMP, &timestamp));
+		ASSERT_TRUE(inputData.integers().get(SurgSim::DataStructures::Names::SEQUENCE_NUMBER, &sequenceNumber));
+		m_sequenceNumbers.push_back(sequenceNumber);
+		m_output.scalars().set(SurgSim::DataStructures::Names::INPUT_TIMESTAMP, timestamp);
+		m_output.integers().set(SurgSim::DataStructures::Names::INPUT_SEQUENCE_NUMBER, sequenceNumber);
+		m_output.scalars().set(SurgSim::DataStructures::Names::OUTPUT_TIMESTAMP,
+							   SurgSim::Framework::getMonotonicTime());
+	}
+
+	bool requestOutput(const std::string& device, DataGroup* outputData) override
+	{
+		*outputData = m_output;
+		return true;
+	}
+
+	DataGroup m_output;
+	std::vector<int> m_sequenceNumbers;
+};
+
+};
+
+TEST(CommonDeviceTests, LatencyStatistics)
+{
+	StampedTestDevice device("MyTestDevice");
+	auto producer = std::make_shared<EchoStampsProducer>();
+	EXPECT_TRUE(device.addInputConsumer(producer));
+	EXPECT_TRUE(device.setOutputProducer(producer));
+
+	// The output has no stamps yet
+	EXPECT_TRUE(device.pullOutput());
+	EXPECT_EQ(0u, device.getLatencyStatistics().getNumberOfSamples());
+
+	for (int i = 0; i < 3; ++i)
+	{
+		device.stampAndPushInput();
+		EXPECT_TRUE(device.pullOutput());
+		// Output computed from the same input only counts once
+		EXPECT_TRUE(device.pullOutput());
+	}
+	EXPECT_EQ((std::vector<int>{0, 1, 2}), producer->m_sequenceNumbers);
+
+	const auto& statistics = device.getLatencyStatistics();
+	EXPECT_EQ(3u, statistics.getNumberOfSamples());
+	EXPECT_LE(0.0, statistics.getAverageLatency(SurgSim::Input::LatencyStatistics::STAGE_TOTAL));
+	EXPECT_LE(statistics.getMaxLatency(SurgSim::Input::LatencyStatistics::STAGE_SIMULATION),
+			  statistics.getMaxLatency(SurgSim::Input::LatencyStatistics::STAGE_TOTAL));
+}
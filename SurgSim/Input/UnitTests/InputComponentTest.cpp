@@ -17,10 +17,12 @@
  * Tests for the InputComponent class.
  */
 
+#include <boost/thread.hpp>
 #include <memory>
 #include <string>
 #include <gtest/gtest.h>
 #include "SurgSim/Input/InputComponent.h"
+#include "SurgSim/Input/UnitTests/TestDevice.h"
 #include "SurgSim/DataStructures/DataGroup.h"
 #include "yaml-cpp/yaml.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
@@ -68,3 +70,68 @@ TEST(InputComponentTest, Serialization)
 	EXPECT_EQ(input->getDeviceName(), newInput->getDeviceName());
 }
 
+
+TEST(InputComponentTest, LatestInput)
+{
+	auto device = std::make_shared<TestDevice>("InputDevice");
+	InputComponent input("Input");
+	input.connectDevice(device);
+	EXPECT_TRUE(input.isDeviceConnected());
+
+	// The initial data is available before the device pushes anything
+	DataGroup dataGroup;
+	std::string value;
+	input.getData(&dataGroup);
+	ASSERT_TRUE(dataGroup.strings().get("helloWorld", &value));
+	EXPECT_EQ("data", value);
+
+	// Samples that are not read are skipped
+	device->pushInput("first");
+	device->pushInput("second");
+	input.getData(&dataGroup);
+	ASSERT_TRUE(dataGroup.strings().get("helloWorld", &value));
+	EXPECT_EQ("second", value);
+
+	// Reading again without new input returns the same sample
+	input.getData(&dataGroup);
+	ASSERT_TRUE(dataGroup.strings().get("helloWorld", &value));
+	EXPECT_EQ("second", value);
+
+	input.disconnectDevice(device);
+	EXPECT_FALSE(input.isDeviceConnected());
+	device->pushInput("third");
+	EXPECT_THROW(input.getData(&dataGroup), SurgSim::Framework::AssertionFailure);
+}
+
+TEST(InputComponentTest, ConcurrentInput)
+{
+	auto device = std::make_shared<TestDevice>("InputDevice");
+	InputComponent input("Input");
+	input.connectDevice(device);
+
+	const int numSamples = 10000;
+	boost::thread deviceThread([&device, numSamples]()
+	{
+		for (int i = 0; i < numSamples; ++i)
+		{
+			device->pushInput(std::to_string(i));
+		}
+	});
+
+	// The consumer sees whole samples, in order
+	DataGroup dataGroup;
+	std::string value;
+	int last = -1;
+	while (last < numSamples - 1)
+	{
+		input.getData(&dataGroup);
+		ASSERT_TRUE(dataGroup.strings().get("helloWorld", &value));
+		if (value != "data")
+		{
+			int current = std::stoi(value);
+			ASSERT_LE(last, current);
+			last = current;
+		}
+	}
+	deviceThread.join();
+}
@@ -0,0 +1,165 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "SurgSim/DataStructures/DataGroup.h"
+#include "SurgSim/DataStructures/DataGroupBuilder.h"
+#include "SurgSim/Input/InputLog.h"
+#include "SurgSim/Math/RigidTransform.h"
+#include "SurgSim/Math/Vector.h"
+
+using SurgSim::DataStructures::DataGroup;
+using SurgSim::DataStructures::DataGroupBuilder;
+using SurgSim::Input::InputLogReader;
+using SurgSim::Input::InputLogWriter;
+using SurgSim::Math::makeRigidTranslation;
+using SurgSim::Math::RigidTransform3d;
+using SurgSim::Math::Vector3d;
+
+namespace
+{
+const std::string FILE_NAME = "InputLogTests.log";
+}
+
+TEST(InputLogTests, RoundTrip)
+{
+	DataGroupBuilder builder;
+	builder.addPose(SurgSim::DataStructures::Names::POSE);
+	builder.addVector(SurgSim::DataStructures::Names::FORCE);
+	builder.addMatrix(SurgSim::DataStructures::Names::SPRING_JACOBIAN);
+	builder.addScalar("scalar");
+	builder.addInteger("integer");
+	builder.addBoolean(SurgSim::DataStructures::Names::BUTTON_1);
+	builder.addString("string");
+	builder.addImage("image");
+	DataGroup data = builder.createData();
+
+	DataGroup::DynamicMatrixType matrix(2, 3);
+	matrix << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+	DataGroup::ImageType image(2, 2, 1);
+	image.getAsVector() << 0.5f, 1.5f, 2.5f, 3.5f;
+
+	{
+		InputLogWriter writer;
+		ASSERT_TRUE(writer.open(FILE_NAME));
+		EXPECT_TRUE(writer.isOpen());
+
+		data.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(1.0, 2.0, 3.0)));
+		data.vectors().set(SurgSim::DataStructures::Names::FORCE, Vector3d(4.0, 5.0, 6.0));
+		data.matrices().set(SurgSim::DataStructures::Names::SPRING_JACOBIAN, matrix);
+		data.scalars().set("scalar", 7.0);
+		data.integers().set("integer", 8);
+		data.booleans().set(SurgSim::DataStructures::Names::BUTTON_1, true);
+		data.strings().set("string", "text");
+		data.images().set("image", image);
+		EXPECT_TRUE(writer.write(0.0, data));
+
+		// Entries that are not set are not set when they are read back
+		data.poses().set(SurgSim::DataStructures::Names::POSE, makeRigidTranslation(Vector3d(9.0, 9.0, 9.0)));
+		data.vectors().reset(SurgSim::DataStructures::Names::FORCE);
+		data.images().reset("image");
+		EXPECT_TRUE(writer.write(0.001, data));
+
+		// A new layout
+		DataGroupBuilder otherBuilder;
+		otherBuilder.addScalar("other");
+		DataGroup otherData = otherBuilder.createData();
+		otherData.scalars().set("other", 10.0);
+		EXPECT_TRUE(writer.write(0.002, otherData));
+	}
+
+	InputLogReader reader(FILE_NAME);
+	ASSERT_TRUE(reader.isValid());
+
+	ASSERT_TRUE(reader.readNext());
+	EXPECT_DOUBLE_EQ(0.0, reader.getTime());
+	EXPECT_TRUE(reader.hasNewLayout());
+	RigidTransform3d pose;
+	Vector3d vector;
+	DataGroup::DynamicMatrixType readMatrix;
+	double scalar = 0.0;
+	int integer = 0;
+	bool boolean = false;
+	std::string string;
+	DataGroup::ImageType readImage;
+	ASSERT_TRUE(reader.getData().poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+	EXPECT_TRUE(pose.isApprox(makeRigidTranslation(Vector3d(1.0, 2.0, 3.0))));
+	ASSERT_TRUE(reader.getData().vectors().get(SurgSim::DataStructures::Names::FORCE, &vector));
+	EXPECT_TRUE(vector.isApprox(Vector3d(4.0, 5.0, 6.0)));
+	ASSERT_TRUE(reader.getData().matrices().get(SurgSim::DataStructures::Names::SPRING_JACOBIAN, &readMatrix));
+	EXPECT_TRUE(readMatrix.isApprox(matrix));
+	ASSERT_TRUE(reader.getData().scalars().get("scalar", &scalar));
+	EXPECT_DOUBLE_EQ(7.0, scalar);
+	ASSERT_TRUE(reader.getData().integers().get("integer", &integer));
+	EXPECT_EQ(8, integer);
+	ASSERT_TRUE(reader.getData().booleans().get(SurgSim::DataStructures::Names::BUTTON_1, &boolean));
+	EXPECT_TRUE(boolean);
+	ASSERT_TRUE(reader.getData().strings().get("string", &string));
+	EXPECT_EQ("text", string);
+	ASSERT_TRUE(reader.getData().images().get("image", &readImage));
+	ASSERT_EQ(2u, readImage.getWidth());
+	ASSERT_EQ(2u, readImage.getHeight());
+	EXPECT_TRUE(readImage.getAsVector().isApprox(image.getAsVector()));
+
+	const DataGroup* readData = &reader.getData();
+	ASSERT_TRUE(reader.readNext());
+	EXPECT_DOUBLE_EQ(0.001, reader.getTime());
+	EXPECT_FALSE(reader.hasNewLayout());
+	EXPECT_EQ(readData, &reader.getData());
+	ASSERT_TRUE(reader.getData().poses().get(SurgSim::DataStructures::Names::POSE, &pose));
+	EXPECT_TRUE(pose.isApprox(makeRigidTranslation(Vector3d(9.0, 9.0, 9.0))));
+	EXPECT_FALSE(reader.getData().vectors().hasData(SurgSim::DataStructures::Names::FORCE));
+	EXPECT_FALSE(reader.getData().images().hasData("image"));
+	EXPECT_TRUE(reader.getData().scalars().hasData("scalar"));
+
+	ASSERT_TRUE(reader.readNext());
+	EXPECT_DOUBLE_EQ(0.002, reader.getTime());
+	EXPECT_TRUE(reader.hasNewLayout());
+	EXPECT_EQ(1, reader.getData().scalars().getNumEntries());
+	EXPECT_EQ(0, reader.getData().poses().getNumEntries());
+	ASSERT_TRUE(reader.getData().scalars().get("other", &scalar));
+	EXPECT_DOUBLE_EQ(10.0, scalar);
+
+	EXPECT_FALSE(reader.readNext());
+	EXPECT_TRUE(reader.isValid());
+
+	std::remove(FILE_NAME.c_str());
+}
+
+TEST(InputLogTests, InvalidLog)
+{
+	InputLogWriter writer;
+	EXPECT_FALSE(writer.isOpen());
+	EXPECT_FALSE(writer.write(0.0, DataGroupBuilder().createData()));
+
+	InputLogReader missing("NotAFile.log");
+	EXPECT_FALSE(missing.isValid());
+	EXPECT_FALSE(missing.readNext());
+
+	{
+		std::ofstream file(FILE_NAME, std::ios::out | std::ios::binary | std::ios::trunc);
+		file << "Not an input log";
+	}
+	InputLogReader wrong(FILE_NAME);
+	EXPECT_FALSE(wrong.isValid());
+	EXPECT_FALSE(wrong.readNext());
+
+	std::remove(FILE_NAME.c_str());
+}
@@ -0,0 +1,89 @@
+// This file is a part of the OpenSurgSim project.
+// Copyright 2013-2016, SimQuest Solutions Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Input/LatencyStatistics.h"
+
+namespace SurgSim
+{
+namespace Input
+{
+
+TEST(LatencyStatisticsTests, Init)
+{
+	LatencyStatistics statistics(1e-3, 10);
+	EXPECT_DOUBLE_EQ(1e-3, statistics.getBinWidth());
+	EXPECT_EQ(10u, statistics.getBinCount());
+	EXPECT_EQ(0u, statistics.getNumberOfSamples());
+	EXPECT_EQ(std::vector<size_t>(10, 0), statistics.getHistogram(LatencyStatistics::STAGE_TOTAL));
+	EXPECT_DOUBLE_EQ(0.0, statistics.getAverageLatency(LatencyStatistics::STAGE_TOTAL));
+	EXPECT_DOUBLE_EQ(0.0, statistics.getPercentile(LatencyStatistics::STAGE_TOTAL, 0.5));
+	EXPECT_EQ("0 samples", statistics.getSummary());
+
+	EXPECT_THROW(LatencyStatistics(0.0, 10), Framework::AssertionFailure);
+	EXPECT_THROW(LatencyStatistics(1e-3, 0), Framework::AssertionFailure);
+}
+
+TEST(LatencyStatisticsTests, AddSample)
+{
+	LatencyStatistics statistics(1e-3, 10);
+	statistics.addSample(10.0, 10.0025, 10.0035);
+	statistics.addSample(20.0, 20.0005, 20.0015);
+	statistics.addSample(30.0, 30.0001, 30.5);
+	EXPECT_EQ(3u, statistics.getNumberOfSamples());
+
+	auto histogram = statistics.getHistogram(LatencyStatistics::STAGE_SIMULATION);
+	EXPECT_EQ(2u, histogram[0]);
+	EXPECT_EQ(1u, histogram[2]);
+
+	// Values beyond the range go to the last bin
+	histogram = statistics.getHistogram(LatencyStatistics::STAGE_TOTAL);
+	EXPECT_EQ(1u, histogram[1]);
+	EXPECT_EQ(1u, histogram[3]);
+	EXPECT_EQ(1u, histogram[9]);
+
+	EXPECT_NEAR(0.5, statistics.getMaxLatency(LatencyStatistics::STAGE_TOTAL), 1e-9);
+	EXPECT_NEAR(0.0025, statistics.getMaxLatency(LatencyStatistics::STAGE_SIMULATION), 1e-9);
+	EXPECT_NEAR((0.0035 + 0.0015 + 0.5) / 3.0, statistics.getAverageLatency(LatencyStatistics::STAGE_TOTAL), 1e-9);
+
+	EXPECT_NEAR(0.002, statistics.getPercentile(LatencyStatistics::STAGE_TOTAL, 0.3), 1e-9);
+	EXPECT_NEAR(0.004, statistics.getPercentile(LatencyStatistics::STAGE_TOTAL, 0.5), 1e-9);
+	EXPECT_NEAR(0.5, statistics.getPercentile(LatencyStatistics::STAGE_TOTAL, 1.0), 1e-9);
+	EXPECT_THROW(statistics.getPercentile(LatencyStatistics::STAGE_TOTAL, 1.5), Framework::AssertionFailure);
+	EXPECT_THROW(statistics.getHistogram(LatencyStatistics::STAGE_COUNT), Framework::AssertionFailure);
+
+	EXPECT_NE(std::string::npos, statistics.getSummary().find("3 samples"));
+
+	statistics.reset();
+	EXPECT_EQ(0u, statistics.getNumberOfSamples());
+	EXPECT_DOUBLE_EQ(0.0, statistics.getMaxLatency(LatencyStatistics::STAGE_TOTAL));
+	EXPECT_EQ(std::vector<size_t>(10, 0), statistics.getHistogram(LatencyStatistics::STAGE_OUTPUT));
+}
+
+TEST(LatencyStatisticsTests, NegativeLatency)
+{
+	// Clock readings from different threads can be slightly out of order, they count as no latency
+	LatencyStatistics statistics(1e-3, 10);
+	statistics.addSample(10.0, 9.9, 10.1);
+	EXPECT_EQ(1u, statistics.getHistogram(LatencyStatistics::STAGE_SIMULATION)[0]);
+	EXPECT_DOUBLE_EQ(0.0, statistics.getMaxLatency(LatencyStatistics::STAGE_SIMULATION));
+}
+
+};  // namespace Input
+};  // namespace SurgSim
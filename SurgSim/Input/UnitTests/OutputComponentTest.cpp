@@ -26,6 +26,7 @@
 #include "SurgSim/DataStructures/DataGroupBuilder.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Input/OutputComponent.h"
+#include "SurgSim/Input/UnitTests/TestDevice.h"
 
 using SurgSim::Input::OutputComponent;
 using SurgSim::DataStructures::DataGroup;
@@ -78,3 +79,38 @@ TEST(OutputComponentTest, Serialization)
 	EXPECT_EQ(output->getDeviceName(), newOutput->getDeviceName());
 }
 
+
+TEST(OutputComponentTest, DeviceOutput)
+{
+	auto device = std::make_shared<TestDevice>("OutputDevice");
+	auto output = std::make_shared<OutputComponent>("Output");
+	output->connectDevice(device);
+	EXPECT_TRUE(output->isDeviceConnected());
+	EXPECT_FALSE(device->pullOutput());
+
+	SurgSim::DataStructures::DataGroupBuilder builder;
+	builder.addString("data");
+	DataGroup dataGroup = builder.createData();
+	dataGroup.strings().set("data", "first");
+	output->setData(dataGroup);
+	dataGroup.strings().set("data", "second");
+	output->setData(dataGroup);
+
+	// The device gets the latest data, and keeps getting it until new data is set
+	EXPECT_TRUE(device->pullOutput());
+	EXPECT_EQ("second", device->lastPulledData);
+	EXPECT_TRUE(device->pullOutput());
+	EXPECT_EQ("second", device->lastPulledData);
+
+	dataGroup.strings().set("data", "third");
+	output->setData(dataGroup);
+	std::string value;
+	ASSERT_TRUE(output->getData().strings().get("data", &value));
+	EXPECT_EQ("third", value);
+	EXPECT_TRUE(device->pullOutput());
+	EXPECT_EQ("third", device->lastPulledData);
+
+	output->disconnectDevice(device);
+	EXPECT_FALSE(output->isDeviceConnected());
+	EXPECT_FALSE(device->pullOutput());
+}
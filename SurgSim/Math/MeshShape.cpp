@@ -15,9 +15,13 @@
 
 #include "SurgSim/Math/MeshShape.h"
 
+#include <algorithm>
+
 #include "SurgSim/DataStructures/AabbTree.h"
 #include "SurgSim/DataStructures/AabbTreeData.h"
 #include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 
 using SurgSim::DataStructures::EmptyData;
 using SurgSim::DataStructures::NormalData;
@@ -33,6 +37,7 @@ namespace Math
 {
 
 SURGSIM_REGISTER(SurgSim::Math::Shape, SurgSim::Math::MeshShape, MeshShape);
+SURGSIM_REGISTER(SurgSim::Framework::Asset, SurgSim::Math::MeshShape, MeshShapeAsset);
 
 MeshShape::MeshShape() :
 	m_center(Vector3d::Constant(std::numeric_limits<double>::quiet_NaN())),
@@ -69,7 +74,7 @@ bool MeshShape::calculateNormals()
 		SurgSim::Math::Vector3d normal = (vertex1 - vertex0).cross(vertex2 - vertex0);
 		if (normal.isZero())
 		{
-			SURGSIM_LOG_WARNING(SurgSim::Framework::Logger::getLogger("Math/MeshShape")) <<
+			SURGSIM_LOG_RATE_LIMITED(SurgSim::Framework::Logger::getLogger("Math/MeshShape"), WARNING, 1.0) <<
 					"MeshShape::calculateNormals unable to calculate normals. For example, for triangle #" << i <<
 					" with vertices:" << std::endl << "1: " << vertex0.transpose() << std::endl <<
 					"2: " << vertex1.transpose() << std::endl << "3: " << vertex2.transpose();
@@ -98,6 +103,134 @@ bool MeshShape::doLoad(const std::string& fileName)
 	return update();
 }
 
+bool MeshShape::doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const
+{
+	std::vector<Vector3d> positions;
+	positions.reserve(getNumVertices());
+	for (auto const& vertex : getVertices())
+	{
+		positions.push_back(vertex.position);
+	}
+
+	std::vector<EdgeType::IdType> edges;
+	edges.reserve(getEdges().size());
+	for (auto const& edge : getEdges())
+	{
+		edges.push_back(edge.verticesId);
+	}
+
+	std::vector<TriangleType::IdType> triangles;
+	std::vector<Vector3d> normals;
+	std::vector<uint8_t> validities;
+	triangles.reserve(getTriangles().size());
+	normals.reserve(getTriangles().size());
+	validities.reserve(getTriangles().size());
+	for (auto const& triangle : getTriangles())
+	{
+		triangles.push_back(triangle.verticesId);
+		normals.push_back(triangle.data.normal);
+		validities.push_back(triangle.isValid ? 1 : 0);
+	}
+
+	writer->writeArray(positions);
+	writer->writeArray(edges);
+	writer->writeArray(triangles);
+	writer->writeArray(normals);
+	writer->writeArray(validities);
+	writer->write(m_center);
+	writer->write(m_volume);
+	writer->write(m_secondMomentOfVolume);
+	m_aabbTree->write(writer);
+	return true;
+}
+
+bool MeshShape::doReadBinary(SurgSim::Framework::BinaryReader* reader)
+{
+	std::vector<Vector3d> positions;
+	std::vector<EdgeType::IdType> edges;
+	std::vector<TriangleType::IdType> triangles;
+	std::vector<Vector3d> normals;
+	std::vector<uint8_t> validities;
+	Vector3d center;
+	double volume;
+	Matrix33d secondMomentOfVolume;
+
+	reader->readArray(&positions);
+	reader->readArray(&edges);
+	reader->readArray(&triangles);
+	reader->readArray(&normals);
+	reader->readArray(&validities);
+	reader->read(&center);
+	reader->read(&volume);
+	reader->read(&secondMomentOfVolume);
+	auto aabbTree = std::make_shared<SurgSim::DataStructures::AabbTree>();
+	if (!reader->isValid() || normals.size() != triangles.size() || validities.size() != triangles.size() ||
+		!aabbTree->read(reader, triangles.size()))
+	{
+		return false;
+	}
+	auto isOutOfRange = [&positions](size_t id) {return id >= positions.size();};
+	for (auto const& edge : edges)
+	{
+		if (std::any_of(edge.begin(), edge.end(), isOutOfRange))
+		{
+			return false;
+		}
+	}
+	for (auto const& triangle : triangles)
+	{
+		if (std::any_of(triangle.begin(), triangle.end(), isOutOfRange))
+		{
+			return false;
+		}
+	}
+
+	clear();
+	for (auto const& position : positions)
+	{
+		addVertex(VertexType(position));
+	}
+	for (auto const& edge : edges)
+	{
+		addEdge(EdgeType(edge));
+	}
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		NormalData data;
+		data.normal = normals[i];
+		addTriangle(TriangleType(triangles[i], data));
+	}
+	// Removed triangles are added first to keep the ids of the following ones, then removed again
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		if (validities[i] == 0)
+		{
+			removeTriangle(i);
+		}
+	}
+
+	m_center = center;
+	m_volume = volume;
+	m_secondMomentOfVolume = secondMomentOfVolume;
+	m_aabbTree = aabbTree;
+	return true;
+}
+
+bool MeshShape::doCopyData(const SurgSim::Framework::Asset& other)
+{
+	auto shape = dynamic_cast<const MeshShape*>(&other);
+	if (shape == nullptr)
+	{
+		return false;
+	}
+	shareData(*shape);
+	m_center = shape->m_center;
+	m_volume = shape->m_volume;
+	m_secondMomentOfVolume = shape->m_secondMomentOfVolume;
+	m_aabbTree = shape->m_aabbTree;
+	return true;
+}
+
 int MeshShape::getType() const
 {
 	return SHAPE_TYPE_MESH;
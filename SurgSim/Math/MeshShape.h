@@ -99,6 +99,23 @@ class MeshShape : public Shape, public SurgSim::DataStructures::TriangleMesh<Sur
 	bool doUpdate() override;
 	bool doLoad(const std::string& fileName) override;
 
+	/// Shares the mesh with the other mesh shape until it is modified, and copies its derived data, the AABB tree is
+	/// shared with the other mesh shape
+	/// \param other The mesh shape to copy from.
+	/// \return true if other is a MeshShape
+	bool doCopyData(const SurgSim::Framework::Asset& other) override;
+
+	/// Writes the vertices, edges and triangles with their normals, the volume properties and the structure of the
+	/// AABB tree, so that reading does not need to build the tree again.
+	/// \param writer The writer for the binary cache file.
+	/// \return true
+	bool doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const override;
+
+	/// Reads the data written by doWriteBinary(), including the AABB tree.
+	/// \param reader The reader for the binary cache file.
+	/// \return true if all the data could be read
+	bool doReadBinary(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// Calculate normals for all triangles.
 	/// \note Normals will be normalized.
 	/// \return true on success, or false if any triangle has an indeterminate normal.
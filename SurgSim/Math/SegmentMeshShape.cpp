@@ -27,6 +27,7 @@ namespace SurgSim
 namespace Math
 {
 SURGSIM_REGISTER(SurgSim::Math::Shape, SurgSim::Math::SegmentMeshShape, SegmentMeshShape);
+SURGSIM_REGISTER(SurgSim::Framework::Asset, SurgSim::Math::SegmentMeshShape, SegmentMeshShapeAsset);
 
 SegmentMeshShape::SegmentMeshShape()
 {
@@ -94,6 +95,12 @@ bool SegmentMeshShape::doLoad(const std::string& fileName)
 	return DataStructures::SegmentMeshPlain::doLoad(fileName) && update();
 }
 
+bool SegmentMeshShape::doCopyData(const SurgSim::Framework::Asset& other)
+{
+	// The AABB tree depends on the radius, which is not part of the file, it needs to be rebuilt
+	return DataStructures::SegmentMeshPlain::doCopyData(other) && update();
+}
+
 std::shared_ptr<const DataStructures::AabbTree> SegmentMeshShape::getAabbTree() const
 {
 	return m_aabbTree;
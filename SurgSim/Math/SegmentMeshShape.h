@@ -75,6 +75,7 @@ class SegmentMeshShape : public Shape, public DataStructures::SegmentMeshPlain
 protected:
 	bool doUpdate() override;
 	bool doLoad(const std::string& fileName) override;
+	bool doCopyData(const SurgSim::Framework::Asset& other) override;
 
 	/// Update the AabbTree, which is an axis-aligned bounding box r-tree used to accelerate spatial searches
 	void updateAabbTree();
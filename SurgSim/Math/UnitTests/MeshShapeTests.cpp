@@ -15,12 +15,14 @@
 
 #include <time.h>
 
+#include <boost/filesystem.hpp>
 #include <gtest/gtest.h>
 
 #include "SurgSim/DataStructures/AabbTree.h"
 #include "SurgSim/DataStructures/AabbTreeNode.h"
 #include "SurgSim/DataStructures/EmptyData.h"
 #include "SurgSim/Framework/ApplicationData.h"
+#include "SurgSim/Framework/AssetCache.h"
 #include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Math/BoxShape.h"
 #include "SurgSim/Math/MathConvert.h"
@@ -413,5 +415,72 @@ TEST_F(MeshShapeTest, DoLoadTest)
 	}
 }
 
+TEST_F(MeshShapeTest, CachedLoadSharesDataTest)
+{
+	auto runtime = std::make_shared<SurgSim::Framework::Runtime>("config.txt");
+	auto cache = SurgSim::Framework::Runtime::getAssetCache();
+	cache->clear();
+
+	auto first = std::make_shared<MeshShape>();
+	auto second = std::make_shared<MeshShape>();
+	ASSERT_NO_THROW(first->load("Geometry/staple_collision.ply"));
+	ASSERT_NO_THROW(second->load("Geometry/staple_collision.ply"));
+
+	// The second shape uses the data of the cache instead of a copy
+	const MeshShape& constFirst = *first;
+	const MeshShape& constSecond = *second;
+	EXPECT_EQ(&constFirst.getVertices(), &constSecond.getVertices());
+	EXPECT_EQ(&constFirst.getTriangles(), &constSecond.getTriangles());
+	EXPECT_EQ(first->getAabbTree(), second->getAabbTree());
+
+	// Changing a shape does not change the other shapes or the cached data
+	Vector3d position = second->getVertexPosition(0);
+	first->setVertexPosition(0, position + Vector3d(1.0, 0.0, 0.0));
+	EXPECT_NE(&constFirst.getVertices(), &constSecond.getVertices());
+	EXPECT_TRUE(position.isApprox(second->getVertexPosition(0)));
+
+	auto third = std::make_shared<MeshShape>();
+	ASSERT_NO_THROW(third->load("Geometry/staple_collision.ply"));
+	EXPECT_TRUE(position.isApprox(third->getVertexPosition(0)));
+
+	cache->clear();
+}
+
+TEST_F(MeshShapeTest, BinaryCacheTest)
+{
+	auto runtime = std::make_shared<SurgSim::Framework::Runtime>("config.txt");
+	auto cache = SurgSim::Framework::Runtime::getAssetCache();
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	boost::filesystem::create_directories(directory);
+	cache->clear();
+	cache->setBinaryCacheEnabled(true);
+	cache->setBinaryCacheDirectory(directory.string());
+
+	auto loaded = std::make_shared<MeshShape>();
+	ASSERT_NO_THROW(loaded->load("Geometry/staple_collision.ply"));
+
+	// Without the cached data in memory, the binary cache file is read
+	cache->clear();
+	auto restored = std::make_shared<MeshShape>();
+	ASSERT_NO_THROW(restored->load("Geometry/staple_collision.ply"));
+	EXPECT_TRUE(*loaded == *restored);
+	EXPECT_NEAR(loaded->getVolume(), restored->getVolume(), epsilon);
+
+	// The AABB tree is read from the file instead of being built again
+	auto loadedTree = loaded->getAabbTree();
+	auto restoredTree = restored->getAabbTree();
+	ASSERT_NE(nullptr, restoredTree);
+	EXPECT_NE(loadedTree, restoredTree);
+	EXPECT_TRUE(loadedTree->getAabb().isApprox(restoredTree->getAabb()));
+	EXPECT_EQ(loadedTree->getRoot()->getNumChildren(), restoredTree->getRoot()->getNumChildren());
+	auto spatialJoin = loadedTree->spatialJoin(*restoredTree);
+	EXPECT_EQ(loadedTree->spatialJoin(*loadedTree).size(), spatialJoin.size());
+
+	cache->setBinaryCacheEnabled(false);
+	cache->setBinaryCacheDirectory("");
+	cache->clear();
+	boost::filesystem::remove_all(directory);
+}
+
 };
 };
@@ -15,6 +15,8 @@
 
 #include "SurgSim/Particles/Representation.h"
 
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Math/Vector.h"
 #include "SurgSim/Particles/ParticlesCollisionRepresentation.h"
@@ -44,6 +46,34 @@ bool Representation::doInitialize()
 	return true;
 }
 
+bool Representation::doSaveState(SurgSim::Framework::BinaryWriter* writer) const
+{
+	// At a frame boundary the published particles are the current ones
+	writer->writeArray(m_particles.safeGet()->getVertices());
+	return true;
+}
+
+bool Representation::doRestoreState(SurgSim::Framework::BinaryReader* reader)
+{
+	std::vector<Particle> restored;
+	if (!reader->readArray(&restored))
+	{
+		return false;
+	}
+	if (restored.size() > m_maxParticles)
+	{
+		SURGSIM_LOG_WARNING(m_logger) << "Cannot restore " << restored.size() << " particles, the maximum is "
+			<< m_maxParticles << ".";
+		return false;
+	}
+
+	// Assigning keeps the storage reserved for the maximum number of particles
+	auto& particles = m_particles.unsafeGet().getVertices();
+	particles.assign(restored.cbegin(), restored.cend());
+	m_particles.publish();
+	return true;
+}
+
 void Representation::setMaxParticles(size_t maxParticles)
 {
 	m_particles.unsafeGet().getVertices().reserve(maxParticles);
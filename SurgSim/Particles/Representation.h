@@ -103,6 +103,13 @@ class Representation : public SurgSim::Framework::Representation
 
 	bool doInitialize() override;
 
+	/// Writes all the particles
+	bool doSaveState(SurgSim::Framework::BinaryWriter* writer) const override;
+
+	/// Replaces the particles and publishes them, fails without changing the particles if there are more than
+	/// getMaxParticles()
+	bool doRestoreState(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// Maximum amount of particles allowed in this particle system.
 	size_t m_maxParticles;
 
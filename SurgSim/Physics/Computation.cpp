@@ -16,6 +16,7 @@
 #include "SurgSim/Physics/Computation.h"
 
 #include "SurgSim/Framework/Component.h"
+#include "SurgSim/Framework/Tracer.h"
 #include "SurgSim/Physics/PhysicsManagerState.h"
 
 namespace SurgSim
@@ -35,6 +36,7 @@ Computation::~Computation()
 
 std::shared_ptr<PhysicsManagerState> Computation::update(double dt, const std::shared_ptr<PhysicsManagerState>& state)
 {
+	SURGSIM_TRACE_SCOPE_DYNAMIC("Physics", getClassName());
 	m_timer.beginFrame();
 	auto newState = doUpdate(dt, preparePhysicsState(state));
 	m_timer.endFrame();
@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Framework/Log.h"
 #include "SurgSim/Framework/SceneElement.h"
@@ -38,6 +40,21 @@ using SurgSim::Math::OdeState;
 using SurgSim::Math::SparseMatrix;
 using SurgSim::Math::Vector;
 
+namespace
+{
+void writeState(SurgSim::Framework::BinaryWriter* writer, const OdeState& state)
+{
+	writer->writeArray(state.getPositions().data(), static_cast<size_t>(state.getPositions().size()));
+	writer->writeArray(state.getVelocities().data(), static_cast<size_t>(state.getVelocities().size()));
+}
+
+bool readState(SurgSim::Framework::BinaryReader* reader, OdeState* state)
+{
+	return reader->readArray(state->getPositions().data(), static_cast<size_t>(state->getPositions().size())) &&
+		   reader->readArray(state->getVelocities().data(), static_cast<size_t>(state->getVelocities().size()));
+}
+}
+
 namespace SurgSim
 {
 
@@ -74,6 +91,39 @@ void DeformableRepresentation::resetState()
 	*m_finalState    = *m_initialState;
 }
 
+bool DeformableRepresentation::doSaveState(SurgSim::Framework::BinaryWriter* writer) const
+{
+	if (m_currentState == nullptr)
+	{
+		return false;
+	}
+	writeState(writer, *m_previousState);
+	writeState(writer, *m_currentState);
+	writeState(writer, *m_finalState);
+	return true;
+}
+
+bool DeformableRepresentation::doRestoreState(SurgSim::Framework::BinaryReader* reader)
+{
+	if (m_currentState == nullptr)
+	{
+		return false;
+	}
+
+	// The number of degrees of freedom has to match, the states are only changed once all of them could be read
+	SurgSim::Math::OdeState previousState(*m_previousState);
+	SurgSim::Math::OdeState currentState(*m_currentState);
+	SurgSim::Math::OdeState finalState(*m_finalState);
+	if (!readState(reader, &previousState) || !readState(reader, &currentState) || !readState(reader, &finalState))
+	{
+		return false;
+	}
+	*m_previousState = previousState;
+	*m_currentState = currentState;
+	*m_finalState = finalState;
+	return true;
+}
+
 void DeformableRepresentation::setLocalPose(const SurgSim::Math::RigidTransform3d& pose)
 {
 	SURGSIM_ASSERT(!isInitialized()) <<
@@ -142,6 +142,12 @@ class DeformableRepresentation :
 	bool doInitialize() override;
 	bool doWakeUp() override;
 
+	/// Writes the positions and velocities of the previous, current and final states
+	bool doSaveState(SurgSim::Framework::BinaryWriter* writer) const override;
+
+	/// Reads the states written by doSaveState(), the states are unchanged if any of them cannot be read
+	bool doRestoreState(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// Transform a state using a given transformation
 	/// \param[in,out] state The state to be transformed
 	/// \param transform The transformation to apply
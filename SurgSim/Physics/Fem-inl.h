@@ -16,7 +16,11 @@
 #ifndef SURGSIM_PHYSICS_FEM_INL_H
 #define SURGSIM_PHYSICS_FEM_INL_H
 
+#include <algorithm>
+
 #include "SurgSim/DataStructures/PlyReader.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Log.h"
 
 using SurgSim::DataStructures::PlyReader;
@@ -26,6 +30,73 @@ namespace SurgSim
 namespace Physics
 {
 
+namespace FemElementStructs
+{
+
+/// Write the parameters of an element to a binary cache file
+/// \param writer The writer.
+/// \param parameter The parameters of the element.
+inline void writeBinary(SurgSim::Framework::BinaryWriter* writer, const FemElementParameter& parameter)
+{
+	writer->writeArray(parameter.nodeIds);
+	writer->write(parameter.youngModulus);
+	writer->write(parameter.poissonRatio);
+	writer->write(parameter.massDensity);
+}
+
+/// Write the parameters of a 1D element to a binary cache file
+/// \param writer The writer.
+/// \param parameter The parameters of the element.
+inline void writeBinary(SurgSim::Framework::BinaryWriter* writer, const FemElement1DParameter& parameter)
+{
+	writeBinary(writer, static_cast<const FemElementParameter&>(parameter));
+	writer->write(parameter.radius);
+	writer->write(static_cast<uint8_t>(parameter.enableShear ? 1 : 0));
+}
+
+/// Write the parameters of a 2D element to a binary cache file
+/// \param writer The writer.
+/// \param parameter The parameters of the element.
+inline void writeBinary(SurgSim::Framework::BinaryWriter* writer, const FemElement2DParameter& parameter)
+{
+	writeBinary(writer, static_cast<const FemElementParameter&>(parameter));
+	writer->write(parameter.thickness);
+}
+
+/// Read the parameters of an element from a binary cache file
+/// \param reader The reader.
+/// \param [out] parameter The parameters of the element.
+/// \return true if the parameters could be read
+inline bool readBinary(SurgSim::Framework::BinaryReader* reader, FemElementParameter* parameter)
+{
+	return reader->readArray(&parameter->nodeIds) && reader->read(&parameter->youngModulus) &&
+		   reader->read(&parameter->poissonRatio) && reader->read(&parameter->massDensity);
+}
+
+/// Read the parameters of a 1D element from a binary cache file
+/// \param reader The reader.
+/// \param [out] parameter The parameters of the element.
+/// \return true if the parameters could be read
+inline bool readBinary(SurgSim::Framework::BinaryReader* reader, FemElement1DParameter* parameter)
+{
+	uint8_t enableShear = 0;
+	bool result = readBinary(reader, static_cast<FemElementParameter*>(parameter)) &&
+				  reader->read(&parameter->radius) && reader->read(&enableShear);
+	parameter->enableShear = (enableShear != 0);
+	return result;
+}
+
+/// Read the parameters of a 2D element from a binary cache file
+/// \param reader The reader.
+/// \param [out] parameter The parameters of the element.
+/// \return true if the parameters could be read
+inline bool readBinary(SurgSim::Framework::BinaryReader* reader, FemElement2DParameter* parameter)
+{
+	return readBinary(reader, static_cast<FemElementParameter*>(parameter)) && reader->read(&parameter->thickness);
+}
+
+} // namespace FemElementStructs
+
 template <class VertexData, class Element>
 Fem<VertexData, Element>::Fem()
 {
@@ -110,6 +181,100 @@ bool Fem<VertexData, Element>::loadFemFile(const std::string& filename)
 	return true;
 }
 
+template <class VertexData, class Element>
+bool Fem<VertexData, Element>::isCacheable() const
+{
+	return true;
+}
+
+template <class VertexData, class Element>
+bool Fem<VertexData, Element>::doCopyData(const SurgSim::Framework::Asset& other)
+{
+	auto fem = dynamic_cast<const Fem<VertexData, Element>*>(&other);
+	if (fem == nullptr)
+	{
+		return false;
+	}
+
+	SurgSim::DataStructures::Vertices<VertexData>::shareVertices(*fem);
+	m_elements.clear();
+	m_elements.reserve(fem->m_elements.size());
+	for (auto element = fem->m_elements.cbegin(); element != fem->m_elements.cend(); ++element)
+	{
+		m_elements.push_back(std::make_shared<Element>(**element));
+	}
+	m_boundaryConditions = fem->m_boundaryConditions;
+	return true;
+}
+
+template <class VertexData, class Element>
+bool Fem<VertexData, Element>::doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const
+{
+	const auto& vertices = this->getVertices();
+	std::vector<SurgSim::Math::Vector3d> positions;
+	std::vector<VertexData> data;
+	positions.reserve(vertices.size());
+	data.reserve(vertices.size());
+	for (auto vertex = vertices.cbegin(); vertex != vertices.cend(); ++vertex)
+	{
+		positions.push_back(vertex->position);
+		data.push_back(vertex->data);
+	}
+	writer->writeArray(positions);
+	writer->writeArray(data);
+
+	writer->write(static_cast<uint64_t>(m_elements.size()));
+	for (auto element = m_elements.cbegin(); element != m_elements.cend(); ++element)
+	{
+		FemElementStructs::writeBinary(writer, **element);
+	}
+
+	writer->writeArray(m_boundaryConditions);
+	return true;
+}
+
+template <class VertexData, class Element>
+bool Fem<VertexData, Element>::doReadBinary(SurgSim::Framework::BinaryReader* reader)
+{
+	std::vector<SurgSim::Math::Vector3d> positions;
+	std::vector<VertexData> data;
+	uint64_t numElements = 0;
+	if (!reader->readArray(&positions) || !reader->readArray(&data) || data.size() != positions.size() ||
+		!reader->read(&numElements))
+	{
+		return false;
+	}
+
+	auto isOutOfRange = [&positions](size_t id) {return id >= positions.size();};
+	std::vector<std::shared_ptr<Element>> elements;
+	for (uint64_t i = 0; i < numElements; ++i)
+	{
+		auto element = std::make_shared<Element>();
+		if (!FemElementStructs::readBinary(reader, element.get()) ||
+			std::any_of(element->nodeIds.begin(), element->nodeIds.end(), isOutOfRange))
+		{
+			return false;
+		}
+		elements.push_back(element);
+	}
+
+	std::vector<size_t> boundaryConditions;
+	if (!reader->readArray(&boundaryConditions) ||
+		std::any_of(boundaryConditions.begin(), boundaryConditions.end(), isOutOfRange))
+	{
+		return false;
+	}
+
+	this->clear();
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		this->addVertex(typename SurgSim::DataStructures::Vertices<VertexData>::VertexType(positions[i], data[i]));
+	}
+	m_elements = std::move(elements);
+	m_boundaryConditions = std::move(boundaryConditions);
+	return true;
+}
+
 } // namespace Physics
 } // namespace SurgSim
 
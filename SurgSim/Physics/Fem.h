@@ -89,6 +89,21 @@ class Fem : public SurgSim::DataStructures::Vertices<VertexData>, public SurgSim
 	template <class PlyType, class FemType>
 	bool loadFemFile(const std::string& filename);
 
+	bool isCacheable() const override;
+
+	bool doCopyData(const SurgSim::Framework::Asset& other) override;
+
+	/// Writes the vertices, the element parameters and the boundary conditions. The element matrices are not
+	/// written, they depend on the representation using the mesh and are computed when it is initialized.
+	/// \param writer The writer for the binary cache file.
+	/// \return true
+	bool doWriteBinary(SurgSim::Framework::BinaryWriter* writer) const override;
+
+	/// Reads the data written by doWriteBinary().
+	/// \param reader The reader for the binary cache file.
+	/// \return true if all the data could be read
+	bool doReadBinary(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// Vector of individual elements
 	std::vector<std::shared_ptr<Element>> m_elements;
 
@@ -14,6 +14,8 @@
 // limitations under the License.
 
 #include "SurgSim/Framework/Assert.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Framework/PoseComponent.h"
 #include "SurgSim/Framework/Runtime.h"
@@ -25,6 +27,31 @@
 #include "SurgSim/Physics/RigidRepresentationBase.h"
 #include "SurgSim/Physics/PhysicsConvert.h"
 
+namespace
+{
+void writeState(SurgSim::Framework::BinaryWriter* writer, const SurgSim::Physics::RigidState& state)
+{
+	writer->write(state.getPose());
+	writer->write(state.getLinearVelocity());
+	writer->write(state.getAngularVelocity());
+}
+
+bool readState(SurgSim::Framework::BinaryReader* reader, SurgSim::Physics::RigidState* state)
+{
+	SurgSim::Math::RigidTransform3d pose;
+	SurgSim::Math::Vector3d linearVelocity;
+	SurgSim::Math::Vector3d angularVelocity;
+	if (!reader->read(&pose) || !reader->read(&linearVelocity) || !reader->read(&angularVelocity))
+	{
+		return false;
+	}
+	state->setPose(pose);
+	state->setLinearVelocity(linearVelocity);
+	state->setAngularVelocity(angularVelocity);
+	return true;
+}
+}
+
 namespace SurgSim
 {
 namespace Physics
@@ -82,6 +109,31 @@ bool RigidRepresentationBase::doWakeUp()
 	return true;
 }
 
+bool RigidRepresentationBase::doSaveState(SurgSim::Framework::BinaryWriter* writer) const
+{
+	writeState(writer, m_previousState);
+	writeState(writer, m_currentState);
+	writeState(writer, m_finalState);
+	return true;
+}
+
+bool RigidRepresentationBase::doRestoreState(SurgSim::Framework::BinaryReader* reader)
+{
+	RigidState previousState(m_previousState);
+	RigidState currentState(m_currentState);
+	RigidState finalState(m_finalState);
+	if (!readState(reader, &previousState) || !readState(reader, &currentState) || !readState(reader, &finalState))
+	{
+		return false;
+	}
+
+	m_previousState = previousState;
+	m_currentState = currentState;
+	m_finalState = finalState;
+	updateGlobalInertiaMatrices(m_currentState);
+	return true;
+}
+
 void RigidRepresentationBase::setInitialState(const RigidState& state)
 {
 	m_initialState = state;
@@ -123,6 +123,10 @@ class RigidRepresentationBase : public Representation
 	bool doInitialize() override;
 	bool doWakeUp() override;
 
+	/// Writes the previous, current and final states
+	bool doSaveState(SurgSim::Framework::BinaryWriter* writer) const override;
+	bool doRestoreState(SurgSim::Framework::BinaryReader* reader) override;
+
 	/// Initial rigid representation state (useful for reset)
 	RigidState m_initialState;
 	/// Previous rigid representation state
@@ -19,6 +19,8 @@
 
 #include "SurgSim/DataStructures/Location.h"
 #include "SurgSim/DataStructures/BufferedValue.h"
+#include "SurgSim/Framework/BinaryReader.h"
+#include "SurgSim/Framework/BinaryWriter.h"
 #include "SurgSim/Framework/Runtime.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Math/Matrix.h"
@@ -157,6 +159,50 @@ TEST_F(RigidRepresentationTest, ResetTest)
 	EXPECT_TRUE(rigidBody->getInitialState() == rigidBody->getPreviousState());
 }
 
+TEST_F(RigidRepresentationTest, SaveAndRestoreStateTest)
+{
+	auto runtime = std::make_shared<Runtime>();
+	auto rigidBody = std::make_shared<RigidRepresentation>("Rigid");
+	rigidBody->setLocalActive(true);
+	rigidBody->setIsGravityEnabled(true);
+	rigidBody->setDensity(m_density);
+	rigidBody->setShape(m_sphere);
+	rigidBody->setInitialState(m_state);
+	ASSERT_TRUE(rigidBody->initialize(runtime));
+
+	SurgSim::Framework::BinaryWriter writer;
+	ASSERT_TRUE(rigidBody->saveState(&writer));
+
+	RigidState previousState = rigidBody->getPreviousState();
+	RigidState currentState = rigidBody->getCurrentState();
+	for (int timeStep = 0; timeStep < 10; timeStep++)
+	{
+		rigidBody->beforeUpdate(m_dt);
+		rigidBody->update(m_dt);
+		rigidBody->afterUpdate(m_dt);
+	}
+	ASSERT_NE(currentState, rigidBody->getCurrentState());
+
+	SurgSim::Framework::BinaryReader reader(writer.getBuffer().data(), writer.getBuffer().size());
+	ASSERT_TRUE(rigidBody->restoreState(&reader));
+	EXPECT_TRUE(reader.isAtEnd());
+	EXPECT_EQ(previousState, rigidBody->getPreviousState());
+	EXPECT_EQ(currentState, rigidBody->getCurrentState());
+
+	// The simulation continues identically from the restored state
+	rigidBody->beforeUpdate(m_dt);
+	rigidBody->update(m_dt);
+	rigidBody->afterUpdate(m_dt);
+	RigidState nextState = rigidBody->getCurrentState();
+
+	SurgSim::Framework::BinaryReader secondReader(writer.getBuffer().data(), writer.getBuffer().size());
+	ASSERT_TRUE(rigidBody->restoreState(&secondReader));
+	rigidBody->beforeUpdate(m_dt);
+	rigidBody->update(m_dt);
+	rigidBody->afterUpdate(m_dt);
+	EXPECT_EQ(nextState, rigidBody->getCurrentState());
+}
+
 TEST_F(RigidRepresentationTest, SetGetAndDefaultValueTest)
 {
 	// Create the rigid body
@@ -523,6 +523,62 @@ TEST_F(VirtualToolCouplerTest, SetHapticOutputOnlyWhenColliding)
 	EXPECT_TRUE(data.matrices().hasData(DataStructures::Names::SPRING_JACOBIAN));
 }
 
+TEST_F(VirtualToolCouplerTest, ContactModel)
+{
+	rigidBody->setLocalPose(RigidTransform3d::Identity());
+	rigidBody->setIsGravityEnabled(false);
+	auto input = std::make_shared<Testing::MockInputComponent>("input");
+	DataStructures::DataGroupBuilder builder;
+	builder.addPose(DataStructures::Names::POSE);
+	DataStructures::DataGroup inputData = builder.createData();
+	inputData.poses().set(DataStructures::Names::POSE, RigidTransform3d::Identity());
+	input->setData(inputData);
+	virtualToolCoupler->setInput(input);
+	auto output = std::make_shared<Input::OutputComponent>("output");
+	virtualToolCoupler->setOutput(output);
+	auto collision = std::make_shared<RigidCollisionRepresentation>("collision");
+	rigidBody->setCollisionRepresentation(collision);
+	std::shared_ptr<Runtime> runtime = std::make_shared<Runtime>();
+	virtualToolCoupler->initialize(runtime);
+	rigidBody->initialize(runtime);
+	input->initialize(runtime);
+	output->initialize(runtime);
+	virtualToolCoupler->wakeUp();
+	rigidBody->wakeUp();
+	input->wakeUp();
+	output->wakeUp();
+
+	// One contact 1 cm deep at a known point of the tool, one without a point on the tool
+	auto& collisions = collision->getCollisions().unsafeGet();
+	auto other = std::make_shared<RigidCollisionRepresentation>("collision2");
+	collisions[other].push_back(std::make_shared<Collision::Contact>(
+		Collision::COLLISION_DETECTION_TYPE_DISCRETE, 0.01, 1.0, Vector3d(0.1, 0.0, 0.0),
+		Vector3d::UnitZ().eval(),
+		std::make_pair(DataStructures::Location(Vector3d(0.1, 0.0, 0.0)), DataStructures::Location())));
+	collisions[other].push_back(std::make_shared<Collision::Contact>(
+		Collision::COLLISION_DETECTION_TYPE_DISCRETE, 0.1, 1.0, Vector3d::UnitX().eval(), Vector3d::UnitY().eval(),
+		std::make_pair(DataStructures::Location(), DataStructures::Location())));
+
+	EXPECT_DOUBLE_EQ(0.0, virtualToolCoupler->getContactStiffness());
+	virtualToolCoupler->update(0.1);
+	DataStructures::DataGroup data = virtualToolCoupler->getOutputData();
+	ASSERT_TRUE(data.matrices().hasEntry(DataStructures::Names::CONTACT_MODEL));
+	EXPECT_FALSE(data.matrices().hasData(DataStructures::Names::CONTACT_MODEL));
+
+	EXPECT_THROW(virtualToolCoupler->setContactStiffness(-1.0), SurgSim::Framework::AssertionFailure);
+	virtualToolCoupler->setContactStiffness(500.0);
+	EXPECT_DOUBLE_EQ(500.0, virtualToolCoupler->getContactStiffness());
+	virtualToolCoupler->update(0.1);
+	data = virtualToolCoupler->getOutputData();
+	DataStructures::DataGroup::DynamicMatrixType contactModel;
+	ASSERT_TRUE(data.matrices().get(DataStructures::Names::CONTACT_MODEL, &contactModel));
+	ASSERT_EQ(1, contactModel.rows());
+	ASSERT_EQ(8, contactModel.cols());
+	DataStructures::DataGroup::DynamicMatrixType expected(1, 8);
+	expected << 0.0, 0.0, 1.0, -0.01, 500.0, 0.1, 0.0, 0.0;
+	EXPECT_TRUE(contactModel.isApprox(expected));
+}
+
 TEST_F(VirtualToolCouplerTest, GetInput)
 {
 	EXPECT_EQ(input, virtualToolCoupler->getInput());
@@ -638,6 +694,7 @@ TEST_F(VirtualToolCouplerTest, Serialization)
 	virtualToolCoupler->setCalculateInertialTorques(true);
 
 	virtualToolCoupler->setHapticOutputOnlyWhenColliding(true);
+	virtualToolCoupler->setContactStiffness(num);
 
 	// Encode
 	YAML::Node node;
@@ -659,6 +716,8 @@ TEST_F(VirtualToolCouplerTest, Serialization)
 	EXPECT_TRUE(vec.isApprox(newVirtualToolCoupler->getAttachmentPoint()));
 	EXPECT_TRUE(newVirtualToolCoupler->getCalculateInertialTorques());
 	EXPECT_TRUE(virtualToolCoupler->isHapticOutputOnlyWhenColliding());
+	EXPECT_EQ(num, newVirtualToolCoupler->getContactStiffness());
+	EXPECT_EQ(num, newVirtualToolCoupler->getContactStiffness());
 
 	EXPECT_NE(nullptr, newVirtualToolCoupler->getInput());
 	EXPECT_NE(nullptr, newVirtualToolCoupler->getRepresentation());
@@ -690,12 +749,18 @@ TEST_F(VirtualToolCouplerTest, OutputDataEntries)
 	EXPECT_TRUE(data.vectors().hasEntry(SurgSim::DataStructures::Names::INPUT_LINEAR_VELOCITY));
 	EXPECT_TRUE(data.vectors().hasEntry(SurgSim::DataStructures::Names::INPUT_ANGULAR_VELOCITY));
 
-	EXPECT_EQ(2, data.matrices().getNumEntries());
+	EXPECT_EQ(3, data.matrices().getNumEntries());
 	EXPECT_TRUE(data.matrices().hasEntry(SurgSim::DataStructures::Names::SPRING_JACOBIAN));
 	EXPECT_TRUE(data.matrices().hasEntry(SurgSim::DataStructures::Names::DAMPER_JACOBIAN));
+	EXPECT_TRUE(data.matrices().hasEntry(SurgSim::DataStructures::Names::CONTACT_MODEL));
+
+	EXPECT_EQ(2, data.scalars().getNumEntries());
+	EXPECT_TRUE(data.scalars().hasEntry(SurgSim::DataStructures::Names::INPUT_TIMESTAMP));
+	EXPECT_TRUE(data.scalars().hasEntry(SurgSim::DataStructures::Names::OUTPUT_TIMESTAMP));
+
+	EXPECT_EQ(1, data.integers().getNumEntries());
+	EXPECT_TRUE(data.integers().hasEntry(SurgSim::DataStructures::Names::INPUT_SEQUENCE_NUMBER));
 
-	EXPECT_EQ(0, data.scalars().getNumEntries());
-	EXPECT_EQ(0, data.integers().getNumEntries());
 	EXPECT_EQ(0, data.booleans().getNumEntries());
 	EXPECT_EQ(0, data.strings().getNumEntries());
 	EXPECT_EQ(0, data.customData().getNumEntries());
@@ -19,6 +19,7 @@
 #include "SurgSim/Collision/Representation.h"
 #include "SurgSim/DataStructures/DataGroupBuilder.h"
 #include "SurgSim/DataStructures/DataStructuresConvert.h"
+#include "SurgSim/Framework/Clock.h"
 #include "SurgSim/Framework/FrameworkConvert.h"
 #include "SurgSim/Input/InputComponent.h"
 #include "SurgSim/Input/OutputComponent.h"
@@ -58,6 +59,7 @@ VirtualToolCoupler::VirtualToolCoupler(const std::string& name) :
 	m_calculateInertialTorques(false),
 	m_logger(SurgSim::Framework::Logger::getLogger("Physics/VirtualToolCoupler")),
 	m_hapticOutputOnlyWhenColliding(false),
+	m_contactStiffness(0.0),
 	m_poseIndex(-1),
 	m_linearVelocityIndex(-1),
 	m_angularVelocityIndex(-1),
@@ -67,7 +69,13 @@ VirtualToolCoupler::VirtualToolCoupler(const std::string& name) :
 	m_inputAngularVelocityIndex(-1),
 	m_inputPoseIndex(-1),
 	m_springJacobianIndex(-1),
-	m_damperJacobianIndex(-1)
+	m_damperJacobianIndex(-1),
+	m_contactModelIndex(-1),
+	m_timestampIndex(-1),
+	m_sequenceNumberIndex(-1),
+	m_inputTimestampIndex(-1),
+	m_inputSequenceNumberIndex(-1),
+	m_outputTimestampIndex(-1)
 {
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(VirtualToolCoupler, SurgSim::DataStructures::OptionalValue<double>,
 									  LinearStiffness, getOptionalLinearStiffness, setOptionalLinearStiffness);
@@ -84,6 +92,8 @@ VirtualToolCoupler::VirtualToolCoupler(const std::string& name) :
 									  getCalculateInertialTorques, setCalculateInertialTorques);
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(VirtualToolCoupler, bool, HapticOutputOnlyWhenColliding,
 									  isHapticOutputOnlyWhenColliding, setHapticOutputOnlyWhenColliding);
+	SURGSIM_ADD_SERIALIZABLE_PROPERTY(VirtualToolCoupler, double, ContactStiffness,
+									  getContactStiffness, setContactStiffness);
 
 	SURGSIM_ADD_SERIALIZABLE_PROPERTY(VirtualToolCoupler, std::shared_ptr<SurgSim::Framework::Component>,
 									  Input, getInput, setInput);
@@ -144,6 +154,8 @@ void VirtualToolCoupler::update(double dt)
 	inputData.poses().cacheIndex(m_poseName, &m_poseIndex);
 	inputData.vectors().cacheIndex(SurgSim::DataStructures::Names::LINEAR_VELOCITY, &m_linearVelocityIndex);
 	inputData.vectors().cacheIndex(SurgSim::DataStructures::Names::ANGULAR_VELOCITY, &m_angularVelocityIndex);
+	inputData.scalars().cacheIndex(SurgSim::DataStructures::Names::TIMESTAMP, &m_timestampIndex);
+	inputData.integers().cacheIndex(SurgSim::DataStructures::Names::SEQUENCE_NUMBER, &m_sequenceNumberIndex);
 
 	RigidTransform3d inputPose;
 	if (inputData.poses().get(m_poseIndex, &inputPose))
@@ -228,6 +240,34 @@ void VirtualToolCoupler::update(double dt)
 			m_outputData.vectors().set(m_inputLinearVelocityIndex, outputAlignment.linear() * inputLinearVelocity);
 			m_outputData.vectors().set(m_inputAngularVelocityIndex, outputAlignmentUnScaled * inputAngularVelocity);
 			m_outputData.poses().set(m_inputPoseIndex, outputAlignment * inputPose);
+
+			auto collision = m_rigid->getCollisionRepresentation();
+			if (output && m_contactStiffness > 0.0 && collision != nullptr)
+			{
+				updateContactModel(*collision, outputAlignment, outputAlignment * inputPose);
+				m_outputData.matrices().set(m_contactModelIndex, m_contactModel);
+			}
+			else
+			{
+				m_outputData.matrices().reset(m_contactModelIndex);
+			}
+
+			// Send the stamps of the input back, so the device can measure the latency from its input to this output
+			double timestamp;
+			int sequenceNumber;
+			if (inputData.scalars().get(m_timestampIndex, &timestamp) &&
+				inputData.integers().get(m_sequenceNumberIndex, &sequenceNumber))
+			{
+				m_outputData.scalars().set(m_inputTimestampIndex, timestamp);
+				m_outputData.integers().set(m_inputSequenceNumberIndex, sequenceNumber);
+				m_outputData.scalars().set(m_outputTimestampIndex, SurgSim::Framework::getMonotonicTime());
+			}
+			else
+			{
+				m_outputData.scalars().reset(m_inputTimestampIndex);
+				m_outputData.integers().reset(m_inputSequenceNumberIndex);
+				m_outputData.scalars().reset(m_outputTimestampIndex);
+			}
 			m_output->setData(m_outputData);
 		}
 	}
@@ -245,6 +285,11 @@ bool VirtualToolCoupler::doInitialize()
 	m_inputPoseIndex = m_outputData.poses().getIndex(SurgSim::DataStructures::Names::INPUT_POSE);
 	m_springJacobianIndex = m_outputData.matrices().getIndex(SurgSim::DataStructures::Names::SPRING_JACOBIAN);
 	m_damperJacobianIndex = m_outputData.matrices().getIndex(SurgSim::DataStructures::Names::DAMPER_JACOBIAN);
+	m_contactModelIndex = m_outputData.matrices().getIndex(SurgSim::DataStructures::Names::CONTACT_MODEL);
+	m_inputTimestampIndex = m_outputData.scalars().getIndex(SurgSim::DataStructures::Names::INPUT_TIMESTAMP);
+	m_inputSequenceNumberIndex =
+		m_outputData.integers().getIndex(SurgSim::DataStructures::Names::INPUT_SEQUENCE_NUMBER);
+	m_outputTimestampIndex = m_outputData.scalars().getIndex(SurgSim::DataStructures::Names::OUTPUT_TIMESTAMP);
 
 	return true;
 }
@@ -259,9 +304,50 @@ SurgSim::DataStructures::DataGroup VirtualToolCoupler::buildOutputData()
 	builder.addMatrix(SurgSim::DataStructures::Names::DAMPER_JACOBIAN);
 	builder.addVector(SurgSim::DataStructures::Names::INPUT_LINEAR_VELOCITY);
 	builder.addVector(SurgSim::DataStructures::Names::INPUT_ANGULAR_VELOCITY);
+	builder.addMatrix(SurgSim::DataStructures::Names::CONTACT_MODEL);
+	builder.addScalar(SurgSim::DataStructures::Names::INPUT_TIMESTAMP);
+	builder.addInteger(SurgSim::DataStructures::Names::INPUT_SEQUENCE_NUMBER);
+	builder.addScalar(SurgSim::DataStructures::Names::OUTPUT_TIMESTAMP);
 	return builder.createData();
 }
 
+void VirtualToolCoupler::updateContactModel(SurgSim::Collision::Representation& collision,
+											const RigidTransform3d& outputAlignment,
+											const RigidTransform3d& inputPose)
+{
+	const auto& contacts = collision.getCollisions().unsafeGet();
+	size_t numContacts = 0;
+	for (const auto& contactsWithOther : contacts)
+	{
+		numContacts += contactsWithOther.second.size();
+	}
+
+	// The contacts of the collision representation are first on this representation, with the normal pointing
+	// into it, so each contact is a plane through the deepest point on the tool, offset by the depth.
+	m_contactModel.resize(numContacts, 8);
+	const RigidTransform3d collisionPose = outputAlignment * collision.getPose();
+	const RigidTransform3d inputPoseInverse = inputPose.inverse();
+	DataStructures::DataGroup::DynamicMatrixType::Index row = 0;
+	for (const auto& contactsWithOther : contacts)
+	{
+		for (const auto& contact : contactsWithOther.second)
+		{
+			const auto& toolPoint = contact->penetrationPoints.first.rigidLocalPosition;
+			if (toolPoint.hasValue())
+			{
+				const Vector3d normal = (outputAlignment.linear() * contact->normal).normalized();
+				const Vector3d point = collisionPose * toolPoint.getValue();
+				m_contactModel.block<1, 3>(row, 0) = normal.transpose();
+				m_contactModel(row, 3) = -normal.dot(point + contact->depth * normal);
+				m_contactModel(row, 4) = m_contactStiffness;
+				m_contactModel.block<1, 3>(row, 5) = (inputPoseInverse * point).transpose();
+				++row;
+			}
+		}
+	}
+	m_contactModel.conservativeResize(row, 8);
+}
+
 bool VirtualToolCoupler::doWakeUp()
 {
 	if (m_input == nullptr)
@@ -354,6 +440,17 @@ bool VirtualToolCoupler::doWakeUp()
 	return true;
 }
 
+void VirtualToolCoupler::setContactStiffness(double stiffness)
+{
+	SURGSIM_ASSERT(stiffness >= 0.0) << "The contact stiffness can not be negative.";
+	m_contactStiffness = stiffness;
+}
+
+double VirtualToolCoupler::getContactStiffness() const
+{
+	return m_contactStiffness;
+}
+
 int VirtualToolCoupler::getTargetManagerType() const
 {
 	return SurgSim::Framework::MANAGER_TYPE_PHYSICS;
@@ -28,6 +28,11 @@
 namespace SurgSim
 {
 
+namespace Collision
+{
+class Representation;
+}
+
 namespace Input
 {
 class InputComponent;
@@ -164,6 +169,16 @@ class VirtualToolCoupler : public SurgSim::Framework::Behavior
 	/// \return true if inertia is being simulated.
 	bool getCalculateInertialTorques() const;
 
+	/// Set the stiffness of the contacts sent to the output, for a LocalContactModel device filter to render them at
+	/// the rate of the device.  Each contact of the Representation's collision representation is sent as a plane,
+	/// with this stiffness and the contact point on the tool.
+	/// \sa SurgSim::Devices::LocalContactModel
+	/// \param stiffness The stiffness of the contacts (in N·m-1), 0 to not send any contacts.
+	void setContactStiffness(double stiffness);
+
+	/// \return The stiffness of the contacts sent to the output (in N·m-1), 0 if no contacts are sent.
+	double getContactStiffness() const;
+
 protected:
 	bool doInitialize() override;
 	bool doWakeUp() override;
@@ -172,6 +187,14 @@ class VirtualToolCoupler : public SurgSim::Framework::Behavior
 	/// \return The DataGroup to be sent to the device via the OutputComponent.
 	virtual SurgSim::DataStructures::DataGroup buildOutputData();
 
+	/// Fill the contacts sent to the output device from the contacts of a collision representation.
+	/// \param collision The collision representation of the tool.
+	/// \param outputAlignment The transform from the frame of the Representation to the frame of the output.
+	/// \param inputPose The input pose in the frame of the output.
+	void updateContactModel(SurgSim::Collision::Representation& collision,
+							const SurgSim::Math::RigidTransform3d& outputAlignment,
+							const SurgSim::Math::RigidTransform3d& inputPose);
+
 	/// Used for Serialization.
 	/// \param linearStiffness The OptionalValue object containing the stiffness of the vtc in linear mode (in N·m-1)
 	void setOptionalLinearStiffness(const SurgSim::DataStructures::OptionalValue<double>& linearStiffness);
@@ -275,6 +298,12 @@ class VirtualToolCoupler : public SurgSim::Framework::Behavior
 	/// Whether or not the VTC sends forces and torques to the output device (if any) only when the tool is colliding.
 	bool m_hapticOutputOnlyWhenColliding;
 
+	/// The stiffness of the contacts sent to the output device (in N·m-1), 0 to not send them.
+	double m_contactStiffness;
+
+	/// The contacts sent to the output device, one row per contact, see DataStructures::Names::CONTACT_MODEL.
+	SurgSim::DataStructures::DataGroup::DynamicMatrixType m_contactModel;
+
 	///@{
 	/// Cached DataGroup indices.
 	int m_poseIndex;
@@ -287,6 +316,12 @@ class VirtualToolCoupler : public SurgSim::Framework::Behavior
 	int m_inputPoseIndex;
 	int m_springJacobianIndex;
 	int m_damperJacobianIndex;
+	int m_contactModelIndex;
+	int m_timestampIndex;
+	int m_sequenceNumberIndex;
+	int m_inputTimestampIndex;
+	int m_inputSequenceNumberIndex;
+	int m_outputTimestampIndex;
 	///@}
 };
 